@@ -0,0 +1,401 @@
+/**
+ * @file    blit.c
+ *
+ * @note    Blits with scaling and rotation by multiples of 90 degrees
+ *
+ * @note    The centers of the destination pixels are mapped into the source, so the
+ *          image is not shifted by the scaling. Nearest scaling steps through the
+ *          source with an integer quotient and remainder (as Bresenham), so the pixel
+ *          picked is exact. Bilinear scaling uses 16.16 fixed point positions.
+ *
+ * @note    When source and destination have the same format (and palette), pixels
+ *          are moved without conversion. Otherwise spans of up to BLIT_SPAN pixels are
+ *          collected in a buffer and converted into the destination with
+ *          Pixel_ConvertSurface.
+ *
+ * @note    A rotation by 90 or 270 degrees reads the source by columns. Done by
+ *          lines, each pixel read would use a different cache line and the lines are
+ *          evicted before the next pixels in them are used. The destination is
+ *          processed in blocks of BLIT_BLOCKSIZE x BLIT_BLOCKSIZE pixels, so the
+ *          BLIT_BLOCKSIZE cache lines read for a block are reused by all its lines.
+ *
+ * @note    Bilinear scaling converts the two source lines used into ARGB8888 and
+ *          keeps them while the next destination lines use them. Each channel is
+ *          interpolated with 8-bit weights, two channels at a time.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "blit.h"
+
+/**
+ * @brief   Pixels converted at a time
+ */
+#define BLIT_SPAN               64
+
+/**
+ * @brief   Source lines in ARGB8888 for bilinear scaling
+ */
+static uint32_t lines[2][BLIT_MAXWIDTH];
+
+/**
+ * @brief   Exact position in the source for nearest scaling
+ *
+ * @note    For destination pixel i, the source pixel is (2*i+1)*ssize/(2*dsize). pos
+ *          is the quotient and rem the remainder of this division.
+ */
+typedef struct {
+    int         pos;
+    int         rem;
+    int         q;                  ///< Increment of pos for each destination pixel
+    int         r;                  ///< Increment of rem
+    int         den;                ///< 2*dsize
+} Step_t;
+
+static void stepinit(Step_t *st, int i, int ssize, int dsize) {
+uint32_t num = (uint32_t) (2*i+1)*ssize;
+
+    st->den = 2*dsize;
+    st->pos = num/st->den;
+    st->rem = num%st->den;
+    st->q   = ssize/dsize;
+    st->r   = 2*(ssize%dsize);
+}
+
+static inline void stepnext(Step_t *st) {
+
+    st->pos += st->q;
+    st->rem += st->r;
+    if( st->rem >= st->den ) {
+        st->rem -= st->den;
+        st->pos++;
+    }
+}
+
+/*
+ * @brief   Clip the rectangle (x,y,w,h) against the surface
+ *
+ * @note    Returns 0 if nothing is visible. Otherwise [x0,x1) and [y0,y1) are the
+ *          visible columns and lines
+ */
+static int clip(const LCD_Surface *s, int x, int y, int w, int h, int *x0, int *y0, int *x1, int *y1) {
+
+    *x0 = x < s->x ? s->x : x;
+    *y0 = y < s->y ? s->y : y;
+    *x1 = x+w > s->x+s->w ? s->x+s->w : x+w;
+    *y1 = y+h > s->y+s->h ? s->y+s->h : y+h;
+    return (*x0 < *x1) && (*y0 < *y1);
+}
+
+/*
+ * @brief   Check if pixels can be copied without conversion
+ */
+static int sameformat(const LCD_Surface *dst, const LCD_Surface *src) {
+
+    if( dst->format != src->format )
+        return 0;
+    return (dst->format < LCD_FORMAT_L8) || (dst->clut == src->clut);
+}
+
+/*
+ * @brief   Convert n pixels into the destination line y from x on
+ */
+static void putspan(const LCD_Surface *dst, int x, int y, const void *p, int format,
+                    LCD_CLUT *clut, int n) {
+LCD_Surface span;
+
+    LCD_InitSurface(&span,(void *) p,format,x,y,n,1,0);
+    span.clut = clut;
+    Pixel_ConvertSurface(dst,x,y,&span);
+}
+
+/*
+ * @brief   Copy n pixels reading the source with a step in bytes
+ */
+static void gather(uint8_t *d, const uint8_t *s, int step, int n, int ps) {
+int i;
+
+    switch(ps) {
+    case 4:
+        for(i=0;i<n;i++,s+=step)
+            ((uint32_t *) d)[i] = *(const uint32_t *) s;
+        break;
+    case 2:
+        for(i=0;i<n;i++,s+=step)
+            ((uint16_t *) d)[i] = *(const uint16_t *) s;
+        break;
+    case 1:
+        for(i=0;i<n;i++,s+=step)
+            d[i] = *s;
+        break;
+    default:
+        for(i=0;i<n;i++,s+=step,d+=3) {
+            d[0] = s[0];
+            d[1] = s[1];
+            d[2] = s[2];
+        }
+        break;
+    }
+}
+
+/*
+ * @brief   Copy n pixels of line s in the positions given by st (advanced)
+ */
+static void pick(uint8_t *d, const uint8_t *s, Step_t *st, int n, int ps) {
+int i;
+const uint8_t *p;
+
+    switch(ps) {
+    case 4:
+        for(i=0;i<n;i++,stepnext(st))
+            ((uint32_t *) d)[i] = ((const uint32_t *) s)[st->pos];
+        break;
+    case 2:
+        for(i=0;i<n;i++,stepnext(st))
+            ((uint16_t *) d)[i] = ((const uint16_t *) s)[st->pos];
+        break;
+    case 1:
+        for(i=0;i<n;i++,stepnext(st))
+            d[i] = s[st->pos];
+        break;
+    default:
+        for(i=0;i<n;i++,stepnext(st),d+=3) {
+            p    = s+3*st->pos;
+            d[0] = p[0];
+            d[1] = p[1];
+            d[2] = p[2];
+        }
+        break;
+    }
+}
+
+/*
+ * @brief   Interpolate two ARGB8888 colors (w = weight of b, 0-256), rounded
+ */
+static inline uint32_t lerp(uint32_t a, uint32_t b, unsigned w) {
+uint32_t rb,ag;
+
+    rb = (((a&0x00FF00FF)*(256-w)+(b&0x00FF00FF)*w+0x00800080)>>8)&0x00FF00FF;
+    ag = (((a>>8)&0x00FF00FF)*(256-w)+((b>>8)&0x00FF00FF)*w+0x00800080)&0xFF00FF00;
+    return ag|rb;
+}
+
+/*
+ * @brief   Nearest neighbor scaling
+ */
+static void scalenearest(const LCD_Surface *dst, int x, int y, int w, int h,
+                         const LCD_Surface *src, int x0, int y0, int x1, int y1) {
+uint8_t buffer[BLIT_SPAN*4];
+const uint8_t *line;
+Step_t sx,sy;
+int same = sameformat(dst,src);
+int ps = LCD_GetFormatPixelSize(src->format);
+int dps = LCD_GetFormatPixelSize(dst->format);
+int lastsy = -1;
+int X,Y,n;
+
+    stepinit(&sy,y0-y,src->h,h);
+    for(Y=y0;Y<y1;Y++,stepnext(&sy)) {
+        if( sy.pos == lastsy ) {        // same line again (magnification)
+            memcpy(LCD_GetSurfacePixelAddress(dst,x0,Y),LCD_GetSurfacePixelAddress(dst,x0,Y-1),
+                   (x1-x0)*dps);
+            continue;
+        }
+        lastsy = sy.pos;
+        line   = (const uint8_t *) LCD_GetSurfacePixelAddress(src,src->x,src->y+sy.pos);
+        stepinit(&sx,x0-x,src->w,w);
+        for(X=x0;X<x1;X+=n) {
+            n = x1-X;
+            if( n > BLIT_SPAN )
+                n = BLIT_SPAN;
+            if( same ) {
+                pick((uint8_t *) LCD_GetSurfacePixelAddress(dst,X,Y),line,&sx,n,ps);
+            } else {
+                pick(buffer,line,&sx,n,ps);
+                putspan(dst,X,Y,buffer,src->format,src->clut,n);
+            }
+        }
+    }
+}
+
+/*
+ * @brief   Source position for bilinear scaling (limited to the source size)
+ */
+static inline uint32_t bilinearpos(int i, uint32_t step, int size) {
+int32_t f = i*step+step/2-0x8000;
+
+    if( f < 0 )
+        return 0;
+    if( f > (size-1)*65536 )
+        return (size-1)*65536;
+    return f;
+}
+
+/*
+ * @brief   Bilinear scaling
+ *
+ * @return  0 if OK, -1 if more than BLIT_MAXWIDTH source columns are used
+ */
+static int scalebilinear(const LCD_Surface *dst, int x, int y, const LCD_Surface *src,
+                         uint32_t stepx, uint32_t stepy, int x0, int y0, int x1, int y1) {
+uint32_t buffer[BLIT_SPAN];
+uint32_t *l0 = lines[0], *l1 = lines[1], *lt;
+const uint32_t *clut = src->clut ? src->clut->color : 0;
+uint32_t fx,fy,c0,c1;
+int sxa,sxb,n,t0 = -1,t1 = -1,t;
+int sy0,sy1,a,wx,wy;
+int X,Y,i,k;
+
+    // Source columns used
+    sxa = bilinearpos(x0-x,stepx,src->w)>>16;
+    sxb = (bilinearpos(x1-1-x,stepx,src->w)>>16)+1;
+    if( sxb >= src->w )
+        sxb = src->w-1;
+    n = sxb-sxa+1;
+    if( n > BLIT_MAXWIDTH )
+        return -1;
+
+    for(Y=y0;Y<y1;Y++) {
+        fy  = bilinearpos(Y-y,stepy,src->h);
+        sy0 = fy>>16;
+        sy1 = sy0+1 < src->h ? sy0+1 : sy0;
+        wy  = (fy>>8)&0xFF;
+        if( t1 == sy0 ) {               // second line is now the first
+            lt = l0; l0 = l1; l1 = lt;
+            t  = t0; t0 = t1; t1 = t;
+        }
+        if( t0 != sy0 ) {
+            Pixel_ConvertRow(l0,LCD_FORMAT_ARGB8888,
+                    LCD_GetSurfacePixelAddress(src,src->x+sxa,src->y+sy0),src->format,n,clut);
+            t0 = sy0;
+        }
+        if( (wy != 0) && (t1 != sy1) ) {
+            Pixel_ConvertRow(l1,LCD_FORMAT_ARGB8888,
+                    LCD_GetSurfacePixelAddress(src,src->x+sxa,src->y+sy1),src->format,n,clut);
+            t1 = sy1;
+        }
+
+        for(X=x0;X<x1;X+=k) {
+            k = x1-X;
+            if( k > BLIT_SPAN )
+                k = BLIT_SPAN;
+            for(i=0;i<k;i++) {
+                fx = bilinearpos(X+i-x,stepx,src->w);
+                a  = (fx>>16)-sxa;
+                wx = (fx>>8)&0xFF;
+                c0 = wx ? lerp(l0[a],l0[a+1],wx) : l0[a];
+                if( wy ) {
+                    c1 = wx ? lerp(l1[a],l1[a+1],wx) : l1[a];
+                    c0 = lerp(c0,c1,wy);
+                }
+                buffer[i] = c0;
+            }
+            putspan(dst,X,Y,buffer,LCD_FORMAT_ARGB8888,0,k);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Blit_Scale
+ *
+ * @note    Draw src scaled to w x h pixels into dst with its top left corner at
+ *          (x,y). filter is BLIT_NEAREST or BLIT_BILINEAR.
+ *
+ * @return  0 if OK, -1 if the parameters are wrong or (bilinear) the source columns
+ *          used are more than BLIT_MAXWIDTH
+ */
+int
+Blit_Scale(const LCD_Surface *dst, int x, int y, int w, int h, const LCD_Surface *src,
+           int filter) {
+int x0,y0,x1,y1;
+
+    if( (w <= 0) || (h <= 0) || (src->w <= 0) || (src->h <= 0) )
+        return -1;
+    if( (filter != BLIT_NEAREST) && (filter != BLIT_BILINEAR) )
+        return -1;
+    if( !clip(dst,x,y,w,h,&x0,&y0,&x1,&y1) )
+        return 0;
+
+    switch(filter) {
+    case BLIT_NEAREST:
+        scalenearest(dst,x,y,w,h,src,x0,y0,x1,y1);
+        return 0;
+    case BLIT_BILINEAR:
+        return scalebilinear(dst,x,y,src,((uint32_t) src->w<<16)/w,((uint32_t) src->h<<16)/h,
+                             x0,y0,x1,y1);
+    }
+    return -1;
+}
+
+/**
+ * @brief   Blit_Rotate
+ *
+ * @note    Draw src rotated clockwise by rotation (BLIT_ROTATE_*) into dst with its
+ *          top left corner at (x,y). For 90 and 270 degrees, the width and height are
+ *          swapped.
+ *
+ * @return  0 if OK, -1 if rotation is wrong
+ */
+int
+Blit_Rotate(const LCD_Surface *dst, int x, int y, const LCD_Surface *src, int rotation) {
+uint8_t buffer[BLIT_SPAN*4];
+const uint8_t *base,*p;
+int same = sameformat(dst,src);
+int ps = LCD_GetFormatPixelSize(src->format);
+int w,h,du,dv,ox,oy,bw,bh;
+int x0,y0,x1,y1,X,Y,j,yend,n;
+
+    // Source of the pixel at (x,y) and steps in bytes for the next column (du) and line (dv)
+    switch(rotation) {
+    case BLIT_ROTATE_0:
+        w  = src->w;        h  = src->h;
+        ox = 0;             oy = 0;
+        du = ps;            dv = src->pitch;
+        break;
+    case BLIT_ROTATE_90:
+        w  = src->h;        h  = src->w;
+        ox = 0;             oy = src->h-1;
+        du = -src->pitch;   dv = ps;
+        break;
+    case BLIT_ROTATE_180:
+        w  = src->w;        h  = src->h;
+        ox = src->w-1;      oy = src->h-1;
+        du = -ps;           dv = -src->pitch;
+        break;
+    case BLIT_ROTATE_270:
+        w  = src->h;        h  = src->w;
+        ox = src->w-1;      oy = 0;
+        du = src->pitch;    dv = -ps;
+        break;
+    default:
+        return -1;
+    }
+    if( !clip(dst,x,y,w,h,&x0,&y0,&x1,&y1) )
+        return 0;
+    base = (const uint8_t *) LCD_GetSurfacePixelAddress(src,src->x+ox,src->y+oy);
+
+    // Blocks for 90 and 270 degrees. Lines (in spans) otherwise
+    bw = (rotation&1) ? BLIT_BLOCKSIZE : BLIT_SPAN;
+    bh = (rotation&1) ? BLIT_BLOCKSIZE : 1;
+    for(Y=y0;Y<y1;Y+=bh) {
+        yend = Y+bh < y1 ? Y+bh : y1;
+        for(X=x0;X<x1;X+=bw) {
+            n = x1-X < bw ? x1-X : bw;
+            for(j=Y;j<yend;j++) {
+                p = base+(X-x)*du+(j-y)*dv;
+                if( same ) {
+                    gather((uint8_t *) LCD_GetSurfacePixelAddress(dst,X,j),p,du,n,ps);
+                } else {
+                    gather(buffer,p,du,n,ps);
+                    putspan(dst,X,j,buffer,src->format,src->clut,n);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef BLIT_H
+#define BLIT_H
+/**
+ * @file    blit.h
+ *
+ * @note    Blits with transforms: scaling (nearest or bilinear) and rotation by
+ *          multiples of 90 degrees
+ *
+ * @note    Source and destination can have any LCD_FORMAT_*. Coordinates use fixed
+ *          point (16.16). The output is clipped against the destination surface.
+ *
+ * @author  Hans
+ */
+
+#include "lcd.h"
+
+/**
+ * @brief   Sizes
+ *
+ * @note    Rotations by 90 and 270 degrees are done in blocks of BLIT_BLOCKSIZE x
+ *          BLIT_BLOCKSIZE pixels, so the source lines read fit in the data cache.
+ *          BLIT_MAXWIDTH limits the source columns used by a bilinear scaling (two
+ *          lines of 4 bytes per pixel are kept in .bss).
+ */
+///@{
+#ifndef BLIT_BLOCKSIZE
+#define BLIT_BLOCKSIZE          16
+#endif
+#ifndef BLIT_MAXWIDTH
+#define BLIT_MAXWIDTH           LCD_DW
+#endif
+///@}
+
+/**
+ * @brief   Filters for Blit_Scale
+ */
+///@{
+#define BLIT_NEAREST            (0)
+#define BLIT_BILINEAR           (1)
+///@}
+
+/**
+ * @brief   Rotations for Blit_Rotate (clockwise)
+ */
+///@{
+#define BLIT_ROTATE_0           (0)
+#define BLIT_ROTATE_90          (1)
+#define BLIT_ROTATE_180         (2)
+#define BLIT_ROTATE_270         (3)
+///@}
+
+int  Blit_Scale(const LCD_Surface *dst, int x, int y, int w, int h, const LCD_Surface *src,
+                int filter);
+int  Blit_Rotate(const LCD_Surface *dst, int x, int y, const LCD_Surface *src, int rotation);
+
+#endif
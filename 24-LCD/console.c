@@ -0,0 +1,240 @@
+/**
+ * @file    console.c
+ *
+ * @note    Text console on a LCD layer with hardware scrolling
+ *
+ * @note    Scrolling a frame buffer by software means copying almost all of it for
+ *          each new line. Here the buffer has one more text line than the screen
+ *          (slots) and is used as a ring. The layer shows the lines from the top slot
+ *          on, so scrolling is a change of the start address (CFBAR) at next vertical
+ *          blanking, and only the new line is cleared and drawn.
+ *
+ * @note    The LTDC reads the lines sequentially and cannot wrap around. So the
+ *          ring is stored twice: the buffer has 2*slots text lines and each line is
+ *          drawn in slot i and in slot i+slots. Any sequence of visible lines is then
+ *          contiguous.
+ *
+ * @note    The new line is in the slot that is not visible. It is cleared before
+ *          the address is changed, so the old text is not seen at the bottom. CFBAR is
+ *          only used from the next vertical blanking on, so with more than one new line
+ *          in a frame, the slot recycled is still shown. newline waits for the pending
+ *          reload before clearing it, so scrolling is limited to a line per frame.
+ *
+ * @note    Colors are in the format of the console.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "font.h"
+#include "console.h"
+#include "syscalls.h"
+
+/**
+ * @brief   Console state
+ */
+typedef struct {
+    LCD_Surface         s;              ///< The whole ring buffer (2*slots lines)
+    const Font_Info    *font;
+    int                 layer;
+    unsigned            fg;             ///< Text color
+    unsigned            bg;             ///< Background color
+    int                 rows;           ///< Text lines shown
+    int                 slots;          ///< Text lines in ring (rows+1)
+    int                 cur;            ///< Slot of current line
+    int                 used;           ///< Lines shown (until the screen is full)
+    int                 x;              ///< Position of next character
+} Console_t;
+
+static Console_t console = { .font = 0 };
+
+/*
+ * @brief   Pitch used for the console buffer
+ *
+ * @note    Same as a full size frame buffer
+ */
+static int getpitch(int format) {
+
+    return LCD_GetMinimalFullFrameBufferSize(format)/LCD_DH;
+}
+
+/*
+ * @brief   Fill a rectangle of a text line in both copies
+ */
+static void clearslot(int slot, int x, int w) {
+int h = console.font->height;
+
+    LCD_SurfaceFillRect(&console.s,x,slot*h,w,h,console.bg);
+    LCD_SurfaceFillRect(&console.s,x,(slot+console.slots)*h,w,h,console.bg);
+}
+
+/*
+ * @brief   Advance to next line, scrolling when the screen is full
+ */
+static void newline(void) {
+int top;
+
+    console.cur = (console.cur+1)%console.slots;
+    console.x   = 0;
+    // The slot is the top one of the address still in use until the reload
+    LCD_WaitForReload();
+    clearslot(console.cur,0,LCD_DW);
+    if( console.used < console.rows ) {
+        console.used++;
+        return;
+    }
+    top = (console.cur-console.rows+1+console.slots)%console.slots;
+    LCD_SetFrameBufferAddress(console.layer,
+            (char *) console.s.area+top*console.font->height*console.s.pitch);
+}
+
+/**
+ * @brief   Console_GetBufferSize
+ *
+ * @note    Returns the size in bytes of the area needed by Console_Init
+ */
+int
+Console_GetBufferSize(int format, const Font_Info *font) {
+int slots = LCD_DH/font->height+1;
+
+    return getpitch(format)*2*slots*font->height;
+}
+
+/**
+ * @brief   Console_Init
+ *
+ * @note    Use area (with size given by Console_GetBufferSize) as frame buffer of the
+ *          layer. The console has LCD_DH/height lines and starts empty.
+ *
+ * @return  0 if OK, -1 if the font is too large
+ */
+int
+Console_Init(int layer, void *area, int format, const Font_Info *font, unsigned fg, unsigned bg) {
+int pitch;
+
+    if( (font->height == 0) || (font->height > LCD_DH) )
+        return -1;
+
+    pitch          = getpitch(format);
+    console.font   = font;
+    console.layer  = layer;
+    console.fg     = fg;
+    console.bg     = bg;
+    console.rows   = LCD_DH/font->height;
+    console.slots  = console.rows+1;
+    LCD_InitSurface(&console.s,area,format,0,0,LCD_DW,2*console.slots*font->height,pitch);
+
+    LCD_SetFrameBuffer(layer,area,format,0,0,LCD_DW,console.rows*font->height,pitch);
+    Console_Clear();
+    return 0;
+}
+
+/**
+ * @brief   Console_SetColors
+ *
+ * @note    Used for the next characters
+ */
+void
+Console_SetColors(unsigned fg, unsigned bg) {
+
+    console.fg = fg;
+    console.bg = bg;
+}
+
+/**
+ * @brief   Console_Clear
+ */
+void
+Console_Clear(void) {
+
+    if( !console.font )
+        return;
+    LCD_SurfaceFillRect(&console.s,0,0,console.s.w,console.s.h,console.bg);
+    console.cur  = 0;
+    console.used = 1;
+    console.x    = 0;
+    LCD_SetFrameBufferAddress(console.layer,console.s.area);
+}
+
+/**
+ * @brief   Console_PutChar
+ *
+ * @note    Handles \n, \r, \t and \b. Other control characters are ignored.
+ *          Long lines are wrapped.
+ */
+void
+Console_PutChar(int c) {
+int w,h;
+
+    if( !console.font )
+        return;
+
+    switch(c) {
+    case '\n':
+        newline();
+        return;
+    case '\r':
+        console.x = 0;
+        return;
+    case '\t':
+        w = CONSOLE_TABSIZE*Font_GetCharWidth(console.font,' ');
+        if( w <= 0 )
+            return;                     // Font without ' ' or '?'
+        console.x = (console.x/w+1)*w;
+        if( console.x >= LCD_DW )
+            newline();
+        return;
+    case '\b':
+        console.x -= Font_GetCharWidth(console.font,' ');
+        if( console.x < 0 )
+            console.x = 0;
+        return;
+    }
+    if( (c < ' ') || (c == 0x7F) )
+        return;
+
+    w = Font_GetCharWidth(console.font,c);
+    if( console.x+w > LCD_DW )
+        newline();
+
+    h = console.font->height;
+    clearslot(console.cur,console.x,w);
+    Font_DrawChar(&console.s,console.font,console.x,console.cur*h,c,console.fg);
+    Font_DrawChar(&console.s,console.font,console.x,(console.cur+console.slots)*h,c,console.fg);
+    console.x += w;
+}
+
+/**
+ * @brief   Console_Write
+ *
+ * @note    Returns the number of characters written (n)
+ */
+int
+Console_Write(const char *s, int n) {
+int i;
+
+    for(i=0;i<n;i++)
+        Console_PutChar((unsigned char) s[i]);
+    return n;
+}
+
+/**
+ * @brief   Console_Attach/Console_Detach
+ *
+ * @note    When attached, the output to stdout and stderr (printf) is shown in the
+ *          console too.
+ */
+///@{
+void
+Console_Attach(void) {
+
+    _setwritehook(Console_Write);
+}
+
+void
+Console_Detach(void) {
+
+    _setwritehook(0);
+}
+///@}
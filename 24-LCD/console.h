@@ -0,0 +1,36 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+/**
+ * @file    console.h
+ *
+ * @note    Text console on a LCD layer with hardware scrolling
+ *
+ * @note    The text lines are kept in a ring buffer taller than the screen and the
+ *          layer shows a part of it. Scrolling is done by changing the frame buffer
+ *          start address (CFBAR). Only the new line is drawn.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "font.h"
+
+/**
+ * @brief   Tab size in characters
+ */
+#ifndef CONSOLE_TABSIZE
+#define CONSOLE_TABSIZE         8
+#endif
+
+int  Console_GetBufferSize(int format, const Font_Info *font);
+int  Console_Init(int layer, void *area, int format, const Font_Info *font,
+                  unsigned fg, unsigned bg);
+void Console_SetColors(unsigned fg, unsigned bg);
+void Console_Clear(void);
+void Console_PutChar(int c);
+int  Console_Write(const char *s, int n);
+void Console_Attach(void);
+void Console_Detach(void);
+
+#endif
@@ -0,0 +1,490 @@
+/**
+ * @file    draw.c
+ *
+ * @note    Anti-aliased lines, circles and arcs
+ *
+ * @note    All coordinates are screen coordinates of pixel centers. Drawing is
+ *          clipped against the surface.
+ *
+ * @note    The build does not use the FPU (-mcpu=cortex-m7+nofp). Distances use
+ *          fixed point with 8 fractional bits and coverage is in range 0-255.
+ *
+ * @note    Circles, arcs and thick lines are computed line by line. The coverage of
+ *          each pixel of a line is stored in a mask and LCD_SurfaceBlendMask fills
+ *          the opaque runs with word writes and blends only the edge pixels.
+ *
+ * @note    The mask buffer is static, so these routines are not reentrant.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "draw.h"
+
+#define ABS(X)  ((X)>0?(X):-(X))
+#define MIN(A,B) ((A)<(B)?(A):(B))
+#define MAX(A,B) ((A)>(B)?(A):(B))
+
+/**
+ * @brief   Coverage of a line of pixels
+ */
+static uint8_t mask[DRAW_MASKSIZE];
+
+/**
+ * @brief   Sine table for 0 to 90 degrees (Q15)
+ */
+static const int16_t sintable[91] = {
+        0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+     5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767
+};
+
+/**
+ * @brief   Draw_Sin
+ *
+ * @note    angle in degrees. Result in Q15 format
+ */
+int
+Draw_Sin(int angle) {
+
+    angle %= 360;
+    if( angle < 0 )
+        angle += 360;
+    if( angle <= 90 )
+        return sintable[angle];
+    if( angle <= 180 )
+        return sintable[180-angle];
+    if( angle <= 270 )
+        return -sintable[angle-180];
+    return -sintable[360-angle];
+}
+
+/**
+ * @brief   Draw_Cos
+ *
+ * @note    angle in degrees. Result in Q15 format
+ */
+int
+Draw_Cos(int angle) {
+
+    return Draw_Sin(angle+90);
+}
+
+/**
+ * @brief   Integer square root
+ */
+static uint32_t isqrt64(uint64_t v) {
+uint64_t r = 0;
+uint64_t b = ((uint64_t) 1)<<62;
+
+    while( b > v )
+        b >>= 2;
+    while( b != 0 ) {
+        if( v >= r+b ) {
+            v -= r+b;
+            r  = (r>>1)+b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return (uint32_t) r;
+}
+
+/**
+ * @brief   Convert a distance to the edge (1/256 pixel) into coverage
+ *
+ * @note    v = distance inside the shape + 0.5 pixel
+ */
+static inline unsigned coverage(int32_t v) {
+
+    if( v <= 0 )
+        return 0;
+    if( v >= 255 )
+        return 255;
+    return v;
+}
+
+////////////////////////////////// Lines ///////////////////////////////////////////////////////////
+
+/*
+ * @brief   Plot a pixel of a line. When steep, coordinates are swapped
+ */
+static inline void plotaa(const LCD_Surface *s, int steep, int a, int b, unsigned color, unsigned alpha) {
+
+    if( steep )
+        LCD_SurfaceBlendPixel(s,b,a,color,alpha);
+    else
+        LCD_SurfaceBlendPixel(s,a,b,color,alpha);
+}
+
+/**
+ * @brief   Draw_LineAA
+ *
+ * @note    Xiaolin Wu algorithm. The position on the minor axis is kept in 16.16 fixed
+ *          point and its fractional part gives the intensity of the two pixels.
+ *
+ * @note    Clipping is done by limiting the range on the major axis, so the slope is
+ *          not changed by the clipping.
+ */
+void
+Draw_LineAA(const LCD_Surface *s, int x0, int y0, int x1, int y1, unsigned color) {
+int steep,t,dx,dy,x,xs,xe;
+int lo,hi,mlo,mhi;
+int32_t grad,intery;
+unsigned f;
+
+    steep = ABS(y1-y0) > ABS(x1-x0);
+    if( steep ) {
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+        lo  = s->y; hi  = s->y+s->h-1;
+        mlo = s->x; mhi = s->x+s->w-1;
+    } else {
+        lo  = s->x; hi  = s->x+s->w-1;
+        mlo = s->y; mhi = s->y+s->h-1;
+    }
+    if( x0 > x1 ) {
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    dx   = x1-x0;
+    dy   = y1-y0;
+    grad = (dx!=0) ? (int32_t) ((((int64_t) dy)<<16)/dx) : 0;
+
+    // Clip on major axis
+    xs = MAX(x0,lo);
+    xe = MIN(x1,hi);
+
+    // Clip on minor axis (one pixel margin, since two pixels are plotted)
+    if( grad > 0 ) {
+        if( y0 < mlo-1 )
+            xs = MAX(xs,x0+(int) ((((int64_t) (mlo-1-y0))<<16)/grad));
+        if( y1 > mhi )
+            xe = MIN(xe,x0+(int) ((((int64_t) (mhi-y0))<<16)/grad)+1);
+    } else if( grad < 0 ) {
+        if( y0 > mhi )
+            xs = MAX(xs,x0+(int) ((((int64_t) (y0-mhi))<<16)/(-grad)));
+        if( y1 < mlo-1 )
+            xe = MIN(xe,x0+(int) ((((int64_t) (y0-mlo+1))<<16)/(-grad))+1);
+    } else {
+        if( (y0 < mlo-1) || (y0 > mhi) )
+            return;
+    }
+
+    intery = (y0<<16)+(int32_t) ((int64_t) (xs-x0)*grad);
+    for(x=xs;x<=xe;x++) {
+        f = (intery>>8)&0xFF;
+        plotaa(s,steep,x,intery>>16,color,255-f);
+        if( f )
+            plotaa(s,steep,x,(intery>>16)+1,color,f);
+        intery += grad;
+    }
+}
+
+/**
+ * @brief   Draw_ThickLineAA
+ *
+ * @note    The line is the set of points with distance to the segment less than
+ *          width/2, so it has round caps.
+ *
+ * @note    For each line of the screen, only the pixels near the segment are
+ *          examined. The distance to the infinite line is computed with a
+ *          reciprocal of the length, avoiding a division by pixel.
+ */
+void
+Draw_ThickLineAA(const LCD_Surface *s, int x0, int y0, int x1, int y1, int width, unsigned color) {
+int32_t hw,d;
+int ddx,ddy,ext,x,y,xs,xe,xc,half,px,py,qx,qy,n,i;
+int ylo,yhi,bxlo,bxhi;
+int64_t len2,t,c;
+uint32_t len8;
+uint64_t recip;
+
+    if( width <= 1 ) {
+        Draw_LineAA(s,x0,y0,x1,y1,color);
+        return;
+    }
+
+    hw   = width<<7;
+    ddx  = x1-x0;
+    ddy  = y1-y0;
+    len2 = (int64_t) ddx*ddx+(int64_t) ddy*ddy;
+    if( len2 == 0 ) {
+        Draw_FilledCircleAA(s,x0,y0,width>>1,color);
+        return;
+    }
+    len8  = isqrt64(((uint64_t) len2)<<16);
+    recip = (((uint64_t) 1)<<40)/len8;
+
+    ext  = (width>>1)+2;
+    ylo  = MAX(MIN(y0,y1)-ext,s->y);
+    yhi  = MIN(MAX(y0,y1)+ext,s->y+s->h-1);
+    bxlo = MAX(MIN(x0,x1)-ext,s->x);
+    bxhi = MIN(MAX(x0,x1)+ext,s->x+s->w-1);
+
+    for(y=ylo;y<=yhi;y++) {
+        py = y-y0;
+        xs = bxlo;
+        xe = bxhi;
+        if( ddy != 0 ) {
+            xc   = x0+(int) ((int64_t) py*ddx/ddy);
+            half = (int) ((((int64_t) (hw+256))*len8/(((int64_t) ABS(ddy))<<8))>>8)+1;
+            xs   = MAX(xs,xc-half);
+            xe   = MIN(xe,xc+half);
+        }
+        while( xs <= xe ) {
+            n = MIN(xe-xs+1,DRAW_MASKSIZE);
+            for(i=0;i<n;i++) {
+                x  = xs+i;
+                px = x-x0;
+                t  = (int64_t) px*ddx+(int64_t) py*ddy;
+                if( t <= 0 ) {
+                    d = isqrt64(((uint64_t) ((int64_t) px*px+(int64_t) py*py))<<16);
+                } else if( t >= len2 ) {
+                    qx = x-x1;
+                    qy = y-y1;
+                    d = isqrt64(((uint64_t) ((int64_t) qx*qx+(int64_t) qy*qy))<<16);
+                } else {
+                    c = (int64_t) ddx*py-(int64_t) ddy*px;
+                    if( c < 0 )
+                        c = -c;
+                    d = (int32_t) ((((uint64_t) c)*recip)>>24);
+                }
+                mask[i] = coverage(hw+128-d);
+            }
+            LCD_SurfaceBlendMask(s,xs,y,n,color,mask);
+            xs += n;
+        }
+    }
+}
+
+////////////////////////////////// Circles /////////////////////////////////////////////////////////
+
+/**
+ * @brief   Angular limits of an arc
+ *
+ * @note    v0 and v1 are unit vectors (Q15) of start and end directions
+ */
+typedef struct {
+    int32_t     v0x,v0y;
+    int32_t     v1x,v1y;
+    int         large;          ///< Sweep greater than 180 degrees
+} Sector;
+
+/*
+ * @brief   Coverage given by the angular limits
+ *
+ * @note    The cross products give the signed distances to the lines through the
+ *          center in the start and end directions.
+ */
+static unsigned sectorcoverage(const Sector *sec, int px, int py) {
+int32_t c0,c1;
+unsigned a0,a1;
+
+    c0 = (sec->v0x*py-sec->v0y*px)>>7;
+    c1 = (px*sec->v1y-py*sec->v1x)>>7;
+    a0 = coverage(c0+128);
+    a1 = coverage(c1+128);
+    if( sec->large )
+        return MAX(a0,a1);
+    return MIN(a0,a1);
+}
+
+/*
+ * @brief   Draw a ring
+ *
+ * @note    The ring is the set of points with distance to center between ri and ro,
+ *          both in 24.8 fixed point. When ri is negative, the ring is a disk.
+ *
+ * @note    For each line, pixels nearer than D are inside the hole and pixels
+ *          between C and B are fully covered. Only the other ones need a square root.
+ */
+static void drawring(const LCD_Surface *s, int cx, int cy, int32_t ro, int32_t ri,
+                     const Sector *sec, unsigned color) {
+int32_t rmax,t,d;
+int64_t dy2,sq;
+int A,B,C,D,y,dx,dy,xs,xe,n,i;
+unsigned a;
+
+    rmax = ro+128;
+    if( rmax <= 0 )
+        return;
+
+    for(y=MAX(cy-(rmax>>8),s->y);y<=MIN(cy+(rmax>>8),s->y+s->h-1);y++) {
+        dy  = y-cy;
+        dy2 = ((int64_t) dy*dy)<<16;
+        sq  = (int64_t) rmax*rmax-dy2;
+        if( sq < 0 )
+            continue;
+        A = isqrt64(sq)>>8;
+
+        B = -1;
+        t = ro-128;
+        if( (t >= 0) && ((sq = (int64_t) t*t-dy2) >= 0) )
+            B = isqrt64(sq)>>8;
+
+        C = 0;
+        D = -1;
+        if( ri >= 0 ) {
+            t  = ri+128;
+            sq = (int64_t) t*t-dy2;
+            if( sq > 0 )
+                C = (isqrt64(sq)+255)>>8;
+            t = ri-128;
+            if( (t >= 0) && ((sq = (int64_t) t*t-dy2) >= 0) )
+                D = isqrt64(sq)>>8;
+        }
+
+        xs = MAX(cx-A,s->x);
+        xe = MIN(cx+A,s->x+s->w-1);
+        while( xs <= xe ) {
+            n = MIN(xe-xs+1,DRAW_MASKSIZE);
+            for(i=0;i<n;i++) {
+                dx = ABS(xs+i-cx);
+                if( dx <= D ) {
+                    a = 0;
+                } else if( (dx >= C) && (dx <= B) ) {
+                    a = 255;
+                } else {
+                    d = isqrt64((((uint64_t) dx*dx)<<16)+dy2);
+                    a = coverage(ro+128-d);
+                    if( ri >= 0 )
+                        a = MIN(a,coverage(d-ri+128));
+                }
+                if( sec && a )
+                    a = MIN(a,sectorcoverage(sec,xs+i-cx,dy));
+                mask[i] = a;
+            }
+            LCD_SurfaceBlendMask(s,xs,y,n,color,mask);
+            xs += n;
+        }
+    }
+}
+
+/**
+ * @brief   Draw_CircleAA
+ *
+ * @note    One pixel wide circle
+ */
+void
+Draw_CircleAA(const LCD_Surface *s, int cx, int cy, int r, unsigned color) {
+
+    drawring(s,cx,cy,(r<<8)+128,(r<<8)-128,0,color);
+}
+
+/**
+ * @brief   Draw_FilledCircleAA
+ */
+void
+Draw_FilledCircleAA(const LCD_Surface *s, int cx, int cy, int r, unsigned color) {
+
+    drawring(s,cx,cy,(r<<8)+128,-1,0,color);
+}
+
+/**
+ * @brief   Draw_RingAA
+ *
+ * @note    Circle with radius r (middle of ring) and the width specified
+ */
+void
+Draw_RingAA(const LCD_Surface *s, int cx, int cy, int r, int width, unsigned color) {
+
+    drawring(s,cx,cy,(r<<8)+(width<<7),(r<<8)-(width<<7),0,color);
+}
+
+/**
+ * @brief   Draw_ArcAA
+ *
+ * @note    Angles in degrees. 0 is at 3 o'clock and angles grow clockwise (screen
+ *          y axis points down). The arc goes clockwise from a0 to a1.
+ *
+ * @note    Nothing is drawn when a1 <= a0. A full ring is drawn when a1-a0 >= 360.
+ */
+void
+Draw_ArcAA(const LCD_Surface *s, int cx, int cy, int r, int width, int a0, int a1, unsigned color) {
+Sector sec;
+
+    if( a1 <= a0 )
+        return;
+    if( a1-a0 >= 360 ) {
+        Draw_RingAA(s,cx,cy,r,width,color);
+        return;
+    }
+    sec.v0x   = Draw_Cos(a0);
+    sec.v0y   = Draw_Sin(a0);
+    sec.v1x   = Draw_Cos(a1);
+    sec.v1y   = Draw_Sin(a1);
+    sec.large = (a1-a0) > 180;
+    drawring(s,cx,cy,(r<<8)+(width<<7),(r<<8)-(width<<7),&sec,color);
+}
+
+/**
+ * @brief   Draw_Circle
+ *
+ * @note    Midpoint algorithm. No anti-aliasing
+ */
+void
+Draw_Circle(const LCD_Surface *s, int cx, int cy, int r, unsigned color) {
+int x,y,err;
+
+    x   = r;
+    y   = 0;
+    err = 1-r;
+    while( x >= y ) {
+        LCD_SurfacePutPixel(s,cx+x,cy+y,color);
+        LCD_SurfacePutPixel(s,cx+y,cy+x,color);
+        LCD_SurfacePutPixel(s,cx-y,cy+x,color);
+        LCD_SurfacePutPixel(s,cx-x,cy+y,color);
+        LCD_SurfacePutPixel(s,cx-x,cy-y,color);
+        LCD_SurfacePutPixel(s,cx-y,cy-x,color);
+        LCD_SurfacePutPixel(s,cx+y,cy-x,color);
+        LCD_SurfacePutPixel(s,cx+x,cy-y,color);
+        y++;
+        if( err < 0 ) {
+            err += 2*y+1;
+        } else {
+            x--;
+            err += 2*(y-x)+1;
+        }
+    }
+}
+
+/**
+ * @brief   Draw_FilledCircle
+ *
+ * @note    Midpoint algorithm. Each step fills four spans
+ */
+void
+Draw_FilledCircle(const LCD_Surface *s, int cx, int cy, int r, unsigned color) {
+int x,y,err;
+
+    x   = r;
+    y   = 0;
+    err = 1-r;
+    while( x >= y ) {
+        LCD_SurfaceFillSpan(s,cx-x,cy+y,2*x+1,color);
+        if( y != 0 )
+            LCD_SurfaceFillSpan(s,cx-x,cy-y,2*x+1,color);
+        y++;
+        if( err < 0 ) {
+            err += 2*y+1;
+        } else {
+            if( x >= y ) {
+                LCD_SurfaceFillSpan(s,cx-y+1,cy+x,2*y-1,color);
+                LCD_SurfaceFillSpan(s,cx-y+1,cy-x,2*y-1,color);
+            }
+            x--;
+            err += 2*(y-x)+1;
+        }
+    }
+}
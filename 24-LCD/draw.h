@@ -0,0 +1,36 @@
+#ifndef DRAW_H
+#define DRAW_H
+/**
+ * @file    draw.h
+ *
+ * @note    Anti-aliased lines, circles and arcs
+ *
+ * @note    Only integer and fixed point arithmetic (no FPU)
+ *
+ * @author  Hans
+ */
+
+#include "lcd.h"
+
+/**
+ * @brief   Size of the coverage buffer used to blend a line
+ *
+ * @note    Longer spans are processed in pieces
+ */
+#ifndef DRAW_MASKSIZE
+#define DRAW_MASKSIZE       512
+#endif
+
+void Draw_LineAA(const LCD_Surface *s, int x0, int y0, int x1, int y1, unsigned color);
+void Draw_ThickLineAA(const LCD_Surface *s, int x0, int y0, int x1, int y1, int width, unsigned color);
+void Draw_Circle(const LCD_Surface *s, int cx, int cy, int r, unsigned color);
+void Draw_FilledCircle(const LCD_Surface *s, int cx, int cy, int r, unsigned color);
+void Draw_CircleAA(const LCD_Surface *s, int cx, int cy, int r, unsigned color);
+void Draw_FilledCircleAA(const LCD_Surface *s, int cx, int cy, int r, unsigned color);
+void Draw_RingAA(const LCD_Surface *s, int cx, int cy, int r, int width, unsigned color);
+void Draw_ArcAA(const LCD_Surface *s, int cx, int cy, int r, int width, int a0, int a1, unsigned color);
+
+int  Draw_Sin(int angle);
+int  Draw_Cos(int angle);
+
+#endif
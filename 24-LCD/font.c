@@ -0,0 +1,253 @@
+/**
+ * @file    font.c
+ *
+ * @note    Text rendering using bitmap fonts with alpha
+ *
+ * @note    The glyphs are drawn with LCD_SurfaceBlendMask, so they can be drawn on
+ *          surfaces of any format. There is no kerning, so each character is
+ *          drawn independently and the position advances by a fixed amount.
+ *
+ * @note    A8 glyphs are used directly from flash. A1 and A4 glyphs are expanded
+ *          to A8 when first used and kept in a cache. When the cache is full, the
+ *          least recently used glyph is replaced.
+ *
+ * @note    The (x,y) position is the top left corner of the text line.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "font.h"
+
+/**
+ * @brief   Cache slot
+ */
+typedef struct {
+    const Font_Info    *font;       ///< Font or 0 when free
+    int                 c;          ///< Character
+    uint32_t            lastuse;    ///< Time of last access
+    uint8_t             data[FONT_CACHE_SLOTSIZE];
+} CacheSlot;
+
+static CacheSlot cache[FONT_CACHE_SLOTS];
+static uint32_t  usecounter = 0;
+static Font_CacheStatistics cachestats = { 0, 0 };
+
+/**
+ * @brief   Buffer for a line of glyphs too large for the cache
+ */
+static uint8_t linebuffer[256];
+
+/*
+ * @brief   Get glyph information. Returns 0 when not in font
+ */
+static const Font_Glyph *getglyph(const Font_Info *f, int c) {
+
+    if( (c < f->first) || (c > f->last) ) {
+        c = '?';
+        if( (c < f->first) || (c > f->last) )
+            return 0;
+    }
+    return &f->glyph[c-f->first];
+}
+
+/*
+ * @brief   Expand a line of a glyph to A8
+ */
+static void expandline(uint8_t *dst, const uint8_t *src, int w, int bpp) {
+int i,v;
+
+    switch(bpp) {
+    case 1:
+        for(i=0;i<w;i++)
+            dst[i] = (src[i>>3]&(0x80>>(i&7)))?0xFF:0;
+        break;
+    case 4:
+        for(i=0;i<w;i++) {
+            v = (i&1)?(src[i>>1]>>4):(src[i>>1]&0xF);
+            dst[i] = v*0x11;
+        }
+        break;
+    default:
+        for(i=0;i<w;i++)
+            dst[i] = src[i];
+        break;
+    }
+}
+
+/*
+ * @brief   Size in bytes of a glyph line
+ */
+static inline int linesize(const Font_Info *f, int w) {
+
+    return (w*f->bpp+7)>>3;
+}
+
+/*
+ * @brief   Find glyph in cache. When not found, expand it into the LRU slot
+ *
+ * @note    Returns 0 when the glyph does not fit a slot
+ */
+static const uint8_t *cachelookup(const Font_Info *f, int c, const Font_Glyph *g) {
+CacheSlot *slot,*lru;
+const uint8_t *src;
+int i,ls;
+
+    if( g->w*g->h > FONT_CACHE_SLOTSIZE )
+        return 0;
+
+    usecounter++;
+    lru = &cache[0];
+    for(i=0;i<FONT_CACHE_SLOTS;i++) {
+        slot = &cache[i];
+        if( (slot->font == f) && (slot->c == c) ) {
+            slot->lastuse = usecounter;
+            cachestats.hits++;
+            return slot->data;
+        }
+        if( slot->lastuse < lru->lastuse )
+            lru = slot;
+    }
+
+    cachestats.misses++;
+    ls  = linesize(f,g->w);
+    src = f->bitmap+g->offset;
+    for(i=0;i<g->h;i++)
+        expandline(lru->data+i*g->w,src+i*ls,g->w,f->bpp);
+    lru->font    = f;
+    lru->c       = c;
+    lru->lastuse = usecounter;
+    return lru->data;
+}
+
+/**
+ * @brief   Font_DrawChar
+ *
+ * @note    Returns the advance (distance to next character)
+ */
+int
+Font_DrawChar(const LCD_Surface *s, const Font_Info *f, int x, int y, int c, unsigned color) {
+const Font_Glyph *g;
+const uint8_t *a8,*src;
+int left,top,i,r0,r1,ls;
+
+    g = getglyph(f,c);
+    if( !g )
+        return 0;
+
+    left = x+g->xoff;
+    top  = y+f->ascent-g->yoff;
+
+    // Trivial rejection and vertical clipping
+    if( (left >= s->x+s->w) || (left+g->w <= s->x) || (g->w == 0) )
+        return g->advance;
+    r0 = (top < s->y) ? s->y-top : 0;
+    r1 = (top+g->h > s->y+s->h) ? s->y+s->h-top : g->h;
+    if( r0 >= r1 )
+        return g->advance;
+
+    if( f->bpp == 8 ) {
+        src = f->bitmap+g->offset;
+        for(i=r0;i<r1;i++)
+            LCD_SurfaceBlendMask(s,left,top+i,g->w,color,src+i*g->w);
+        return g->advance;
+    }
+
+    a8 = cachelookup(f,(c<f->first||c>f->last)?'?':c,g);
+    if( a8 ) {
+        for(i=r0;i<r1;i++)
+            LCD_SurfaceBlendMask(s,left,top+i,g->w,color,a8+i*g->w);
+    } else if( g->w <= (int) sizeof(linebuffer) ) {
+        ls  = linesize(f,g->w);
+        src = f->bitmap+g->offset;
+        for(i=r0;i<r1;i++) {
+            expandline(linebuffer,src+i*ls,g->w,f->bpp);
+            LCD_SurfaceBlendMask(s,left,top+i,g->w,color,linebuffer);
+        }
+    }
+    return g->advance;
+}
+
+/**
+ * @brief   Font_DrawString
+ *
+ * @note    '\n' moves to the start of next line
+ *
+ * @note    Returns the horizontal position after the last character
+ */
+int
+Font_DrawString(const LCD_Surface *s, const Font_Info *f, int x, int y, const char *str,
+                unsigned color) {
+int x0 = x;
+
+    while( *str ) {
+        if( *str == '\n' ) {
+            x  = x0;
+            y += f->height;
+        } else {
+            x += Font_DrawChar(s,f,x,y,(unsigned char) *str,color);
+        }
+        str++;
+    }
+    return x;
+}
+
+/**
+ * @brief   Font_GetCharWidth
+ */
+int
+Font_GetCharWidth(const Font_Info *f, int c) {
+const Font_Glyph *g = getglyph(f,c);
+
+    return g ? g->advance : 0;
+}
+
+/**
+ * @brief   Font_GetStringWidth
+ *
+ * @note    Width of the longest line
+ */
+int
+Font_GetStringWidth(const Font_Info *f, const char *str) {
+int w = 0, wmax = 0;
+
+    while( *str ) {
+        if( *str == '\n' ) {
+            w = 0;
+        } else {
+            w += Font_GetCharWidth(f,(unsigned char) *str);
+            if( w > wmax )
+                wmax = w;
+        }
+        str++;
+    }
+    return wmax;
+}
+
+/**
+ * @brief   Font_FlushCache
+ *
+ * @note    Must be called when a font in RAM is changed
+ */
+void
+Font_FlushCache(void) {
+int i;
+
+    for(i=0;i<FONT_CACHE_SLOTS;i++) {
+        cache[i].font    = 0;
+        cache[i].lastuse = 0;
+    }
+    usecounter = 0;
+    cachestats.hits   = 0;
+    cachestats.misses = 0;
+}
+
+/**
+ * @brief   Font_GetCacheStatistics
+ */
+void
+Font_GetCacheStatistics(Font_CacheStatistics *st) {
+
+    *st = cachestats;
+}
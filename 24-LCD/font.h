@@ -0,0 +1,75 @@
+#ifndef FONT_H
+#define FONT_H
+/**
+ * @file    font.h
+ *
+ * @note    Bitmap fonts with alpha (A1, A4 or A8 glyphs)
+ *
+ * @note    Font files are generated by tools/mkfont from TTF or BDF fonts
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * @brief   Glyph cache
+ *
+ * @note    A1 and A4 glyphs are expanded to A8 and kept in a LRU cache.
+ *          Glyphs larger than FONT_CACHE_SLOTSIZE bytes are expanded line by line.
+ */
+///@{
+#ifndef FONT_CACHE_SLOTS
+#define FONT_CACHE_SLOTS        32
+#endif
+#ifndef FONT_CACHE_SLOTSIZE
+#define FONT_CACHE_SLOTSIZE     512
+#endif
+///@}
+
+/**
+ * @brief   Glyph information
+ *
+ * @note    Each line of the bitmap starts at a byte boundary. In A4 the first pixel is
+ *          in the low order nibble and in A1 the first pixel is the most significant bit.
+ */
+typedef struct {
+    uint32_t    offset;             ///< Position of bitmap in font bitmap data
+    uint8_t     w;                  ///< Bitmap width
+    uint8_t     h;                  ///< Bitmap height
+    int8_t      xoff;               ///< Horizontal distance from origin to bitmap
+    int8_t      yoff;               ///< Distance from baseline up to bitmap top
+    uint8_t     advance;            ///< Distance to next character origin
+} Font_Glyph;
+
+/**
+ * @brief   Font information
+ */
+typedef struct {
+    const uint8_t      *bitmap;     ///< Bitmap data of all glyphs
+    const Font_Glyph   *glyph;      ///< Glyph information (first to last)
+    uint16_t            first;      ///< First character
+    uint16_t            last;       ///< Last character
+    uint8_t             bpp;        ///< Bits per pixel (1, 4 or 8)
+    uint8_t             height;     ///< Line height
+    uint8_t             ascent;     ///< Distance from top of line to baseline
+} Font_Info;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t    hits;
+    uint32_t    misses;
+} Font_CacheStatistics;
+
+int  Font_DrawChar(const LCD_Surface *s, const Font_Info *f, int x, int y, int c, unsigned color);
+int  Font_DrawString(const LCD_Surface *s, const Font_Info *f, int x, int y, const char *str,
+                     unsigned color);
+int  Font_GetCharWidth(const Font_Info *f, int c);
+int  Font_GetStringWidth(const Font_Info *f, const char *str);
+void Font_FlushCache(void);
+void Font_GetCacheStatistics(Font_CacheStatistics *st);
+
+#endif
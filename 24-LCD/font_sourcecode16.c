@@ -0,0 +1,371 @@
+/**
+ * @file    font_sourcecode16.c
+ *
+ * @note    Generated by mkfont from SourceCodePro-Regular.ttf. Do not edit
+ */
+
+#include "font.h"
+
+static const uint8_t font_sourcecode16_bitmap[] = {
+    0x90,0x05,0xC0,0x06,0xC0,0x06,0xB0,0x05,0xB0,0x05,0xA0,0x04,0xA0,0x04,0x30,0x01,
+    0x30,0x01,0xF4,0x0D,0xF3,0x0C,0x20,0x01,0xDD,0x30,0x8F,0xCD,0x30,0x7F,0xBC,0x20,
+    0x6F,0x9A,0x00,0x4F,0x89,0x00,0x3E,0x23,0x00,0x15,0x00,0x23,0x30,0x02,0x00,0x48,
+    0x90,0x04,0x00,0x2A,0xB0,0x02,0x82,0x8D,0xE8,0x28,0x72,0x7E,0xE7,0x27,0x10,0x0C,
+    0xC1,0x00,0x52,0x3B,0xB5,0x03,0xD7,0xBD,0xDD,0x0B,0x70,0x06,0x67,0x00,0x80,0x05,
+    0x49,0x00,0xA0,0x03,0x3A,0x00,0x00,0x80,0x05,0x00,0x00,0x90,0x06,0x00,0x20,0xEA,
+    0x9D,0x02,0xD0,0x3A,0x94,0x0A,0xF2,0x02,0x00,0x00,0xD0,0x3B,0x00,0x00,0x20,0xFA,
+    0x5C,0x00,0x00,0x20,0xE8,0x0A,0x00,0x00,0x40,0x2F,0x63,0x00,0x40,0x1F,0xD4,0xAD,
+    0xEA,0x07,0x00,0xB4,0x29,0x00,0x00,0x90,0x06,0x00,0x00,0x70,0x04,0x00,0x20,0x35,
+    0x00,0x00,0x00,0xD2,0xB7,0x06,0x20,0x0B,0x87,0x20,0x0C,0xC1,0x06,0x78,0x20,0x0D,
+    0x7A,0x00,0xB5,0x60,0x1A,0x06,0x00,0x70,0xAC,0x01,0x00,0x00,0x00,0x10,0x80,0xDC,
+    0x06,0x00,0x95,0xD2,0x10,0x1E,0x50,0x1C,0xB4,0x00,0x2C,0xD4,0x02,0xD2,0x10,0x1E,
+    0x31,0x00,0x90,0xCB,0x07,0x00,0x00,0x00,0x22,0x00,0x00,0x81,0x4A,0x00,0x00,0x00,
+    0x9B,0xE5,0x02,0x00,0x10,0x2F,0xC0,0x04,0x00,0x00,0x3F,0xE4,0x01,0x00,0x00,0xBA,
+    0x3D,0x00,0x00,0x00,0xFA,0x04,0x20,0x0A,0xA0,0xAB,0x0B,0x70,0x0B,0xF3,0x12,0x9D,
+    0xD0,0x05,0xF5,0x00,0xD2,0xCD,0x00,0xE1,0x07,0x80,0xCF,0x03,0x50,0xEE,0xCE,0x83,
+    0x1E,0x00,0x30,0x02,0x00,0x01,0xF1,0x0A,0xF1,0x0A,0xE0,0x09,0xD0,0x07,0xB0,0x05,
+    0x40,0x02,0x00,0x50,0x03,0x00,0xD5,0x02,0x30,0x3E,0x00,0xB0,0x07,0x00,0xF3,0x01,
+    0x00,0xB7,0x00,0x00,0x99,0x00,0x00,0x8A,0x00,0x00,0x89,0x00,0x00,0xB7,0x00,0x00,
+    0xE3,0x01,0x00,0xC0,0x07,0x00,0x30,0x2E,0x00,0x00,0xD7,0x02,0x00,0x70,0x04,0x70,
+    0x02,0x00,0x70,0x1D,0x00,0x00,0xB8,0x00,0x00,0xD0,0x05,0x00,0x70,0x0C,0x00,0x20,
+    0x1F,0x00,0x00,0x3F,0x00,0x00,0x4E,0x00,0x00,0x3E,0x00,0x20,0x1F,0x00,0x60,0x0C,
+    0x00,0xC0,0x06,0x00,0xC7,0x00,0x60,0x2E,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,
+    0x00,0xA0,0x04,0x00,0x76,0xA2,0x45,0x19,0x71,0xFD,0xBF,0x05,0x00,0xE5,0x1D,0x00,
+    0x10,0x3D,0x99,0x00,0x80,0x06,0xC0,0x03,0x10,0x00,0x10,0x00,0x00,0xA0,0x04,0x00,
+    0x00,0xB0,0x05,0x00,0x00,0xB0,0x05,0x00,0xB7,0xEB,0xBC,0x3B,0x32,0xC3,0x37,0x13,
+    0x00,0xB0,0x05,0x00,0x00,0xB0,0x05,0x00,0x00,0x30,0x02,0x00,0x60,0x05,0xF5,0x2F,
+    0xD2,0x5F,0x00,0x3E,0x60,0x0D,0xD8,0x02,0x13,0x00,0xB7,0xBB,0xBB,0x3B,0x32,0x33,
+    0x33,0x13,0x70,0x04,0xF6,0x1F,0xF5,0x0D,0x20,0x01,0x00,0x00,0x10,0x05,0x00,0x00,
+    0x70,0x0A,0x00,0x00,0xD0,0x05,0x00,0x00,0xE4,0x00,0x00,0x00,0x89,0x00,0x00,0x10,
+    0x3E,0x00,0x00,0x60,0x0C,0x00,0x00,0xB0,0x06,0x00,0x00,0xF2,0x01,0x00,0x00,0xA8,
+    0x00,0x00,0x00,0x4D,0x00,0x00,0x40,0x0E,0x00,0x00,0xA0,0x08,0x00,0x00,0xE1,0x03,
+    0x00,0x00,0x73,0x00,0x00,0x00,0x00,0x52,0x15,0x00,0x70,0xBE,0xDC,0x03,0xF3,0x03,
+    0x90,0x0C,0xA9,0x00,0x10,0x3F,0x7C,0x30,0x01,0x6D,0x6D,0xF2,0x0B,0x7C,0x6D,0xB1,
+    0x07,0x7C,0x7B,0x00,0x00,0x5D,0xB8,0x00,0x20,0x2F,0xE2,0x06,0xB1,0x0A,0x40,0xEE,
+    0xBE,0x01,0x00,0x30,0x02,0x00,0x00,0x10,0x02,0x00,0x60,0xFB,0x0C,0x00,0x40,0xB6,
+    0x0C,0x00,0x00,0x80,0x0C,0x00,0x00,0x80,0x0C,0x00,0x00,0x80,0x0C,0x00,0x00,0x80,
+    0x0C,0x00,0x00,0x80,0x0C,0x00,0x00,0x80,0x0C,0x00,0x10,0x81,0x1C,0x01,0xF6,0xFF,
+    0xFF,0x7F,0x00,0x64,0x04,0x00,0xD4,0xAC,0xCD,0x01,0x58,0x00,0xC1,0x09,0x00,0x00,
+    0x70,0x0C,0x00,0x00,0x90,0x0A,0x00,0x00,0xF3,0x03,0x00,0x10,0x8D,0x00,0x00,0xC1,
+    0x0A,0x00,0x20,0xAC,0x00,0x00,0xD2,0x2A,0x22,0x12,0xFC,0xFF,0xFF,0x5F,0x00,0x40,
+    0x56,0x01,0x00,0x40,0xDD,0xDA,0x4E,0x00,0x30,0x05,0x00,0xCA,0x00,0x00,0x00,0x00,
+    0xD7,0x00,0x00,0x00,0x30,0x7D,0x00,0x00,0x90,0xFE,0x06,0x00,0x00,0x20,0x74,0x7E,
+    0x00,0x00,0x00,0x00,0xF3,0x02,0x00,0x00,0x00,0xF1,0x04,0xC0,0x17,0x10,0xEA,0x01,
+    0x40,0xFC,0xFE,0x3C,0x00,0x00,0x10,0x23,0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,
+    0x00,0xC0,0x2F,0x00,0x00,0x00,0xB9,0x2F,0x00,0x00,0x60,0x2D,0x2F,0x00,0x00,0xE3,
+    0x23,0x2F,0x00,0x10,0x6D,0x20,0x2F,0x00,0xB0,0x09,0x20,0x2F,0x00,0xF5,0xDD,0xDD,
+    0xDF,0x09,0x31,0x33,0x43,0x4F,0x02,0x00,0x00,0x20,0x2F,0x00,0x00,0x00,0x20,0x2F,
+    0x00,0x00,0x33,0x33,0x23,0x00,0x00,0xEF,0xEE,0xCE,0x00,0x10,0x3F,0x00,0x00,0x00,
+    0x20,0x1F,0x00,0x00,0x00,0x30,0x4F,0x66,0x02,0x00,0x30,0xAF,0xA8,0x7F,0x00,0x00,
+    0x01,0x00,0xF5,0x02,0x00,0x00,0x00,0xF0,0x05,0x00,0x00,0x00,0xF2,0x04,0xC0,0x06,
+    0x20,0xDB,0x00,0x40,0xFC,0xFE,0x2B,0x00,0x00,0x10,0x13,0x00,0x00,0x00,0x40,0x46,
+    0x00,0x20,0xDD,0xDB,0x2D,0xD0,0x09,0x00,0x04,0xE5,0x00,0x00,0x00,0x99,0x20,0x14,
+    0x00,0x9B,0xDA,0xFC,0x08,0xEB,0x04,0x30,0x4F,0x9A,0x00,0x00,0x8B,0xC7,0x00,0x00,
+    0x7C,0xE1,0x07,0x50,0x2F,0x30,0xEC,0xDE,0x04,0x00,0x20,0x02,0x00,0x32,0x33,0x33,
+    0x13,0xEC,0xEE,0xEE,0x7F,0x00,0x00,0x70,0x0B,0x00,0x00,0xE3,0x02,0x00,0x00,0x7C,
+    0x00,0x00,0x40,0x1E,0x00,0x00,0xA0,0x09,0x00,0x00,0xE0,0x05,0x00,0x00,0xF2,0x03,
+    0x00,0x00,0xF4,0x01,0x00,0x00,0xF5,0x00,0x00,0x00,0x52,0x25,0x00,0x80,0x9E,0xEA,
+    0x05,0xF2,0x02,0x50,0x0E,0xE4,0x00,0x20,0x0F,0xD0,0x19,0x70,0x0A,0x20,0xEE,0xCA,
+    0x01,0xC2,0x36,0xE8,0x08,0x7B,0x00,0x20,0x5E,0x5D,0x00,0x00,0x7C,0xC9,0x01,0x40,
+    0x4F,0xA1,0xCE,0xED,0x06,0x00,0x31,0x02,0x00,0x00,0x64,0x04,0x00,0xC1,0xAD,0xCD,
+    0x01,0xB9,0x00,0xA0,0x0B,0x5D,0x00,0x20,0x2F,0x6D,0x00,0x00,0x5E,0xD9,0x02,0xB3,
+    0x6F,0x91,0xEE,0x4C,0x5E,0x00,0x00,0x10,0x3F,0x00,0x00,0x70,0x0D,0x53,0x00,0xE5,
+    0x05,0xD4,0xEE,0x6E,0x00,0x00,0x22,0x00,0x00,0x30,0x01,0xF5,0x0E,0xF6,0x1F,0x60,
+    0x04,0x00,0x00,0x00,0x00,0x70,0x04,0xF6,0x1F,0xF5,0x0D,0x20,0x01,0x30,0x01,0xF5,
+    0x0E,0xF6,0x1F,0x60,0x04,0x00,0x00,0x00,0x00,0x60,0x05,0xF5,0x2F,0xD2,0x5F,0x00,
+    0x3E,0x60,0x0D,0xD8,0x02,0x13,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0xD4,0x09,0x00,
+    0x81,0x5E,0x00,0x30,0xAD,0x01,0x00,0xF1,0x07,0x00,0x00,0x90,0x5E,0x00,0x00,0x00,
+    0xD4,0x1A,0x00,0x00,0x10,0xD9,0x04,0x00,0x00,0x40,0x0C,0x00,0x00,0x00,0x01,0x85,
+    0x88,0x88,0x28,0x85,0x88,0x88,0x28,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x01,0xE9,
+    0xEE,0xEE,0x3E,0x53,0x00,0x00,0x00,0xD2,0x1A,0x00,0x00,0x10,0xD9,0x04,0x00,0x00,
+    0x40,0x9D,0x01,0x00,0x00,0xC1,0x0A,0x00,0x10,0xE9,0x04,0x00,0xD4,0x1A,0x00,0x81,
+    0x5E,0x00,0x00,0xA4,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0xEB,0x7C,0x00,0xD1,
+    0x37,0xE6,0x06,0x00,0x00,0xA0,0x0A,0x00,0x00,0xD0,0x06,0x00,0x10,0xAB,0x00,0x00,
+    0xA0,0x0A,0x00,0x00,0xF2,0x02,0x00,0x00,0x51,0x00,0x00,0x00,0x30,0x01,0x00,0x00,
+    0xF7,0x0A,0x00,0x00,0xF7,0x09,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x21,0x01,0x00,
+    0x00,0xA2,0xBD,0x7D,0x00,0x10,0x7D,0x00,0xC1,0x04,0x80,0x09,0x00,0x50,0x09,0xE0,
+    0x02,0x00,0x51,0x0B,0xE2,0x00,0xB4,0xCC,0x0B,0xC3,0x30,0x3E,0x40,0x0B,0xC3,0x60,
+    0x0A,0x50,0x0B,0xE2,0x30,0x6E,0xB7,0x0B,0xD0,0x02,0x84,0x16,0x04,0x80,0x08,0x00,
+    0x00,0x00,0x10,0x5D,0x00,0x10,0x00,0x00,0xC2,0x9B,0xCB,0x01,0x00,0x00,0x53,0x03,
+    0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x40,0xDE,0x00,0x00,0x00,0x90,0xE8,0x03,0x00,
+    0x00,0xE0,0xA3,0x08,0x00,0x00,0xD4,0x50,0x0D,0x00,0x00,0x9A,0x10,0x4F,0x00,0x00,
+    0x7E,0x44,0x9C,0x00,0x50,0xCF,0xCC,0xED,0x00,0xA0,0x0A,0x00,0xF2,0x04,0xE1,0x05,
+    0x00,0xC0,0x09,0xF5,0x01,0x00,0x70,0x0E,0x83,0x88,0x36,0x00,0xF5,0x88,0xFA,0x08,
+    0xF5,0x00,0x50,0x1F,0xF5,0x00,0x30,0x1F,0xF5,0x00,0xB2,0x09,0xF5,0xFF,0xCF,0x03,
+    0xF5,0x00,0x51,0x4E,0xF5,0x00,0x00,0xAA,0xF5,0x00,0x00,0xAA,0xF5,0x11,0x72,0x4F,
+    0xF5,0xFF,0xBE,0x04,0x00,0x82,0x9A,0x04,0x50,0xBF,0x98,0x5E,0xF2,0x07,0x00,0x12,
+    0xD9,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,
+    0xAB,0x00,0x00,0x00,0xF6,0x02,0x00,0x00,0xC0,0x4D,0x10,0x99,0x10,0xFA,0xFF,0x2B,
+    0x00,0x10,0x23,0x00,0x85,0x78,0x05,0x00,0xDA,0xA9,0xDD,0x03,0xAA,0x00,0xA0,0x1E,
+    0xAA,0x00,0x10,0x7E,0xAA,0x00,0x00,0xAA,0xAA,0x00,0x00,0xC9,0xAA,0x00,0x00,0xBA,
+    0xAA,0x00,0x00,0x9C,0xAA,0x00,0x40,0x4F,0xBA,0x21,0xE6,0x09,0xFA,0xFF,0x6C,0x00,
+    0x81,0x88,0x88,0x28,0xF2,0x9A,0x99,0x39,0xF2,0x03,0x00,0x00,0xF2,0x03,0x00,0x00,
+    0xF2,0x14,0x11,0x00,0xF2,0xFF,0xFF,0x08,0xF2,0x14,0x11,0x00,0xF2,0x03,0x00,0x00,
+    0xF2,0x03,0x00,0x00,0xF2,0x24,0x22,0x12,0xF2,0xFF,0xFF,0x7F,0x86,0x88,0x88,0x04,
+    0xCD,0x99,0x99,0x05,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,
+    0xED,0xCC,0xAC,0x00,0xAD,0x55,0x45,0x00,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,
+    0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x40,0xA9,0x28,0x00,0x00,0xF8,0x8A,
+    0xEA,0x03,0x50,0x4F,0x00,0x30,0x00,0xC0,0x0A,0x00,0x00,0x00,0xF1,0x05,0x00,0x00,
+    0x00,0xF2,0x04,0x50,0x77,0x03,0xF2,0x04,0x80,0xEA,0x08,0xE0,0x07,0x00,0xB0,0x08,
+    0xA0,0x0D,0x00,0xB0,0x08,0x20,0xAE,0x02,0xD2,0x08,0x00,0xC3,0xFF,0xAF,0x02,0x00,
+    0x00,0x32,0x01,0x00,0x56,0x00,0x00,0x38,0x9B,0x00,0x00,0x5F,0x9B,0x00,0x00,0x5F,
+    0x9B,0x00,0x00,0x5F,0xAB,0x22,0x22,0x5F,0xFB,0xFF,0xFF,0x5F,0x9B,0x11,0x11,0x5F,
+    0x9B,0x00,0x00,0x5F,0x9B,0x00,0x00,0x5F,0x9B,0x00,0x00,0x5F,0x9B,0x00,0x00,0x5F,
+    0x84,0x88,0x88,0x18,0x95,0xE9,0x9C,0x19,0x00,0xD0,0x07,0x00,0x00,0xD0,0x07,0x00,
+    0x00,0xD0,0x07,0x00,0x00,0xD0,0x07,0x00,0x00,0xD0,0x07,0x00,0x00,0xD0,0x07,0x00,
+    0x00,0xD0,0x07,0x00,0x21,0xD2,0x28,0x02,0xF7,0xFF,0xFF,0x1F,0x60,0x88,0x88,0x07,
+    0x80,0x99,0xC9,0x0D,0x00,0x00,0x70,0x0D,0x00,0x00,0x70,0x0D,0x00,0x00,0x70,0x0D,
+    0x00,0x00,0x70,0x0D,0x00,0x00,0x70,0x0D,0x00,0x00,0x70,0x0D,0x10,0x00,0x80,0x0C,
+    0xC7,0x03,0xE3,0x08,0xA1,0xFF,0xAF,0x01,0x00,0x31,0x01,0x00,0x73,0x00,0x00,0x56,
+    0x00,0xE6,0x00,0x70,0x2E,0x00,0xE6,0x00,0xF5,0x04,0x00,0xE6,0x30,0x6E,0x00,0x00,
+    0xE6,0xD1,0x0B,0x00,0x00,0xE6,0xDC,0x2F,0x00,0x00,0xF6,0x1D,0xBB,0x00,0x00,0xE6,
+    0x02,0xF3,0x04,0x00,0xE6,0x00,0x90,0x0C,0x00,0xE6,0x00,0x20,0x6E,0x00,0xE6,0x00,
+    0x00,0xE8,0x01,0x36,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,
+    0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x7D,
+    0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x8D,0x22,0x22,0x01,0xFD,0xFF,0xFF,0x0A,0x65,
+    0x00,0x20,0x28,0xFB,0x02,0x70,0x5F,0xCB,0x07,0xC0,0x5C,0x8B,0x0C,0xC2,0x5C,0x6B,
+    0x2D,0x77,0x5C,0x6B,0x68,0x2C,0x5C,0x6B,0xC2,0x0B,0x5C,0x6B,0xC0,0x06,0x5C,0x6B,
+    0x10,0x00,0x5C,0x6B,0x00,0x00,0x5C,0x6B,0x00,0x00,0x5C,0x65,0x00,0x00,0x27,0xFA,
+    0x03,0x00,0x4F,0xDA,0x0B,0x00,0x4F,0x8A,0x3D,0x00,0x4F,0x8A,0xB6,0x00,0x4F,0x9A,
+    0xD0,0x04,0x4F,0x9A,0x60,0x0C,0x4F,0x9A,0x00,0x4D,0x4E,0x9A,0x00,0xC6,0x4D,0x9A,
+    0x00,0xD0,0x4F,0x9A,0x00,0x50,0x4F,0x00,0x71,0x9A,0x04,0x00,0x10,0xDC,0x98,0x7F,
+    0x00,0x80,0x1D,0x00,0xF6,0x02,0xE0,0x07,0x00,0xD0,0x08,0xF2,0x04,0x00,0xA0,0x0B,
+    0xF3,0x02,0x00,0x80,0x0C,0xF3,0x03,0x00,0x90,0x0C,0xF1,0x05,0x00,0xB0,0x0A,0xB0,
+    0x0A,0x00,0xF2,0x05,0x40,0x7F,0x20,0xCC,0x00,0x00,0xE5,0xFF,0x2B,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x83,0x88,0x57,0x00,0xF6,0x88,0xDA,0x2D,0xE6,0x00,0x10,0x8D,0xE6,
+    0x00,0x00,0xB9,0xE6,0x00,0x00,0x9C,0xF6,0x44,0xA5,0x3E,0xF6,0xCC,0x9C,0x02,0xE6,
+    0x00,0x00,0x00,0xE6,0x00,0x00,0x00,0xE6,0x00,0x00,0x00,0xE6,0x00,0x00,0x00,0x00,
+    0x71,0x9A,0x04,0x00,0x10,0xDC,0x97,0x7F,0x00,0x80,0x1D,0x00,0xF6,0x02,0xE0,0x07,
+    0x00,0xD0,0x07,0xF2,0x03,0x00,0xA0,0x0A,0xF3,0x02,0x00,0x90,0x0B,0xF3,0x03,0x00,
+    0x90,0x0B,0xF1,0x05,0x00,0xC0,0x09,0xB0,0x0A,0x00,0xF2,0x04,0x40,0x7F,0x20,0xCC,
+    0x00,0x00,0xE5,0xFF,0x1B,0x00,0x00,0x00,0xCB,0x00,0x00,0x00,0x00,0xD2,0x8D,0x06,
+    0x00,0x00,0x10,0x97,0x06,0x83,0x88,0x47,0x00,0xF6,0x88,0xEA,0x1C,0xE6,0x00,0x10,
+    0x6E,0xE6,0x00,0x00,0x8C,0xE6,0x00,0x20,0x6E,0xE6,0x88,0xE9,0x0B,0xF6,0x98,0x8F,
+    0x00,0xE6,0x00,0xCA,0x00,0xE6,0x00,0xF2,0x06,0xE6,0x00,0x80,0x1E,0xE6,0x00,0x10,
+    0x8E,0x10,0xA6,0x7A,0x01,0xC0,0x8D,0xC8,0x1D,0xF5,0x01,0x00,0x03,0xF6,0x01,0x00,
+    0x00,0xD1,0x6D,0x00,0x00,0x20,0xFA,0x7E,0x01,0x00,0x20,0xE8,0x1D,0x00,0x00,0x20,
+    0x7E,0x01,0x00,0x00,0x8C,0xBA,0x04,0x60,0x4F,0xA2,0xFF,0xEF,0x06,0x00,0x31,0x02,
+    0x00,0x82,0x88,0x88,0x88,0x07,0x93,0x99,0xCE,0x99,0x09,0x00,0x00,0x7D,0x00,0x00,
+    0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,
+    0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x00,
+    0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x56,0x00,0x00,0x37,0x9B,0x00,0x00,0x5E,
+    0x9B,0x00,0x00,0x5E,0x9B,0x00,0x00,0x5E,0x9B,0x00,0x00,0x5E,0x9B,0x00,0x00,0x5E,
+    0x9B,0x00,0x00,0x5E,0x9B,0x00,0x00,0x5F,0xC9,0x00,0x20,0x3F,0xF3,0x07,0xB1,0x0C,
+    0x60,0xFE,0xDF,0x02,0x00,0x31,0x02,0x00,0x82,0x01,0x00,0x40,0x06,0xE1,0x06,0x00,
+    0xB0,0x09,0xA0,0x0A,0x00,0xF1,0x04,0x50,0x1E,0x00,0xE5,0x00,0x10,0x4F,0x00,0xA9,
+    0x00,0x00,0x9B,0x00,0x5E,0x00,0x00,0xD6,0x30,0x1E,0x00,0x00,0xF1,0x73,0x0A,0x00,
+    0x00,0xB0,0xC7,0x06,0x00,0x00,0x70,0xFD,0x01,0x00,0x00,0x20,0xBF,0x00,0x00,0x46,
+    0x00,0x00,0x00,0x36,0x9A,0x00,0x00,0x00,0x4E,0xB8,0x00,0x00,0x10,0x2F,0xD6,0x00,
+    0x59,0x30,0x0F,0xF3,0x00,0xAE,0x50,0x0D,0xF1,0x42,0xEA,0x60,0x0B,0xE0,0x84,0xC6,
+    0x84,0x08,0xB0,0xC5,0x82,0xA8,0x06,0x90,0xD8,0x40,0xBC,0x04,0x70,0x9D,0x00,0xDE,
+    0x02,0x50,0x5F,0x00,0xEB,0x00,0x60,0x05,0x00,0x70,0x03,0x50,0x2F,0x00,0xE6,0x01,
+    0x00,0xAC,0x10,0x6E,0x00,0x00,0xF3,0x73,0x0C,0x00,0x00,0x90,0xEC,0x04,0x00,0x00,
+    0x20,0xBF,0x00,0x00,0x00,0x80,0xFD,0x02,0x00,0x00,0xF2,0xA3,0x0A,0x00,0x00,0xAA,
+    0x20,0x4F,0x00,0x40,0x2F,0x00,0xD9,0x00,0xC0,0x08,0x00,0xE1,0x07,0x82,0x01,0x00,
+    0x40,0x06,0xD0,0x08,0x00,0xD0,0x07,0x50,0x1E,0x00,0xE5,0x01,0x00,0x8C,0x00,0x6D,
+    0x00,0x00,0xE5,0x51,0x0D,0x00,0x00,0xC0,0xD8,0x06,0x00,0x00,0x40,0xDF,0x00,0x00,
+    0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x7D,0x00,0x00,0x00,
+    0x00,0x7D,0x00,0x00,0x83,0x88,0x88,0x48,0x94,0x99,0xB9,0x6F,0x00,0x00,0xA0,0x0B,
+    0x00,0x00,0xE6,0x01,0x00,0x20,0x5E,0x00,0x00,0xB0,0x0A,0x00,0x00,0xD6,0x01,0x00,
+    0x20,0x4E,0x00,0x00,0xC0,0x09,0x00,0x00,0xE7,0x23,0x22,0x12,0xFE,0xFF,0xFF,0x9F,
+    0x52,0x55,0x05,0xC6,0x77,0x07,0xA6,0x00,0x00,0xA6,0x00,0x00,0xA6,0x00,0x00,0xA6,
+    0x00,0x00,0xA6,0x00,0x00,0xA6,0x00,0x00,0xA6,0x00,0x00,0xA6,0x00,0x00,0xA6,0x00,
+    0x00,0xA6,0x00,0x00,0xA6,0x00,0x00,0xB6,0x55,0x05,0x73,0x77,0x07,0x52,0x00,0x00,
+    0x00,0xF2,0x02,0x00,0x00,0xB0,0x07,0x00,0x00,0x50,0x0D,0x00,0x00,0x00,0x3E,0x00,
+    0x00,0x00,0x99,0x00,0x00,0x00,0xE3,0x01,0x00,0x00,0xC0,0x05,0x00,0x00,0x70,0x0B,
+    0x00,0x00,0x10,0x2F,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0xD5,0x00,0x00,0x00,0xE0,
+    0x04,0x00,0x00,0x90,0x09,0x00,0x00,0x20,0x08,0x52,0x55,0x05,0x73,0x77,0x0F,0x00,
+    0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,
+    0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,0x00,0x10,0x0F,
+    0x52,0x55,0x0F,0x73,0x77,0x07,0x00,0xA0,0x06,0x00,0x00,0xD4,0x0D,0x00,0x00,0x6A,
+    0x4C,0x00,0x10,0x1E,0xA7,0x00,0x70,0x0A,0xE1,0x01,0xD0,0x04,0xA0,0x07,0x61,0x00,
+    0x30,0x05,0xD1,0xDD,0xDD,0xDD,0x08,0x40,0x44,0x44,0x44,0x02,0x70,0x05,0x40,0x1E,
+    0x00,0x76,0x50,0xEB,0xBE,0x02,0xC2,0x26,0xB3,0x0D,0x00,0x00,0x30,0x3F,0x10,0x95,
+    0xDC,0x4F,0xD2,0x4A,0x11,0x4F,0xAA,0x00,0x10,0x4F,0xC9,0x01,0xA2,0x4F,0xD2,0xDE,
+    0x4D,0x4D,0x00,0x22,0x00,0x00,0x53,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC8,0x00,
+    0x00,0x00,0xC8,0x00,0x00,0x00,0xC8,0xC5,0xCE,0x04,0xF8,0x4B,0xA3,0x2E,0xD8,0x00,
+    0x00,0x7E,0xC8,0x00,0x00,0x9B,0xC8,0x00,0x00,0x9B,0xC8,0x00,0x10,0x6E,0xE8,0x05,
+    0xA1,0x1E,0xA8,0xEA,0xDF,0x03,0x00,0x20,0x02,0x00,0x10,0xD8,0xDE,0x08,0xC0,0x5D,
+    0x42,0x3B,0xE6,0x02,0x00,0x00,0xBA,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0xE8,0x01,
+    0x00,0x00,0xE2,0x2A,0x10,0x47,0x30,0xFB,0xFE,0x2B,0x00,0x10,0x13,0x00,0x00,0x00,
+    0x00,0x61,0x01,0x00,0x00,0x00,0xF3,0x02,0x00,0x00,0x00,0xF3,0x02,0x00,0x00,0x00,
+    0xF3,0x02,0x00,0xC4,0xCE,0xF6,0x02,0x40,0x8F,0x42,0xFC,0x02,0xB0,0x0A,0x00,0xF3,
+    0x02,0xF0,0x06,0x00,0xF3,0x02,0xF0,0x05,0x00,0xF3,0x02,0xD0,0x08,0x00,0xF3,0x02,
+    0x80,0x3E,0x20,0xFB,0x02,0x00,0xFA,0xDE,0xF5,0x02,0x00,0x10,0x03,0x00,0x00,0x20,
+    0xEA,0xBE,0x02,0xD1,0x29,0x82,0x1E,0xC9,0x00,0x00,0x7C,0xBD,0x88,0x88,0x9C,0xBD,
+    0x77,0x77,0x47,0xBA,0x00,0x00,0x00,0xF3,0x07,0x10,0x06,0x40,0xED,0xED,0x1A,0x00,
+    0x20,0x13,0x00,0x00,0x00,0x85,0x68,0x01,0x00,0x80,0x9E,0xA8,0x01,0x00,0xE0,0x06,
+    0x00,0x00,0x00,0xF2,0x03,0x00,0x00,0xB4,0xFC,0xBC,0x5B,0x00,0x52,0xF6,0x56,0x25,
+    0x00,0x00,0xF2,0x03,0x00,0x00,0x00,0xF2,0x03,0x00,0x00,0x00,0xF2,0x03,0x00,0x00,
+    0x00,0xF2,0x03,0x00,0x00,0x00,0xF2,0x03,0x00,0x00,0x00,0xF2,0x03,0x00,0x00,0x30,
+    0xEB,0xBD,0xBB,0x00,0xE1,0x07,0xE3,0x46,0x00,0xE6,0x00,0x90,0x09,0x00,0xE5,0x01,
+    0xA0,0x09,0x00,0xB0,0x6B,0xE9,0x02,0x00,0xD2,0x86,0x16,0x00,0x00,0xD5,0x01,0x00,
+    0x00,0x00,0xD1,0xEF,0xEE,0x6C,0x00,0xA7,0x21,0x22,0xF8,0x00,0x5C,0x00,0x00,0xE6,
+    0x00,0xE7,0x57,0x96,0x4E,0x00,0x30,0x87,0x58,0x01,0x00,0x53,0x00,0x00,0x00,0xC8,
+    0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC8,0xB3,0xDE,0x05,0xD8,
+    0x5C,0x93,0x2F,0xD8,0x01,0x10,0x5F,0xC8,0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0xC8,
+    0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0x00,0x10,0x15,0x00,0x70,
+    0x9F,0x00,0x20,0x39,0x00,0x00,0x00,0xB6,0xBB,0x4B,0x53,0x55,0x6E,0x00,0x00,0x6E,
+    0x00,0x00,0x6E,0x00,0x00,0x6E,0x00,0x00,0x6E,0x00,0x00,0x6E,0x00,0x00,0x6E,0x00,
+    0x00,0x51,0x01,0x00,0x00,0xF7,0x09,0x00,0x00,0x92,0x03,0x00,0x00,0x00,0x00,0x60,
+    0xBB,0xBB,0x04,0x30,0x55,0xE5,0x06,0x00,0x00,0xE0,0x06,0x00,0x00,0xE0,0x06,0x00,
+    0x00,0xE0,0x06,0x00,0x00,0xE0,0x06,0x00,0x00,0xE0,0x06,0x00,0x00,0xE0,0x06,0x00,
+    0x00,0xE0,0x05,0x00,0x00,0xF3,0x03,0xC0,0xAA,0xAE,0x00,0x30,0x76,0x04,0x00,0x62,
+    0x00,0x00,0x00,0x00,0xF5,0x00,0x00,0x00,0x00,0xF5,0x00,0x00,0x00,0x00,0xF5,0x00,
+    0x00,0x00,0x00,0xF5,0x00,0x20,0x4B,0x00,0xF5,0x00,0xD2,0x07,0x00,0xF5,0x20,0x7E,
+    0x00,0x00,0xF5,0xE3,0x0D,0x00,0x00,0xF5,0x7E,0x8C,0x00,0x00,0xF5,0x06,0xE3,0x05,
+    0x00,0xF5,0x00,0x60,0x2E,0x00,0xF5,0x00,0x00,0xCA,0x00,0x64,0x66,0x01,0x00,0xA7,
+    0xFB,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,
+    0xF1,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,0xF1,0x04,0x00,0x00,
+    0xF1,0x04,0x00,0x00,0xE0,0x08,0x11,0x00,0x50,0xEF,0x6F,0x00,0x00,0x31,0x01,0xB0,
+    0xE5,0x2C,0xEC,0x05,0xF1,0x3B,0xDD,0xA4,0x0C,0xF1,0x04,0x79,0x60,0x0D,0xF1,0x03,
+    0x79,0x60,0x0D,0xF1,0x03,0x79,0x60,0x0D,0xF1,0x03,0x79,0x60,0x0D,0xF1,0x03,0x79,
+    0x60,0x0D,0xF1,0x03,0x79,0x60,0x0D,0x76,0xB3,0xDE,0x05,0xD8,0x5C,0x93,0x2F,0xD8,
+    0x01,0x10,0x5F,0xC8,0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0xC8,
+    0x00,0x00,0x6E,0xC8,0x00,0x00,0x6E,0x00,0xB3,0xDE,0x19,0x00,0x30,0x8F,0x42,0xCC,
+    0x00,0xB0,0x0A,0x00,0xF2,0x05,0xF0,0x06,0x00,0xC0,0x09,0xF0,0x05,0x00,0xB0,0x09,
+    0xD0,0x09,0x00,0xE1,0x07,0x60,0x5F,0x10,0xE9,0x01,0x00,0xE7,0xFE,0x3C,0x00,0x00,
+    0x00,0x23,0x00,0x00,0x76,0xC5,0xCE,0x04,0xE8,0x4B,0xA3,0x2E,0xD8,0x00,0x00,0x7E,
+    0xC8,0x00,0x00,0x9B,0xC8,0x00,0x00,0x9B,0xC8,0x00,0x10,0x6E,0xE8,0x05,0x91,0x1E,
+    0xD8,0xEB,0xDF,0x03,0xC8,0x20,0x02,0x00,0xC8,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x00,0xC4,0xCE,0xB4,0x01,0x40,0x8F,0x42,0xFC,0x02,0xB0,0x0A,
+    0x00,0xF3,0x02,0xF0,0x06,0x00,0xF3,0x02,0xF0,0x05,0x00,0xF3,0x02,0xD0,0x08,0x00,
+    0xF3,0x02,0x80,0x3E,0x20,0xFB,0x02,0x00,0xFA,0xEE,0xF7,0x02,0x00,0x10,0x03,0xF3,
+    0x02,0x00,0x00,0x00,0xF3,0x02,0x00,0x00,0x00,0xF3,0x02,0x00,0x00,0x00,0x41,0x00,
+    0x57,0x91,0xEE,0x06,0x9A,0x8D,0x44,0x02,0xFA,0x05,0x00,0x00,0xBA,0x00,0x00,0x00,
+    0xAA,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,
+    0x50,0xEC,0xAE,0x04,0xF3,0x15,0x62,0x08,0xF5,0x02,0x00,0x00,0x90,0xAF,0x16,0x00,
+    0x00,0x62,0xFB,0x09,0x00,0x00,0x30,0x5F,0x77,0x01,0x30,0x4F,0xA3,0xDE,0xED,0x07,
+    0x00,0x31,0x02,0x00,0x00,0x97,0x00,0x00,0x00,0x99,0x00,0x00,0xB9,0xEE,0xBB,0x5B,
+    0x54,0xBC,0x55,0x25,0x00,0x9B,0x00,0x00,0x00,0x9B,0x00,0x00,0x00,0x9B,0x00,0x00,
+    0x00,0xAA,0x00,0x00,0x00,0xE7,0x02,0x10,0x00,0xB1,0xDF,0x8E,0x00,0x00,0x32,0x01,
+    0x69,0x00,0x30,0x1B,0x8C,0x00,0x30,0x1F,0x8C,0x00,0x30,0x1F,0x8C,0x00,0x30,0x1F,
+    0x8C,0x00,0x30,0x1F,0x9B,0x00,0x40,0x1F,0xE8,0x02,0xC4,0x1F,0xD2,0xEF,0x2B,0x1F,
+    0x00,0x22,0x00,0x00,0xB1,0x03,0x00,0x70,0x07,0xA0,0x0A,0x00,0xE1,0x04,0x30,0x1F,
+    0x00,0xD6,0x00,0x00,0x7C,0x00,0x6C,0x00,0x00,0xD6,0x30,0x1E,0x00,0x00,0xE1,0x94,
+    0x09,0x00,0x00,0x80,0xEA,0x03,0x00,0x00,0x20,0xCF,0x00,0x00,0x69,0x00,0x24,0x00,
+    0x4A,0xB9,0x00,0x9D,0x10,0x3F,0xE5,0x20,0xCA,0x40,0x0E,0xF2,0x62,0xD7,0x71,0x0B,
+    0xE0,0x96,0x94,0xA4,0x08,0xA0,0xC8,0x61,0xD8,0x05,0x70,0xCC,0x20,0xFC,0x02,0x40,
+    0x8F,0x00,0xDE,0x00,0xA5,0x01,0x40,0x1B,0xC0,0x09,0xD1,0x07,0x20,0x5E,0xB9,0x00,
+    0x00,0xE5,0x1E,0x00,0x00,0xE6,0x1D,0x00,0x30,0x3E,0xAB,0x00,0xD1,0x08,0xE2,0x06,
+    0xC9,0x00,0x40,0x3E,0xB1,0x03,0x00,0x70,0x07,0x90,0x0A,0x00,0xE0,0x04,0x20,0x2F,
+    0x00,0xD5,0x00,0x00,0x8A,0x00,0x7B,0x00,0x00,0xE3,0x21,0x1F,0x00,0x00,0xB0,0x76,
+    0x0A,0x00,0x00,0x40,0xDD,0x04,0x00,0x00,0x00,0xDC,0x00,0x00,0x00,0x00,0x7C,0x00,
+    0x00,0x00,0x60,0x1E,0x00,0x00,0x90,0xEC,0x04,0x00,0x00,0x40,0x14,0x00,0x00,0x00,
+    0xB3,0xBB,0xBB,0x4B,0x51,0x55,0xD5,0x1C,0x00,0x00,0xD9,0x01,0x00,0x70,0x2E,0x00,
+    0x00,0xE6,0x03,0x00,0x40,0x4F,0x00,0x00,0xE3,0x17,0x11,0x01,0xFC,0xFF,0xFF,0x8F,
+    0x00,0x00,0x52,0x05,0x00,0x80,0x7C,0x07,0x00,0xD0,0x04,0x00,0x00,0xD0,0x03,0x00,
+    0x00,0xC0,0x04,0x00,0x00,0xC0,0x05,0x00,0x00,0xE2,0x03,0x00,0xD1,0x8F,0x00,0x00,
+    0x00,0xE4,0x02,0x00,0x00,0xC0,0x05,0x00,0x00,0xC0,0x04,0x00,0x00,0xD0,0x03,0x00,
+    0x00,0xD0,0x04,0x00,0x00,0x90,0x6C,0x05,0x00,0x00,0x64,0x07,0x6C,0x6C,0x6C,0x6C,
+    0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x52,0x14,0x00,0x00,
+    0x73,0xE8,0x03,0x00,0x00,0xA0,0x07,0x00,0x00,0x90,0x07,0x00,0x00,0xA0,0x06,0x00,
+    0x00,0xA0,0x06,0x00,0x00,0x90,0x09,0x00,0x00,0x10,0xEC,0x09,0x00,0x80,0x1A,0x00,
+    0x00,0xA0,0x06,0x00,0x00,0xA0,0x06,0x00,0x00,0x90,0x07,0x00,0x00,0x90,0x07,0x00,
+    0x52,0xE7,0x03,0x00,0x73,0x26,0x00,0x00,0x30,0x26,0x00,0x13,0xD4,0xE9,0x36,0x2D,
+    0x38,0x20,0xDB,0x05,
+};
+
+static const Font_Glyph font_sourcecode16_glyph[] = {
+    {      0,   0,   0,    0,    0,  10 },     // ' '
+    {      0,   3,  12,    3,   11,  10 },     // '!'
+    {     24,   6,   6,    2,   11,  10 },     // '"'
+    {     42,   8,  11,    1,   11,  10 },     // '#'
+    {     86,   8,  14,    1,   12,  10 },     // '$'
+    {    142,  10,  12,    0,   11,  10 },     // '%'
+    {    202,  10,  12,    0,   11,  10 },     // '&'
+    {    262,   3,   6,    3,   11,  10 },     // '''
+    {    274,   5,  15,    3,   12,  10 },     // '('
+    {    319,   6,  15,    1,   12,  10 },     // ')'
+    {    364,   8,   8,    1,    9,  10 },     // '*'
+    {    396,   8,   8,    1,    9,  10 },     // '+'
+    {    428,   4,   7,    3,    3,  10 },     // ','
+    {    442,   8,   2,    1,    6,  10 },     // '-'
+    {    450,   4,   4,    3,    3,  10 },     // '.'
+    {    458,   8,  15,    1,   12,  10 },     // '/'
+    {    518,   8,  12,    1,   11,  10 },     // '0'
+    {    566,   8,  11,    1,   11,  10 },     // '1'
+    {    610,   8,  11,    1,   11,  10 },     // '2'
+    {    654,   9,  12,    0,   11,  10 },     // '3'
+    {    714,   9,  11,    0,   11,  10 },     // '4'
+    {    769,   9,  12,    0,   11,  10 },     // '5'
+    {    829,   8,  12,    1,   11,  10 },     // '6'
+    {    877,   8,  11,    1,   11,  10 },     // '7'
+    {    921,   8,  12,    1,   11,  10 },     // '8'
+    {    969,   8,  12,    1,   11,  10 },     // '9'
+    {   1017,   4,  10,    3,    9,  10 },     // ':'
+    {   1037,   4,  13,    3,    9,  10 },     // ';'
+    {   1063,   7,  10,    1,   10,  10 },     // '<'
+    {   1103,   8,   5,    1,    8,  10 },     // '='
+    {   1123,   7,  10,    1,   10,  10 },     // '>'
+    {   1163,   7,  12,    1,   11,  10 },     // '?'
+    {   1211,   9,  14,    0,   11,  10 },     // '@'
+    {   1281,  10,  11,    0,   11,  10 },     // 'A'
+    {   1336,   8,  11,    1,   11,  10 },     // 'B'
+    {   1380,   8,  12,    1,   11,  10 },     // 'C'
+    {   1428,   8,  11,    1,   11,  10 },     // 'D'
+    {   1472,   8,  11,    1,   11,  10 },     // 'E'
+    {   1516,   7,  11,    2,   11,  10 },     // 'F'
+    {   1560,   9,  12,    0,   11,  10 },     // 'G'
+    {   1620,   8,  11,    1,   11,  10 },     // 'H'
+    {   1664,   8,  11,    1,   11,  10 },     // 'I'
+    {   1708,   7,  12,    1,   11,  10 },     // 'J'
+    {   1756,   9,  11,    1,   11,  10 },     // 'K'
+    {   1811,   7,  11,    2,   11,  10 },     // 'L'
+    {   1855,   8,  11,    1,   11,  10 },     // 'M'
+    {   1899,   8,  11,    1,   11,  10 },     // 'N'
+    {   1943,   9,  12,    0,   11,  10 },     // 'O'
+    {   2003,   8,  11,    1,   11,  10 },     // 'P'
+    {   2047,   9,  14,    0,   11,  10 },     // 'Q'
+    {   2117,   8,  11,    1,   11,  10 },     // 'R'
+    {   2161,   8,  12,    1,   11,  10 },     // 'S'
+    {   2209,   9,  11,    0,   11,  10 },     // 'T'
+    {   2264,   8,  12,    1,   11,  10 },     // 'U'
+    {   2312,   9,  11,    0,   11,  10 },     // 'V'
+    {   2367,  10,  11,    0,   11,  10 },     // 'W'
+    {   2422,   9,  11,    0,   11,  10 },     // 'X'
+    {   2477,   9,  11,    0,   11,  10 },     // 'Y'
+    {   2532,   8,  11,    1,   11,  10 },     // 'Z'
+    {   2576,   6,  15,    3,   12,  10 },     // '['
+    {   2621,   8,  15,    1,   12,  10 },     // 92
+    {   2681,   5,  15,    1,   12,  10 },     // ']'
+    {   2726,   7,   7,    1,   11,  10 },     // '^'
+    {   2754,   9,   2,    0,   -1,  10 },     // '_'
+    {   2764,   4,   3,    2,   12,  10 },     // '`'
+    {   2770,   8,   9,    1,    8,  10 },     // 'a'
+    {   2806,   8,  13,    1,   12,  10 },     // 'b'
+    {   2858,   8,   9,    1,    8,  10 },     // 'c'
+    {   2894,   9,  13,    0,   12,  10 },     // 'd'
+    {   2959,   8,   9,    1,    8,  10 },     // 'e'
+    {   2995,   9,  12,    1,   12,  10 },     // 'f'
+    {   3055,   9,  12,    1,    8,  10 },     // 'g'
+    {   3115,   8,  12,    1,   12,  10 },     // 'h'
+    {   3163,   6,  12,    1,   12,  10 },     // 'i'
+    {   3199,   7,  16,    0,   12,  10 },     // 'j'
+    {   3263,   9,  12,    1,   12,  10 },     // 'k'
+    {   3323,   8,  13,    1,   12,  10 },     // 'l'
+    {   3375,   9,   8,    0,    8,  10 },     // 'm'
+    {   3415,   8,   8,    1,    8,  10 },     // 'n'
+    {   3447,   9,   9,    0,    8,  10 },     // 'o'
+    {   3492,   8,  12,    1,    8,  10 },     // 'p'
+    {   3540,   9,  12,    0,    8,  10 },     // 'q'
+    {   3600,   7,   8,    2,    8,  10 },     // 'r'
+    {   3632,   8,   9,    1,    8,  10 },     // 's'
+    {   3668,   8,  11,    1,   10,  10 },     // 't'
+    {   3712,   8,   9,    1,    8,  10 },     // 'u'
+    {   3748,   9,   8,    0,    8,  10 },     // 'v'
+    {   3788,  10,   8,    0,    8,  10 },     // 'w'
+    {   3828,   8,   8,    1,    8,  10 },     // 'x'
+    {   3860,   9,  12,    0,    8,  10 },     // 'y'
+    {   3920,   8,   8,    1,    8,  10 },     // 'z'
+    {   3952,   8,  15,    1,   12,  10 },     // '{'
+    {   4012,   2,  16,    4,   12,  10 },     // '|'
+    {   4028,   7,  15,    1,   12,  10 },     // '}'
+    {   4088,   8,   3,    1,    7,  10 },     // '~'
+};
+
+const Font_Info font_sourcecode16 = {
+    font_sourcecode16_bitmap,
+    font_sourcecode16_glyph,
+    32, 126, 4, 21, 16
+};
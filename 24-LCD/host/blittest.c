@@ -0,0 +1,347 @@
+/**
+ * @file    blittest.c
+ *
+ * @note    Host test of the scaling and rotation blits (blit.c)
+ *
+ * @note    A synthetic source image (gradients, sharp edges and varying alpha) is
+ *          converted into every format. For all pairs of formats, with palettes for L8,
+ *          AL44 and AL88, the output is compared with references made pixel by pixel:
+ *          - rotations must copy exactly the source pixel of each destination pixel
+ *          - nearest scaling must pick the source pixel containing the center of each
+ *            destination pixel mapped into the source
+ *          - bilinear scaling into ARGB8888 must differ by at most BILINEAR_MAXDIFF
+ *            from an interpolation in floating point, and into other formats it must
+ *            be the ARGB8888 result converted
+ *          The destinations are inside a larger buffer and are crossed by the images,
+ *          so the clipping is checked too. A bilinear scaling is also compared with a
+ *          golden image.
+ *
+ * @note    Then it prints the pixels per second of each mode
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -O2 -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Ihost -I. \
+ *                  -o blittest host/blittest.c host/golden.c host/lcdhost.c blit.c lcd.c \
+ *                  pixel.c -lm
+ *              ./blittest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "blit.h"
+#include "golden.h"
+
+/**
+ * @brief   Source size (odd, not a multiple of the block size)
+ */
+#define SW                  101
+#define SH                  77
+
+/**
+ * @brief   Destination and the buffer around it
+ */
+#define DW                  150
+#define DH                  120
+#define BW                  (DW+40)
+#define BH                  (DH+40)
+
+#define BILINEAR_MAXDIFF    3
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+
+static const char *formatname[] = {
+    "ARGB8888", "RGB888", "RGB565", "ARGB1555", "ARGB4444", "L8", "AL44", "AL88"
+};
+
+static uint32_t image[SW*SH];
+static uint32_t srcbuf[SW*SH];
+static uint32_t dstbuf[BW*BH],refbuf[BW*BH];
+static LCD_CLUT palette;
+
+/**
+ * @brief   Synthetic source in ARGB8888
+ */
+static void makeimage(void) {
+int x,y;
+uint32_t r,g,b,a;
+
+    for(y=0;y<SH;y++) {
+        for(x=0;x<SW;x++) {
+            r = x*255/(SW-1);
+            g = y*255/(SH-1);
+            b = ((x/8+y/8)&1) ? 230 : 20;
+            a = (x*3+y*5)&0xFF;
+            if( (x-SW/2)*(x-SW/2)+(y-SH/2)*(y-SH/2) < 20*20 ) {
+                r = 255-r;
+                a = 255;
+            }
+            image[y*SW+x] = (a<<24)|(r<<16)|(g<<8)|b;
+        }
+    }
+}
+
+/**
+ * @brief   Source in a format, at screen position (5,7)
+ */
+static void makesource(LCD_Surface *src, int format) {
+LCD_Surface argb;
+
+    LCD_InitSurface(&argb,image,LCD_FORMAT_ARGB8888,5,7,SW,SH,0);
+    LCD_InitSurface(src,srcbuf,format,5,7,SW,SH,0);
+    if( format >= LCD_FORMAT_L8 )
+        src->clut = &palette;
+    Pixel_ConvertSurface(src,5,7,&argb);
+}
+
+/**
+ * @brief   Destination at screen position (-20,10) in the middle of buf
+ */
+static void makedestination(LCD_Surface *dst, uint32_t *buf, int format) {
+int ps = LCD_GetFormatPixelSize(format);
+
+    memset(buf,0x5A,BW*BH*4);
+    LCD_InitSurface(dst,(uint8_t *) buf+20*BW*ps+20*ps,format,-20,10,DW,DH,BW*ps);
+    if( format >= LCD_FORMAT_L8 )
+        dst->clut = &palette;
+}
+
+/**
+ * @brief   Copies source pixel (sx,sy) to (X,Y) of the reference, clipped
+ */
+static void putref(const LCD_Surface *ref, int X, int Y, const LCD_Surface *src, int sx, int sy) {
+LCD_Surface one;
+
+    LCD_InitSurface(&one,LCD_GetSurfacePixelAddress(src,src->x+sx,src->y+sy),src->format,
+                    X,Y,1,1,0);
+    one.clut = src->clut;
+    Pixel_ConvertSurface(ref,X,Y,&one);
+}
+
+static void compare(const char *what, int sf, int df) {
+
+    if( memcmp(dstbuf,refbuf,sizeof(dstbuf)) != 0 ) {
+        printf("%s from %s to %s differs\n",what,formatname[sf],formatname[df]);
+        failures++;
+    }
+}
+
+static void checkrotations(const LCD_Surface *src, int df) {
+LCD_Surface dst,ref;
+int rot,ox,oy,w,h,u,v,sx,sy;
+
+    for(rot=0;rot<4;rot++) {
+        makedestination(&dst,dstbuf,df);
+        makedestination(&ref,refbuf,df);
+        ox = -30+rot*17;
+        oy = 5+rot*9;
+        CHECK(Blit_Rotate(&dst,ox,oy,src,rot) == 0);
+        w = (rot&1) ? src->h : src->w;
+        h = (rot&1) ? src->w : src->h;
+        for(v=0;v<h;v++) {
+            for(u=0;u<w;u++) {
+                switch(rot) {
+                case BLIT_ROTATE_0:     sx = u;             sy = v;             break;
+                case BLIT_ROTATE_90:    sx = v;             sy = src->h-1-u;    break;
+                case BLIT_ROTATE_180:   sx = src->w-1-u;    sy = src->h-1-v;    break;
+                default:                sx = src->w-1-v;    sy = u;             break;
+                }
+                putref(&ref,ox+u,oy+v,src,sx,sy);
+            }
+        }
+        compare(rot==0?"Rotation 0":rot==1?"Rotation 90":rot==2?"Rotation 180":"Rotation 270",
+                src->format,df);
+    }
+}
+
+static const int sizes[][2] = { { 200, 230 }, { 37, 29 }, { 101, 133 }, { 50, 66 }, { 1, 1 } };
+
+#define NSIZES  ((int) (sizeof(sizes)/sizeof(sizes[0])))
+
+static void checknearest(const LCD_Surface *src, int df) {
+LCD_Surface dst,ref;
+int k,w,h,u,v,ox = -25,oy = 3;
+
+    for(k=0;k<NSIZES;k++) {
+        w = sizes[k][0];
+        h = sizes[k][1];
+        makedestination(&dst,dstbuf,df);
+        makedestination(&ref,refbuf,df);
+        CHECK(Blit_Scale(&dst,ox,oy,w,h,src,BLIT_NEAREST) == 0);
+        for(v=0;v<h;v++) {
+            for(u=0;u<w;u++)
+                putref(&ref,ox+u,oy+v,src,(int) floor((u+0.5)*src->w/w),
+                       (int) floor((v+0.5)*src->h/h));
+        }
+        compare("Nearest",src->format,df);
+    }
+}
+
+/**
+ * @brief   Bilinear into ARGB8888 against floating point, and into the other formats
+ *          against the ARGB8888 result converted
+ */
+static void checkbilinear(const LCD_Surface *src) {
+static uint32_t out[200*230];
+LCD_Surface argb,dst,ref;
+uint32_t p00,p01,p10,p11;
+int k,w,h,u,v,c,x0,y0,x1,y1,d,df,maxd;
+double fx,fy,ax,ay,val;
+
+    for(k=0;k<NSIZES;k++) {
+        w = sizes[k][0];
+        h = sizes[k][1];
+        LCD_InitSurface(&argb,out,LCD_FORMAT_ARGB8888,0,0,w,h,0);
+        CHECK(Blit_Scale(&argb,0,0,w,h,src,BLIT_BILINEAR) == 0);
+        maxd = 0;
+        for(v=0;v<h;v++) {
+            for(u=0;u<w;u++) {
+                fx = fmin(fmax((u+0.5)*src->w/w-0.5,0),src->w-1);
+                fy = fmin(fmax((v+0.5)*src->h/h-0.5,0),src->h-1);
+                x0 = (int) fx;
+                y0 = (int) fy;
+                x1 = x0+1 < src->w ? x0+1 : x0;
+                y1 = y0+1 < src->h ? y0+1 : y0;
+                ax = fx-x0;
+                ay = fy-y0;
+                p00 = Golden_GetPixel(src,x0,y0);
+                p01 = Golden_GetPixel(src,x1,y0);
+                p10 = Golden_GetPixel(src,x0,y1);
+                p11 = Golden_GetPixel(src,x1,y1);
+                for(c=0;c<32;c+=8) {
+                    val = (((p00>>c)&0xFF)*(1-ax)+((p01>>c)&0xFF)*ax)*(1-ay)
+                        + (((p10>>c)&0xFF)*(1-ax)+((p11>>c)&0xFF)*ax)*ay;
+                    d = abs((int) ((out[v*w+u]>>c)&0xFF)-(int) lround(val));
+                    if( d > maxd )
+                        maxd = d;
+                }
+            }
+        }
+        if( maxd > BILINEAR_MAXDIFF ) {
+            printf("Bilinear %dx%d from %s: differs by %d\n",w,h,formatname[src->format],maxd);
+            failures++;
+        }
+
+        for(df=0;df<8;df++) {
+            makedestination(&dst,dstbuf,df);
+            makedestination(&ref,refbuf,df);
+            CHECK(Blit_Scale(&dst,-25,3,w,h,src,BLIT_BILINEAR) == 0);
+            Pixel_ConvertSurface(&ref,-25,3,&argb);
+            compare("Bilinear",src->format,df);
+        }
+    }
+}
+
+/**
+ * @brief   Parameters and limits
+ */
+static void checkerrors(void) {
+static uint32_t wide[2*BLIT_MAXWIDTH*2];
+LCD_Surface src,dst;
+
+    makesource(&src,LCD_FORMAT_ARGB8888);
+    makedestination(&dst,dstbuf,LCD_FORMAT_ARGB8888);
+    CHECK(Blit_Rotate(&dst,0,0,&src,4) == -1);
+    CHECK(Blit_Scale(&dst,0,0,0,10,&src,BLIT_NEAREST) == -1);
+    CHECK(Blit_Scale(&dst,0,0,10,10,&src,2) == -1);
+    /* Outside the destination: nothing to do */
+    CHECK(Blit_Scale(&dst,1000,0,10,10,&src,BLIT_BILINEAR) == 0);
+    CHECK(Blit_Rotate(&dst,0,-1000,&src,BLIT_ROTATE_90) == 0);
+    /* More than BLIT_MAXWIDTH source columns used by a bilinear scaling */
+    LCD_InitSurface(&src,wide,LCD_FORMAT_ARGB8888,0,0,2*BLIT_MAXWIDTH,2,0);
+    CHECK(Blit_Scale(&dst,0,20,100,2,&src,BLIT_BILINEAR) == -1);
+    CHECK(Blit_Scale(&dst,0,20,100,2,&src,BLIT_NEAREST) == 0);
+}
+
+/**
+ * @brief   Pixels per second of each mode for a 272x272 source
+ */
+static void benchmark(void) {
+static uint32_t sbuf[480*272],dbuf[480*272];
+static const int formats[][2] = {
+    { LCD_FORMAT_ARGB8888, LCD_FORMAT_ARGB8888 },
+    { LCD_FORMAT_RGB565,   LCD_FORMAT_RGB565   },
+    { LCD_FORMAT_RGB888,   LCD_FORMAT_RGB888   },
+    { LCD_FORMAT_RGB565,   LCD_FORMAT_ARGB8888 },
+};
+static const char *modes[] = {
+    "Rotate 0", "Rotate 90", "Rotate 180", "Rotate 270", "Nearest", "Bilinear"
+};
+LCD_Surface src,dst;
+clock_t start;
+double t;
+int f,m,n;
+
+    printf("Mpixels/s          ");
+    for(f=0;f<4;f++)
+        printf("%8s>%-8s",formatname[formats[f][0]],formatname[formats[f][1]]);
+    printf("\n");
+    for(m=0;m<6;m++) {
+        printf("%-19s",modes[m]);
+        for(f=0;f<4;f++) {
+            LCD_InitSurface(&src,sbuf,formats[f][0],0,0,m<4?272:240,m<4?272:136,0);
+            LCD_InitSurface(&dst,dbuf,formats[f][1],0,0,480,272,0);
+            n = 0;
+            start = clock();
+            do {
+                if( m < 4 )
+                    Blit_Rotate(&dst,0,0,&src,m);
+                else
+                    Blit_Scale(&dst,0,0,480,272,&src,m==4?BLIT_NEAREST:BLIT_BILINEAR);
+                n++;
+                t = (double) (clock()-start)/CLOCKS_PER_SEC;
+            } while( t < 0.05 );
+            printf("%17.0f",n*(m<4?272.0*272:480.0*272)/t/1e6);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+static uint32_t out[240*180];
+uint32_t colors[256];
+LCD_Surface src,dst;
+int i,sf,df;
+
+    if( Golden_Init(argc,argv) < 0 )
+        return 2;
+
+    makeimage();
+    for(i=0;i<256;i++)
+        colors[i] = ((i&0xE0)<<16)|((i&0x1C)<<11)|((i&0x03)<<6)|0x202020;
+    LCD_InitCLUT(&palette,colors,256);
+
+    /* Bilinear magnification and reduction */
+    makesource(&src,LCD_FORMAT_ARGB8888);
+    LCD_InitSurface(&dst,out,LCD_FORMAT_ARGB8888,0,0,240,180,0);
+    LCD_SurfaceFillRect(&dst,0,0,240,180,0xFF000000);
+    Blit_Scale(&dst,0,0,240,140,&src,BLIT_BILINEAR);
+    Blit_Scale(&dst,10,140,50,38,&src,BLIT_BILINEAR);
+    Blit_Scale(&dst,70,140,170,40,&src,BLIT_BILINEAR);
+    failures += Golden_Check("blit-bilinear",&dst);
+    if( Golden_Update )
+        return 0;
+
+    for(sf=0;sf<8;sf++) {
+        makesource(&src,sf);
+        for(df=0;df<8;df++) {
+            checkrotations(&src,df);
+            checknearest(&src,df);
+        }
+        checkbilinear(&src);
+    }
+    checkerrors();
+
+    benchmark();
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file    drawtest.c
+ *
+ * @note    Host test of the anti-aliased drawing (draw.c)
+ *
+ * @note    Scenes with lines, thick lines, circles, rings and arcs in all directions
+ *          and crossing the borders are compared with golden images. The coverage of
+ *          some shapes is also compared with the area covered (computed with 16x16
+ *          samples per pixel) and drawing into a part of a larger buffer must not
+ *          write outside it.
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Ihost -I. \
+ *                  -o drawtest host/drawtest.c host/golden.c host/lcdhost.c draw.c lcd.c \
+ *                  pixel.c -lm
+ *              ./drawtest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lcd.h"
+#include "draw.h"
+#include "golden.h"
+
+#define W       80
+#define H       60
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+
+static uint32_t buffer[W*H];
+
+static void initsurface(LCD_Surface *s, int format, uint32_t bg) {
+
+    LCD_InitSurface(s,buffer,format,0,0,W,H,0);
+    LCD_SurfaceFillRect(s,0,0,W,H,bg);
+}
+
+/**
+ * @brief   Coverage (0-255) of pixel (x,y) by a shape, with 16x16 samples
+ */
+typedef int (*Inside)(double x, double y, const double *p);
+
+static int area(int x, int y, Inside inside, const double *p) {
+int i,j,n = 0;
+
+    for(i=0;i<16;i++)
+        for(j=0;j<16;j++)
+            n += inside(x-0.5+(j+0.5)/16,y-0.5+(i+0.5)/16,p);
+    return (n*255+128)/256;
+}
+
+/* p = cx, cy, R */
+static int indisk(double x, double y, const double *p) {
+
+    return (x-p[0])*(x-p[0])+(y-p[1])*(y-p[1]) < p[2]*p[2];
+}
+
+/* p = x0, y0, x1, y1, half width */
+static int incapsule(double x, double y, const double *p) {
+double dx = p[2]-p[0], dy = p[3]-p[1];
+double t = ((x-p[0])*dx+(y-p[1])*dy)/(dx*dx+dy*dy);
+
+    if( t < 0 ) t = 0;
+    if( t > 1 ) t = 1;
+    dx = x-(p[0]+t*dx);
+    dy = y-(p[1]+t*dy);
+    return dx*dx+dy*dy < p[4]*p[4];
+}
+
+/* p = cx, cy, inner radius, outer radius, a0, a1 (degrees, clockwise) */
+static int insector(double x, double y, const double *p) {
+double d2 = (x-p[0])*(x-p[0])+(y-p[1])*(y-p[1]);
+double a = atan2(y-p[1],x-p[0])*180/M_PI;
+
+    if( d2 < p[2]*p[2] || d2 >= p[3]*p[3] )
+        return 0;
+    while( a < p[4] )
+        a += 360;
+    return a < p[5];
+}
+
+/**
+ * @brief   Compares the green channel of the surface with the area covered
+ *
+ * @note    The drawing uses the distance of the pixel center to the edge, so it
+ *          differs a little from the area on slanted edges
+ */
+static void checkarea(const char *name, LCD_Surface *s, Inside inside, const double *p,
+                      int maxdiff, double maxmean) {
+int x,y,d,maxd = 0;
+double sum = 0;
+
+    for(y=0;y<H;y++) {
+        for(x=0;x<W;x++) {
+            d = abs((int) ((Golden_GetPixel(s,x,y)>>8)&0xFF)-area(x,y,inside,p));
+            sum += d;
+            if( d > maxd )
+                maxd = d;
+        }
+    }
+    if( maxd > maxdiff || sum/(W*H) > maxmean ) {
+        printf("%s: differs from area: max %d mean %.2f\n",name,maxd,sum/(W*H));
+        failures++;
+    }
+}
+
+/**
+ * @brief   Lines of Wu: each column (or line when steep) has a total intensity of one
+ *          pixel, centered on the ideal line
+ */
+static void checkwu(int x0, int y0, int x1, int y1) {
+LCD_Surface s;
+int x,y,steep,u,v,n,m,c,umin,umax;
+double sum,moment,ideal;
+
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_LineAA(&s,x0,y0,x1,y1,0xFFFFFFFF);
+    steep = abs(y1-y0) > abs(x1-x0);
+    n = steep ? H : W;
+    m = steep ? W : H;
+    umin = steep ? (y0<y1?y0:y1) : (x0<x1?x0:x1);
+    umax = steep ? (y0<y1?y1:y0) : (x0<x1?x1:x0);
+    for(u=0;u<n;u++) {
+        sum = moment = 0;
+        for(v=0;v<m;v++) {
+            x = steep ? v : u;
+            y = steep ? u : v;
+            c = (Golden_GetPixel(&s,x,y)>>8)&0xFF;
+            sum    += c;
+            moment += c*v;
+        }
+        if( u < umin || u > umax ) {
+            CHECK(sum == 0);
+            continue;
+        }
+        if( steep )
+            ideal = x0+(double) (x1-x0)*(u-y0)/(y1-y0);
+        else
+            ideal = y0+(double) (y1-y0)*(u-x0)/(x1-x0);
+        if( fabs(sum-255) > 2 || fabs(moment/sum-ideal) > 0.02 ) {
+            printf("Wu line (%d,%d)-(%d,%d) at %d: intensity %.0f center %.3f expected %.3f\n",
+                   x0,y0,x1,y1,u,sum,moment/sum,ideal);
+            failures++;
+        }
+    }
+}
+
+/**
+ * @brief   Drawing in a surface inside a larger buffer only writes the surface
+ */
+static void checkclipping(void) {
+static uint32_t big[3*W*3*H];
+LCD_Surface s;
+int x,y,inside,bad = 0;
+
+    for(x=0;x<3*W*3*H;x++)
+        big[x] = 0x12345678;
+    /* Surface at screen position (100,50), in the middle of the buffer */
+    LCD_InitSurface(&s,big+H*3*W+W,LCD_FORMAT_ARGB8888,100,50,W,H,3*W*4);
+    Draw_LineAA(&s,0,0,300,200,0xFFFFFFFF);
+    Draw_LineAA(&s,190,40,90,140,0xFFFFFFFF);
+    Draw_ThickLineAA(&s,95,45,185,115,9,0xFFFFFFFF);
+    Draw_FilledCircleAA(&s,100,50,20,0xFFFFFFFF);
+    Draw_CircleAA(&s,180,110,15,0xFFFFFFFF);
+    Draw_ArcAA(&s,140,80,45,6,30,330,0xFFFFFFFF);
+    Draw_Circle(&s,100,110,12,0xFFFFFFFF);
+    Draw_FilledCircle(&s,180,50,12,0xFFFFFFFF);
+    for(y=0;y<3*H;y++) {
+        for(x=0;x<3*W;x++) {
+            inside = x >= W && x < 2*W && y >= H && y < 2*H;
+            if( !inside && big[y*3*W+x] != 0x12345678 )
+                bad++;
+        }
+    }
+    if( bad ) {
+        printf("Clipping: %d pixels written outside the surface\n",bad);
+        failures++;
+    }
+}
+
+int main(int argc, char *argv[]) {
+LCD_Surface s;
+int i,a;
+double p[6];
+
+    if( Golden_Init(argc,argv) < 0 )
+        return 2;
+
+    /* Thin lines in 24 directions and crossing the borders */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    for(i=0,a=0;i<24;i++,a+=15)
+        Draw_LineAA(&s,40,30,40+(Draw_Cos(a)*27>>15),30+(Draw_Sin(a)*27>>15),0xFFFFFFFF);
+    Draw_LineAA(&s,-10,5,90,50,0xFFFFFF00);
+    Draw_LineAA(&s,5,-20,30,80,0xFF00FFFF);
+    Draw_LineAA(&s,70,2,75,2,0xFFFF00FF);
+    failures += Golden_Check("draw-lines",&s);
+
+    /* Thick lines with round caps */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_ThickLineAA(&s,5,5,35,12,2,0xFFFFFFFF);
+    Draw_ThickLineAA(&s,5,20,35,40,3,0xFFFF0000);
+    Draw_ThickLineAA(&s,10,55,20,25,5,0xFF00FF00);
+    Draw_ThickLineAA(&s,45,10,75,50,8,0xFF0000FF);
+    Draw_ThickLineAA(&s,60,-5,90,20,6,0xFFFFFFFF);
+    Draw_ThickLineAA(&s,50,55,50,55,7,0xFFFFFF00);
+    failures += Golden_Check("draw-thick",&s);
+
+    /* Circles and rings, some clipped */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_CircleAA(&s,15,15,12,0xFFFFFFFF);
+    Draw_FilledCircleAA(&s,15,15,6,0xFFFF8000);
+    Draw_RingAA(&s,45,20,14,5,0xFF00C0FF);
+    Draw_Circle(&s,15,45,10,0xFFFFFFFF);
+    Draw_FilledCircle(&s,40,48,7,0xFF80FF80);
+    Draw_FilledCircleAA(&s,75,55,15,0xFFFF00FF);
+    Draw_CircleAA(&s,0,0,25,0xFFFFFF00);
+    failures += Golden_Check("draw-circles",&s);
+
+    /* Arcs: quadrants, more than a half turn, across 0 degrees, narrow and full */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_ArcAA(&s,20,20,15,4,0,90,0xFFFFFFFF);
+    Draw_ArcAA(&s,20,20,8,3,135,400,0xFFFF0000);
+    Draw_ArcAA(&s,58,20,15,6,-60,60,0xFF00FF00);
+    Draw_ArcAA(&s,58,20,7,2,200,210,0xFFFFFF00);
+    Draw_ArcAA(&s,20,48,10,2,0,360,0xFF00FFFF);
+    Draw_ArcAA(&s,60,50,18,8,180,360,0xFFFF00FF);
+    failures += Golden_Check("draw-arcs",&s);
+
+    /* Blending over a colored background in RGB565 */
+    initsurface(&s,LCD_FORMAT_RGB565,RGB565(32,64,128));
+    Draw_FilledCircleAA(&s,25,30,18,RGB565(255,255,0));
+    Draw_ArcAA(&s,25,30,22,4,-90,180,RGB565(255,0,0));
+    Draw_ThickLineAA(&s,45,10,75,50,5,RGB565(255,255,255));
+    Draw_LineAA(&s,45,50,78,5,RGB565(0,255,0));
+    failures += Golden_Check("draw-rgb565",&s);
+
+    if( Golden_Update )
+        return 0;
+
+    /* Coverage against the area covered */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_FilledCircleAA(&s,40,30,20,0xFFFFFFFF);
+    p[0] = 40; p[1] = 30; p[2] = 20.5;
+    checkarea("Filled circle",&s,indisk,p,24,0.5);
+
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_ThickLineAA(&s,10,12,70,45,7,0xFFFFFFFF);
+    p[0] = 10; p[1] = 12; p[2] = 70; p[3] = 45; p[4] = 3.5;
+    checkarea("Thick line",&s,incapsule,p,24,0.5);
+
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Draw_ArcAA(&s,40,30,22,6,30,250,0xFFFFFFFF);
+    p[0] = 40; p[1] = 30; p[2] = 19; p[3] = 25; p[4] = 30; p[5] = 250;
+    checkarea("Arc",&s,insector,p,24,0.5);
+
+    /* Wu lines in all octants */
+    checkwu(5,10,75,30);
+    checkwu(75,50,5,40);
+    checkwu(10,2,30,57);
+    checkwu(60,58,50,3);
+    checkwu(3,3,60,55);
+
+    checkclipping();
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
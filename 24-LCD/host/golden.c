@@ -0,0 +1,168 @@
+/**
+ * @file    golden.c
+ *
+ * @note    Comparison of surfaces with golden images for the host tests
+ *
+ * @note    The golden images are binary PPM files (RGB, 8 bits per component) in
+ *          GOLDEN_DIR. Surfaces of any format are converted to RGB888 for the
+ *          comparison, which must be exact. When it fails, the image obtained is
+ *          written in the current directory (name-got.ppm) to be inspected.
+ *
+ * @note    With the option -w, the tests write the golden images instead of comparing.
+ *          This is done only after a change in the output was checked.
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "golden.h"
+
+#define MAX(A,B) ((A)>(B)?(A):(B))
+
+int Golden_Update = 0;
+
+/**
+ * @brief   Golden_Init
+ *
+ * @note    Processes the command line of a test. Returns 0 if OK
+ */
+int
+Golden_Init(int argc, char *argv[]) {
+
+    if( argc == 2 && strcmp(argv[1],"-w") == 0 ) {
+        Golden_Update = 1;
+        return 0;
+    }
+    if( argc > 1 ) {
+        fprintf(stderr,"Usage: %s [-w]\n",argv[0]);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Golden_GetPixel
+ *
+ * @note    Pixel (x,y) of the surface (relative to its first pixel) in ARGB8888
+ */
+uint32_t
+Golden_GetPixel(const LCD_Surface *s, int x, int y) {
+uint32_t p;
+
+    p = Pixel_Read(LCD_GetSurfacePixelAddress(s,s->x+x,s->y+y),s->format);
+    return Pixel_Unpack(s->format,p,s->clut?s->clut->color:0);
+}
+
+/**
+ * @brief   Golden_WritePPM
+ *
+ * @note    Writes the surface in RGB. Returns 0 if OK
+ */
+int
+Golden_WritePPM(const char *filename, const LCD_Surface *s) {
+FILE *f;
+uint32_t c;
+int x,y;
+
+    f = fopen(filename,"wb");
+    if( !f )
+        return -1;
+    fprintf(f,"P6\n%d %d\n255\n",s->w,s->h);
+    for(y=0;y<s->h;y++) {
+        for(x=0;x<s->w;x++) {
+            c = Golden_GetPixel(s,x,y);
+            fputc((c>>16)&0xFF,f);
+            fputc((c>>8)&0xFF,f);
+            fputc(c&0xFF,f);
+        }
+    }
+    return fclose(f);
+}
+
+/**
+ * @brief   Golden_ReadPPM
+ *
+ * @note    Returns the RGB pixels (malloc) or 0 when the file cannot be read
+ */
+uint8_t *
+Golden_ReadPPM(const char *filename, int *w, int *h) {
+FILE *f;
+uint8_t *p;
+int max,n;
+
+    f = fopen(filename,"rb");
+    if( !f )
+        return 0;
+    if( fscanf(f,"P6 %d %d %d",w,h,&max) != 3 || max != 255 || fgetc(f) == EOF ) {
+        fclose(f);
+        return 0;
+    }
+    n = *w**h*3;
+    p = malloc(n);
+    if( p && (int) fread(p,1,n,f) != n ) {
+        free(p);
+        p = 0;
+    }
+    fclose(f);
+    return p;
+}
+
+/**
+ * @brief   Golden_Check
+ *
+ * @note    Compares the surface with GOLDEN_DIR/name.ppm (or writes it with -w).
+ *          Returns 0 if equal
+ */
+int
+Golden_Check(const char *name, const LCD_Surface *s) {
+char filename[256];
+uint8_t *ref;
+uint32_t c;
+int w,h,x,y,i,d,maxd,bad;
+
+    snprintf(filename,sizeof(filename),"%s%s.ppm",GOLDEN_DIR,name);
+    if( Golden_Update ) {
+        if( Golden_WritePPM(filename,s) != 0 ) {
+            printf("%s: cannot write\n",filename);
+            return 1;
+        }
+        printf("%s written\n",filename);
+        return 0;
+    }
+
+    ref = Golden_ReadPPM(filename,&w,&h);
+    if( !ref ) {
+        printf("%s: cannot read\n",filename);
+        return 1;
+    }
+    if( w != s->w || h != s->h ) {
+        printf("%s: size %dx%d, expected %dx%d\n",name,s->w,s->h,w,h);
+        free(ref);
+        return 1;
+    }
+    bad = maxd = 0;
+    for(y=0;y<h;y++) {
+        for(x=0;x<w;x++) {
+            c = Golden_GetPixel(s,x,y);
+            i = (y*w+x)*3;
+            d = abs((int) ((c>>16)&0xFF)-ref[i]);
+            d = MAX(d,abs((int) ((c>>8)&0xFF)-ref[i+1]));
+            d = MAX(d,abs((int) (c&0xFF)-ref[i+2]));
+            if( d ) {
+                bad++;
+                maxd = MAX(maxd,d);
+            }
+        }
+    }
+    free(ref);
+    if( bad == 0 )
+        return 0;
+    snprintf(filename,sizeof(filename),"%s-got.ppm",name);
+    Golden_WritePPM(filename,s);
+    printf("%s: %d pixels differ (at most %d levels), output in %s\n",name,bad,maxd,filename);
+    return 1;
+}
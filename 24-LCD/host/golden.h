@@ -0,0 +1,29 @@
+#ifndef GOLDEN_H
+#define GOLDEN_H
+/**
+ * @file    golden.h
+ *
+ * @note    Comparison of surfaces with golden images for the host tests
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * @brief   Directory of the golden images (relative to the project directory)
+ */
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR          "host/golden/"
+#endif
+
+extern int Golden_Update;
+
+int      Golden_Init(int argc, char *argv[]);
+int      Golden_Check(const char *name, const LCD_Surface *s);
+int      Golden_WritePPM(const char *filename, const LCD_Surface *s);
+uint8_t *Golden_ReadPPM(const char *filename, int *w, int *h);
+uint32_t Golden_GetPixel(const LCD_Surface *s, int x, int y);
+
+#endif
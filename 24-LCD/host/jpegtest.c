@@ -0,0 +1,436 @@
+/**
+ * @file    jpegtest.c
+ *
+ * @note    Host test of the JPEG decoder (jpeg.c)
+ *
+ * @note    The images in host/jpeg (generated by mkjpegref.c) are decoded with all
+ *          scales and compared with the output of libjpeg (JDCT_ISLOW, no fancy
+ *          upsampling) stored with them. The decoder must also
+ *          - give the same output reading the data from a stream in chunks
+ *          - clip against the surface and not write outside it
+ *          - decode into a band moved down by the row callback
+ *          - return an error for truncated and progressive images, a wrong scale, and
+ *            not write outside the surface with corrupted data
+ *
+ * @note    Then it prints the decoding time of each image and scale
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -O2 -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Ihost -I. \
+ *                  -o jpegtest host/jpegtest.c host/golden.c host/lcdhost.c jpeg.c image.c \
+ *                  lcd.c pixel.c -lm
+ *              ./jpegtest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "image.h"
+#include "jpeg.h"
+#include "golden.h"
+
+#define DIR         "host/jpeg/"
+
+/**
+ * @brief   Largest difference allowed with libjpeg (it is expected to be the same)
+ */
+#define MAXDIFF     0
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+
+static const struct {
+    const char *name;
+    int         components;
+    int         hs,vs;
+} images[] = {
+    { "yuv444",  3, 1, 1 },
+    { "yuv422",  3, 2, 1 },
+    { "yuv440",  3, 1, 2 },
+    { "yuv420",  3, 2, 2 },
+    { "gray",    1, 1, 1 },
+    { "restart", 3, 2, 2 },
+};
+
+#define NIMAGES     ((int) (sizeof(images)/sizeof(images[0])))
+
+static uint8_t *load(const char *filename, int *n) {
+FILE *f;
+uint8_t *p;
+
+    f = fopen(filename,"rb");
+    if( !f )
+        return 0;
+    fseek(f,0,SEEK_END);
+    *n = ftell(f);
+    rewind(f);
+    p = malloc(*n);
+    if( p && (int) fread(p,1,*n,f) != *n ) {
+        free(p);
+        p = 0;
+    }
+    fclose(f);
+    return p;
+}
+
+/**
+ * @brief   Stream delivering the data in chunks of a fixed size
+ */
+typedef struct {
+    const uint8_t  *data;
+    int             size;
+    int             pos;
+    int             chunk;
+} Stream;
+
+static int readchunk(void *ctx, uint8_t *buf, int n) {
+Stream *st = (Stream *) ctx;
+int k;
+
+    k = st->size-st->pos;
+    if( k > st->chunk )
+        k = st->chunk;
+    if( k > n )
+        k = n;
+    memcpy(buf,st->data+st->pos,k);
+    st->pos += k;
+    return k;
+}
+
+/**
+ * @brief   Decodes the data from memory into an ARGB8888 surface of w x h pixels
+ *
+ * @note    Returns the pixels (malloc) and the return code of Jpeg_Decode in rc
+ */
+static uint32_t *decode(const uint8_t *data, int n, int scale, int w, int h, int *rc) {
+Image_Reader r;
+LCD_Surface s;
+uint32_t *p;
+
+    p = calloc(w*h,4);
+    LCD_InitSurface(&s,p,LCD_FORMAT_ARGB8888,0,0,w,h,0);
+    Image_InitMemoryReader(&r,data,n);
+    *rc = Jpeg_Decode(&r,&s,0,0,scale);
+    return p;
+}
+
+/**
+ * @brief   Output of all scales against the references of libjpeg
+ */
+static void checkreference(int k, const uint8_t *data, int n) {
+char filename[256];
+uint8_t *ref;
+uint32_t *img,c;
+int scale,w,h,i,d,maxd,bad,rc;
+
+    for(scale=1;scale<=8;scale*=2) {
+        snprintf(filename,sizeof(filename),"%s%s-%d.ppm",DIR,images[k].name,scale);
+        ref = Golden_ReadPPM(filename,&w,&h);
+        if( !ref ) {
+            printf("%s: cannot read\n",filename);
+            failures++;
+            continue;
+        }
+        img = decode(data,n,scale,w,h,&rc);
+        CHECK(rc == 0);
+        bad = maxd = 0;
+        for(i=0;i<w*h;i++) {
+            c = img[i];
+            d = abs((int) ((c>>16)&0xFF)-ref[3*i]);
+            if( abs((int) ((c>>8)&0xFF)-ref[3*i+1]) > d )
+                d = abs((int) ((c>>8)&0xFF)-ref[3*i+1]);
+            if( abs((int) (c&0xFF)-ref[3*i+2]) > d )
+                d = abs((int) (c&0xFF)-ref[3*i+2]);
+            if( (c>>24) != 0xFF || d > MAXDIFF )
+                bad++;
+            if( d > maxd )
+                maxd = d;
+        }
+        if( bad ) {
+            printf("%s 1/%d: %d pixels differ from libjpeg (at most %d levels)\n",
+                   images[k].name,scale,bad,maxd);
+            failures++;
+        }
+        free(img);
+        free(ref);
+    }
+}
+
+/**
+ * @brief   Header information
+ */
+static void checkheader(int k, const uint8_t *data, int n, int *w, int *h) {
+Image_Reader r;
+Jpeg_Info info;
+
+    Image_InitMemoryReader(&r,data,n);
+    CHECK(Jpeg_ReadHeader(&r,&info) == 0);
+    CHECK(info.components == images[k].components);
+    CHECK(info.hs == images[k].hs && info.vs == images[k].vs);
+    *w = info.w;
+    *h = info.h;
+}
+
+/**
+ * @brief   Reading from a stream gives the same pixels
+ */
+static void checkstream(int k, const uint8_t *data, int n, int w, int h) {
+static const int chunks[] = { 1, 37, 4096 };
+Image_Reader r;
+LCD_Surface s;
+Stream st;
+uint32_t *ref,*img;
+int i,rc;
+
+    ref = decode(data,n,1,w,h,&rc);
+    img = malloc(w*h*4);
+    for(i=0;i<3;i++) {
+        memset(img,0,w*h*4);
+        LCD_InitSurface(&s,img,LCD_FORMAT_ARGB8888,0,0,w,h,0);
+        st.data  = data;
+        st.size  = n;
+        st.pos   = 0;
+        st.chunk = chunks[i];
+        Image_InitStreamReader(&r,readchunk,&st);
+        CHECK(Jpeg_Decode(&r,&s,0,0,1) == 0);
+        if( memcmp(img,ref,w*h*4) != 0 ) {
+            printf("%s: stream read in chunks of %d bytes differs\n",images[k].name,chunks[i]);
+            failures++;
+        }
+    }
+    free(img);
+    free(ref);
+}
+
+/**
+ * @brief   The image placed across the borders of a surface inside a larger buffer
+ *
+ * @note    The pixels inside must be the ones of the full image and nothing must be
+ *          written outside
+ */
+#define SW      40
+#define SH      30
+#define GUARD   0x12345678
+
+static void checkclipping(int k, const uint8_t *data, int n, int w, int h) {
+static uint32_t big[3*SW*3*SH];
+static const int px[] = { -5, 20, -30, 10 };
+static const int py[] = { 3, -20, 10, -3 };
+Image_Reader r;
+LCD_Surface s;
+uint32_t *ref,expected;
+int i,x,y,ix,iy,rc,bad = 0;
+
+    ref = decode(data,n,1,w,h,&rc);
+    /* Surface at screen position (100,50), in the middle of the buffer */
+    LCD_InitSurface(&s,big+SH*3*SW+SW,LCD_FORMAT_ARGB8888,100,50,SW,SH,3*SW*4);
+    for(i=0;i<4;i++) {
+        for(x=0;x<3*SW*3*SH;x++)
+            big[x] = GUARD;
+        Image_InitMemoryReader(&r,data,n);
+        CHECK(Jpeg_Decode(&r,&s,100+px[i],50+py[i],1) == 0);
+        for(y=0;y<3*SH;y++) {
+            for(x=0;x<3*SW;x++) {
+                ix = x-SW-px[i];
+                iy = y-SH-py[i];
+                expected = GUARD;
+                if( x >= SW && x < 2*SW && y >= SH && y < 2*SH
+                    && ix >= 0 && ix < w && iy >= 0 && iy < h )
+                    expected = ref[iy*w+ix];
+                if( big[y*3*SW+x] != expected )
+                    bad++;
+            }
+        }
+    }
+    if( bad ) {
+        printf("%s: %d pixels wrong when clipped\n",images[k].name,bad);
+        failures++;
+    }
+    free(ref);
+}
+
+/**
+ * @brief   Decoding into a band of one MCU row moved down by the row callback
+ */
+typedef struct {
+    LCD_Surface     band;
+    uint32_t       *img;
+    int             w;
+    int             lines;
+} Band;
+
+static void nextband(void *ctx, int y, int h) {
+Band *b = (Band *) ctx;
+int i;
+
+    for(i=0;i<h;i++)
+        memcpy(b->img+(y+i)*b->w,(uint32_t *) b->band.area+i*b->w,b->w*4);
+    b->lines += h;
+    b->band.y += b->band.h;
+}
+
+static void checkband(int k, const uint8_t *data, int n, int w, int h) {
+static uint32_t bandbuf[16*256];
+Image_Reader r;
+uint32_t *ref;
+Band b;
+int rc;
+
+    ref = decode(data,n,1,w,h,&rc);
+    b.img   = calloc(w*h,4);
+    b.w     = w;
+    b.lines = 0;
+    LCD_InitSurface(&b.band,bandbuf,LCD_FORMAT_ARGB8888,0,0,w,8*images[k].vs,0);
+    Jpeg_SetRowCallback(nextband,&b);
+    Image_InitMemoryReader(&r,data,n);
+    CHECK(Jpeg_Decode(&r,&b.band,0,0,1) == 0);
+    Jpeg_SetRowCallback(0,0);
+    CHECK(b.lines == h);
+    if( memcmp(b.img,ref,w*h*4) != 0 ) {
+        printf("%s: decoding into a band differs\n",images[k].name);
+        failures++;
+    }
+    free(b.img);
+    free(ref);
+}
+
+/**
+ * @brief   Truncated and corrupted data
+ *
+ * @note    Truncated data must give an error. Corrupted data can give any pixels, but
+ *          must not write outside the surface.
+ */
+static void checkerrors(int k, const uint8_t *data, int n, int w, int h) {
+static const int lengths[] = { 0, 2, 100, 300 };
+Image_Reader r;
+LCD_Surface s;
+uint32_t *big;
+uint8_t *bad;
+int i,j,x,y,pos,overrun = 0;
+
+    big = malloc(3*w*3*h*4);
+    LCD_InitSurface(&s,big+h*3*w+w,LCD_FORMAT_ARGB8888,0,0,w,h,3*w*4);
+    for(i=0;i<4;i++) {
+        Image_InitMemoryReader(&r,data,lengths[i]);
+        CHECK(Jpeg_Decode(&r,&s,0,0,1) < 0);
+    }
+    Image_InitMemoryReader(&r,data,n/2);
+    CHECK(Jpeg_Decode(&r,&s,0,0,1) == -3);
+    Image_InitMemoryReader(&r,data,n);
+    CHECK(Jpeg_Decode(&r,&s,0,0,3) == -1);
+
+    bad = malloc(n);
+    srand(k+1);
+    for(i=0;i<200;i++) {
+        for(j=0;j<3*w*3*h;j++)
+            big[j] = GUARD;
+        memcpy(bad,data,n);
+        for(j=0;j<4;j++) {
+            pos = rand()%n;
+            bad[pos] ^= 1<<(rand()%8);
+        }
+        Image_InitMemoryReader(&r,bad,n);
+        Jpeg_Decode(&r,&s,rand()%9-4,rand()%9-4,1<<(rand()%4));
+        for(y=0;y<3*h;y++) {
+            for(x=0;x<3*w;x++) {
+                if( (x < w || x >= 2*w || y < h || y >= 2*h) && big[y*3*w+x] != GUARD )
+                    overrun++;
+            }
+        }
+    }
+    if( overrun ) {
+        printf("%s: corrupted data wrote %d pixels outside the surface\n",images[k].name,
+               overrun);
+        failures++;
+    }
+    free(bad);
+    free(big);
+}
+
+/**
+ * @brief   Decoding time in microseconds
+ */
+static void benchmark(void) {
+uint8_t *data;
+uint32_t *img;
+char filename[256];
+Image_Reader r;
+LCD_Surface s;
+clock_t start;
+double t;
+int k,n,scale,count;
+
+    img = malloc(256*256*4);
+    printf("Decoding time (us)");
+    for(scale=1;scale<=8;scale*=2)
+        printf("%8s1/%d","",scale);
+    printf("\n");
+    for(k=0;k<NIMAGES;k++) {
+        snprintf(filename,sizeof(filename),"%s%s.jpg",DIR,images[k].name);
+        data = load(filename,&n);
+        if( !data )
+            continue;
+        printf("%-18s",images[k].name);
+        for(scale=1;scale<=8;scale*=2) {
+            LCD_InitSurface(&s,img,LCD_FORMAT_RGB565,0,0,256,256,0);
+            count = 0;
+            start = clock();
+            do {
+                Image_InitMemoryReader(&r,data,n);
+                Jpeg_Decode(&r,&s,0,0,scale);
+                count++;
+                t = (double) (clock()-start)/CLOCKS_PER_SEC;
+            } while( t < 0.05 );
+            printf("%11.1f",t*1e6/count);
+        }
+        printf("\n");
+        free(data);
+    }
+    free(img);
+}
+
+int main(void) {
+char filename[256];
+uint8_t *data;
+Image_Reader r;
+LCD_Surface s;
+uint32_t pixel;
+int k,n,w,h;
+
+    for(k=0;k<NIMAGES;k++) {
+        snprintf(filename,sizeof(filename),"%s%s.jpg",DIR,images[k].name);
+        data = load(filename,&n);
+        if( !data ) {
+            printf("%s: cannot read\n",filename);
+            failures++;
+            continue;
+        }
+        checkheader(k,data,n,&w,&h);
+        checkreference(k,data,n);
+        checkstream(k,data,n,w,h);
+        checkclipping(k,data,n,w,h);
+        checkband(k,data,n,w,h);
+        checkerrors(k,data,n,w,h);
+        free(data);
+    }
+
+    data = load(DIR "progressive.jpg",&n);
+    CHECK(data != 0);
+    if( data ) {
+        LCD_InitSurface(&s,&pixel,LCD_FORMAT_ARGB8888,0,0,1,1,0);
+        Image_InitMemoryReader(&r,data,n);
+        CHECK(Jpeg_Decode(&r,&s,0,0,1) == -2);
+        free(data);
+    }
+
+    benchmark();
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file    lcdhost.c
+ *
+ * @note    What lcd.c needs outside of it to run on a host: the registers (variables)
+ *          and the GPIO and clock routines (they do nothing)
+ *
+ * @note    Only the surfaces (LCD_InitSurface, LCD_Surface*) and the CLUTs are used
+ *          by the host tests. LCD_Init is never called.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "stm32f746xx.h"
+#include "system_stm32f746.h"
+#include "gpio.h"
+
+LTDC_TypeDef        LCDHost_LTDC;
+LTDC_Layer_TypeDef  LCDHost_Layer[2];
+RCC_TypeDef         LCDHost_RCC;
+GPIO_TypeDef        LCDHost_GPIO[11];
+
+uint32_t SystemCoreClock = 200000000;
+
+const PLLConfiguration_t PLLSAIConfiguration_48MHz = { 0 };
+
+void SystemConfigPLLSAI(const PLLConfiguration_t *pllconfig) {
+
+    (void) pllconfig;
+}
+
+int SystemGetPLLFrequencies(uint32_t whichone, PLLOutputFrequencies_t *pllfreq) {
+
+    (void) whichone;
+    pllfreq->infreq    = HSE_FREQ;
+    pllfreq->pllinfreq = 1000000;
+    pllfreq->vcofreq   = 192000000;
+    pllfreq->poutfreq  = 48000000;
+    pllfreq->qoutfreq  = 48000000;
+    pllfreq->routfreq  = 38400000;
+    return 0;
+}
+
+void GPIO_Init(GPIO_TypeDef *gpio, uint32_t imask, uint32_t omask) {
+
+    (void) gpio; (void) imask; (void) omask;
+}
+
+void GPIO_ConfigureMultiplePins( const GPIO_PinConfiguration *conf ) {
+
+    (void) conf;
+}
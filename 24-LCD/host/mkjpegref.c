@@ -0,0 +1,193 @@
+/**
+ * @file    mkjpegref.c
+ *
+ * @note    Generates the test images of jpegtest.c with libjpeg
+ *
+ * @note    A synthetic image (gradients, sharp edges, a checkerboard of colors and
+ *          noise) is encoded with each sampling, in grayscale and with restart markers.
+ *          The size is not a multiple of the MCU size. Each JPEG file is decoded by
+ *          libjpeg with JDCT_ISLOW and without fancy upsampling at scales 1, 2, 4 and 8
+ *          and the output is written as a PPM file. These are the references.
+ *
+ *          File               | Contents
+ *          -------------------|--------------------------------------------------
+ *          name.jpg           | Test image
+ *          name-S.ppm         | Reference decoded by libjpeg at scale 1/S
+ *          progressive.jpg    | Progressive image, that must be rejected (no reference)
+ *
+ * @note    Only needed to regenerate the files in host/jpeg. Build and run (in the
+ *          directory above)
+ *              gcc -Wall -o mkjpegref host/mkjpegref.c -ljpeg
+ *              ./mkjpegref
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <jpeglib.h>
+
+#define DIR         "host/jpeg/"
+#define W           75
+#define H           45
+
+/**
+ * @brief   Images generated
+ */
+static const struct {
+    const char *name;
+    int         hs,vs;              ///< Luminance sampling (0 = grayscale)
+    int         quality;
+    int         restart;            ///< Restart interval in MCUs
+    int         progressive;
+} images[] = {
+    { "yuv444",      1, 1, 90, 0, 0 },
+    { "yuv422",      2, 1, 85, 0, 0 },
+    { "yuv440",      1, 2, 85, 0, 0 },
+    { "yuv420",      2, 2, 75, 0, 0 },
+    { "gray",        0, 0, 90, 0, 0 },
+    { "restart",     2, 2, 95, 3, 0 },
+    { "progressive", 2, 2, 75, 0, 1 },
+};
+
+static uint8_t image[W*H*3];
+
+static uint32_t nextrandom(void) {
+static uint32_t x = 2463534242U;
+
+    x ^= x<<13;
+    x ^= x>>17;
+    x ^= x<<5;
+    return x;
+}
+
+/**
+ * @brief   Synthetic image
+ */
+static void makeimage(void) {
+int x,y,i;
+uint8_t *p;
+
+    for(y=0;y<H;y++) {
+        for(x=0;x<W;x++) {
+            p = &image[(y*W+x)*3];
+            if( y < 15 ) {
+                // gradients
+                p[0] = x*255/(W-1);
+                p[1] = y*255/14;
+                p[2] = 255-x*255/(W-1);
+            } else if( y < 30 ) {
+                // checkerboard of saturated colors with sharp edges
+                i = (x/5+y/5)%6;
+                p[0] = (i&1) ? 255 : 0;
+                p[1] = (i&2) ? 255 : 0;
+                p[2] = (i&4) ? 255 : 20*i;
+            } else if( x < W/2 ) {
+                // noise
+                p[0] = nextrandom()&0xFF;
+                p[1] = nextrandom()&0xFF;
+                p[2] = nextrandom()&0xFF;
+            } else {
+                // thin lines
+                p[0] = p[1] = p[2] = ((x+y)%4 == 0) ? 255 : 40;
+            }
+        }
+    }
+}
+
+static int encode(const char *filename, int hs, int vs, int quality, int restart,
+                  int progressive) {
+struct jpeg_compress_struct ci;
+struct jpeg_error_mgr je;
+JSAMPROW row;
+FILE *f;
+
+    f = fopen(filename,"wb");
+    if( !f )
+        return -1;
+    ci.err = jpeg_std_error(&je);
+    jpeg_create_compress(&ci);
+    jpeg_stdio_dest(&ci,f);
+    ci.image_width      = W;
+    ci.image_height     = H;
+    ci.input_components = 3;
+    ci.in_color_space   = JCS_RGB;
+    jpeg_set_defaults(&ci);
+    jpeg_set_quality(&ci,quality,TRUE);
+    if( hs == 0 ) {
+        jpeg_set_colorspace(&ci,JCS_GRAYSCALE);
+    } else {
+        ci.comp_info[0].h_samp_factor = hs;
+        ci.comp_info[0].v_samp_factor = vs;
+    }
+    ci.restart_interval = restart;
+    ci.optimize_coding  = restart != 0;
+    if( progressive )
+        jpeg_simple_progression(&ci);
+    jpeg_start_compress(&ci,TRUE);
+    while( ci.next_scanline < H ) {
+        row = &image[ci.next_scanline*W*3];
+        jpeg_write_scanlines(&ci,&row,1);
+    }
+    jpeg_finish_compress(&ci);
+    jpeg_destroy_compress(&ci);
+    return fclose(f);
+}
+
+static int decode(const char *jpgname, const char *ppmname, int scale) {
+struct jpeg_decompress_struct ci;
+struct jpeg_error_mgr je;
+JSAMPROW row;
+FILE *f,*o;
+
+    f = fopen(jpgname,"rb");
+    o = fopen(ppmname,"wb");
+    if( !f || !o )
+        return -1;
+    ci.err = jpeg_std_error(&je);
+    jpeg_create_decompress(&ci);
+    jpeg_stdio_src(&ci,f);
+    jpeg_read_header(&ci,TRUE);
+    ci.out_color_space     = JCS_RGB;
+    ci.dct_method          = JDCT_ISLOW;
+    ci.do_fancy_upsampling = FALSE;
+    ci.scale_num           = 1;
+    ci.scale_denom         = scale;
+    jpeg_start_decompress(&ci);
+    row = malloc(ci.output_width*3);
+    fprintf(o,"P6\n%d %d\n255\n",ci.output_width,ci.output_height);
+    while( ci.output_scanline < ci.output_height ) {
+        jpeg_read_scanlines(&ci,&row,1);
+        fwrite(row,3,ci.output_width,o);
+    }
+    free(row);
+    jpeg_finish_decompress(&ci);
+    jpeg_destroy_decompress(&ci);
+    fclose(f);
+    return fclose(o);
+}
+
+int main(void) {
+char jpgname[256],ppmname[256];
+int i,scale;
+
+    makeimage();
+    for(i=0;i<(int) (sizeof(images)/sizeof(images[0]));i++) {
+        snprintf(jpgname,sizeof(jpgname),"%s%s.jpg",DIR,images[i].name);
+        if( encode(jpgname,images[i].hs,images[i].vs,images[i].quality,images[i].restart,
+                   images[i].progressive) ) {
+            printf("%s: cannot write\n",jpgname);
+            return 1;
+        }
+        for(scale=1;(scale<=8)&&!images[i].progressive;scale*=2) {
+            snprintf(ppmname,sizeof(ppmname),"%s%s-%d.ppm",DIR,images[i].name,scale);
+            if( decode(jpgname,ppmname,scale) ) {
+                printf("%s: cannot write\n",ppmname);
+                return 1;
+            }
+        }
+        printf("%s written\n",jpgname);
+    }
+    return 0;
+}
@@ -0,0 +1,344 @@
+/**
+ * @file    pixeltest.c
+ *
+ * @note    Host test of the pixel format conversions (pixel.c and the color macros of
+ *          lcd.h)
+ *
+ * @note    Checks that
+ *          - the macros RGB565, RGB555, ARGB1555 and ARGB4444 give the same pixels as
+ *            Pixel_Color for all colors
+ *          - every pixel of the 16-bit and gray formats goes unchanged through ARGB8888
+ *            (Pixel_Unpack and then Pixel_Pack) and its components are expanded to 8 bits
+ *            with an error below one level
+ *          - packing an 8-bit component loses less than one step of the format
+ *          - the row and surface conversions of all pairs of formats, at all alignments,
+ *            with and without palettes, give Pixel_Pack(Pixel_Unpack()) of each pixel
+ *          - AL44 uses the nearest of the first 16 palette entries and CLUT entries
+ *            outside the palette are not written
+ *          - Pixel_ConvertSurface clips against the destination
+ *
+ * @note    Then it prints the conversion rate of a 480x272 surface for all pairs
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -O2 -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Ihost -I. \
+ *                  -o pixeltest host/pixeltest.c host/lcdhost.c lcd.c pixel.c -lm
+ *              ./pixeltest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "lcd.h"
+#include "pixel.h"
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+
+/* Reports only the first errors of a check */
+#define REPORT(...) do { if( failures++ < 20 ) printf(__VA_ARGS__); } while(0)
+
+static const char *formatname[] = {
+    "ARGB8888", "RGB888", "RGB565", "ARGB1555", "ARGB4444", "L8", "AL44", "AL88"
+};
+static const int pixelsize[] = { 4, 3, 2, 2, 2, 1, 1, 2 };
+
+/* Bits of A, R, G and B in the 16-bit formats */
+static const int bits[][4] = {
+    { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 5, 6, 5 }, { 1, 5, 5, 5 }, { 4, 4, 4, 4 }
+};
+
+static uint32_t nextrandom(void) {
+static uint32_t x = 12345;
+
+    x ^= x<<13;
+    x ^= x>>17;
+    x ^= x<<5;
+    return x;
+}
+
+/**
+ * @brief   Macros of lcd.h against Pixel_Color
+ */
+static void checkmacros(void) {
+uint32_t c,a,r,g,b;
+
+    for(c=0;c<(1<<24);c++) {
+        r = (c>>16)&0xFF;
+        g = (c>>8)&0xFF;
+        b = c&0xFF;
+        a = r^b;
+        if( RGB565(r,g,b) != Pixel_Color(LCD_FORMAT_RGB565,255,r,g,b) )
+            REPORT("RGB565(%u,%u,%u) = %04X\n",r,g,b,RGB565(r,g,b));
+        if( RGB555(r,g,b) != (Pixel_Color(LCD_FORMAT_ARGB1555,0,r,g,b)) )
+            REPORT("RGB555(%u,%u,%u) = %04X\n",r,g,b,RGB555(r,g,b));
+        if( ARGB1555(a,r,g,b) != Pixel_Color(LCD_FORMAT_ARGB1555,a,r,g,b) )
+            REPORT("ARGB1555(%u,%u,%u,%u) = %04X\n",a,r,g,b,ARGB1555(a,r,g,b));
+        if( ARGB4444(a,r,g,b) != Pixel_Color(LCD_FORMAT_ARGB4444,a,r,g,b) )
+            REPORT("ARGB4444(%u,%u,%u,%u) = %04X\n",a,r,g,b,ARGB4444(a,r,g,b));
+        if( RGBA(r,g,b,a) != Pixel_Color(LCD_FORMAT_ARGB8888,a,r,g,b) )
+            REPORT("RGBA(%u,%u,%u,%u) = %08X\n",r,g,b,a,RGBA(r,g,b,a));
+    }
+}
+
+/**
+ * @brief   Round trip of all pixels through ARGB8888 and expansion error
+ */
+static void checkroundtrip(void) {
+uint32_t v,c,r,n,max;
+int f,i,k,shift;
+double d,dmax;
+
+    /* 16-bit formats: the components of c are compared with v*255/max */
+    for(f=LCD_FORMAT_RGB565;f<=LCD_FORMAT_ARGB4444;f++) {
+        dmax = 0;
+        for(v=0;v<0x10000;v++) {
+            c = Pixel_Unpack(f,v,0);
+            r = Pixel_Pack(f,c);
+            if( r != v )
+                REPORT("%s: %04X -> %08X -> %04X\n",formatname[f],v,c,r);
+            shift = 0;
+            for(k=3;k>=0;k--) {
+                if( bits[f][k] == 0 ) {
+                    if( ((c>>(24-8*k))&0xFF) != 0xFF )
+                        REPORT("%s: %04X has alpha %u\n",formatname[f],v,(c>>24)&0xFF);
+                    continue;
+                }
+                max = (1<<bits[f][k])-1;
+                n = (v>>shift)&max;
+                d = fabs((double) ((c>>(24-8*k))&0xFF)-n*255.0/max);
+                if( d > dmax )
+                    dmax = d;
+                shift += bits[f][k];
+            }
+        }
+        if( dmax >= 1 )
+            REPORT("%s: components expanded with an error of %.2f\n",formatname[f],dmax);
+    }
+
+    /* Gray formats without a palette */
+    for(f=LCD_FORMAT_L8;f<=LCD_FORMAT_AL88;f++) {
+        n = f == LCD_FORMAT_AL88 ? 0x10000 : 0x100;
+        for(v=0;v<n;v++) {
+            r = Pixel_Pack(f,Pixel_Unpack(f,v,0));
+            if( r != v )
+                REPORT("%s: %04X -> %04X\n",formatname[f],v,r);
+        }
+    }
+
+    /* 24 and 32 bits: random pixels */
+    for(i=0;i<100000;i++) {
+        v = nextrandom();
+        CHECK(Pixel_Pack(LCD_FORMAT_ARGB8888,Pixel_Unpack(LCD_FORMAT_ARGB8888,v,0)) == v);
+        CHECK(Pixel_Pack(LCD_FORMAT_RGB888,Pixel_Unpack(LCD_FORMAT_RGB888,v&0xFFFFFF,0))
+              == (v&0xFFFFFF));
+    }
+}
+
+/**
+ * @brief   Packing error: truncation loses less than one step of the format
+ */
+static void checkpacking(void) {
+uint32_t c,u;
+int f,k,step,d;
+
+    for(f=LCD_FORMAT_RGB565;f<=LCD_FORMAT_ARGB4444;f++) {
+        for(c=0;c<256;c++) {
+            u = Pixel_Unpack(f,Pixel_Pack(f,c*0x01010101),0);
+            for(k=0;k<4;k++) {
+                if( bits[f][k] == 0 )
+                    continue;
+                step = 256>>bits[f][k];
+                d = abs((int) ((u>>(24-8*k))&0xFF)-(int) c);
+                if( d >= step )
+                    REPORT("%s: %u packed with an error of %d\n",formatname[f],c,d);
+            }
+        }
+    }
+    /* The luminance of a gray is the gray */
+    for(c=0;c<256;c++)
+        CHECK(Pixel_Pack(LCD_FORMAT_L8,0xFF000000|(c*0x010101)) == c);
+}
+
+/**
+ * @brief   All pairs of formats, rows and surfaces, at all alignments
+ */
+#define N       1000
+
+static void checkpairs(void) {
+static uint8_t a[N*4+8],b[N*4+8];
+static LCD_CLUT palette;
+uint32_t clut[256],sv,expected,got;
+LCD_Surface src,dst;
+int sf,df,off,doff,i,mode;
+
+    for(i=0;i<256;i++)
+        clut[i] = 0xFF000000|((i*0x10101)^0x123456);
+    LCD_InitCLUT(&palette,clut,256);
+    for(sf=0;sf<8;sf++) {
+        for(df=0;df<8;df++) {
+            for(off=0;off<4;off++) {
+                doff = (off*3)&3;
+                for(i=0;i<N;i++)
+                    Pixel_Write(a+off+i*pixelsize[sf],sf,Pixel_Pack(sf,nextrandom()));
+                /* mode 0: row, 1: surface, 2: surface with palettes */
+                for(mode=0;mode<3;mode++) {
+                    memset(b,0,sizeof(b));
+                    if( mode == 0 ) {
+                        Pixel_ConvertRow(b+doff,df,a+off,sf,N,clut);
+                    } else {
+                        LCD_InitSurface(&src,a+off,sf,0,0,N/4,4,N/4*pixelsize[sf]);
+                        LCD_InitSurface(&dst,b+doff,df,0,0,N/4,4,N/4*pixelsize[df]);
+                        if( mode == 2 ) {
+                            src.clut = &palette;
+                            dst.clut = &palette;
+                        }
+                        Pixel_ConvertSurface(&dst,0,0,&src);
+                    }
+                    for(i=0;i<N;i++) {
+                        sv = Pixel_Read(a+off+i*pixelsize[sf],sf);
+                        if( sf == df )
+                            expected = sv;
+                        else if( mode == 0 )
+                            expected = Pixel_Pack(df,Pixel_Unpack(sf,sv,clut));
+                        else if( mode == 1 )
+                            expected = Pixel_Pack(df,Pixel_Unpack(sf,sv,0));
+                        else
+                            expected = Pixel_PackCLUT(df,Pixel_Unpack(sf,sv,clut),&palette);
+                        got = Pixel_Read(b+doff+i*pixelsize[df],df);
+                        if( got != expected )
+                            REPORT("%s to %s (offset %d, mode %d) pixel %d: %X expected %X\n",
+                                   formatname[sf],formatname[df],off,mode,i,got,expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Palette searches
+ *
+ * @note    With more than 16 colors, AL44 must use the nearest of the first 16 entries
+ *          and not the low 4 bits of the nearest entry. A negative first entry is not
+ *          written.
+ */
+static void checkclut(void) {
+static LCD_CLUT palette;
+uint32_t colors[32],c;
+int i;
+
+    for(i=0;i<16;i++)
+        colors[i] = i*0x111111;                 // grays
+    for(i=16;i<32;i++)
+        colors[i] = 0xFF0000|((i-16)*0x11);     // reds with blue
+    LCD_InitCLUT(&palette,colors,32);
+    for(i=16;i<32;i++) {
+        c = 0xFF000000|colors[i];
+        CHECK(Pixel_PackCLUT(LCD_FORMAT_L8,c,&palette) == (uint32_t) i);
+        CHECK((Pixel_PackCLUT(LCD_FORMAT_AL44,c,&palette)&0xF)
+                == (uint32_t) LCD_FindCLUTIndexN(&palette,c,16));
+        CHECK(LCD_FindCLUTIndexN(&palette,c,16) < 16);
+    }
+    /* A red is nearer to a middle gray than to black */
+    CHECK((Pixel_PackCLUT(LCD_FORMAT_AL44,0xFFFF0000,&palette)&0xF) != 0);
+    CHECK(Pixel_PackCLUT(LCD_FORMAT_AL44,0xFF777777,&palette) == 0xF7);
+
+    colors[0] = 0x123456;
+    LCD_SetCLUTEntries(&palette,-1,2,colors);
+    CHECK(palette.color[0] == 0 && palette.n == 32);
+    LCD_SetCLUTEntries(&palette,30,2,colors);
+    CHECK(palette.color[30] == 0x123456 && palette.n == 32);
+}
+
+/**
+ * @brief   Pixel_ConvertSurface clips against the destination
+ */
+static void checkclipping(void) {
+static uint16_t sbuf[30*20],dbuf[3*40*3*30];
+LCD_Surface src,dst;
+int x,y,sx,sy,pos,in,bad = 0;
+static const int px[] = { -10, 25, 15, -35, 45 };
+static const int py[] = { -5, 20, 5, -25, 35 };
+
+    for(x=0;x<30*20;x++)
+        sbuf[x] = x+1;
+    LCD_InitSurface(&src,sbuf,LCD_FORMAT_RGB565,0,0,30,20,0);
+    /* Destination at screen position (40,30), in the middle of the buffer */
+    LCD_InitSurface(&dst,dbuf+30*3*40+40,LCD_FORMAT_RGB565,40,30,40,30,3*40*2);
+    for(pos=0;pos<5;pos++) {
+        for(x=0;x<3*40*3*30;x++)
+            dbuf[x] = 0xDEAD;
+        Pixel_ConvertSurface(&dst,40+px[pos],30+py[pos],&src);
+        for(y=0;y<3*30;y++) {
+            for(x=0;x<3*40;x++) {
+                in = x >= 40 && x < 80 && y >= 30 && y < 60;
+                sx = x-40-px[pos];
+                sy = y-30-py[pos];
+                if( in && sx >= 0 && sx < 30 && sy >= 0 && sy < 20 ) {
+                    if( dbuf[y*3*40+x] != sbuf[sy*30+sx] )
+                        bad++;
+                } else if( dbuf[y*3*40+x] != 0xDEAD ) {
+                    bad++;
+                }
+            }
+        }
+    }
+    if( bad ) {
+        printf("Clipping: %d pixels wrong\n",bad);
+        failures++;
+    }
+}
+
+/**
+ * @brief   Conversion rate of a 480x272 surface, in millions of pixels per second
+ */
+static void benchmark(void) {
+static uint32_t a[480*272],b[480*272];
+LCD_Surface src,dst;
+int sf,df,i,n;
+clock_t start;
+double t;
+
+    for(i=0;i<480*272;i++)
+        a[i] = nextrandom();
+    printf("Mpixels/s   ");
+    for(df=0;df<8;df++)
+        printf("%9s",formatname[df]);
+    printf("\n");
+    for(sf=0;sf<8;sf++) {
+        printf("%-12s",formatname[sf]);
+        LCD_InitSurface(&src,a,sf,0,0,480,272,0);
+        for(df=0;df<8;df++) {
+            LCD_InitSurface(&dst,b,df,0,0,480,272,0);
+            n = 0;
+            start = clock();
+            do {
+                Pixel_ConvertSurface(&dst,0,0,&src);
+                n++;
+                t = (double) (clock()-start)/CLOCKS_PER_SEC;
+            } while( t < 0.05 );
+            printf("%9.0f",n*480.0*272/t/1e6);
+        }
+        printf("\n");
+    }
+}
+
+int main(void) {
+
+    checkmacros();
+    checkroundtrip();
+    checkpacking();
+    checkpairs();
+    checkclut();
+    checkclipping();
+    benchmark();
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
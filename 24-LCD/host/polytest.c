@@ -0,0 +1,314 @@
+/**
+ * @file    polytest.c
+ *
+ * @note    Host test of the polygon fill (poly.c)
+ *
+ * @note    Scenes with triangles (integer and sub-pixel vertices), concave and
+ *          self-intersecting polygons with both fill rules and clipped shapes are
+ *          compared with golden images. Each pixel is also compared with a point in
+ *          polygon test of its center done in floating point, a mesh of triangles must
+ *          cover its outline exactly once and drawing into a part of a larger buffer
+ *          must not write outside it.
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -Ihost -I. \
+ *                  -o polytest host/polytest.c host/golden.c host/lcdhost.c poly.c lcd.c \
+ *                  pixel.c -lm
+ *              ./polytest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lcd.h"
+#include "poly.h"
+#include "golden.h"
+
+#define W       80
+#define H       60
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+
+static uint32_t buffer[W*H];
+
+static void initsurface(LCD_Surface *s, int format, uint32_t bg) {
+
+    LCD_InitSurface(s,buffer,format,0,0,W,H,0);
+    LCD_SurfaceFillRect(s,0,0,W,H,bg);
+}
+
+/**
+ * @brief   Star with 5 points (self-intersecting), centered at (cx,cy) in pixels
+ */
+static void star(Poly_Point *p, double cx, double cy, double r) {
+int i;
+double a;
+
+    for(i=0;i<5;i++) {
+        a = (i*144-90)*M_PI/180;
+        p[i].x = (int) lround(POLY_FIX(cx+r*cos(a)));
+        p[i].y = (int) lround(POLY_FIX(cy+r*sin(a)));
+    }
+}
+
+/**
+ * @brief   Point in polygon test of the center of pixel (x,y)
+ *
+ * @note    The crossings of the line with the edges are computed in floating point.
+ *          Like poly.c, an edge crosses the lines from its upper end (included) to its
+ *          lower end (excluded) and the pixel is inside when the crossings at its left
+ *          or on it give a nonzero winding (or an odd count).
+ *
+ * @note    dmin is set to the smallest distance from the center to a crossing
+ */
+static int inside(const Poly_Point *p, int n, int rule, int x, int y, double *dmin) {
+int i,winding = 0;
+double x0,y0,x1,y1,xc;
+
+    *dmin = 1e9;
+    for(i=0;i<n;i++) {
+        x0 = p[i].x/(double) POLY_FIX(1);
+        y0 = p[i].y/(double) POLY_FIX(1);
+        x1 = p[(i+1)%n].x/(double) POLY_FIX(1);
+        y1 = p[(i+1)%n].y/(double) POLY_FIX(1);
+        if( y0 == y1 || y < fmin(y0,y1) || y >= fmax(y0,y1) )
+            continue;
+        xc = x0+(x1-x0)*(y-y0)/(y1-y0);
+        *dmin = fmin(*dmin,fabs(x-xc));
+        if( xc <= x ) {
+            if( rule == POLY_NONZERO )
+                winding += y1 > y0 ? 1 : -1;
+            else
+                winding ^= 1;
+        }
+    }
+    return winding != 0;
+}
+
+/**
+ * @brief   Fills the polygon and compares each pixel with the point in polygon test
+ *
+ * @note    The intersections of poly.c are rounded to 1/65536 pixel, so a center
+ *          nearer than that to an edge can go either way
+ */
+static void checkinside(const char *name, const Poly_Point *p, int n, int rule) {
+LCD_Surface s;
+int x,y,got,expected,bad = 0;
+double d;
+
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    CHECK(Poly_Fill(&s,p,n,0xFFFFFFFF,rule) == 0);
+    for(y=0;y<H;y++) {
+        for(x=0;x<W;x++) {
+            got = Golden_GetPixel(&s,x,y) == 0xFFFFFFFF;
+            expected = inside(p,n,rule,x,y,&d);
+            if( got != expected && d > 1.0/1024 ) {
+                if( bad++ == 0 )
+                    printf("%s: pixel (%d,%d) is %d, expected %d\n",name,x,y,got,expected);
+            }
+        }
+    }
+    if( bad ) {
+        printf("%s: %d pixels differ from the point in polygon test\n",name,bad);
+        failures++;
+    }
+}
+
+/**
+ * @brief   A jittered grid of vertices cut into triangles is filled triangle by
+ *          triangle. Each pixel must be filled once when its center is inside the
+ *          outline of the grid and never otherwise.
+ */
+#define GN      5
+
+static void checkmesh(unsigned seed) {
+LCD_Surface s;
+static uint8_t count[W*H];
+Poly_Point g[GN][GN],outline[4*(GN-1)];
+Poly_Point *a,*b,*c,*d;
+int i,j,x,y,n,overlaps = 0,gaps = 0;
+
+    srand(seed);
+    for(i=0;i<GN;i++) {
+        for(j=0;j<GN;j++) {
+            g[i][j].x = POLY_FIX(4+j*18)+rand()%POLY_FIX(8);
+            g[i][j].y = POLY_FIX(2+i*13)+rand()%POLY_FIX(6);
+        }
+    }
+    memset(count,0,sizeof(count));
+    for(i=0;i<GN-1;i++) {
+        for(j=0;j<GN-1;j++) {
+            a = &g[i][j];
+            b = &g[i][j+1];
+            c = &g[i+1][j+1];
+            d = &g[i+1][j];
+            initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+            Poly_FillTriangle(&s,a->x,a->y,b->x,b->y,c->x,c->y,0xFFFFFFFF);
+            for(n=0;n<W*H;n++)
+                count[n] += buffer[n] == 0xFFFFFFFF;
+            initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+            Poly_FillTriangle(&s,c->x,c->y,d->x,d->y,a->x,a->y,0xFFFFFFFF);
+            for(n=0;n<W*H;n++)
+                count[n] += buffer[n] == 0xFFFFFFFF;
+        }
+    }
+
+    /* Outline: top, right, bottom and left sides */
+    n = 0;
+    for(j=0;j<GN-1;j++)
+        outline[n++] = g[0][j];
+    for(i=0;i<GN-1;i++)
+        outline[n++] = g[i][GN-1];
+    for(j=GN-1;j>0;j--)
+        outline[n++] = g[GN-1][j];
+    for(i=GN-1;i>0;i--)
+        outline[n++] = g[i][0];
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Poly_Fill(&s,outline,n,0xFFFFFFFF,POLY_NONZERO);
+
+    for(y=0;y<H;y++) {
+        for(x=0;x<W;x++) {
+            n = y*W+x;
+            if( count[n] > 1 )
+                overlaps++;
+            else if( count[n] != (buffer[n] == 0xFFFFFFFF) )
+                gaps++;
+        }
+    }
+    if( overlaps || gaps ) {
+        printf("Mesh %u: %d pixels filled more than once, %d differ from the outline\n",
+               seed,overlaps,gaps);
+        failures++;
+    }
+}
+
+/**
+ * @brief   Filling a surface inside a larger buffer only writes the surface
+ */
+static void checkclipping(void) {
+static uint32_t big[3*W*3*H];
+LCD_Surface s;
+Poly_Point p[5];
+int x,y,in,bad = 0;
+
+    for(x=0;x<3*W*3*H;x++)
+        big[x] = 0x12345678;
+    /* Surface at screen position (100,50), in the middle of the buffer */
+    LCD_InitSurface(&s,big+H*3*W+W,LCD_FORMAT_ARGB8888,100,50,W,H,3*W*4);
+    Poly_FillTriangle(&s,POLY_FIX(80),POLY_FIX(30),POLY_FIX(200),POLY_FIX(60),
+                      POLY_FIX(120),POLY_FIX(130),0xFFFFFFFF);
+    star(p,180,110,40);
+    Poly_Fill(&s,p,5,0xFFFFFFFF,POLY_NONZERO);
+    star(p,100,50,25);
+    Poly_Fill(&s,p,5,0xFFFFFFFF,POLY_EVENODD);
+    for(y=0;y<3*H;y++) {
+        for(x=0;x<3*W;x++) {
+            in = x >= W && x < 2*W && y >= H && y < 2*H;
+            if( !in && big[y*3*W+x] != 0x12345678 )
+                bad++;
+        }
+    }
+    if( bad ) {
+        printf("Clipping: %d pixels written outside the surface\n",bad);
+        failures++;
+    }
+}
+
+int main(int argc, char *argv[]) {
+LCD_Surface s;
+Poly_Point p[POLY_MAXEDGES+1];
+Poly_Point concave[] = {
+    { POLY_FIX(5),  POLY_FIX(5)  }, { POLY_FIX(35), POLY_FIX(5)  },
+    { POLY_FIX(35), POLY_FIX(15) }, { POLY_FIX(15), POLY_FIX(15) },
+    { POLY_FIX(15), POLY_FIX(25) }, { POLY_FIX(30), POLY_FIX(25) },
+    { POLY_FIX(30), POLY_FIX(35) }, { POLY_FIX(15), POLY_FIX(35) },
+    { POLY_FIX(15), POLY_FIX(55) }, { POLY_FIX(5),  POLY_FIX(55) }
+};
+Poly_Point bowtie[] = {
+    { 43*16+5, 33*16+3 }, { 75*16+11, 57*16+8 }, { 75*16+2, 35*16+13 }, { 44*16+9, 56*16+1 }
+};
+int i;
+
+    if( Golden_Init(argc,argv) < 0 )
+        return 2;
+
+    /* Triangles: integer vertices, sub-pixel vertices, thin, clipped and degenerate */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    Poly_FillTriangle(&s,POLY_FIX(5),POLY_FIX(5),POLY_FIX(30),POLY_FIX(10),
+                      POLY_FIX(10),POLY_FIX(28),0xFFFFFFFF);
+    Poly_FillTriangle(&s,POLY_FIX(30),POLY_FIX(10),POLY_FIX(45),POLY_FIX(3),
+                      POLY_FIX(38),POLY_FIX(25),0xFFFF0000);
+    Poly_FillTriangle(&s,50*16+3,2*16+13,77*16+9,8*16+1,61*16+14,27*16+7,0xFF00FF00);
+    Poly_FillTriangle(&s,5*16+8,35*16+8,75*16+8,38*16+4,5*16+8,36*16+12,0xFFFFFF00);
+    Poly_FillTriangle(&s,POLY_FIX(-20),POLY_FIX(40),POLY_FIX(30),POLY_FIX(70),
+                      POLY_FIX(10),POLY_FIX(45),0xFF00FFFF);
+    Poly_FillTriangle(&s,POLY_FIX(60),POLY_FIX(30),POLY_FIX(100),POLY_FIX(50),
+                      POLY_FIX(50),POLY_FIX(80),0xFFFF00FF);
+    Poly_FillTriangle(&s,POLY_FIX(40),POLY_FIX(45),POLY_FIX(50),POLY_FIX(45),
+                      POLY_FIX(60),POLY_FIX(45),0xFFFFFFFF);
+    failures += Golden_Check("poly-triangles",&s);
+
+    /* Star with both rules, concave polygon and self-intersecting quadrilateral */
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    star(p,55,15,14);
+    Poly_Fill(&s,p,5,0xFFFFFF00,POLY_EVENODD);
+    star(p,67,38,14);
+    Poly_Fill(&s,p,5,0xFF00C0FF,POLY_NONZERO);
+    Poly_Fill(&s,concave,sizeof(concave)/sizeof(concave[0]),0xFFFF8000,POLY_EVENODD);
+    Poly_Fill(&s,bowtie,4,0xFFFF0080,POLY_NONZERO);
+    failures += Golden_Check("poly-shapes",&s);
+
+    /* Stars crossing the borders, in RGB565 */
+    initsurface(&s,LCD_FORMAT_RGB565,RGB565(32,64,128));
+    star(p,5,5,30);
+    Poly_Fill(&s,p,5,RGB565(255,255,0),POLY_NONZERO);
+    star(p,75,50,25);
+    Poly_Fill(&s,p,5,RGB565(255,0,0),POLY_EVENODD);
+    star(p,40,70,20);
+    Poly_Fill(&s,p,5,RGB565(255,255,255),POLY_NONZERO);
+    failures += Golden_Check("poly-rgb565",&s);
+
+    if( Golden_Update )
+        return 0;
+
+    /* Pixel centers against the point in polygon test */
+    star(p,40,30,28);
+    checkinside("Star even-odd",p,5,POLY_EVENODD);
+    checkinside("Star nonzero",p,5,POLY_NONZERO);
+    checkinside("Concave",concave,sizeof(concave)/sizeof(concave[0]),POLY_EVENODD);
+    checkinside("Bow tie",bowtie,4,POLY_NONZERO);
+    srand(1);
+    for(i=0;i<100;i++) {
+        p[0].x = rand()%POLY_FIX(W+40)-POLY_FIX(20);
+        p[0].y = rand()%POLY_FIX(H+40)-POLY_FIX(20);
+        p[1].x = rand()%POLY_FIX(W+40)-POLY_FIX(20);
+        p[1].y = rand()%POLY_FIX(H+40)-POLY_FIX(20);
+        p[2].x = rand()%POLY_FIX(W+40)-POLY_FIX(20);
+        p[2].y = rand()%POLY_FIX(H+40)-POLY_FIX(20);
+        checkinside("Random triangle",p,3,POLY_EVENODD);
+    }
+
+    /* Adjacent triangles neither overlap nor leave gaps */
+    for(i=1;i<=20;i++)
+        checkmesh(i);
+
+    /* Too many edges */
+    for(i=0;i<=POLY_MAXEDGES;i++) {
+        p[i].x = POLY_FIX(i);
+        p[i].y = POLY_FIX(i%2);
+    }
+    initsurface(&s,LCD_FORMAT_ARGB8888,0xFF000000);
+    CHECK(Poly_Fill(&s,p,POLY_MAXEDGES+1,0xFFFFFFFF,POLY_EVENODD) == -1);
+    CHECK(Poly_Fill(&s,p,POLY_MAXEDGES,0xFFFFFFFF,POLY_EVENODD) == 0);
+
+    checkclipping();
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
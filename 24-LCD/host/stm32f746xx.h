@@ -0,0 +1,252 @@
+#ifndef STM32F746XX_H
+#define STM32F746XX_H
+/**
+ * @file    stm32f746xx.h
+ *
+ * @note    Replacement of the CMSIS device header to compile lcd.c and the drawing
+ *          modules on a host
+ *
+ * @note    Only the LTDC and what lcd.c uses are defined. The registers are variables
+ *          (lcdhost.c) and the core functions (interrupt masking, NVIC) do nothing.
+ *          The host tests use the surfaces, not the controller.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+
+#define __IO    volatile
+
+typedef enum {
+    LTDC_IRQn           = 88,
+    LTDC_ER_IRQn        = 89
+} IRQn_Type;
+
+/**
+ * @brief   Registers (same layout as the device)
+ */
+///@{
+typedef struct {
+    uint32_t        RESERVED0[2];
+    __IO uint32_t   SSCR;               ///< 0x08 Synchronization size
+    __IO uint32_t   BPCR;               ///< 0x0C Back porch
+    __IO uint32_t   AWCR;               ///< 0x10 Active width
+    __IO uint32_t   TWCR;               ///< 0x14 Total width
+    __IO uint32_t   GCR;                ///< 0x18 Global control
+    uint32_t        RESERVED1[2];
+    __IO uint32_t   SRCR;               ///< 0x24 Shadow reload
+    uint32_t        RESERVED2[1];
+    __IO uint32_t   BCCR;               ///< 0x2C Background color
+    uint32_t        RESERVED3[1];
+    __IO uint32_t   IER;                ///< 0x34 Interrupt enable
+    __IO uint32_t   ISR;                ///< 0x38 Interrupt status
+    __IO uint32_t   ICR;                ///< 0x3C Interrupt clear
+    __IO uint32_t   LIPCR;              ///< 0x40 Line interrupt position
+    __IO uint32_t   CPSR;               ///< 0x44 Current position
+    __IO uint32_t   CDSR;               ///< 0x48 Current display status
+} LTDC_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CR;                 ///< 0x84 Control
+    __IO uint32_t   WHPCR;              ///< 0x88 Window horizontal position
+    __IO uint32_t   WVPCR;              ///< 0x8C Window vertical position
+    __IO uint32_t   CKCR;               ///< 0x90 Color keying
+    __IO uint32_t   PFCR;               ///< 0x94 Pixel format
+    __IO uint32_t   CACR;               ///< 0x98 Constant alpha
+    __IO uint32_t   DCCR;               ///< 0x9C Default color
+    __IO uint32_t   BFCR;               ///< 0xA0 Blending factors
+    uint32_t        RESERVED0[2];
+    __IO uint32_t   CFBAR;              ///< 0xAC Frame buffer address
+    __IO uint32_t   CFBLR;              ///< 0xB0 Frame buffer length
+    __IO uint32_t   CFBLNR;             ///< 0xB4 Frame buffer line number
+    uint32_t        RESERVED1[3];
+    __IO uint32_t   CLUTWR;             ///< 0xC4 CLUT write
+} LTDC_Layer_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CR;
+    __IO uint32_t   AHB1ENR;
+    __IO uint32_t   APB2ENR;
+    __IO uint32_t   DCKCFGR1;
+    __IO uint32_t   BDCR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t   MODER;
+    __IO uint32_t   OTYPER;
+    __IO uint32_t   OSPEEDR;
+    __IO uint32_t   PUPDR;
+    __IO uint32_t   IDR;
+    __IO uint32_t   ODR;
+    __IO uint32_t   BSRR;
+    __IO uint32_t   LCKR;
+    __IO uint32_t   AFR[2];
+} GPIO_TypeDef;
+///@}
+
+extern LTDC_TypeDef         LCDHost_LTDC;
+extern LTDC_Layer_TypeDef   LCDHost_Layer[2];
+extern RCC_TypeDef          LCDHost_RCC;
+extern GPIO_TypeDef         LCDHost_GPIO[11];
+
+#define LTDC                    (&LCDHost_LTDC)
+#define LTDC_Layer1             (&LCDHost_Layer[0])
+#define LTDC_Layer2             (&LCDHost_Layer[1])
+#define RCC                     (&LCDHost_RCC)
+#define GPIOA                   (&LCDHost_GPIO[0])
+#define GPIOB                   (&LCDHost_GPIO[1])
+#define GPIOC                   (&LCDHost_GPIO[2])
+#define GPIOD                   (&LCDHost_GPIO[3])
+#define GPIOE                   (&LCDHost_GPIO[4])
+#define GPIOF                   (&LCDHost_GPIO[5])
+#define GPIOG                   (&LCDHost_GPIO[6])
+#define GPIOH                   (&LCDHost_GPIO[7])
+#define GPIOI                   (&LCDHost_GPIO[8])
+#define GPIOJ                   (&LCDHost_GPIO[9])
+#define GPIOK                   (&LCDHost_GPIO[10])
+
+/**
+ * @brief   Register fields
+ */
+///@{
+#define RCC_CR_HSION                    (1UL<<0)
+#define RCC_CR_HSIRDY                   (1UL<<1)
+#define RCC_CR_HSEON                    (1UL<<16)
+#define RCC_CR_HSERDY                   (1UL<<17)
+#define RCC_CR_HSEBYP                   (1UL<<18)
+#define RCC_CR_PLLON                    (1UL<<24)
+#define RCC_CR_PLLRDY                   (1UL<<25)
+#define RCC_CR_PLLI2SON                 (1UL<<26)
+#define RCC_CR_PLLI2SRDY                (1UL<<27)
+#define RCC_CR_PLLSAION                 (1UL<<28)
+#define RCC_CR_PLLSAIRDY                (1UL<<29)
+#define RCC_BDCR_LSEON                  (1UL<<0)
+#define RCC_BDCR_LSERDY                 (1UL<<1)
+#define RCC_BDCR_LSEBYP                 (1UL<<2)
+#define RCC_AHB1ENR_GPIOEEN             (1UL<<4)
+#define RCC_AHB1ENR_GPIOGEN             (1UL<<6)
+#define RCC_AHB1ENR_GPIOHEN             (1UL<<7)
+#define RCC_AHB1ENR_GPIOIEN             (1UL<<8)
+#define RCC_AHB1ENR_GPIOJEN             (1UL<<9)
+#define RCC_AHB1ENR_GPIOKEN             (1UL<<10)
+#define RCC_APB2ENR_LTDCEN              (1UL<<26)
+#define RCC_DCKCFGR1_PLLSAIDIVR_Pos     (16)
+#define RCC_DCKCFGR1_PLLSAIDIVR         (3UL<<16)
+
+#define GPIO_MODER_MODER0_Pos           (0)
+#define GPIO_MODER_MODER0_Msk           (3UL<<0)
+#define GPIO_MODER_MODER1_Pos           (2)
+#define GPIO_MODER_MODER1_Msk           (3UL<<2)
+#define GPIO_MODER_MODER2_Pos           (4)
+#define GPIO_MODER_MODER2_Msk           (3UL<<4)
+#define GPIO_MODER_MODER3_Pos           (6)
+#define GPIO_MODER_MODER3_Msk           (3UL<<6)
+#define GPIO_MODER_MODER4_Pos           (8)
+#define GPIO_MODER_MODER4_Msk           (3UL<<8)
+#define GPIO_MODER_MODER5_Pos           (10)
+#define GPIO_MODER_MODER5_Msk           (3UL<<10)
+#define GPIO_MODER_MODER6_Pos           (12)
+#define GPIO_MODER_MODER6_Msk           (3UL<<12)
+#define GPIO_MODER_MODER7_Pos           (14)
+#define GPIO_MODER_MODER7_Msk           (3UL<<14)
+#define GPIO_MODER_MODER8_Pos           (16)
+#define GPIO_MODER_MODER8_Msk           (3UL<<16)
+#define GPIO_MODER_MODER9_Pos           (18)
+#define GPIO_MODER_MODER9_Msk           (3UL<<18)
+#define GPIO_MODER_MODER10_Pos          (20)
+#define GPIO_MODER_MODER10_Msk          (3UL<<20)
+#define GPIO_MODER_MODER11_Pos          (22)
+#define GPIO_MODER_MODER11_Msk          (3UL<<22)
+#define GPIO_MODER_MODER12_Pos          (24)
+#define GPIO_MODER_MODER12_Msk          (3UL<<24)
+#define GPIO_MODER_MODER13_Pos          (26)
+#define GPIO_MODER_MODER13_Msk          (3UL<<26)
+#define GPIO_MODER_MODER14_Pos          (28)
+#define GPIO_MODER_MODER14_Msk          (3UL<<28)
+#define GPIO_MODER_MODER15_Pos          (30)
+#define GPIO_MODER_MODER15_Msk          (3UL<<30)
+#define GPIO_AFRL_AFRL0_Pos             (0)
+#define GPIO_AFRL_AFRL0_Msk             (15UL<<0)
+#define GPIO_AFRL_AFRL1_Pos             (4)
+#define GPIO_AFRL_AFRL1_Msk             (15UL<<4)
+#define GPIO_AFRL_AFRL2_Pos             (8)
+#define GPIO_AFRL_AFRL2_Msk             (15UL<<8)
+#define GPIO_AFRL_AFRL3_Pos             (12)
+#define GPIO_AFRL_AFRL3_Msk             (15UL<<12)
+#define GPIO_AFRL_AFRL4_Pos             (16)
+#define GPIO_AFRL_AFRL4_Msk             (15UL<<16)
+#define GPIO_AFRL_AFRL5_Pos             (20)
+#define GPIO_AFRL_AFRL5_Msk             (15UL<<20)
+#define GPIO_AFRL_AFRL6_Pos             (24)
+#define GPIO_AFRL_AFRL6_Msk             (15UL<<24)
+#define GPIO_AFRL_AFRL7_Pos             (28)
+#define GPIO_AFRL_AFRL7_Msk             (15UL<<28)
+
+#define LTDC_SSCR_VSH_Pos               (0)
+#define LTDC_SSCR_HSW_Pos               (16)
+#define LTDC_BPCR_AVBP_Pos              (0)
+#define LTDC_BPCR_AVBP_Msk              (0x7FFUL<<0)
+#define LTDC_BPCR_AHBP_Pos              (16)
+#define LTDC_BPCR_AHBP_Msk              (0xFFFUL<<16)
+#define LTDC_AWCR_AAH_Pos               (0)
+#define LTDC_AWCR_AAW_Pos               (16)
+#define LTDC_TWCR_TOTALH_Pos            (0)
+#define LTDC_TWCR_TOTALW_Pos            (16)
+#define LTDC_GCR_LTDCEN                 (1UL<<0)
+#define LTDC_GCR_PCPOL                  (1UL<<28)
+#define LTDC_GCR_DEPOL                  (1UL<<29)
+#define LTDC_GCR_VSPOL                  (1UL<<30)
+#define LTDC_GCR_HSPOL                  (1UL<<31)
+#define LTDC_SRCR_IMR                   (1UL<<0)
+#define LTDC_SRCR_VBR                   (1UL<<1)
+#define LTDC_IER_LIE                    (1UL<<0)
+#define LTDC_IER_FUIE                   (1UL<<1)
+#define LTDC_IER_TERRIE                 (1UL<<2)
+#define LTDC_IER_RRIE                   (1UL<<3)
+#define LTDC_ISR_LIF                    (1UL<<0)
+#define LTDC_ISR_FUIF                   (1UL<<1)
+#define LTDC_ISR_TERRIF                 (1UL<<2)
+#define LTDC_ISR_RRIF                   (1UL<<3)
+#define LTDC_ICR_CLIF                   (1UL<<0)
+#define LTDC_ICR_CFUIF                  (1UL<<1)
+#define LTDC_ICR_CTERRIF                (1UL<<2)
+#define LTDC_ICR_CRRIF                  (1UL<<3)
+#define LTDC_LIPCR_LIPOS_Pos            (0)
+
+#define LTDC_LxCR_LEN                   (1UL<<0)
+#define LTDC_LxCR_COLKEN                (1UL<<1)
+#define LTDC_LxCR_CLUTEN                (1UL<<4)
+#define LTDC_LxWHPCR_WHSTPOS_Pos        (0)
+#define LTDC_LxWHPCR_WHSTPOS_Msk        (0xFFFUL<<0)
+#define LTDC_LxWHPCR_WHSPPOS_Pos        (16)
+#define LTDC_LxWVPCR_WVSTPOS_Pos        (0)
+#define LTDC_LxWVPCR_WVSTPOS_Msk        (0x7FFUL<<0)
+#define LTDC_LxWVPCR_WVSPPOS_Pos        (16)
+#define LTDC_LxBFCR_BF2_Pos             (0)
+#define LTDC_LxBFCR_BF1_Pos             (8)
+#define LTDC_LxCFBLR_CFBLL_Pos          (0)
+#define LTDC_LxCFBLR_CFBLL_Msk          (0x1FFFUL<<0)
+#define LTDC_LxCFBLR_CFBP_Pos           (16)
+#define LTDC_LxCFBLR_CFBP_Msk           (0x1FFFUL<<16)
+#define LTDC_LxCFBLNR_CFBLNBR_Pos       (0)
+#define LTDC_LxCFBLNR_CFBLNBR_Msk       (0x7FFUL<<0)
+#define LTDC_LxCLUTWR_CLUTADD_Pos       (24)
+///@}
+
+/**
+ * @brief   Core functions (do nothing)
+ */
+///@{
+static inline uint32_t __get_PRIMASK(void)              { return 0; }
+static inline void     __set_PRIMASK(uint32_t primask)  { (void) primask; }
+static inline void     __disable_irq(void)              {}
+static inline void     __enable_irq(void)               {}
+static inline void     __NOP(void)                      {}
+static inline void     __DSB(void)                      {}
+static inline void     NVIC_EnableIRQ(IRQn_Type irqn)   { (void) irqn; }
+static inline void     NVIC_DisableIRQ(IRQn_Type irqn)  { (void) irqn; }
+static inline void     NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+                                                        { (void) irqn; (void) priority; }
+///@}
+
+#endif
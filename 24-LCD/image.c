@@ -0,0 +1,325 @@
+/**
+ * @file    image.c
+ *
+ * @note    Streaming decoders for compressed images
+ *
+ * @note    QOI (https://qoiformat.org/qoi-specification.pdf) has good compression for
+ *          drawings and photos and is very simple to decode. The decoded pixels are
+ *          ARGB8888.
+ *
+ * @note    RLE stores pixels already in a LCD_FORMAT_* format. It is faster to decode
+ *          and good for flat images (icons, buttons). Little endian header:
+ *
+ *          Offset | Size | Contents
+ *          -------|------|----------------------------------
+ *             0   |  4   | "RLE1"
+ *             4   |  2   | Width
+ *             6   |  2   | Height
+ *             8   |  1   | Format (LCD_FORMAT_*)
+ *             9   |  3   | 0
+ *
+ *          followed by packets. The control byte c has in bit 7 the type and in bits
+ *          6-0 the count n-1. When bit 7 is 1, the next pixel is repeated n times,
+ *          otherwise n pixels follow. Packets can cross rows.
+ *
+ * @note    Each row is decoded into a buffer in .bss (DTCM) and then converted and
+ *          copied into the surface using Pixel_ConvertSurface, that clips it.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "image.h"
+
+/**
+ * @brief   Row buffer
+ */
+static uint32_t rowbuffer[IMAGE_MAXWIDTH];
+
+/**
+ * @brief   QOI opcodes
+ */
+///@{
+#define QOI_OP_INDEX            0x00
+#define QOI_OP_DIFF             0x40
+#define QOI_OP_LUMA             0x80
+#define QOI_OP_RUN              0xC0
+#define QOI_OP_RGB              0xFE
+#define QOI_OP_RGBA             0xFF
+#define QOI_MASK                0xC0
+#define QOI_HASH(C)             ((((C)>>16&0xFF)*3+((C)>>8&0xFF)*5+((C)&0xFF)*7+((C)>>24)*11)&63)
+///@}
+
+/**
+ * @brief   Image_Refill
+ *
+ * @note    Get more data from the read function. Returns the next byte. After the end,
+ *          returns 0 and sets eof
+ */
+int
+Image_Refill(Image_Reader *r) {
+int n;
+
+    if( r->read ) {
+        n = r->read(r->ctx,r->buffer,IMAGE_READERBUFSIZE);
+        if( n > 0 ) {
+            r->p   = r->buffer;
+            r->end = r->buffer+n;
+            return *r->p++;
+        }
+    }
+    r->eof = 1;
+    return 0;
+}
+
+/**
+ * @brief   Get n bytes
+ */
+static void getbytes(Image_Reader *r, uint8_t *dst, int n) {
+int k;
+
+    while( n > 0 ) {
+        k = r->end-r->p;
+        if( k == 0 ) {
+            *dst++ = Image_Refill(r);
+            n--;
+            if( r->eof )
+                return;
+            continue;
+        }
+        if( k > n )
+            k = n;
+        memcpy(dst,r->p,k);
+        r->p += k;
+        dst  += k;
+        n    -= k;
+    }
+}
+
+/**
+ * @brief   Copy a decoded row into the surface
+ */
+static void putrow(const LCD_Surface *s, int x, int y, int format, int w) {
+LCD_Surface row;
+
+    if( (y < s->y) || (y >= s->y+s->h) )
+        return;
+    LCD_InitSurface(&row,rowbuffer,format,x,y,w,1,0);
+    Pixel_ConvertSurface(s,x,y,&row);
+}
+
+/**
+ * @brief   Image_InitMemoryReader
+ *
+ * @note    Data is read directly from memory (e.g. memory-mapped flash)
+ */
+void
+Image_InitMemoryReader(Image_Reader *r, const void *data, int size) {
+
+    r->p    = (const uint8_t *) data;
+    r->end  = r->p+size;
+    r->read = 0;
+    r->ctx  = 0;
+    r->eof  = 0;
+}
+
+/**
+ * @brief   Image_InitStreamReader
+ *
+ * @note    Data is read in chunks of up to IMAGE_READERBUFSIZE bytes by calling read
+ */
+void
+Image_InitStreamReader(Image_Reader *r, Image_ReadFunction read, void *ctx) {
+
+    r->p    = r->buffer;
+    r->end  = r->buffer;
+    r->read = read;
+    r->ctx  = ctx;
+    r->eof  = 0;
+}
+
+/**
+ * @brief   Image_ReadHeader
+ *
+ * @return  0 if OK, -1 if not a QOI or RLE image, -2 if too wide
+ */
+int
+Image_ReadHeader(Image_Reader *r, Image_Info *info) {
+uint8_t h[14];
+
+    getbytes(r,h,4);
+    if( r->eof )
+        return -1;
+    if( memcmp(h,"qoif",4) == 0 ) {
+        getbytes(r,h+4,10);
+        info->type   = IMAGE_QOI;
+        info->w      = (h[6]<<8)|h[7];          // only 16 bits are used
+        info->h      = (h[10]<<8)|h[11];
+        info->format = LCD_FORMAT_ARGB8888;
+        if( h[4] || h[5] || h[8] || h[9] )
+            return -2;
+    } else if( memcmp(h,"RLE1",4) == 0 ) {
+        getbytes(r,h+4,8);
+        info->type   = IMAGE_RLE;
+        info->w      = h[4]|(h[5]<<8);
+        info->h      = h[6]|(h[7]<<8);
+        info->format = h[8];
+        if( info->format > LCD_FORMAT_AL88 )
+            return -1;
+    } else {
+        return -1;
+    }
+    if( r->eof )
+        return -1;
+    if( info->w > IMAGE_MAXWIDTH )
+        return -2;
+    return 0;
+}
+
+/*
+ * @brief   Decode QOI data
+ */
+static void decodeqoi(Image_Reader *r, const Image_Info *info, const LCD_Surface *s, int x, int y) {
+uint32_t index[64];
+uint32_t px = 0xFF000000;
+uint32_t *row = rowbuffer;
+unsigned rr,g,b;
+int run = 0;
+int i,j,b1,b2,vg;
+
+    memset(index,0,sizeof(index));
+    for(j=0;j<info->h;j++) {
+        for(i=0;i<info->w;i++) {
+            if( run > 0 ) {
+                run--;
+            } else {
+                b1 = Image_GetByte(r);
+                if( b1 == QOI_OP_RGB ) {
+                    rr = Image_GetByte(r);
+                    g  = Image_GetByte(r);
+                    b  = Image_GetByte(r);
+                    px = (px&0xFF000000)|(rr<<16)|(g<<8)|b;
+                } else if( b1 == QOI_OP_RGBA ) {
+                    rr = Image_GetByte(r);
+                    g  = Image_GetByte(r);
+                    b  = Image_GetByte(r);
+                    px = ((uint32_t) Image_GetByte(r)<<24)|(rr<<16)|(g<<8)|b;
+                } else {
+                    switch( b1&QOI_MASK ) {
+                    case QOI_OP_INDEX:
+                        px = index[b1];
+                        break;
+                    case QOI_OP_DIFF:
+                        rr = ((px>>16)+((b1>>4)&3)-2)&0xFF;
+                        g  = ((px>>8)+((b1>>2)&3)-2)&0xFF;
+                        b  = (px+(b1&3)-2)&0xFF;
+                        px = (px&0xFF000000)|(rr<<16)|(g<<8)|b;
+                        break;
+                    case QOI_OP_LUMA:
+                        b2 = Image_GetByte(r);
+                        vg = (b1&0x3F)-32;
+                        rr = ((px>>16)+vg-8+((b2>>4)&0xF))&0xFF;
+                        g  = ((px>>8)+vg)&0xFF;
+                        b  = (px+vg-8+(b2&0xF))&0xFF;
+                        px = (px&0xFF000000)|(rr<<16)|(g<<8)|b;
+                        break;
+                    case QOI_OP_RUN:
+                        run = b1&0x3F;
+                        break;
+                    }
+                }
+                index[QOI_HASH(px)] = px;
+            }
+            row[i] = px;
+        }
+        putrow(s,x,y+j,LCD_FORMAT_ARGB8888,info->w);
+    }
+}
+
+/*
+ * @brief   Decode RLE data
+ */
+static void decoderle(Image_Reader *r, const Image_Info *info, const LCD_Surface *s, int x, int y) {
+uint8_t *row = (uint8_t *) rowbuffer;
+uint8_t pixel[4];
+int ps = LCD_GetFormatPixelSize(info->format);
+int cnt = 0, literal = 0;
+int i,j,k,n,c;
+
+    for(j=0;j<info->h;j++) {
+        n = 0;
+        while( n < info->w ) {
+            if( cnt == 0 ) {
+                c = Image_GetByte(r);
+                if( r->eof )
+                    return;
+                cnt     = (c&0x7F)+1;
+                literal = (c&0x80) == 0;
+                if( !literal )
+                    getbytes(r,pixel,ps);
+            }
+            k = info->w-n;
+            if( k > cnt )
+                k = cnt;
+            if( literal ) {
+                getbytes(r,row+n*ps,k*ps);
+            } else if( ps == 2 ) {
+                for(i=0;i<k;i++) {
+                    row[(n+i)*2]   = pixel[0];
+                    row[(n+i)*2+1] = pixel[1];
+                }
+            } else {
+                for(i=0;i<k*ps;i++)
+                    row[n*ps+i] = pixel[i%ps];
+            }
+            cnt -= k;
+            n   += k;
+        }
+        putrow(s,x,y+j,info->format,info->w);
+    }
+}
+
+/**
+ * @brief   Image_DecodeData
+ *
+ * @note    Decode the image described by info (read by Image_ReadHeader) into s with
+ *          its top left corner at (x,y). Clipped against the surface.
+ *
+ * @return  0 if OK, -1 if the image type is unknown, -3 if the data ended too soon
+ */
+int
+Image_DecodeData(Image_Reader *r, const Image_Info *info, const LCD_Surface *s, int x, int y) {
+
+    switch(info->type) {
+    case IMAGE_QOI:
+        decodeqoi(r,info,s,x,y);
+        break;
+    case IMAGE_RLE:
+        decoderle(r,info,s,x,y);
+        break;
+    default:
+        return -1;
+    }
+    return r->eof ? -3 : 0;
+}
+
+/**
+ * @brief   Image_Decode
+ *
+ * @note    Read header and decode image into s at (x,y)
+ *
+ * @return  0 if OK, negative values as Image_ReadHeader and Image_DecodeData
+ */
+int
+Image_Decode(Image_Reader *r, const LCD_Surface *s, int x, int y) {
+Image_Info info;
+int rc;
+
+    rc = Image_ReadHeader(r,&info);
+    if( rc < 0 )
+        return rc;
+    return Image_DecodeData(r,&info,s,x,y);
+}
@@ -0,0 +1,92 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+/**
+ * @file    image.h
+ *
+ * @note    Streaming decoders for compressed images (QOI and RLE)
+ *
+ * @note    Images are decoded a row at a time into a buffer in internal RAM and each
+ *          row is converted into the surface format. No buffer for the whole image is
+ *          needed. Images are generated by tools/mkimage.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * @brief   Limits
+ *
+ * @note    IMAGE_MAXWIDTH sets the size of the row buffer (4 bytes per pixel)
+ */
+///@{
+#ifndef IMAGE_MAXWIDTH
+#define IMAGE_MAXWIDTH          LCD_DW
+#endif
+#ifndef IMAGE_READERBUFSIZE
+#define IMAGE_READERBUFSIZE     256
+#endif
+///@}
+
+/**
+ * @brief   Image types
+ */
+///@{
+#define IMAGE_QOI               (1)     ///< Quite OK Image format (qoiformat.org)
+#define IMAGE_RLE               (2)     ///< Run length encoding of pixels in any format
+///@}
+
+/**
+ * @brief   Function that reads up to n bytes into buf
+ *
+ * @note    Returns the number of bytes read. 0 or less at end of data
+ */
+typedef int (*Image_ReadFunction)(void *ctx, uint8_t *buf, int n);
+
+/**
+ * @brief   Source of compressed data
+ *
+ * @note    For data in memory (e.g. memory-mapped flash), bytes are read directly.
+ *          Otherwise the read function is called to fill the buffer.
+ */
+typedef struct {
+    const uint8_t      *p;          ///< Next byte
+    const uint8_t      *end;        ///< End of bytes available
+    Image_ReadFunction  read;       ///< Function to get more data (0 = memory)
+    void               *ctx;        ///< Parameter for read
+    int                 eof;        ///< Read past end of data
+    uint8_t             buffer[IMAGE_READERBUFSIZE];
+} Image_Reader;
+
+/**
+ * @brief   Image information (from header)
+ */
+typedef struct {
+    int         type;               ///< IMAGE_QOI or IMAGE_RLE
+    int         w;                  ///< Width in pixels
+    int         h;                  ///< Height in pixels
+    int         format;             ///< Format of the decoded pixels (LCD_FORMAT_*)
+} Image_Info;
+
+int  Image_Refill(Image_Reader *r);
+
+/**
+ * @brief   Image_GetByte
+ *
+ * @note    Returns the next byte of compressed data. At the end, returns 0 and sets eof
+ */
+static inline int Image_GetByte(Image_Reader *r) {
+
+    if( r->p < r->end )
+        return *r->p++;
+    return Image_Refill(r);
+}
+
+void Image_InitMemoryReader(Image_Reader *r, const void *data, int size);
+void Image_InitStreamReader(Image_Reader *r, Image_ReadFunction read, void *ctx);
+int  Image_ReadHeader(Image_Reader *r, Image_Info *info);
+int  Image_DecodeData(Image_Reader *r, const Image_Info *info, const LCD_Surface *s, int x, int y);
+int  Image_Decode(Image_Reader *r, const LCD_Surface *s, int x, int y);
+
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @file    img_landscape_jpg.c
+ *
+ * @note    Generated by mkimage from landscape.jpg. Do not edit
+ */
+
+#include <stdint.h>
+
+const int img_landscape_jpg_size = 3396;
+
+const uint8_t img_landscape_jpg[] = {
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,0x00,0x08,0x06,0x06,0x07,0x06,0x05,0x08,
+    0x07,0x07,0x07,0x09,0x09,0x08,0x0A,0x0C,0x14,0x0D,0x0C,0x0B,0x0B,0x0C,0x19,0x12,
+    0x13,0x0F,0x14,0x1D,0x1A,0x1F,0x1E,0x1D,0x1A,0x1C,0x1C,0x20,0x24,0x2E,0x27,0x20,
+    0x22,0x2C,0x23,0x1C,0x1C,0x28,0x37,0x29,0x2C,0x30,0x31,0x34,0x34,0x34,0x1F,0x27,
+    0x39,0x3D,0x38,0x32,0x3C,0x2E,0x33,0x34,0x32,0xFF,0xDB,0x00,0x43,0x01,0x09,0x09,
+    0x09,0x0C,0x0B,0x0C,0x18,0x0D,0x0D,0x18,0x32,0x21,0x1C,0x21,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0xFF,0xC0,
+    0x00,0x11,0x08,0x00,0x88,0x00,0xF0,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1B,0x00,0x01,0x01,0x00,0x02,0x03,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x05,0x06,0x01,0x04,0x07,0x02,0xFF,0xC4,
+    0x00,0x36,0x10,0x00,0x01,0x03,0x03,0x03,0x02,0x03,0x05,0x08,0x02,0x02,0x03,0x00,
+    0x00,0x00,0x00,0x01,0x00,0x02,0x12,0x03,0x04,0x11,0x05,0x21,0x31,0x41,0x51,0x06,
+    0x61,0x71,0x13,0x22,0x81,0x91,0xA1,0x14,0x15,0x23,0x32,0x42,0xB1,0xC1,0xF0,0x33,
+    0x52,0x72,0xE1,0x62,0xC2,0xF1,0xFF,0xC4,0x00,0x1A,0x01,0x01,0x01,0x00,0x03,0x01,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x03,0x04,
+    0x01,0x06,0xFF,0xC4,0x00,0x27,0x11,0x00,0x02,0x02,0x02,0x01,0x05,0x00,0x01,0x04,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x01,0x02,0x03,0x11,0x13,0x04,0x05,
+    0x21,0x31,0x41,0x81,0x06,0x15,0x22,0x32,0x51,0x61,0x91,0xFF,0xDD,0x00,0x04,0x00,
+    0x03,0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,0x3F,0x00,0xD4,
+    0xE2,0x91,0x56,0x82,0x41,0x7D,0xB7,0x21,0x21,0x48,0xC5,0x22,0xAD,0x04,0x82,0x72,
+    0x05,0x23,0x14,0x8A,0xB4,0x12,0x09,0xC8,0x14,0xFF,0xD0,0xD4,0xE2,0x91,0x56,0x82,
+    0x41,0x7D,0xB7,0x21,0x21,0x48,0xC5,0x22,0xAD,0x04,0x82,0x72,0x05,0x23,0x14,0x8A,
+    0xB4,0x12,0x09,0xC8,0x14,0xFF,0xD1,0xD4,0xE2,0x91,0x56,0x82,0x41,0x7D,0xB7,0x21,
+    0x21,0x48,0xC5,0x22,0xAD,0x04,0x82,0x72,0x05,0x23,0x14,0x8A,0xB4,0x12,0x09,0xC8,
+    0x14,0xFF,0xD2,0xD4,0xE2,0x91,0x56,0x82,0x41,0x7D,0xB7,0x21,0x21,0x48,0xC5,0x22,
+    0xAD,0x04,0x82,0x72,0x05,0x23,0x14,0x8A,0xB4,0x12,0x09,0xC8,0x14,0xFF,0xD3,0xD4,
+    0xE2,0x91,0x56,0x82,0x41,0x7D,0xB7,0x21,0x21,0x48,0xC5,0x22,0xAD,0x04,0x82,0x72,
+    0x05,0x23,0x14,0x8A,0xB4,0x12,0x09,0xC8,0x14,0xFF,0xD4,0xC0,0x45,0x22,0xAD,0x14,
+    0x8A,0xFA,0x9E,0x42,0x7A,0x91,0x8A,0x45,0x5A,0x29,0x14,0xE4,0x0A,0x46,0x29,0x15,
+    0x68,0xA4,0x53,0x90,0x29,0xFF,0xD5,0xC0,0x45,0x22,0xAD,0x14,0x8A,0xFA,0x9E,0x42,
+    0x7A,0x91,0x8A,0x45,0x5A,0x29,0x14,0xE4,0x0A,0x46,0x29,0x15,0x68,0xA4,0x53,0x90,
+    0x29,0xFF,0xD6,0xC0,0x45,0x22,0xAD,0x14,0x8A,0xFA,0x9E,0x42,0x7A,0x91,0x8A,0x45,
+    0x5A,0x29,0x14,0xE4,0x0A,0x46,0x29,0x15,0x68,0xA4,0x53,0x90,0x29,0xFF,0xD7,0xC0,
+    0x45,0x22,0xAD,0x14,0x8A,0xFA,0x9E,0x42,0x7A,0x91,0x8A,0x45,0x5A,0x29,0x14,0xE4,
+    0x0A,0x46,0x29,0x15,0x68,0xA4,0x53,0x90,0x29,0xFF,0xD0,0xC0,0x45,0x22,0xAD,0x14,
+    0x8A,0xFA,0x9E,0x42,0x7A,0x91,0x8A,0x45,0x5A,0x29,0x14,0xE4,0x0A,0x46,0x29,0x15,
+    0x68,0xA4,0x53,0x90,0x29,0xFF,0xD1,0xC6,0x45,0x22,0xAD,0x14,0x8A,0xBA,0xE7,0x32,
+    0x91,0x8A,0x45,0x5A,0x29,0x14,0x70,0xA4,0x62,0x91,0x56,0x8A,0x45,0x1C,0x29,0xFF,
+    0xD2,0xC6,0x45,0x22,0xAD,0x14,0x8A,0xBA,0xE7,0x32,0x91,0x8A,0x45,0x5A,0x29,0x14,
+    0x70,0xA4,0x62,0x91,0x56,0x8A,0x45,0x1C,0x29,0xFF,0xD3,0xC6,0x45,0x22,0xAD,0x14,
+    0x8A,0xBA,0xE7,0x32,0x91,0x8A,0x45,0x5A,0x29,0x14,0x70,0xA4,0x62,0x91,0x56,0x8A,
+    0x45,0x1C,0x29,0xFF,0xD4,0xC6,0x45,0x22,0xAD,0x15,0x91,0xD2,0x34,0x4B,0xAD,0x66,
+    0xE7,0xD9,0x5B,0x80,0x1A,0xDD,0xDF,0x51,0xDC,0x34,0x7F,0x7A,0x2B,0x59,0x33,0xD7,
+    0x1D,0x66,0xF7,0x9D,0x44,0x1C,0xF1,0x49,0x99,0xD4,0x18,0x88,0xA4,0x57,0xAA,0x58,
+    0x78,0x3B,0x49,0xB3,0x60,0xF6,0xB4,0x7E,0xD3,0x53,0xAB,0xEA,0xF1,0xF2,0xE1,0x77,
+    0xDF,0xA0,0xE9,0x15,0x19,0x17,0x69,0xB6,0xA0,0x7F,0xE3,0x48,0x34,0xFC,0xC2,0x89,
+    0x7F,0xD4,0x98,0x22,0xDA,0xAD,0x66,0x60,0xE9,0x8E,0x8A,0xDA,0xF3,0x27,0x8E,0x45,
+    0x22,0xBD,0x07,0x58,0xF0,0x35,0x17,0x53,0x75,0x6D,0x2D,0xC5,0x8F,0x1B,0xFB,0x17,
+    0xBB,0x20,0xFA,0x13,0xC7,0xC5,0x68,0xF5,0x28,0xBE,0x95,0x47,0x53,0xA8,0xD2,0xD7,
+    0xB4,0xE1,0xCD,0x23,0x04,0x15,0x4F,0xA4,0xEE,0x38,0x7A,0xAA,0xB6,0x39,0xFC,0x7D,
+    0x34,0x64,0xC3,0x6A,0x4E,0xA4,0xFF,0xD5,0xC6,0x45,0x22,0xAD,0x14,0x8A,0xBA,0xE7,
+    0x32,0x91,0x8A,0x45,0x5A,0x29,0x14,0x70,0xA4,0x62,0x91,0x56,0x8A,0x45,0x1C,0x29,
+    0xFF,0xD6,0x8C,0x52,0x2A,0xD1,0x48,0xAA,0x2E,0x62,0xA4,0x62,0x91,0x56,0x8A,0x45,
+    0x1C,0x29,0x18,0xA4,0x55,0xA2,0x91,0x47,0x0A,0x7F,0xFF,0xD7,0x8C,0x52,0x2A,0xD1,
+    0x48,0xAA,0x2E,0x62,0xA4,0x62,0x91,0x56,0x8A,0x45,0x1C,0x29,0x18,0xA4,0x55,0xA2,
+    0x91,0x47,0x0A,0x7F,0xFF,0xD0,0x8C,0x52,0x2A,0xD1,0x48,0xAA,0x2E,0x62,0xA4,0x62,
+    0x91,0x56,0x8A,0x45,0x1C,0x29,0x18,0xA4,0x55,0xA2,0x91,0x47,0x0A,0x7F,0xFF,0xD1,
+    0x88,0xA6,0x5C,0x40,0x03,0x24,0xEC,0x02,0xF5,0x7D,0x1B,0x4C,0xA7,0xA5,0x69,0x94,
+    0xAD,0xDA,0x04,0xF1,0x2A,0x8E,0x1F,0xA9,0xDD,0x57,0x9C,0xE9,0x8C,0x69,0xD5,0x6C,
+    0xC3,0xBF,0x29,0xAE,0xCC,0xFA,0x48,0x2F,0x56,0x53,0xBB,0xF6,0x7B,0x4C,0x53,0x1C,
+    0x7A,0xF6,0x74,0x74,0xD4,0x8F,0x32,0x11,0x11,0x7C,0xE1,0xD6,0x16,0x93,0xE3,0x7D,
+    0x29,0x8D,0x34,0xB5,0x2A,0x4D,0x00,0xBC,0xFB,0x3A,0xB8,0xEA,0x71,0xB1,0xFA,0x63,
+    0xE4,0xB7,0x65,0x85,0xF1,0x5B,0x5A,0xEF,0x0E,0xDC,0x67,0x90,0x59,0x8F,0x59,0x05,
+    0xDB,0xDB,0x73,0x5B,0x17,0x55,0x49,0xAF,0xD9,0xD7,0xFD,0x35,0x65,0xAC,0x5A,0x93,
+    0xB3,0xFF,0xD2,0x8C,0x52,0x2A,0xD1,0x48,0xAA,0x2E,0x62,0xA4,0x62,0x91,0x56,0x8A,
+    0x45,0x1C,0x29,0x18,0xA4,0x55,0xA2,0x91,0x47,0x0A,0x7F,0xFF,0xD3,0xB4,0x52,0x2A,
+    0xF0,0x48,0x2D,0xAE,0x6D,0x52,0x11,0x48,0xAB,0xC1,0x20,0x8E,0x14,0x84,0x52,0x2A,
+    0xF0,0x48,0x23,0x85,0x3F,0xFF,0xD4,0xB4,0x52,0x2A,0xF0,0x48,0x2D,0xAE,0x6D,0x52,
+    0x11,0x48,0xA5,0xE5,0xD5,0xBD,0x85,0x0F,0x6F,0x75,0x54,0x53,0xA7,0x90,0x32,0x77,
+    0xC9,0x3D,0x00,0x1B,0x95,0x3B,0x2D,0x46,0xCB,0x50,0x90,0xB5,0xB8,0x6D,0x47,0x37,
+    0x96,0xEE,0x1D,0xD3,0x7C,0x1D,0xF1,0xB8,0xDD,0x79,0xC8,0x63,0xE3,0x7A,0xDF,0x92,
+    0x91,0x48,0xAB,0xC1,0x20,0xBD,0x73,0x25,0x3F,0xFF,0xD5,0xB4,0x52,0x2A,0xF0,0x48,
+    0x2D,0xAE,0x6D,0x52,0x11,0x48,0xAB,0xC1,0x20,0x8E,0x14,0x84,0x52,0x2A,0xF0,0x48,
+    0x23,0x85,0x3F,0xFF,0xD6,0xEC,0x32,0x4C,0x7B,0x5E,0xD3,0x87,0x34,0xE4,0x1F,0x35,
+    0xEA,0x16,0x17,0x8C,0xBF,0xB1,0xA5,0x72,0xCC,0x61,0xED,0xDC,0x76,0x3D,0x42,0xF3,
+    0x48,0x2C,0x9E,0x8F,0xAB,0xD6,0xD2,0x6A,0x90,0x04,0xE8,0x3C,0xFB,0xEC,0xCF,0xD4,
+    0x79,0xAE,0x3E,0xE3,0xD3,0xCF,0x51,0x48,0x9A,0xFF,0x00,0x68,0x3A,0x71,0xCA,0xC9,
+    0xE8,0x28,0xBA,0x56,0x9A,0xB5,0x95,0xEB,0x41,0xA5,0x5D,0xB2,0x3F,0xA1,0xC7,0x0E,
+    0x1F,0x05,0xDB,0x75,0x46,0x31,0xB2,0x7B,0xDA,0xD6,0xF7,0x27,0x0B,0xE6,0x6D,0x4B,
+    0x56,0x75,0x68,0xD4,0x9D,0x3B,0x3E,0x96,0xAD,0xE3,0x2B,0xE6,0x8A,0x14,0xAC,0x58,
+    0x72,0xE7,0x1F,0x68,0xFC,0x74,0x03,0x81,0xFD,0xEC,0xBB,0xBA,0x97,0x89,0x6D,0x6D,
+    0x58,0xE6,0x5B,0x38,0x57,0xAD,0xD3,0x1F,0x94,0x7A,0x9E,0xBF,0x05,0xA5,0xD7,0xA9,
+    0x52,0xE6,0xBB,0xEB,0x56,0x71,0x75,0x47,0x9C,0xB8,0x95,0x5B,0xB6,0xF4,0x76,0xE4,
+    0x8C,0xB9,0x23,0x51,0x1E,0x8D,0x59,0x2D,0xE3,0x50,0x7F,0xFF,0xD7,0xB4,0x52,0x2A,
+    0xF0,0x48,0x2D,0xAE,0x6D,0x52,0x11,0x48,0xAB,0xC1,0x20,0x8E,0x14,0x84,0x52,0x2A,
+    0xF0,0x48,0x23,0x85,0x3F,0xFF,0xD0,0xC9,0xC5,0x22,0xAD,0x04,0x82,0xE7,0x73,0xAD,
+    0x48,0xC5,0x22,0xAD,0x04,0x82,0x38,0x52,0x31,0x48,0xAB,0x41,0x20,0x8E,0x14,0xFF,
+    0xD1,0xC9,0xC5,0x70,0xE8,0xB1,0x8E,0x7B,0xDC,0x1A,0xD6,0x8C,0x97,0x13,0x80,0x02,
+    0xBC,0x16,0xBB,0xE2,0xFB,0xE7,0x5A,0x69,0xAC,0xB7,0xA7,0x90,0xEB,0x92,0x41,0x77,
+    0x66,0x8C,0x64,0x73,0xD7,0x20,0x7A,0x65,0x68,0x73,0xA3,0x24,0xC6,0x3A,0x4D,0xA7,
+    0xE1,0xA7,0x6A,0xFA,0x9D,0x4D,0x5A,0xF1,0xD5,0x5E,0xE7,0x0A,0x4D,0x27,0xD8,0xB0,
+    0xED,0x16,0xE7,0xB7,0x7E,0xEB,0xAF,0x65,0x73,0x57,0x4F,0xBB,0xA7,0x71,0x40,0x81,
+    0x52,0x99,0xC8,0x04,0x64,0x1E,0x84,0x1F,0x2C,0x65,0x7C,0xB9,0xB8,0xE7,0x0B,0x82,
+    0xCD,0xCE,0x72,0xBC,0x62,0x1C,0xDE,0x66,0xCD,0xF4,0xF4,0xED,0x3A,0xF6,0x96,0xA5,
+    0x65,0x4E,0xE6,0x91,0x1E,0xF0,0xF7,0x9A,0x0E,0x60,0xEE,0xA0,0xFA,0x2E,0xD4,0x56,
+    0x85,0xE1,0xCD,0x63,0xEE,0xBB,0xB3,0x4E,0xB1,0x71,0xB5,0xAB,0xF9,0x80,0xDE,0x0E,
+    0xFF,0x00,0x6C,0x7D,0x0E,0x3E,0xB8,0x0B,0xD0,0xE0,0xBD,0x72,0xC7,0x4F,0x92,0x32,
+    0xD7,0x7F,0x4F,0xFF,0xD2,0xC9,0xC5,0x22,0xAD,0x05,0x0A,0xF7,0x76,0x96,0xCF,0x0C,
+    0xAF,0x73,0x46,0x93,0x88,0xCE,0x2A,0x54,0x0D,0x38,0xEF,0xBA,0xD0,0xE7,0x5C,0xC4,
+    0x47,0xB3,0x98,0xA4,0x55,0x59,0x1A,0x8C,0x6B,0xD8,0xE0,0xE6,0x38,0x65,0xAE,0x07,
+    0x20,0x8E,0xEB,0x98,0x23,0x85,0x23,0x14,0x8A,0xB4,0x12,0x0B,0xC7,0x0A,0x7F,0xFF,
+    0xD3,0xC9,0xC5,0x22,0xAD,0x05,0x8E,0xD6,0x75,0x5A,0x7A,0x3D,0xA3,0x6A,0xBA,0x9F,
+    0xB4,0xA8,0xF7,0x45,0x94,0xC3,0x80,0xCF,0x73,0xE8,0x3D,0x3A,0x8E,0xEB,0x43,0x9D,
+    0x56,0xD5,0x61,0xAD,0xE8,0xED,0xC5,0x22,0xB4,0xD6,0x78,0xC7,0x50,0x0F,0x05,0xF6,
+    0xF6,0xC5,0x80,0xFB,0xC0,0x07,0x02,0x47,0x91,0xC9,0xFD,0x96,0xD5,0xA6,0xEA,0xB6,
+    0x7A,0xAD,0x39,0x5B,0xBF,0x0F,0x19,0x95,0x27,0xE0,0x3D,0xBE,0x64,0x76,0xE3,0x74,
+    0x73,0x56,0x3C,0xF8,0xF2,0x4E,0xAB,0x27,0x62,0x2A,0x77,0x15,0xA8,0xDA,0xD0,0x7D,
+    0x7A,0xEF,0x6D,0x3A,0x4C,0x19,0x73,0x8F,0x45,0xD9,0x7C,0x69,0xB1,0xCF,0x7B,0x83,
+    0x5A,0xD1,0x92,0xE2,0x70,0x00,0xEE,0xB4,0x0F,0x11,0xEB,0x7F,0x7A,0xBC,0x50,0xA0,
+    0x31,0x69,0x4D,0xD9,0x04,0x8D,0xDE,0xE1,0xB6,0x7C,0x87,0x61,0xFF,0x00,0xC0,0x71,
+    0x9F,0x2C,0x62,0xAE,0xE7,0xD9,0xFF,0xD4,0xD2,0xF5,0xBD,0x66,0xAE,0xAF,0x70,0x03,
+    0x72,0xCB,0x66,0x1F,0xC3,0xA7,0xFF,0x00,0xB1,0xF3,0xFD,0xBE,0x64,0xF7,0x3C,0x35,
+    0xAD,0x1B,0x2A,0xED,0xB3,0xB8,0xA8,0x05,0xA3,0xCE,0xCE,0x79,0xFF,0x00,0x19,0xF5,
+    0xEC,0x4F,0x3F,0x3D,0xB7,0xCE,0x10,0x34,0xED,0xB1,0xCF,0xAA,0xE0,0xB4,0x97,0x63,
+    0x0B,0x9D,0x89,0xD1,0x9A,0xD1,0x77,0xDF,0x93,0xD5,0xE2,0x91,0x58,0xEF,0x0D,0xEA,
+    0x1F,0x78,0xE9,0x4C,0x9B,0xE5,0x5E,0x8F,0xE1,0xD4,0xC9,0xC9,0x3D,0x8F,0x39,0xDC,
+    0x75,0x3D,0x41,0x59,0x78,0x2F,0x5C,0xB5,0x49,0x8B,0xD6,0x2D,0x1F,0x48,0xC5,0x22,
+    0xAD,0x04,0x82,0xF1,0xCC,0x94,0xFF,0xD5,0xD8,0x22,0x91,0x5C,0x59,0xDC,0xD2,0xBF,
+    0xB4,0xA7,0x73,0x40,0x93,0x4E,0xA0,0xC8,0x90,0xC1,0x1D,0x08,0xF9,0xAB,0xC1,0x4B,
+    0x72,0x8C,0x44,0x4C,0x6E,0x08,0xC5,0x22,0xB5,0xAD,0x63,0xC5,0x8D,0xA4,0xE3,0x6F,
+    0xA6,0xC5,0xEF,0x04,0x87,0x56,0x70,0xCB,0x78,0xFD,0x3D,0xCE,0x7A,0x9D,0xB6,0xEA,
+    0xB0,0xB4,0x7C,0x4F,0xAB,0x51,0xAB,0xED,0x0D,0x71,0x54,0x13,0x92,0xD7,0xB0,0x16,
+    0x9D,0xB1,0xD3,0x04,0x7C,0x31,0xBF,0xC5,0x65,0x13,0x27,0x1D,0xFA,0xEC,0x34,0xB2,
+    0xFB,0x37,0xF8,0xA4,0x57,0x5B,0x49,0xD4,0xE8,0x6A,0xF6,0x82,0xB5,0x1F,0x75,0xE3,
+    0x6A,0x94,0xC9,0xDD,0x87,0xF9,0x1D,0x8A,0xEF,0xC1,0x78,0xE7,0x65,0x56,0xF1,0x16,
+    0xAF,0xA3,0xFF,0xD6,0xD8,0x22,0xBC,0xCB,0x5C,0xD4,0x3E,0xF2,0xD5,0xAA,0x57,0x69,
+    0xFC,0x26,0xFB,0x94,0xBF,0xE2,0x3E,0x5C,0xEE,0x77,0xE3,0x2B,0x76,0xF1,0x5D,0xF7,
+    0xD8,0xB4,0xA3,0x41,0x9F,0xE5,0xB9,0xCB,0x07,0xFC,0x7F,0x51,0xE3,0xB6,0xDF,0x1F,
+    0x25,0xE7,0xC6,0x9F,0x43,0xD9,0x4E,0xAD,0xBE,0x9A,0xFB,0x8E,0x5F,0x31,0x8A,0x3F,
+    0x24,0x71,0xB6,0xC3,0x3E,0x85,0x21,0xBF,0x42,0x15,0x8B,0x7B,0x84,0xC6,0x38,0xC6,
+    0x30,0xB2,0x62,0x5E,0xC8,0xC7,0x27,0x38,0xE5,0x66,0xF4,0xCF,0x13,0xDE,0xE9,0xCD,
+    0x6D,0x1A,0x80,0x5C,0x50,0x60,0x88,0x63,0xCE,0x1C,0x39,0xE1,0xDF,0x2E,0x73,0xC7,
+    0x45,0x8A,0x88,0xE7,0xAE,0x78,0x42,0xDE,0x70,0x13,0x66,0x74,0xC9,0x6A,0x4E,0xEB,
+    0x3A,0x3F,0xFF,0xD7,0xC1,0x6A,0x1E,0x2D,0xBD,0xBA,0x67,0xB3,0xB6,0x63,0x6D,0x5A,
+    0x46,0x1C,0x5A,0x64,0xFE,0xB9,0xDF,0xA7,0xCB,0x3B,0x72,0xB0,0x15,0x25,0x52,0xA1,
+    0x75,0x47,0x97,0x3D,0xC4,0xB8,0x92,0x72,0x49,0x3D,0x57,0xDC,0x7B,0x6C,0xB9,0x2D,
+    0xC6,0xFE,0x4B,0x83,0x64,0xBC,0x99,0x6F,0x92,0x77,0x69,0xD9,0x9A,0xF0,0xDE,0xBA,
+    0xFB,0x0A,0xAC,0xB4,0xB8,0x74,0xAD,0x6A,0x3B,0x00,0xB8,0x81,0xEC,0xC9,0x3C,0xFA,
+    0x77,0xF9,0xFA,0xEF,0xD1,0x5E,0x4E,0x58,0x71,0xFF,0x00,0x6B,0xD0,0xBC,0x2F,0xA9,
+    0x3B,0x51,0xD3,0x4B,0x2A,0xBC,0xBE,0xBD,0x03,0x17,0x39,0xDB,0x97,0x34,0xFE,0x53,
+    0xFB,0x8F,0x86,0x7A,0xAC,0x6D,0x6D,0x79,0x28,0xF6,0xFC,0xFB,0x9E,0x2B,0x7E,0x0C,
+    0xB4,0x52,0x2A,0xD0,0x48,0x2C,0x1C,0xAA,0xA7,0xFF,0xD0,0xCF,0x3C,0xB6,0x9B,0x1C,
+    0xF7,0xB9,0xAD,0x63,0x46,0x5C,0xE7,0x1C,0x00,0x3B,0x95,0xE6,0x3A,0xB5,0xEB,0xB5,
+    0x2D,0x4A,0xAD,0xD3,0xB2,0x18,0x4E,0x29,0x87,0x7E,0x96,0x8E,0x36,0xCF,0xC7,0xD4,
+    0x95,0xB9,0xF8,0xBB,0x50,0xFB,0x2D,0x8B,0x6C,0xE9,0xBB,0x15,0x6E,0x3F,0x36,0x0E,
+    0xE1,0x83,0x9E,0xBD,0x78,0xF3,0x19,0x5A,0x2C,0x3C,0xB0,0x4A,0x9D,0x5B,0x7D,0x34,
+    0xF7,0x1C,0xBF,0xCA,0x31,0xC7,0xC3,0xAE,0x58,0x72,0x4E,0x06,0xCB,0xE9,0x93,0xA4,
+    0xF6,0xBD,0xAE,0x2D,0x7B,0x4E,0x5A,0x41,0xDC,0x1C,0xF4,0x55,0x8E,0x7B,0x60,0x23,
+    0x5A,0x33,0xC8,0x59,0x31,0x37,0x67,0xD5,0x6B,0xBB,0xBB,0x96,0x42,0xE2,0xEA,0xB5,
+    0x56,0x03,0x90,0xDA,0x95,0x0B,0x86,0x7B,0xEE,0xBA,0xF1,0xDB,0x3B,0x6D,0xF4,0x55,
+    0x23,0x1C,0x80,0x85,0xBB,0x74,0xF4,0x46,0x3D,0x9B,0x4C,0xFB,0x3F,0xFF,0xD1,0xD0,
+    0x20,0x43,0x73,0x81,0x95,0xF5,0x13,0x8C,0x05,0x58,0x67,0x9D,0xC6,0x3E,0x2B,0x88,
+    0x8E,0x36,0x5C,0x0C,0x47,0xD9,0x99,0xF0,0xAD,0xFF,0x00,0xD8,0xF5,0x51,0x45,0xC7,
+    0xF0,0x6E,0xB0,0xC2,0x7B,0x3B,0x78,0x9F,0xE3,0xE3,0xE4,0xBD,0x02,0x2B,0xCA,0x1A,
+    0x5D,0x4E,0xA3,0x5E,0xC7,0x16,0x39,0xA7,0x21,0xC0,0xEE,0x0F,0x39,0xF5,0x5E,0x9F,
+    0xA4,0xDF,0x37,0x53,0xD3,0x69,0x5C,0x8C,0x07,0x11,0x8A,0x8D,0x1F,0xA5,0xC3,0x91,
+    0xC9,0xF5,0xF4,0x21,0x63,0x6B,0x68,0xAF,0xDB,0xB2,0xB4,0x4E,0x39,0xF8,0x76,0x22,
+    0x91,0x56,0x82,0x95,0xC5,0x5A,0x56,0xB6,0xEF,0xAF,0x5D,0xE2,0x9D,0x26,0x0C,0xB9,
+    0xC7,0xA2,0xC1,0xCA,0x73,0x11,0x11,0xB9,0x3F,0xFF,0xD2,0xC0,0xE9,0x1A,0xD5,0xCE,
+    0x90,0xF2,0x29,0x06,0xD4,0xA4,0xF3,0x97,0xD2,0x77,0x07,0xCC,0x76,0x3D,0x33,0xF4,
+    0xD9,0x76,0x35,0x4F,0x13,0x5E,0x6A,0x34,0xDF,0x45,0x80,0x5B,0xDB,0xB8,0x60,0xB5,
+    0x87,0x2E,0x70,0xDB,0x39,0x77,0xCF,0x8C,0x6C,0x70,0x72,0xB1,0x31,0x00,0xE5,0x22,
+    0x01,0x27,0x05,0x49,0xF1,0xBD,0x92,0xE3,0xA9,0xCB,0x14,0xE3,0x8B,0x78,0x20,0x19,
+    0xB9,0xC6,0x3B,0x0D,0xD0,0x53,0x23,0x3B,0x00,0xAE,0x18,0x46,0xC4,0x24,0x4E,0xC3,
+    0x00,0xAC,0x98,0xD3,0xB3,0xEE,0xC6,0xF2,0xBE,0x9B,0x74,0xCB,0x9B,0x67,0x61,0xC3,
+    0x90,0x78,0x70,0xEC,0x47,0x50,0xB6,0x8A,0x5E,0x35,0xA5,0xF6,0x42,0x6A,0xD9,0xBC,
+    0xDC,0x8C,0x08,0xB1,0xDE,0xE3,0xBC,0xF3,0xC8,0xEB,0xB6,0x0F,0xAA,0xD5,0x23,0x9D,
+    0xB1,0xF1,0x48,0xE4,0x80,0x77,0x58,0xCE,0xA7,0xD9,0xBF,0x0F,0x55,0x97,0x0C,0x6A,
+    0x92,0x7F,0xFF,0xD3,0xD5,0x6F,0xAF,0x2B,0xEA,0x57,0x4F,0xB8,0xB8,0x71,0x73,0xDD,
+    0xC0,0x1C,0x34,0x74,0x03,0xCB,0x75,0xD6,0x80,0xC6,0xD8,0xDD,0x76,0x23,0x8D,0xCA,
+    0xE2,0x27,0xA7,0xCD,0x4A,0xD9,0x1A,0x6D,0x36,0x9D,0xC9,0x02,0xDC,0xEF,0x95,0xCC,
+    0x7C,0x95,0x8B,0x7B,0x80,0x91,0x3B,0x9E,0x0A,0xF5,0x8F,0x36,0x44,0x0D,0xB0,0x76,
+    0xF8,0xA1,0x6E,0xFB,0x8F,0x92,0xB4,0x06,0x77,0xC6,0xE3,0xA2,0xE2,0x38,0xDC,0x81,
+    0xB2,0x30,0xD9,0xFF,0xD4,0xD3,0x61,0xBB,0xB0,0x98,0xDF,0x60,0xAC,0x5B,0x9C,0x03,
+    0x83,0xE6,0x98,0xC9,0xE9,0xF3,0x52,0xD8,0x8B,0xB2,0x30,0xF7,0x88,0xE9,0xFB,0x2C,
+    0x86,0x8B,0x7E,0x74,0x9D,0x49,0xB7,0x31,0x2E,0xA5,0xBB,0x2A,0x34,0x63,0x25,0xA7,
+    0xFE,0xF0,0x7E,0x0B,0xA9,0x0C,0x6C,0x07,0x2B,0x98,0xEC,0x71,0xD3,0xCD,0x79,0x33,
+    0xB3,0x2A,0x5E,0x69,0x68,0xB5,0x7D,0xC1,0xEA,0xEC,0x85,0x46,0x35,0xEC,0x70,0x73,
+    0x1C,0x32,0xD7,0x34,0xE4,0x11,0xDC,0x23,0xE3,0x4D,0x8E,0x7B,0xDC,0x1A,0xD6,0x8C,
+    0x97,0x13,0x80,0x07,0x75,0xA6,0x68,0x5E,0x24,0x6E,0x99,0x6E,0x6D,0x6E,0xA9,0xBD,
+    0xF4,0x1B,0x93,0x4C,0xD3,0x02,0x40,0x93,0xB8,0x39,0xC6,0x46,0xF9,0xFE,0xED,0xC6,
+    0xBD,0xE2,0x41,0xA9,0xDB,0x0B,0x5B,0x4A,0x6F,0xA7,0x45,0xD8,0x35,0x0D,0x40,0x24,
+    0x48,0x39,0x03,0x62,0x70,0x36,0xCF,0xF7,0x7D,0x1A,0xB6,0xF4,0x7D,0x07,0xEE,0x38,
+    0x78,0x9F,0x7E,0x7F,0xC7,0xFB,0x3F,0xFF,0xD5,0xD6,0xB5,0x5B,0xE7,0x6A,0xBA,0x8D,
+    0x6B,0x9D,0xC3,0x5C,0x70,0xC6,0x9E,0x8C,0xE8,0x3F,0x93,0xE6,0x4A,0xE8,0xC3,0x23,
+    0x7C,0x6D,0xD1,0x58,0x30,0x75,0xEC,0xB9,0xC6,0x31,0xD4,0xF3,0x85,0x2B,0x64,0x7B,
+    0x5E,0x6D,0x69,0xB4,0xFB,0x92,0x30,0x19,0x3B,0x6C,0xB8,0xC0,0x1F,0xCA,0xBC,0x7F,
+    0xBD,0xD0,0x8D,0xB1,0xF4,0x5E,0xB1,0x8E,0xC8,0x16,0x63,0x6C,0x7A,0x2E,0x43,0x76,
+    0x38,0xFD,0x95,0xA3,0xB0,0xE3,0xD1,0x71,0x0C,0xF3,0xBE,0x78,0x46,0x1B,0x3F,0xFF,
+    0xD6,0xD3,0xA1,0x80,0x7A,0x2F,0x92,0xD1,0x9D,0xD5,0xC3,0x48,0x04,0xE3,0xE8,0x91,
+    0xDB,0xF9,0x52,0xD8,0x8B,0xB2,0x18,0x2E,0x3B,0x05,0x9B,0xF0,0xE6,0xB3,0xF7,0x55,
+    0xDC,0x2B,0x39,0xC6,0xD2,0xAF,0xE6,0x03,0x78,0xBB,0xFD,0xB1,0xF4,0x3E,0x5D,0xF0,
+    0xB1,0x71,0xC8,0xC2,0x06,0x8C,0xEC,0x06,0xEB,0xC9,0x9D,0xF8,0x33,0xC7,0x96,0xD8,
+    0xED,0x17,0xAF,0xB8,0x3D,0x51,0xF5,0xA8,0x53,0xB7,0xFB,0x43,0xEB,0x53,0x6D,0x1C,
+    0x03,0xED,0x1C,0xE0,0x1B,0x83,0xC1,0xCF,0x0B,0x41,0xF1,0x26,0xB4,0xDD,0x56,0xBB,
+    0x29,0x50,0xC8,0xB6,0xA4,0x4C,0x49,0x24,0x4C,0xF7,0x23,0xF6,0xF5,0x3D,0xF0,0xB1,
+    0x01,0xA4,0x94,0x0C,0xCF,0x51,0xDD,0x61,0x58,0xD7,0x93,0xB3,0xA9,0xEE,0x16,0xCD,
+    0x54,0x88,0xD4,0x1F,0xFF,0xD7,0xD6,0x61,0x8D,0xC7,0x09,0x00,0x7D,0x4F,0x44,0x45,
+    0x1B,0x64,0x31,0x12,0x46,0x47,0x08,0x5A,0x71,0xD0,0x76,0x08,0x89,0xB0,0x20,0x76,
+    0xC9,0x20,0x2E,0x23,0x8E,0x80,0x22,0x26,0xC1,0xFF,0xD0,0xD6,0x31,0x91,0xE4,0xBE,
+    0x83,0x42,0x22,0x8D,0xB2,0x19,0xC0,0x19,0x39,0x40,0xC3,0xC1,0x08,0x89,0xB0,0x7C,
+    0xC4,0xE3,0x18,0xDD,0x7D,0x40,0xEE,0x36,0x44,0x4D,0x83,0xFF,0xD1,0xD6,0x48,0xC6,
+    0xDB,0x8F,0x82,0x47,0x6D,0xCE,0x06,0x39,0x44,0x51,0xB6,0x43,0x38,0x88,0x27,0x7D,
+    0xFD,0x50,0xB3,0xB7,0x3E,0x88,0x89,0xB0,0x72,0x1B,0xB6,0x76,0x41,0x4F,0x7F,0xD9,
+    0x11,0x36,0x0F,0xFF,0xD2,0xD6,0x30,0x33,0x9E,0x30,0xB9,0x81,0xDF,0xAA,0x22,0x8D,
+    0xB2,0x18,0x0D,0x00,0x9E,0xDD,0x97,0x11,0xE0,0x91,0x90,0x88,0x9B,0x02,0x00,0x9E,
+    0x47,0x9A,0x47,0xA6,0x76,0xE1,0x11,0x36,0x0F,0xFF,0xD3,0xD6,0x03,0x31,0xC7,0x1C,
+    0xAE,0x61,0xB9,0x07,0xAA,0x22,0x8D,0xB2,0x18,0x0D,0xD8,0x8C,0x65,0x71,0x1C,0x74,
+    0x18,0x44,0x4D,0x81,0xEC,0xF9,0xE3,0x03,0x65,0xCC,0x7C,0x89,0x07,0xBF,0x54,0x44,
+    0xD8,0x3F,0xFF,0xD9,
+};
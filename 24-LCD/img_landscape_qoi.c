@@ -0,0 +1,641 @@
+/**
+ * @file    img_landscape_qoi.c
+ *
+ * @note    Generated by mkimage from landscape.ppm. Do not edit
+ */
+
+#include <stdint.h>
+
+const int img_landscape_qoi_size = 10059;
+
+const uint8_t img_landscape_qoi[] = {
+    0x71,0x6F,0x69,0x66,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x88,0x03,0x00,0xFE,0x28,
+    0x50,0xC8,0xFD,0xFD,0xFD,0xF4,0x79,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,
+    0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,
+    0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,
+    0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,
+    0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,
+    0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,
+    0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,
+    0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,
+    0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,
+    0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7D,
+    0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,
+    0x96,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x97,0xFD,0xFD,0xFD,0xF4,
+    0x79,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,
+    0x7A,0xFD,0xFD,0xFD,0xF4,0xA1,0x96,0xFD,0xFD,0xFD,0xF4,0x7D,0xFD,0xFD,0xFD,0xF4,
+    0xA1,0x96,0xFD,0xFD,0xE6,0xFE,0x6F,0x77,0xA5,0xFE,0x9A,0x98,0x97,0xFE,0xBE,0xB4,
+    0x8C,0xFE,0xDA,0xC9,0x83,0xFE,0xEE,0xD9,0x7D,0xFE,0xFA,0xE2,0x79,0xA4,0x93,0x1C,
+    0x27,0x05,0x07,0xFE,0x9A,0x98,0x97,0x18,0x26,0xFD,0x7A,0xFD,0xFD,0xE4,0xFE,0x93,
+    0x92,0x9A,0xFE,0xCE,0xC0,0x87,0x38,0xCB,0x10,0x3E,0x29,0xFB,0xA1,0x96,0xFD,0xFD,
+    0xE2,0xFE,0x91,0x8F,0x9A,0xFE,0xDB,0xC9,0x83,0x38,0xCF,0x08,0x29,0x2D,0xF9,0x7D,
+    0xFD,0xFD,0xE1,0xFE,0xC0,0xB4,0x8B,0x38,0xD3,0x06,0x2E,0xF8,0xA1,0x96,0xFD,0xFD,
+    0xDF,0xFE,0x80,0x82,0x9F,0xFE,0xDF,0xCD,0x81,0x38,0xD5,0x1A,0x18,0x32,0xF6,0x7A,
+    0xFD,0xFD,0xDE,0xFE,0x88,0x88,0x9C,0xFE,0xEF,0xD9,0x7C,0x38,0xD7,0x23,0x39,0x35,
+    0xF5,0xA1,0x96,0xFD,0xFD,0xDD,0xFE,0x82,0x83,0x9E,0x23,0x38,0xD9,0x23,0x1C,0x39,
+    0xF4,0x7D,0xFD,0xFD,0xDD,0xFE,0xE0,0xCD,0x81,0x38,0xDB,0x1D,0x3A,0xF4,0xA1,0x96,
+    0xFD,0xFD,0xDC,0xFE,0xC3,0xB6,0x89,0x38,0xDD,0x0B,0x3E,0xF3,0x7A,0xFD,0xFD,0xDB,
+    0xFE,0x98,0x93,0x97,0x38,0xDF,0x3D,0x01,0xF2,0xA1,0x96,0xFD,0xFD,0xDB,0xFE,0xDE,
+    0xCB,0x81,0x38,0xDF,0x0D,0x05,0xF2,0x7D,0xFD,0xFD,0xDA,0xFE,0x9E,0x97,0x94,0x38,
+    0xE1,0x0E,0x06,0xF1,0x7A,0xFD,0xFD,0xDA,0xFE,0xD3,0xC2,0x84,0x38,0xE1,0x14,0x09,
+    0xF1,0xA1,0x96,0xFD,0xFD,0xD9,0xFE,0x81,0x7F,0x9C,0x38,0xE3,0x37,0x0D,0xF0,0x7D,
+    0xFD,0xFD,0xD9,0xFE,0xA7,0x9E,0x91,0x38,0xE3,0x37,0x0E,0xF0,0xA1,0x96,0xFD,0xFD,
+    0xD9,0xFE,0xC7,0xB8,0x87,0x38,0xE3,0x13,0x12,0xF0,0x7A,0xFD,0xFD,0xD9,0xFE,0xDF,
+    0xCC,0x80,0x38,0xE3,0x0E,0x15,0xF0,0xA1,0x96,0xFD,0xFD,0xD9,0xFE,0xF1,0xDA,0x7B,
+    0x38,0xE3,0x27,0x19,0xF0,0x7D,0xFD,0xFD,0xD9,0xFE,0xFB,0xE3,0x78,0x38,0xE3,0x1D,
+    0x1A,0xF0,0xA1,0x96,0xFD,0xFD,0xD9,0x38,0xE5,0x1E,0xF0,0x7A,0xFD,0xFD,0xD9,0x1D,
+    0x38,0xE3,0x1D,0x21,0xF0,0xA1,0x96,0xFD,0xFD,0xD9,0x27,0x38,0xE3,0x27,0x25,0xF0,
+    0x7D,0xFD,0xFD,0xD9,0xFE,0xE2,0xCD,0x7F,0x38,0xE3,0x15,0x26,0xF0,0xA1,0x96,0xFD,
+    0xFD,0xD9,0xFE,0xCC,0xBB,0x85,0x38,0xE3,0x23,0x2A,0xF0,0x7A,0xFD,0xFD,0xD9,0xFE,
+    0xB1,0xA3,0x8C,0x38,0xE3,0x0B,0x2D,0xF0,0xA1,0x96,0xFD,0xFD,0xD9,0xFE,0x91,0x87,
+    0x94,0x38,0xE3,0x17,0x31,0xF0,0x7D,0xFD,0xFD,0xDA,0xFE,0xDA,0xC6,0x81,0x38,0xE1,
+    0x28,0x32,0xF1,0xA1,0x97,0xFD,0xFD,0xDA,0xFE,0xAE,0xA0,0x8C,0x38,0xE1,0x33,0x3D,
+    0xF1,0x79,0xFD,0xFD,0xDB,0xFE,0xE4,0xCE,0x7E,0x38,0xDF,0x19,0x39,0xF2,0x7D,0xFD,
+    0xFD,0xDB,0xFE,0xAD,0x9E,0x8C,0x38,0xDF,0x26,0x3A,0xF2,0xA1,0x96,0xFD,0xFD,0xDC,
+    0xFE,0xD0,0xBD,0x83,0x38,0xDD,0x2B,0x3E,0xF3,0x7A,0xFD,0xFD,0xDD,0xFE,0xE7,0xD1,
+    0x7D,0x38,0xDB,0x2A,0x01,0xF4,0xA1,0x96,0xFD,0xFD,0xDD,0xFE,0xA3,0x93,0x8E,0xFE,
+    0xF3,0xDB,0x7A,0x38,0xD9,0x2B,0x1F,0x05,0xF4,0x7D,0xFD,0xFD,0xDE,0xFE,0xA9,0x99,
+    0x8B,0x2B,0x38,0xD7,0x2B,0x3A,0x06,0xF5,0xA1,0x96,0xFD,0xFD,0xDF,0xFE,0xA5,0x95,
+    0x8C,0xFE,0xE9,0xD2,0x7D,0x38,0xD5,0x35,0x21,0x0A,0xF6,0x7A,0xFD,0xFD,0xE1,0xFE,
+    0xD3,0xBE,0x81,0x38,0xD3,0x2B,0x0D,0xF8,0xA1,0x96,0xFD,0xFD,0xE2,0xFE,0xB5,0xA2,
+    0x88,0xFE,0xE6,0xCF,0x7D,0x38,0xCF,0x1D,0x36,0x11,0xF9,0x7D,0xFD,0xC6,0xFE,0x0F,
+    0x40,0x24,0xA7,0x88,0xA3,0x88,0xC0,0x95,0x88,0x12,0xFD,0xD7,0xFE,0xB8,0xA5,0x87,
+    0xFE,0xDF,0xC8,0x7E,0x38,0xCB,0x2C,0x07,0x12,0xFB,0xA1,0x96,0xFD,0xC5,0xFE,0x11,
+    0x43,0x26,0x9D,0x88,0xA6,0x88,0xA5,0x88,0x2E,0xC0,0xA3,0x88,0x9C,0x88,0x16,0xFD,
+    0xD7,0xA6,0x90,0xFE,0xBE,0xAA,0x85,0xFE,0xD5,0xBF,0x80,0xFE,0xE7,0xD0,0x7C,0xFE,
+    0xF4,0xDC,0x7A,0xFE,0xFC,0xE3,0x78,0x38,0x20,0x33,0x1E,0x2F,0x24,0x3B,0x16,0xFD,
+    0x7A,0xFD,0xC4,0xFE,0x1A,0x4C,0x2E,0x97,0x88,0x40,0xA6,0x88,0x99,0x88,0xA6,0x88,
+    0xC0,0xA3,0x88,0x01,0xC0,0x19,0xFD,0xF7,0x0D,0xAB,0x88,0x36,0x9D,0x88,0x32,0x19,
+    0xE4,0xA1,0x96,0xFD,0xC3,0xFE,0x1A,0x4D,0x2E,0x97,0x88,0xA6,0x88,0x98,0x88,0xA4,
+    0x88,0x9B,0x88,0xC1,0xAA,0x88,0x40,0x12,0xFE,0x9F,0x8B,0x8C,0xFD,0xF6,0xFE,0x14,
+    0x47,0x28,0x28,0x3F,0x2C,0xA5,0x88,0x12,0x0A,0x1D,0xE3,0x7D,0xFD,0xC2,0xFE,0x12,
+    0x45,0x25,0xA9,0x88,0x9B,0x88,0xC0,0x7F,0x07,0xA2,0x88,0x07,0xA7,0x88,0x07,0x0E,
+    0x03,0x9D,0x88,0x1E,0xFD,0xF4,0xFE,0x0F,0x42,0x22,0xA6,0x88,0x12,0x30,0x97,0x88,
+    0x7F,0x30,0x7F,0x16,0x1E,0xE2,0xA1,0x96,0xFD,0xC1,0xFE,0x10,0x44,0x23,0xAA,0x88,
+    0x9A,0x88,0x04,0xC0,0x9D,0x88,0x40,0x17,0xA2,0x88,0x99,0x88,0x7F,0xC0,0xA5,0x88,
+    0x40,0x17,0x22,0xFD,0xF2,0x39,0x26,0x97,0x88,0x08,0x0C,0x04,0x7F,0x39,0xC0,0x35,
+    0x98,0x88,0x22,0xE1,0x7A,0xFD,0xC1,0xFE,0x15,0x49,0x27,0xA3,0x88,0xA3,0x88,0x7F,
+    0x40,0x0C,0x32,0x9C,0x88,0xA6,0x88,0x3D,0x1F,0x36,0x1B,0x96,0x88,0x1F,0x40,0x25,
+    0xFD,0xF0,0x32,0x10,0x0C,0x95,0x88,0x10,0x27,0xA4,0x88,0x0C,0x40,0xC1,0x01,0x3D,
+    0x25,0xE0,0xA1,0x96,0xFD,0xC0,0xFE,0x12,0x47,0x24,0xC0,0xA6,0x88,0x9B,0x88,0x9D,
+    0x88,0xAC,0x88,0x19,0x24,0xC0,0x19,0xA3,0x88,0x24,0x9D,0x88,0xA4,0x88,0x37,0xA2,
+    0x88,0x9D,0x88,0x29,0xFD,0xEF,0xFE,0x1A,0x4F,0x2C,0x24,0x33,0xA2,0x88,0x2C,0x06,
+    0x20,0x11,0x24,0x20,0x0A,0x24,0x20,0x24,0x29,0xE0,0x7D,0xFD,0xC0,0xFE,0x14,0x49,
+    0x25,0xA3,0x88,0x9A,0x88,0xA7,0x88,0x40,0xA4,0x88,0x55,0x21,0x2C,0x0E,0x1D,0x3F,
+    0x0E,0x3F,0x34,0x2C,0xC0,0x3B,0x2A,0xFD,0xED,0xFE,0x1D,0x52,0x2E,0x3B,0x3F,0x1D,
+    0x3B,0x34,0x28,0x21,0xA7,0x88,0x98,0x88,0x2C,0x3B,0x12,0x55,0x28,0x2C,0x2A,0xDF,
+    0x7A,0xFD,0xFE,0x1D,0x53,0x2E,0x98,0x88,0x9C,0x88,0xAA,0x88,0x97,0x88,0xC0,0x39,
+    0xA7,0x88,0x39,0x2D,0xC0,0x35,0x55,0x35,0x08,0x2D,0x9D,0x88,0x99,0x88,0xA3,0x88,
+    0x35,0xFE,0xA7,0x8F,0x88,0xFD,0xEB,0x08,0x17,0xC0,0x35,0xA4,0x88,0x17,0x0F,0x35,
+    0x0F,0x7F,0x35,0x22,0x1E,0x04,0x22,0xC0,0x08,0x39,0x2D,0xDE,0xA1,0x96,0xFD,0xFE,
+    0x16,0x4C,0x26,0xA2,0x88,0x55,0x1B,0xA6,0x88,0x97,0x88,0x3D,0x9D,0x88,0x3D,0xA7,
+    0x88,0x9D,0x88,0x2E,0xA6,0x88,0x1B,0x9A,0x88,0x2E,0x01,0x1B,0x9C,0x88,0x01,0x31,
+    0xFD,0xEA,0x26,0x1F,0xA5,0x88,0x26,0x39,0xA2,0x88,0x1B,0x39,0x2E,0x17,0x35,0x26,
+    0x39,0x2A,0x2E,0x39,0x17,0x01,0x1B,0x31,0xDE,0x7D,0xFC,0xFE,0x1C,0x53,0x2C,0x55,
+    0xA3,0x88,0x99,0x88,0x1C,0xC0,0x9C,0x88,0x9A,0x88,0xAB,0x88,0x99,0x88,0x40,0x7F,
+    0x06,0x02,0x9D,0x88,0xC0,0x02,0xC0,0x2B,0x24,0x20,0x0D,0x32,0xFD,0xE9,0x02,0x24,
+    0x06,0xA8,0x88,0x06,0x0D,0x33,0x0D,0x40,0x24,0x3A,0x2B,0x0D,0x3E,0x06,0x20,0x33,
+    0x11,0x15,0x33,0x32,0xDD,0xA1,0x96,0xFC,0xFE,0x1C,0x53,0x2B,0x7F,0x9C,0x88,0x15,
+    0x9A,0x88,0xA4,0x88,0x9A,0x88,0x24,0x28,0x40,0xA4,0x88,0x37,0x99,0x88,0xA5,0x88,
+    0x15,0x28,0x0A,0x0E,0xA2,0x88,0x3B,0x19,0xA7,0x88,0x15,0x36,0xFD,0xE7,0x02,0x2C,
+    0x19,0x28,0x3B,0x0A,0x24,0x1D,0x28,0x06,0x19,0x24,0x06,0x37,0x02,0x06,0x3B,0x1D,
+    0xAA,0x88,0x0E,0x1D,0x36,0xDD,0x7A,0xFB,0xFE,0x15,0x4D,0x24,0xC1,0xA6,0x88,0x9B,
+    0x88,0x7F,0xA8,0x88,0x99,0x88,0xA4,0x88,0x0B,0x0F,0x1E,0xC1,0x9C,0x88,0x0F,0x00,
+    0x1A,0x07,0x55,0x9C,0x88,0x31,0x1A,0x0B,0x39,0xFD,0xCB,0x07,0x22,0x1E,0x9B,0x88,
+    0xA6,0x88,0x22,0x2D,0x39,0xD2,0x07,0x31,0xC0,0x1E,0x22,0x1A,0xC0,0x07,0x2D,0x22,
+    0x1A,0x0B,0x00,0x1A,0x22,0x0F,0x1E,0x0F,0x1A,0x0B,0x22,0x3C,0x0F,0x39,0xDC,0xA1,
+    0x96,0xFB,0xFE,0x15,0x4D,0x23,0xAB,0x88,0x94,0x88,0xA4,0x88,0x1B,0xA9,0x88,0x7F,
+    0x1B,0x2A,0xA5,0x88,0x2A,0x0F,0x1B,0xA3,0x88,0xC0,0x0F,0x22,0x35,0x9C,0x88,0x2A,
+    0xA6,0x88,0x39,0x31,0x08,0x39,0x3D,0xFD,0xC8,0xFE,0x1F,0x57,0x2D,0x2A,0x35,0xC0,
+    0x0F,0x9C,0x88,0x17,0x13,0x17,0x00,0x3D,0xD0,0x04,0x40,0x2A,0x08,0x31,0x26,0x1B,
+    0xC1,0x0F,0x17,0x00,0x22,0x26,0x04,0x35,0x26,0x35,0x2A,0xC0,0x26,0x22,0x04,0x2A,
+    0x3D,0xDC,0x7D,0xFA,0xFE,0x18,0x51,0x26,0x55,0xA9,0x88,0x9D,0x88,0x14,0x9C,0x88,
+    0xA3,0x88,0x9C,0x88,0xA3,0x88,0x9B,0x88,0x1C,0x40,0x18,0x0D,0x1C,0x0D,0xC0,0x2B,
+    0x9C,0x88,0x1C,0x2F,0x14,0x09,0x2F,0x36,0x27,0x36,0xFE,0xB0,0x94,0x83,0xFD,0xC6,
+    0x2B,0x0D,0xA3,0x88,0x1C,0x9C,0x88,0x2B,0x9D,0x88,0x2B,0x14,0x27,0x1C,0x0D,0x2B,
+    0xFE,0xB0,0x94,0x83,0xCD,0x2F,0x18,0x27,0xC0,0x14,0x27,0x2F,0x0D,0xC0,0x20,0x14,
+    0x0D,0x3A,0x2F,0x1C,0x18,0x2F,0x05,0x2F,0x20,0x36,0x20,0x1C,0x14,0xC0,0x2B,0x3E,
+    0xDB,0xA1,0x96,0xFA,0xFE,0x1C,0x55,0x29,0xC0,0x9B,0x88,0x55,0xA7,0x88,0xA4,0x88,
+    0xC0,0x99,0x88,0x37,0x20,0xA2,0x88,0x06,0xC0,0x1C,0x06,0xC0,0x33,0x55,0x37,0xAA,
+    0x88,0x20,0x7F,0x24,0x06,0x7F,0x06,0x20,0x0D,0x02,0xFD,0xC5,0xFE,0x15,0x4E,0x22,
+    0x1C,0x33,0x2F,0x1C,0x3E,0x20,0x0D,0xC0,0x15,0x06,0x24,0xA2,0x88,0x20,0xFE,0xB2,
+    0x95,0x82,0xCB,0x06,0x28,0x0D,0x3E,0x15,0x24,0x1C,0x37,0x3E,0x11,0x1C,0x9A,0x88,
+    0x20,0x24,0x20,0x11,0x20,0x11,0x28,0x02,0x33,0x06,0x24,0x11,0x28,0x1C,0x3E,0xFE,
+    0xB2,0x95,0x82,0xDB,0x7A,0xFA,0xFE,0x1B,0x55,0x28,0xA3,0x88,0x97,0x88,0xC0,0xAB,
+    0x88,0x9A,0x88,0x34,0x99,0x88,0x34,0x0B,0xC0,0xA2,0x88,0xC0,0x07,0x34,0x07,0x0B,
+    0x34,0x98,0x88,0xA2,0x88,0xA4,0x88,0x2D,0x0B,0xA6,0x88,0x38,0x25,0xA2,0x88,0x16,
+    0x05,0xD1,0x03,0xC0,0x12,0x1A,0xC0,0x38,0x05,0xE9,0x16,0x03,0x16,0x1A,0x12,0x07,
+    0x38,0x25,0x34,0x12,0x03,0x29,0x03,0x1A,0x2D,0x3C,0xAB,0x88,0x05,0xC8,0x25,0x03,
+    0x38,0x0B,0x25,0x21,0xC0,0x1A,0x29,0xC0,0x12,0x29,0x25,0x38,0x0B,0x12,0xC1,0x16,
+    0x34,0x3C,0xC0,0x34,0x25,0x34,0x07,0x0B,0xC0,0x29,0x05,0xDA,0xA1,0x96,0xF9,0xFE,
+    0x1C,0x56,0x28,0x9D,0x88,0xA6,0x88,0xA2,0x88,0x7F,0xC0,0x94,0x88,0xA7,0x88,0xA3,
+    0x88,0x0F,0x1A,0x0B,0x9B,0x88,0x0F,0xA2,0x88,0x9A,0x88,0x2D,0x1A,0x35,0x2D,0x99,
+    0x88,0x29,0x98,0x88,0x0B,0x04,0x31,0x1A,0x04,0x13,0x29,0x09,0xCE,0x3C,0x0B,0xC0,
+    0x1A,0x04,0x1E,0x22,0x0F,0x29,0x09,0xE7,0x0F,0xC0,0x13,0x00,0x1E,0x13,0x3C,0x1E,
+    0x22,0x04,0x0F,0x3C,0x2D,0x0F,0x04,0x0B,0x31,0xC0,0x22,0x0F,0x09,0xC4,0x1A,0x2D,
+    0x35,0x22,0x2D,0x1E,0x3C,0x35,0xC0,0x0B,0x3C,0x22,0x31,0x22,0x13,0x31,0x13,0x2D,
+    0x22,0x31,0xC0,0x3C,0x29,0x31,0x0B,0x1E,0x29,0xC0,0x13,0x2D,0x00,0x09,0xDA,0x7D,
+    0xF9,0xFE,0x1D,0x58,0x29,0x55,0x9B,0x88,0xAB,0x88,0x97,0x88,0xA6,0x88,0x14,0x27,
+    0x7F,0x2E,0x09,0x2E,0x94,0x88,0x09,0x01,0xA2,0x88,0x3A,0xA8,0x88,0x36,0xA6,0x88,
+    0x2E,0x1F,0x10,0x98,0x88,0x09,0x32,0x9D,0x88,0x01,0x2E,0x36,0x14,0x0A,0xCB,0x32,
+    0x10,0x05,0x2E,0x32,0x05,0x3A,0x09,0x23,0x1F,0x23,0x05,0x0A,0xE5,0x36,0x32,0x14,
+    0x05,0x2E,0x1F,0x10,0x01,0x23,0x09,0x10,0x14,0xC0,0x27,0x32,0x3A,0x36,0x10,0x01,
+    0x1F,0xC1,0x32,0x27,0x23,0x01,0x32,0x14,0x1F,0xC0,0x36,0x1F,0x18,0x23,0x01,0x10,
+    0x32,0x27,0x05,0x32,0x3A,0x10,0x14,0x01,0x14,0xC0,0x05,0x01,0xC0,0x1F,0xC1,0x09,
+    0x23,0x1F,0x27,0x10,0xC0,0x0A,0xDA,0xA1,0x96,0xF8,0xFE,0x1B,0x56,0x26,0xA6,0x88,
+    0x96,0x88,0xA6,0x88,0xA5,0x88,0x18,0x98,0x88,0x18,0xA2,0x88,0x1C,0x36,0x3E,0x20,
+    0x36,0x95,0x88,0x36,0x9D,0x88,0x02,0xA5,0x88,0x3E,0x36,0x27,0x1C,0x18,0x40,0x3E,
+    0x20,0xA5,0x88,0x3E,0x2B,0x20,0x2B,0x3A,0x02,0x0E,0xC7,0x3E,0x3A,0x11,0x27,0x09,
+    0x1C,0x11,0x0D,0x11,0x18,0x2B,0x02,0x20,0x3A,0x27,0x0E,0xE4,0x20,0x27,0x11,0x1C,
+    0x18,0x27,0x3E,0x09,0x3E,0x55,0x3A,0x2F,0xC0,0x0D,0x3E,0x11,0xC0,0x27,0x3A,0x18,
+    0x0D,0x2B,0x3A,0xC0,0x27,0x02,0x20,0x3E,0x18,0x27,0xC0,0x3A,0x3E,0x0D,0x09,0x27,
+    0x2F,0x1C,0x3A,0x1C,0x20,0x2B,0x36,0x3E,0x09,0x0D,0x27,0x2F,0x3E,0x09,0x27,0x2F,
+    0x18,0x02,0x09,0x1C,0x0D,0x1C,0x36,0x0E,0xD9,0x7A,0xF8,0xFE,0x1A,0x56,0x25,0xA9,
+    0x88,0x98,0x88,0x34,0x40,0xA9,0x88,0x7F,0x97,0x88,0xA7,0x88,0x40,0x0E,0x2C,0x25,
+    0x0E,0x03,0x30,0x7F,0x25,0xC0,0x3B,0x25,0x2C,0x30,0x40,0x03,0x3B,0x9A,0x88,0x34,
+    0x16,0x2C,0x34,0x2C,0x1D,0x03,0x16,0xC0,0x11,0xC3,0x34,0x21,0x12,0x30,0x16,0x25,
+    0x40,0xC0,0x3B,0x0E,0x07,0x3B,0x34,0x1D,0x07,0x30,0x2C,0x3F,0x11,0xE2,0x2C,0x0E,
+    0x30,0x12,0x1D,0x03,0x16,0x0E,0x2C,0x25,0x16,0x34,0x21,0x34,0x30,0xC0,0x21,0x3B,
+    0x25,0x34,0xC0,0x03,0x30,0x3F,0x0E,0x21,0x34,0x30,0x2C,0x03,0x12,0x30,0x0E,0x16,
+    0x34,0x16,0x07,0xC0,0x3B,0x07,0x30,0x12,0x21,0x0E,0x03,0x34,0x21,0x25,0x3B,0x1D,
+    0x25,0x3B,0x07,0xC0,0x21,0x25,0x1D,0x3F,0x07,0x0E,0x11,0xD9,0xA1,0x96,0xF7,0xFE,
+    0x1E,0x5A,0x28,0x40,0x40,0x55,0xA6,0x88,0xA3,0x88,0x0B,0x9C,0x88,0xC0,0xA8,0x88,
+    0x0F,0x07,0x2D,0x0F,0x0B,0xA8,0x88,0x1E,0x29,0x1E,0xA2,0x88,0x0F,0x38,0x25,0x2D,
+    0xA9,0x88,0x0B,0x25,0x3C,0x25,0x38,0x29,0x55,0x25,0x0B,0xC0,0x25,0xC0,0x3C,0xC0,
+    0x0F,0xA9,0x88,0x03,0x16,0x2D,0x1A,0x29,0x16,0x34,0x07,0x25,0x07,0x0F,0x1A,0x07,
+    0x29,0x07,0x3C,0x34,0x07,0x29,0x25,0x15,0xE1,0x1E,0x34,0x0B,0x34,0x16,0x34,0x03,
+    0x1E,0x0B,0x2D,0x1E,0x2D,0x0F,0x3C,0x29,0x0F,0xC0,0x25,0x1E,0x07,0x38,0x07,0x1A,
+    0x1E,0x1A,0x0F,0x2D,0x07,0x0F,0x38,0x25,0x2D,0x29,0x03,0x34,0x38,0x0F,0x34,0x07,
+    0x0B,0x1E,0x0B,0x03,0x1A,0x1E,0x0B,0x0F,0x29,0x0F,0x34,0x0B,0x1A,0x34,0x2D,0x0B,
+    0x03,0x29,0x03,0x1E,0x25,0x0B,0x15,0xD8,0x7D,0xF7,0xFE,0x19,0x56,0x23,0xA5,0x88,
+    0x9D,0x88,0xA5,0x88,0xC0,0x01,0xA2,0x88,0xC0,0x0C,0xA4,0x88,0x2E,0xA3,0x88,0x40,
+    0x23,0x7F,0xA8,0x88,0x3D,0x0C,0xC0,0xA3,0x88,0x1B,0x39,0x0C,0xC0,0x98,0x88,0xA4,
+    0x88,0x39,0x32,0x01,0x1F,0x2E,0x0C,0x1F,0x23,0x2E,0x1F,0x32,0x1B,0x23,0x14,0x10,
+    0x08,0x2A,0x0C,0x1F,0x2E,0x10,0x1F,0xC0,0x10,0x1F,0x39,0xC0,0x0C,0xC0,0x14,0x0C,
+    0x23,0x32,0x1F,0x39,0x1F,0x16,0xDF,0x08,0x1F,0x1B,0x23,0x3D,0x10,0x3D,0xC0,0x1F,
+    0x39,0x2E,0x23,0x1B,0x08,0x14,0x32,0x14,0x0C,0x3D,0x1B,0x10,0x08,0x01,0x39,0x1B,
+    0x39,0x1F,0xC0,0x08,0x2A,0x1F,0x2E,0x10,0x3D,0x1B,0x1F,0x0C,0xC0,0x32,0x14,0x32,
+    0x10,0x2A,0x01,0x1B,0x32,0x23,0x32,0x08,0x2E,0x39,0x1B,0x14,0x08,0x23,0x0C,0x2A,
+    0x10,0x39,0x23,0x01,0x10,0x16,0xD8,0xA1,0x97,0xF6,0xFE,0x1A,0x57,0x23,0xA9,0x88,
+    0x55,0x55,0x32,0x2B,0xC0,0xAB,0x88,0x97,0x88,0x32,0x98,0x88,0x14,0x40,0x9A,0x88,
+    0x23,0x9C,0x88,0xA2,0x88,0xA4,0x88,0x10,0x98,0x88,0x09,0xC0,0x23,0x05,0x09,0x36,
+    0x05,0x32,0x27,0x14,0x09,0x10,0x05,0x01,0x2B,0x18,0x36,0x09,0x1C,0x01,0x14,0x10,
+    0x36,0x14,0x05,0x2B,0x36,0x23,0x14,0x10,0x23,0xC0,0x36,0x1C,0x27,0x05,0x1C,0x09,
+    0x18,0x01,0xC0,0x32,0x1C,0x21,0xDF,0x14,0x2B,0x18,0x14,0x01,0x27,0x10,0x14,0x32,
+    0x23,0x14,0x18,0x14,0x36,0x14,0xC0,0x36,0x23,0x32,0x23,0x18,0x05,0x18,0x3A,0x14,
+    0x05,0x23,0x3A,0x14,0x10,0x3A,0x18,0x32,0x1C,0x36,0x01,0x32,0x23,0x1C,0x27,0x36,
+    0xC0,0x18,0x32,0x10,0x32,0x1C,0x2B,0xC0,0x1C,0x36,0x18,0x05,0x18,0x10,0xC0,0x27,
+    0x32,0x01,0x05,0x10,0x27,0x36,0x21,0xD7,0x79,0xF6,0xFE,0x20,0x5E,0x29,0xA5,0x88,
+    0x95,0x88,0x0A,0x40,0x9D,0x88,0xA4,0x88,0x3F,0x40,0x3F,0xA2,0x88,0x2C,0x3F,0xA7,
+    0x88,0x15,0x1D,0x3B,0x1D,0xA4,0x88,0x1D,0xA7,0x88,0x3B,0x06,0x1D,0x3B,0x2C,0x15,
+    0x0A,0x9C,0x88,0x06,0x0A,0x3B,0x06,0x3B,0x30,0xC0,0x3F,0x0E,0x3F,0x0E,0x06,0x21,
+    0x30,0x1D,0x3F,0x0A,0x15,0x30,0x3B,0xA4,0x88,0x06,0x3F,0x21,0x30,0x3B,0x28,0x21,
+    0x19,0x0E,0x19,0x3B,0x2C,0x21,0x37,0xFE,0xBF,0x9B,0x7C,0xDD,0x30,0x06,0x19,0x37,
+    0x3B,0x37,0x06,0x30,0xA3,0x88,0x37,0x1D,0x3F,0x0A,0x15,0xC0,0x06,0x21,0x15,0x0E,
+    0x37,0xC0,0x30,0x3B,0x30,0x37,0x0A,0x1D,0x37,0x19,0x0A,0x3B,0x30,0x28,0x0A,0x30,
+    0x3F,0x3B,0x28,0x06,0x0E,0x3F,0x19,0x1D,0x3B,0x06,0x19,0x1D,0x0A,0x37,0x15,0x19,
+    0x0E,0x15,0xC0,0x28,0x2C,0x0A,0x30,0x21,0x15,0x06,0x37,0x2C,0x06,0xFE,0xBF,0x9B,
+    0x7C,0xD7,0x7D,0xF5,0xFE,0x1E,0x5C,0x26,0x9C,0x88,0xA8,0x88,0xA2,0x88,0x9D,0x88,
+    0x25,0xA8,0x88,0x95,0x88,0xA2,0x88,0x21,0x25,0xC0,0xA7,0x88,0x16,0xA3,0x88,0x9C,
+    0x88,0xC0,0x25,0x16,0x03,0x21,0x3F,0x55,0x29,0x21,0x30,0x21,0x07,0x03,0x25,0xC0,
+    0x12,0x0E,0x25,0xC0,0x12,0x16,0x12,0x40,0x30,0x12,0x16,0x34,0x07,0x30,0x1D,0x07,
+    0x0E,0x30,0x0E,0x12,0x21,0x07,0x29,0x21,0x34,0x21,0x0E,0x07,0x3F,0x1D,0xC0,0x16,
+    0x34,0x30,0x1E,0xDD,0x12,0xC0,0x34,0x38,0x07,0xC0,0x0E,0x25,0x16,0x38,0x3F,0x21,
+    0x0E,0x29,0x30,0x07,0x3F,0x38,0x16,0x30,0x16,0x21,0x30,0x3F,0x25,0x03,0x34,0x29,
+    0x1D,0x29,0x25,0x30,0x16,0x38,0x0E,0x16,0x25,0x3F,0xC0,0x34,0x25,0x30,0x0E,0x21,
+    0x03,0x29,0x38,0x34,0xC0,0x07,0x38,0x25,0x1D,0x07,0x3F,0x30,0x29,0x34,0x38,0xC0,
+    0x0E,0x38,0x25,0x34,0x1E,0xD7,0xA1,0x96,0xD8,0xFE,0x1D,0x5C,0x25,0x22,0xDA,0xFE,
+    0x1E,0x5D,0x26,0xA4,0x88,0x98,0x88,0xA5,0x88,0x2E,0x7F,0x7F,0xA4,0x88,0x39,0xA6,
+    0x88,0x55,0x13,0x1B,0x3D,0x04,0x39,0x2A,0x2E,0x26,0x39,0x3D,0x39,0xA7,0x88,0xC0,
+    0x04,0x13,0x0C,0xA7,0x88,0x2A,0x08,0x3D,0x04,0x35,0xC0,0x13,0x26,0x55,0x35,0x08,
+    0x26,0x08,0x2A,0x1B,0x04,0x2A,0x26,0x0C,0x2E,0x35,0x26,0x3D,0x0C,0x1B,0xC0,0x08,
+    0x2A,0x26,0x2E,0x2A,0x26,0x2A,0x26,0x2A,0x17,0x0C,0x08,0xFE,0xC2,0x9D,0x7A,0xDB,
+    0x13,0x3D,0x13,0x39,0x3D,0x04,0x26,0x39,0x26,0xC0,0xA4,0x88,0x13,0x26,0x04,0x35,
+    0x2E,0x35,0x2A,0x17,0x04,0x0C,0xC0,0x3D,0x35,0x0C,0x04,0x1B,0x17,0x22,0xC0,0x39,
+    0xC0,0x2A,0x0C,0xC0,0x22,0x08,0x17,0x08,0x3D,0x35,0x0C,0x2A,0xC0,0x04,0xC0,0x22,
+    0x04,0x35,0x2E,0x26,0x2E,0x04,0x0C,0x08,0x13,0x26,0x3D,0x17,0x2E,0x22,0x08,0x35,
+    0x04,0x08,0x2A,0xFE,0xC2,0x9D,0x7A,0xD6,0x7A,0xD5,0xFE,0x20,0x5F,0x27,0x7F,0xC0,
+    0xA3,0x88,0x40,0x99,0x88,0x7F,0x25,0xD6,0x1F,0xA5,0x88,0x36,0xAA,0x88,0x7F,0xC0,
+    0x36,0x2A,0x36,0x05,0x3D,0x99,0x88,0xA6,0x88,0xC0,0x2A,0x01,0x2E,0x9C,0x88,0x2A,
+    0x3D,0x0C,0x01,0x2A,0x1F,0x1B,0x98,0x88,0x2A,0x3D,0x23,0x05,0x2E,0x01,0x14,0x05,
+    0x2A,0x36,0x1B,0x01,0x10,0x1B,0x01,0x32,0x0C,0xC0,0x2A,0x36,0x3D,0x10,0xC1,0x01,
+    0x32,0x2A,0x01,0x1F,0x2A,0x1B,0x23,0x0C,0x3D,0x2E,0x14,0x36,0x01,0x0C,0x05,0x2E,
+    0x14,0x25,0xDA,0x2E,0x0C,0xC0,0x1F,0x01,0x2A,0x1B,0x05,0x3D,0x36,0x1F,0x23,0x10,
+    0x0C,0x14,0x10,0x1B,0x23,0x05,0x23,0x01,0xC0,0x0C,0x23,0x2A,0x0C,0x1F,0x1B,0x1F,
+    0x01,0x1F,0x0C,0x2A,0x0C,0x1B,0x23,0x10,0x1F,0x10,0x2E,0x05,0x3D,0x1F,0x32,0x14,
+    0xC0,0x36,0x10,0xC0,0x05,0x2A,0x36,0x0C,0x05,0x14,0x1F,0x2A,0x10,0x0C,0x2E,0x2A,
+    0x32,0x14,0xC0,0x2E,0x05,0x25,0xD6,0xA1,0x96,0xD3,0xFE,0x1F,0x5F,0x26,0x9C,0x88,
+    0xA7,0x88,0x55,0xA6,0x88,0x40,0x7F,0xC0,0x2F,0x97,0x88,0xA5,0x88,0x29,0xD4,0x20,
+    0x15,0x3B,0x33,0x2F,0x28,0x15,0x9C,0x88,0x11,0x19,0xA3,0x88,0x11,0x28,0x40,0x2F,
+    0x33,0xC0,0x19,0xC0,0x15,0xA3,0x88,0x3B,0x33,0x28,0x15,0x28,0x2F,0x3B,0x33,0x20,
+    0x28,0x20,0x33,0x20,0x02,0x11,0x33,0x0A,0x28,0x15,0x2F,0x24,0x0A,0x02,0x11,0x3B,
+    0x15,0x0A,0x33,0x0A,0x11,0x24,0x3B,0x33,0x28,0x2F,0x3B,0xC0,0x37,0x24,0x37,0x20,
+    0x15,0x19,0x02,0x19,0x33,0x20,0x29,0xD9,0x06,0x2F,0x33,0x11,0x24,0x33,0x2F,0x15,
+    0x33,0x19,0x20,0x15,0x20,0x15,0x2F,0x28,0x24,0x37,0x06,0x19,0x37,0x02,0x37,0x19,
+    0x2F,0x20,0x02,0x0A,0x20,0x06,0xC0,0x19,0x37,0xC1,0x06,0x15,0x37,0x02,0x24,0x3B,
+    0x19,0xC0,0x37,0x28,0xC0,0x0A,0x2F,0x02,0x33,0x02,0x28,0x33,0x15,0x20,0x28,0x02,
+    0x19,0x33,0x24,0x15,0x20,0x28,0x0A,0x11,0x0A,0x19,0x2F,0x29,0xD5,0x7D,0xD2,0xFE,
+    0x26,0x66,0x2C,0x96,0x88,0xC0,0xAB,0x88,0x9B,0x88,0xC1,0x19,0x98,0x88,0xA7,0x88,
+    0xC0,0x21,0x19,0x2A,0xD2,0xFE,0x24,0x64,0x2A,0xC0,0x99,0x88,0xA2,0x88,0x1D,0x21,
+    0xA2,0x88,0x30,0x19,0x28,0x1D,0x55,0x28,0x21,0x30,0x3F,0x28,0x21,0x0E,0xA2,0x88,
+    0x3B,0x3F,0x12,0x3B,0x3F,0x30,0x28,0x2C,0x03,0x3F,0xA8,0x88,0xC0,0x0A,0xC0,0x12,
+    0x0A,0x0E,0x37,0x2C,0x3F,0x0A,0x03,0xC0,0x37,0x0E,0x21,0x37,0x21,0x19,0x12,0xC0,
+    0x1D,0x19,0x0A,0x30,0x28,0x30,0x3B,0xC0,0x1D,0x12,0x28,0x30,0x1D,0x19,0x3B,0x21,
+    0x28,0x0A,0x3F,0x2A,0xD8,0x28,0x03,0x28,0x12,0x37,0x30,0x37,0x0A,0x1D,0x19,0x2C,
+    0x3B,0x0A,0x30,0x3F,0x03,0x19,0x21,0x19,0xC0,0x3B,0xC0,0x30,0x1D,0x3F,0x37,0x19,
+    0x1D,0xC0,0x3F,0x2C,0x12,0x19,0x21,0xC0,0x3B,0x03,0x2C,0x37,0x03,0x2C,0x30,0x1D,
+    0x28,0x3B,0x0E,0x30,0x12,0xC0,0x19,0x28,0x03,0x1D,0x2C,0x30,0x21,0x0A,0x3B,0x30,
+    0x3B,0x1D,0x3B,0x0E,0x30,0xC0,0x0E,0x19,0x0A,0x2A,0xD5,0xFE,0x28,0x69,0x2E,0xFE,
+    0xC8,0xA0,0x77,0xCF,0x3C,0x95,0x88,0xA4,0x88,0x9B,0x88,0xA7,0x88,0x08,0xA9,0x88,
+    0x99,0x88,0xC0,0xA2,0x88,0x31,0x08,0x0F,0x55,0x17,0x0F,0x2E,0xD1,0xFE,0x22,0x63,
+    0x28,0x17,0x22,0x3C,0x00,0x0F,0x7F,0x04,0x22,0x04,0x13,0x31,0x08,0x00,0x31,0x08,
+    0x22,0x04,0x0F,0xA2,0x88,0x13,0x3C,0x26,0x0F,0xC0,0x00,0x04,0x17,0x0F,0x3C,0xC1,
+    0x13,0x22,0xC0,0x00,0x3C,0x08,0x0F,0xC0,0x17,0x08,0x0F,0x00,0x08,0x17,0x13,0xC1,
+    0x3C,0x00,0x08,0x1E,0x13,0x0F,0x17,0x31,0x1E,0x17,0x00,0x31,0x13,0x00,0x3C,0x00,
+    0x08,0x26,0x13,0xC0,0x40,0x2E,0xD7,0x26,0x0F,0x26,0x0F,0x17,0x22,0x13,0x00,0x22,
+    0x13,0xC0,0x04,0x0F,0x13,0x08,0x2D,0x17,0x3C,0x1E,0x35,0x3C,0x04,0x3C,0x22,0x00,
+    0x04,0x0F,0x3C,0x0F,0x17,0xC0,0x2D,0x26,0x04,0x22,0x17,0x26,0x04,0x00,0x2D,0x1E,
+    0x04,0x35,0xC0,0x17,0x04,0x2D,0x31,0x08,0x2D,0x00,0x04,0x3C,0xC0,0x35,0x00,0x17,
+    0x00,0x13,0xC0,0x04,0x00,0x26,0x08,0x31,0x13,0x3C,0x2D,0x08,0xC0,0x2E,0xD4,0xFE,
+    0x22,0x63,0x27,0x7F,0xFE,0xC9,0xA0,0x77,0xCD,0xFE,0x28,0x69,0x2D,0x97,0x88,0xA6,
+    0x88,0x98,0x88,0x35,0x40,0x35,0x55,0xC0,0x08,0x2A,0x2E,0x7F,0xC0,0x40,0x17,0x2E,
+    0x17,0x31,0xCF,0x08,0x1F,0x35,0x99,0x88,0xA3,0x88,0x3D,0xA9,0x88,0x10,0x1B,0x39,
+    0x1B,0x17,0x35,0x1B,0x3D,0x26,0x10,0xC0,0x39,0x10,0x2E,0x0C,0x08,0x10,0xC0,0x3D,
+    0x04,0x1F,0x08,0x2E,0x10,0x08,0x3D,0xC0,0x39,0x0C,0x3D,0x39,0x08,0x1B,0xC0,0x2A,
+    0x26,0x1F,0x3D,0x17,0x2E,0x3D,0x26,0x17,0x0C,0x17,0x2A,0x17,0x39,0x1B,0x10,0x39,
+    0x10,0x1F,0x26,0xC0,0x17,0x26,0x17,0x2A,0x35,0x17,0x1B,0xC0,0x1F,0x26,0x31,0xD6,
+    0x2A,0x3D,0x35,0x08,0x04,0x39,0x17,0xC0,0x26,0x08,0xC0,0x39,0x17,0x26,0x35,0x17,
+    0x04,0x39,0x17,0x39,0x2E,0x0C,0x26,0x08,0x0C,0x17,0x04,0xC0,0x2A,0x17,0x08,0x0C,
+    0xC1,0x10,0x17,0x04,0x10,0x04,0x39,0xC0,0x1B,0x3D,0x08,0x39,0x3D,0x35,0x39,0x1B,
+    0x35,0x26,0x2E,0x2A,0xC0,0x10,0x26,0x1F,0x1B,0x04,0x10,0x0C,0x04,0x08,0x35,0x10,
+    0x0C,0x2A,0x10,0x1B,0xC0,0x31,0xD3,0x0C,0xA6,0x77,0xA3,0x88,0xFE,0xCB,0xA1,0x76,
+    0xCC,0xFE,0x1D,0x5F,0x22,0xA3,0x88,0xA8,0x88,0x96,0x88,0xA4,0x88,0x24,0xA9,0x88,
+    0xC0,0x24,0x7F,0x09,0x3A,0x99,0x88,0xA2,0x88,0x1C,0x20,0x02,0x15,0x2B,0x3A,0x35,
+    0xCE,0x3A,0x33,0x09,0xC1,0x9C,0x88,0x3A,0x1C,0x2B,0x20,0x11,0xC0,0x2F,0xC0,0x0D,
+    0x55,0x09,0x24,0x02,0x2F,0x02,0x1C,0x15,0x1C,0x02,0x2B,0x02,0xC0,0x3A,0x2F,0xC0,
+    0x02,0x1C,0x33,0x3A,0x11,0x3A,0xC0,0x20,0x15,0x3A,0xC0,0x2B,0x11,0x3E,0xC0,0x33,
+    0x2B,0x33,0x15,0x20,0x2F,0x0D,0x20,0x09,0x0D,0x3E,0x20,0x1C,0x24,0x1C,0x2B,0x11,
+    0x09,0x0D,0x2B,0x11,0x2F,0x15,0x11,0x09,0x24,0x35,0xD5,0x2B,0x3E,0x24,0x0D,0x02,
+    0x1C,0x3A,0x2B,0x3A,0x11,0x2F,0x20,0x09,0x02,0x15,0x24,0x1C,0x0D,0xC1,0x33,0xC0,
+    0x11,0x15,0x24,0x02,0x15,0x2B,0x15,0x2F,0x3A,0xC0,0x15,0x24,0x15,0xC1,0x0D,0x20,
+    0xC0,0x09,0x15,0x1C,0x15,0x0D,0x02,0x3E,0x02,0x11,0xC0,0x1C,0x0D,0xC0,0x11,0x02,
+    0x33,0x02,0x2F,0x15,0x02,0x0D,0x3A,0x3E,0x15,0x20,0xC0,0x2F,0x24,0x15,0x1C,0x33,
+    0x0D,0x35,0xD1,0x2B,0x24,0xAC,0x87,0x96,0x88,0x7F,0xFE,0xCC,0xA2,0x75,0xCA,0x0A,
+    0x3B,0xA2,0x88,0x11,0x95,0x88,0x55,0x11,0x99,0x88,0xA6,0x88,0x3B,0x2C,0xA6,0x88,
+    0x3B,0x0A,0x1D,0x02,0x19,0x28,0x1D,0xA9,0x88,0x2C,0x06,0x36,0xCC,0x0A,0x11,0x0A,
+    0xA7,0x88,0x3B,0x2C,0x1D,0x0A,0x1D,0x02,0xC0,0x2C,0xC0,0x11,0xC0,0x02,0x0A,0x19,
+    0x02,0x19,0xA4,0x88,0x40,0x0A,0x02,0x1D,0x02,0x19,0x11,0x0A,0x28,0xC1,0x06,0x11,
+    0x33,0x24,0x37,0x33,0x37,0x2C,0x37,0x0A,0x06,0x28,0x3B,0x24,0x33,0x2C,0x0A,0x2C,
+    0x11,0xC0,0x37,0x19,0x15,0x19,0x28,0x11,0x28,0x37,0x06,0x28,0xC1,0x37,0x06,0x15,
+    0x1D,0x28,0x3B,0x19,0x3B,0x19,0x24,0x36,0xD4,0x3B,0x15,0x02,0xC0,0x3B,0xC0,0x06,
+    0x33,0xC0,0x3B,0xC1,0x2C,0x24,0x19,0x0A,0x28,0x33,0x28,0x3B,0x19,0x06,0x19,0x2C,
+    0x37,0x3B,0x15,0x28,0x06,0x2C,0x3B,0x33,0x28,0x2C,0x33,0x3B,0x06,0x15,0x1D,0xC0,
+    0x02,0x0A,0x33,0x28,0x02,0x28,0x15,0x28,0x11,0x15,0x33,0x11,0x33,0x28,0xC0,0x33,
+    0x2C,0x3B,0x37,0x1D,0x19,0x24,0x02,0x11,0x0A,0x1D,0x0A,0x19,0x28,0x24,0x37,0x0A,
+    0x36,0xD0,0x28,0x11,0x1D,0xA4,0x77,0x7F,0xA7,0x88,0x40,0xFE,0xCE,0xA3,0x74,0xC8,
+    0xFE,0x1E,0x61,0x22,0x0F,0x40,0x7F,0x0F,0xA2,0x88,0xA3,0x88,0x1E,0x00,0xC0,0x0F,
+    0x31,0x1E,0x29,0x1A,0xC1,0x29,0x1A,0xA4,0x88,0x9A,0x88,0x7F,0x29,0x1A,0x3A,0xCA,
+    0x0B,0x00,0x1A,0x2D,0x0F,0x3C,0x16,0x31,0x1E,0x0F,0xC0,0x16,0x00,0xC0,0x16,0x0F,
+    0x22,0x00,0x0B,0x2D,0x00,0x22,0x16,0x2D,0x31,0x29,0x0F,0xA7,0x88,0x07,0x0F,0x31,
+    0x0B,0x38,0xC0,0x0F,0x29,0x2D,0x00,0x29,0x07,0x38,0x07,0x22,0x0F,0x2D,0x0B,0x1A,
+    0x22,0xC0,0x2D,0x0B,0x1A,0x2D,0x00,0x0B,0x31,0x1A,0x2D,0x38,0x07,0x29,0x38,0x1E,
+    0x29,0x2D,0x16,0x29,0x31,0x0B,0x2D,0x3C,0x31,0x1E,0x31,0x38,0x3A,0xD3,0x38,0x2D,
+    0x22,0x00,0x2D,0x0F,0x2D,0x1E,0xC1,0x0B,0x3C,0x22,0x1E,0x00,0x38,0x1E,0x22,0x31,
+    0x3C,0xC0,0x29,0x0F,0x1E,0x2D,0x16,0x38,0x07,0x29,0x0B,0x29,0x1E,0x29,0x1E,0x38,
+    0x00,0x2D,0x00,0x2D,0x31,0x3C,0x2D,0x1A,0x07,0x29,0x07,0x0F,0x3C,0x0B,0x00,0x0B,
+    0x07,0x0F,0x22,0x07,0x38,0x0F,0x31,0x07,0x31,0x22,0x1A,0xC0,0x0B,0x29,0x0B,0x07,
+    0x2D,0x1A,0x16,0x00,0x29,0x07,0x0B,0x3A,0xCE,0x3C,0x22,0x3C,0x1A,0xA4,0x87,0x9D,
+    0x88,0x0F,0x9C,0x88,0x9B,0x88,0xFE,0xCF,0xA3,0x74,0xC5,0xFE,0x28,0x6B,0x2B,0xC0,
+    0x9C,0x88,0x9B,0x88,0x0F,0x35,0xC0,0x13,0x9C,0x88,0x0F,0x55,0xC0,0x22,0x9C,0x88,
+    0x9D,0x88,0x13,0xA5,0x88,0x35,0x17,0x08,0xC0,0x13,0x2A,0x35,0x31,0x35,0x1E,0x3D,
+    0xC8,0x08,0x31,0x13,0xC0,0x2A,0x31,0x17,0x31,0x2A,0x13,0x00,0x08,0x22,0x17,0xA3,
+    0x88,0x13,0x39,0x35,0x26,0x08,0xC0,0x35,0x08,0xC0,0x1E,0x0F,0x31,0x22,0x26,0x17,
+    0x22,0x0F,0x04,0x13,0xC0,0x22,0xC0,0x26,0x08,0x22,0x31,0x22,0x26,0x31,0x1E,0x17,
+    0x26,0x00,0x08,0x00,0x2A,0x35,0x39,0x04,0xC0,0x0F,0x00,0x22,0x0F,0x08,0x31,0x13,
+    0xC0,0x22,0x13,0x35,0x17,0x2A,0x39,0x0F,0x39,0xC0,0x22,0x04,0x08,0x13,0x04,0x3D,
+    0xD2,0x08,0x13,0xC0,0x22,0x31,0x2A,0x31,0x17,0x31,0x13,0xC0,0x04,0x26,0x35,0x1E,
+    0xC0,0x08,0x31,0x26,0x08,0x1E,0x2A,0x22,0x2A,0x1E,0x00,0x39,0x22,0x17,0x13,0x35,
+    0x13,0x35,0x0F,0x39,0x04,0x2A,0x0F,0x13,0x26,0x04,0x13,0x35,0x22,0x39,0x08,0x04,
+    0x22,0x04,0x31,0x0F,0x13,0x22,0x08,0x35,0x08,0x35,0x08,0x31,0x17,0xC0,0x1E,0xC0,
+    0x17,0x13,0x00,0x08,0x39,0x0F,0x39,0x04,0x2A,0x13,0x08,0x35,0x3D,0xCD,0x22,0x35,
+    0x26,0x04,0x9B,0x77,0xA6,0x88,0x7F,0xA4,0x88,0x18,0x9D,0x88,0x14,0xFE,0xD1,0xA4,
+    0x73,0xC1,0x14,0x2B,0xA6,0x88,0x55,0x09,0x55,0xA7,0x88,0x2B,0x40,0x55,0x18,0x0D,
+    0x18,0x0D,0x18,0x3E,0xA7,0x88,0x3E,0x27,0x3A,0xC0,0x18,0x05,0x27,0x05,0x3A,0x14,
+    0x36,0x3A,0x27,0x36,0x01,0xC5,0x23,0x18,0x3A,0x18,0x14,0x09,0x27,0x9B,0x88,0x0D,
+    0x1C,0x27,0x1C,0x36,0x1C,0x2F,0x23,0x3A,0x36,0x23,0x2F,0x3A,0x09,0x2F,0x3A,0xC1,
+    0x36,0xC0,0x05,0x09,0x1C,0x23,0x2B,0x1C,0x3A,0x09,0x14,0x09,0x05,0x23,0x0D,0x2F,
+    0x09,0x05,0x3A,0x36,0x23,0xC0,0x36,0x1C,0xC0,0x3E,0x36,0x3A,0x09,0x1C,0x14,0x2B,
+    0x3E,0x09,0x2F,0x23,0x3A,0x3E,0x23,0x09,0x0D,0x3E,0x27,0x23,0x14,0x0D,0x23,0x3A,
+    0x0D,0x09,0xC0,0x3A,0x01,0xD1,0x27,0x05,0x14,0x27,0x2B,0x1C,0xC0,0x0D,0xC0,0x27,
+    0x0D,0xC0,0x3E,0x18,0x36,0x27,0x0D,0x09,0x0D,0x3A,0x36,0x23,0x14,0xC0,0x05,0x3A,
+    0x36,0x0D,0x2F,0x3A,0x23,0x0D,0x1C,0xC0,0x14,0x18,0x36,0x18,0x2F,0x05,0x3E,0x0D,
+    0x27,0x18,0x36,0x0D,0x1C,0x3A,0x14,0x0D,0x2B,0x14,0x3A,0x3E,0x09,0x18,0x2F,0x27,
+    0x18,0x1C,0x14,0x1C,0xC0,0x14,0x23,0x2F,0x14,0xC0,0x2B,0x2F,0x2B,0x27,0x1C,0x3E,
+    0x23,0x3E,0x01,0xCC,0x23,0xC0,0x3E,0x09,0x3A,0x9D,0x87,0xA6,0x88,0xA4,0x88,0x40,
+    0x55,0x1C,0x55,0x20,0x0D,0x9A,0x88,0x40,0xA4,0x88,0x55,0x0D,0x02,0xA7,0x88,0x11,
+    0xC1,0x02,0x2F,0x9B,0x88,0xC0,0x06,0x15,0x24,0xC0,0x9D,0x88,0x24,0x0D,0x11,0x20,
+    0x2B,0x3E,0x20,0x3E,0x06,0x37,0x15,0x2F,0x37,0xC0,0x11,0xFE,0xD2,0xA5,0x72,0xC1,
+    0x2B,0x33,0x11,0x15,0x24,0x1C,0x2B,0x0D,0x9B,0x88,0x11,0x2B,0x02,0x3E,0x1C,0x37,
+    0x2F,0x20,0x15,0x1C,0x2F,0x02,0x3E,0x37,0x02,0x06,0x24,0x0D,0xC0,0x06,0x11,0x15,
+    0x2B,0x37,0x02,0x15,0xC0,0x33,0x37,0x20,0x0D,0x37,0x20,0x06,0x2B,0xC0,0x3E,0x11,
+    0x06,0x20,0x2F,0x3E,0x2F,0x06,0x15,0x2F,0x0D,0x1C,0x11,0x0D,0x3E,0x2F,0x11,0x24,
+    0x2F,0x11,0x20,0x1C,0x02,0x20,0x06,0xC0,0x24,0x3E,0xC0,0x1C,0x02,0x06,0xC0,0x02,
+    0x06,0x24,0xFE,0xD2,0xA5,0x72,0xD0,0x06,0x1C,0x0D,0x3E,0x06,0x37,0x2F,0x11,0x24,
+    0x06,0x33,0x20,0x3E,0x37,0x3E,0x11,0x2F,0x33,0x11,0x0D,0x37,0x0D,0x3E,0x37,0x33,
+    0x3E,0x20,0xC0,0x24,0x33,0x7F,0x2B,0x20,0xC0,0x2F,0x37,0x33,0x2F,0x15,0x1C,0xC0,
+    0x20,0xC0,0x33,0x3E,0xC0,0x15,0x02,0x2F,0x0D,0x11,0x2B,0x0D,0x1C,0x11,0x0D,0x2F,
+    0x3E,0x11,0x20,0x2B,0x0D,0x24,0x33,0x37,0x06,0x15,0x20,0x06,0x02,0x33,0xC0,0x2B,
+    0x2F,0x33,0x15,0x06,0xFE,0xD2,0xA5,0x72,0xCA,0x2F,0x15,0x20,0x37,0x20,0xC0,0xA5,
+    0x77,0x40,0x9C,0x88,0xA3,0x88,0x07,0x9D,0x88,0x21,0x95,0x88,0x34,0x9B,0x88,0xA9,
+    0x88,0x98,0x88,0x03,0x30,0x95,0x88,0x30,0x9B,0x88,0x38,0x3C,0xAA,0x88,0x38,0x21,
+    0x34,0x21,0x3C,0x03,0x9D,0x88,0x0B,0xC0,0x12,0x07,0x03,0xC0,0x12,0x21,0xC0,0x03,
+    0x25,0x0B,0x03,0x25,0x34,0x07,0x03,0x12,0x3C,0x29,0x1A,0x3C,0x03,0x0B,0x30,0x3C,
+    0x0B,0x34,0xC0,0x38,0x30,0xC0,0x29,0x1A,0x34,0x1A,0x29,0xC0,0x0B,0x34,0x07,0x21,
+    0x03,0x16,0x38,0x03,0x1A,0x38,0x03,0x30,0x29,0x0B,0x03,0x38,0x3C,0xC0,0x16,0x03,
+    0x38,0x25,0x16,0xC0,0x30,0x0B,0x1A,0x29,0x30,0x12,0x3C,0x12,0x30,0x16,0xC0,0x07,
+    0xC0,0x34,0x1A,0xC0,0x30,0x29,0xC0,0x30,0x3C,0x07,0x0B,0x25,0x07,0x29,0xC0,0x38,
+    0x1A,0x21,0xC0,0x34,0x16,0x0B,0x25,0x12,0x21,0x30,0x03,0xFE,0xD4,0xA6,0x71,0xCE,
+    0x3C,0x25,0x38,0xC0,0x30,0xC0,0x21,0x38,0x29,0x30,0x1A,0x21,0x12,0x16,0x12,0x3C,
+    0x30,0xC0,0x16,0x25,0x34,0x3C,0x1A,0x29,0x25,0x12,0x0B,0x38,0x21,0x03,0x16,0x29,
+    0x34,0x07,0x0B,0x29,0xC0,0x25,0x03,0x0B,0x1A,0x25,0x07,0x21,0x12,0x03,0x12,0x03,
+    0x16,0xC0,0x34,0x16,0x30,0x3C,0x12,0x16,0x1A,0x16,0x1A,0x3C,0x38,0x16,0x03,0x16,
+    0x12,0x0B,0x29,0x03,0x38,0x25,0x03,0x16,0x38,0x34,0x30,0x0B,0x07,0x30,0x1A,0x06,
+    0xC8,0x34,0x21,0x34,0x30,0x38,0x12,0xC0,0x97,0x87,0xA8,0x88,0xA2,0x88,0x7F,0x96,
+    0x88,0xAB,0x88,0x99,0x88,0xA2,0x88,0x9D,0x88,0x38,0x13,0x00,0x40,0x38,0x13,0xA5,
+    0x88,0x29,0x1E,0x04,0x2D,0xA2,0x88,0x29,0x22,0x38,0xC0,0x3C,0x1E,0x2D,0x38,0xC0,
+    0x97,0x88,0x3C,0x04,0x1E,0x38,0x04,0x1E,0x0B,0x13,0x31,0x1A,0x04,0x2D,0x13,0x00,
+    0x0B,0x04,0x0F,0x38,0x04,0x13,0xC0,0x04,0x0B,0x00,0x0F,0x00,0x13,0x3C,0x2D,0x0B,
+    0x0F,0xC0,0x38,0x22,0x1A,0x0F,0x3C,0x31,0x0F,0x0B,0x31,0xC0,0x1A,0x38,0x29,0x31,
+    0x00,0xC0,0x3C,0x0F,0x29,0x00,0x0B,0x04,0x1A,0x2D,0x00,0x1A,0x38,0x31,0x22,0x31,
+    0x22,0x13,0x00,0x1E,0x31,0x22,0xC0,0x3C,0x38,0x0B,0x13,0x0F,0x1E,0x29,0x31,0x22,
+    0x04,0x2D,0x31,0x1E,0x38,0x13,0x29,0x00,0x38,0x31,0x29,0x1A,0x00,0x3C,0x38,0x1A,
+    0x2D,0x0F,0x13,0xFE,0xD5,0xA6,0x71,0xCE,0x13,0xC0,0x31,0x13,0x3C,0x2D,0x29,0x3C,
+    0x2D,0x04,0x0B,0x22,0x2D,0x1E,0x3C,0x13,0x31,0x04,0x31,0x00,0x31,0x3C,0x0B,0x00,
+    0xC1,0x0F,0x00,0xC0,0x04,0xC1,0x1A,0x38,0x2D,0x04,0x31,0x13,0x0F,0x2D,0x1A,0x00,
+    0x13,0x31,0x1A,0x13,0x31,0x04,0x31,0x1A,0x22,0x0B,0xC0,0x1A,0xC0,0x04,0x2D,0x29,
+    0x04,0x3C,0x31,0x2D,0x22,0x3C,0x04,0x31,0x22,0x13,0x04,0x22,0x0F,0x0B,0x13,0x3C,
+    0xC0,0x00,0x31,0x1E,0x04,0x3C,0x09,0xC6,0x00,0x0F,0x00,0x3C,0x1E,0xC0,0x3C,0xC0,
+    0x6E,0x55,0x9D,0x88,0x9D,0x88,0x7F,0xAA,0x88,0x32,0xA2,0x88,0x9D,0x88,0x27,0x10,
+    0x9A,0x88,0x01,0x98,0x88,0x01,0x09,0xA5,0x88,0x27,0x36,0x14,0x23,0x09,0x23,0xA5,
+    0x88,0x10,0x32,0x01,0x3D,0x18,0x3D,0x2E,0x09,0x27,0x01,0x23,0x01,0x23,0x01,0x05,
+    0x10,0x09,0x36,0xC0,0x05,0x2E,0x23,0x05,0x01,0x09,0x10,0x05,0x36,0x01,0xC0,0x2E,
+    0x01,0x27,0x36,0x18,0x36,0x32,0x27,0x09,0xAA,0x88,0x23,0x05,0x09,0x27,0x3D,0x18,
+    0x09,0x2E,0x10,0x23,0x32,0x27,0x36,0x10,0x32,0x3D,0x1F,0x18,0x1F,0x23,0x36,0x18,
+    0x27,0x14,0x01,0x32,0xC0,0x01,0x1F,0x14,0x23,0x10,0x36,0x32,0x05,0x23,0x14,0x23,
+    0x3D,0x10,0x36,0x23,0x10,0x18,0x27,0x1F,0x10,0x1F,0x3D,0x14,0x18,0x09,0x23,0x10,
+    0x32,0x09,0x3D,0x32,0x18,0x1F,0xC0,0x3D,0x36,0x32,0x14,0xFE,0xD7,0xA7,0x70,0xCC,
+    0x01,0x18,0x14,0x1F,0x09,0x05,0x10,0x01,0x3D,0x10,0x14,0x27,0x10,0x27,0x23,0x1F,
+    0x05,0x2E,0x32,0x2E,0x36,0x32,0x2E,0x23,0x09,0x01,0x05,0x18,0x05,0xC0,0x09,0x10,
+    0x18,0x14,0x1F,0x01,0x1F,0x27,0x36,0x05,0x2E,0x18,0x27,0x32,0x14,0x23,0x1F,0x3D,
+    0x32,0x3D,0x1F,0x32,0x1F,0xC0,0x18,0x10,0x32,0x10,0x18,0x1F,0x09,0xC1,0x05,0x09,
+    0x05,0xC0,0x27,0x01,0x32,0x10,0x2E,0x1F,0x14,0x09,0x32,0x14,0x36,0xC0,0x14,0x2E,
+    0xC0,0x0D,0xC3,0x09,0xC0,0x32,0x01,0x36,0x23,0x27,0xC0,0x36,0x18,0xA6,0x87,0x9A,
+    0x88,0xA2,0x88,0xA3,0x88,0x11,0xA7,0x88,0x7F,0x7F,0x09,0x2F,0x11,0x2B,0x9D,0x88,
+    0x7F,0xA6,0x88,0x09,0x3A,0x3E,0x11,0x18,0xA2,0x88,0x2B,0xC1,0x09,0x2B,0x0D,0x3A,
+    0x1C,0x18,0x11,0x7F,0x3A,0x36,0xC0,0x2B,0x2F,0x2B,0x2F,0x09,0xC0,0xA4,0x88,0x09,
+    0x36,0x09,0x18,0x2F,0x0D,0x2B,0x36,0x3A,0x0D,0x1C,0x36,0x3A,0x2B,0x09,0x2B,0x0D,
+    0x3E,0x1C,0x09,0xC0,0x05,0x36,0xC0,0x09,0x3E,0x0D,0x11,0x27,0x20,0x0D,0x36,0x2B,
+    0x2F,0x0D,0x05,0xC0,0x18,0x0D,0x3A,0x11,0x2F,0x3A,0x20,0x3E,0x2F,0x20,0x2B,0x11,
+    0x2F,0x20,0xC0,0x3A,0x09,0x36,0x27,0x3A,0x05,0x11,0xC0,0x0D,0x11,0x09,0x3A,0x36,
+    0x27,0x3E,0x1C,0x18,0x3A,0x20,0x1C,0xC0,0x2B,0x27,0x2B,0x0D,0x20,0x3E,0x36,0x3A,
+    0x09,0x1C,0x2B,0xC0,0x36,0xC1,0xFE,0xD8,0xA8,0x6F,0xCA,0x2B,0x18,0x0D,0x2F,0xC0,
+    0x11,0x1C,0xC0,0x2B,0x20,0x27,0x18,0x05,0x1C,0x18,0x2F,0xC0,0x05,0x36,0x27,0x20,
+    0x09,0x3E,0x3A,0x36,0x3E,0x1C,0x18,0x09,0x27,0x36,0x2F,0x05,0x3E,0x0D,0x2F,0x36,
+    0x2F,0x27,0x2B,0xC0,0x3A,0x1C,0x36,0x05,0x11,0x09,0x20,0x11,0x1C,0x3E,0x2F,0x3E,
+    0x2B,0x3A,0x09,0x18,0x0D,0x2B,0x18,0x1C,0x3A,0x1C,0x20,0x18,0xC0,0x11,0x05,0x2F,
+    0x09,0x36,0x3A,0x2F,0x20,0x11,0x20,0x11,0x2F,0x0D,0x3E,0x36,0x3A,0x2B,0x36,0x09,
+    0xC0,0x0D,0x36,0x27,0x0D,0x09,0x2B,0x20,0x36,0x2B,0x3A,0x3E,0x20,0xAB,0x77,0xC0,
+    0x9A,0x88,0x9D,0x88,0xA8,0x88,0x55,0x97,0x88,0x2C,0x3B,0x9B,0x88,0x2C,0x16,0xA4,
+    0x88,0x21,0xA7,0x88,0x2C,0x16,0x3B,0x1D,0x40,0x21,0x1D,0x16,0x0A,0x9C,0x88,0x21,
+    0x3B,0x0A,0x30,0x3B,0x0A,0x3B,0x16,0x1D,0x2C,0x3F,0x2C,0x3B,0x2C,0x97,0x88,0x30,
+    0xC0,0x3B,0x25,0x1D,0x16,0xC0,0x0A,0x0E,0x1D,0x30,0x0A,0x21,0x34,0x30,0x3B,0x16,
+    0x34,0x0A,0x12,0x0E,0x3B,0x1D,0x30,0x2C,0x34,0x0A,0x1D,0x3F,0x3B,0x12,0x1D,0x0A,
+    0x1D,0x12,0x3B,0x2C,0x16,0x0A,0x30,0x0E,0x1D,0x30,0x34,0x21,0x34,0x3F,0x30,0x1D,
+    0x0E,0x2C,0x34,0x0E,0x2C,0x25,0x1D,0xC1,0x30,0x12,0x30,0x3F,0x3B,0x16,0x0A,0x2C,
+    0x3B,0x12,0x34,0x2C,0x12,0x30,0x12,0x25,0x12,0x16,0x25,0x2C,0x0A,0x25,0x3F,0x34,
+    0x3F,0x9C,0x88,0x0A,0x03,0x16,0x03,0x25,0xC0,0xFE,0xD9,0xA8,0x6F,0xCA,0x25,0x3B,
+    0x16,0x1D,0x2C,0x25,0x16,0x12,0x30,0x34,0x21,0x25,0x16,0x0A,0x30,0x0A,0x1D,0xC0,
+    0x03,0x34,0x0E,0x1D,0x3F,0x34,0x21,0x1D,0x30,0x0E,0x0A,0xC0,0x1D,0x2C,0x34,0x21,
+    0x0E,0x25,0x2C,0x0A,0xC0,0x16,0xC0,0x0A,0x1D,0x12,0x25,0x3F,0x25,0x16,0x2C,0x16,
+    0x3B,0x12,0x0E,0x12,0x1D,0xC0,0x0A,0xC0,0x12,0x3F,0x30,0x25,0x0A,0x2C,0x03,0x12,
+    0x2C,0xC0,0x0A,0x34,0x0E,0xC0,0x3B,0x16,0x21,0x3B,0x3F,0x25,0x30,0x0A,0x2C,0x34,
+    0x12,0x25,0x21,0x12,0x0A,0x03,0x21,0x1D,0x34,0x0E,0x03,0x1D,0x16,0x03,0x3B,0x3F,
+    0x54,0xA5,0x88,0x98,0x88,0xA4,0x88,0x34,0x29,0x38,0xA3,0x88,0x40,0x9A,0x88,0xA3,
+    0x88,0x9C,0x88,0xA8,0x88,0x1A,0xA7,0x88,0x16,0x29,0x40,0xC1,0x03,0x0B,0x38,0x29,
+    0x1A,0x1E,0x07,0xA5,0x88,0x16,0x3C,0x38,0x12,0x07,0x2D,0x16,0x12,0x1A,0x2D,0x0B,
+    0x2D,0x38,0xC0,0x3C,0x2D,0x34,0x07,0x16,0x34,0x12,0x0B,0x3C,0x0B,0x1A,0x29,0x03,
+    0x29,0xC0,0x03,0x1A,0x25,0x12,0x3C,0x1E,0x0B,0x1A,0x07,0x12,0x25,0x16,0x1E,0x29,
+    0x1E,0x12,0x3C,0x03,0x0B,0x1A,0x34,0x0B,0x2D,0x38,0x03,0x29,0x03,0x29,0x12,0xC0,
+    0x0B,0x2D,0x1E,0x38,0x29,0x25,0x29,0x34,0x12,0x38,0x29,0x25,0x12,0x03,0x1A,0x38,
+    0x12,0x25,0x1A,0x12,0x29,0x25,0x2D,0x12,0x38,0x0B,0x25,0x07,0x29,0x12,0x1A,0x03,
+    0x1E,0x2D,0x25,0x16,0x1E,0x3C,0x25,0x12,0x0B,0x12,0x16,0x07,0xFE,0xDB,0xA9,0x6E,
+    0xC8,0x1A,0x38,0xC0,0x25,0x1E,0x2D,0x38,0x3C,0x03,0x25,0x0B,0x07,0x34,0x38,0x07,
+    0x2D,0x38,0x12,0x34,0x3C,0x03,0x34,0x07,0x0B,0x34,0x1A,0x16,0x12,0x1E,0x1A,0xC0,
+    0x12,0x3C,0x1A,0x34,0x16,0x1A,0x07,0x3C,0x38,0x29,0x16,0x29,0x0B,0x1A,0x1E,0x1A,
+    0x16,0x25,0x1A,0x07,0x1A,0xC0,0x3C,0x1A,0xC0,0x12,0x29,0x3C,0x1A,0x38,0x34,0x07,
+    0x34,0x07,0x03,0x3C,0x38,0x1E,0x2D,0x25,0x0B,0x29,0x1E,0x16,0x03,0x1A,0x1E,0x38,
+    0x12,0x2D,0x25,0x34,0x03,0x29,0x3C,0x1E,0x29,0x0B,0x25,0x29,0x16,0x38,0x03,0x0B,
+    0x16,0x2D,0x1E,0x29,0x9C,0x77,0xAA,0x88,0x9D,0x88,0x23,0xA2,0x88,0xAA,0x88,0x55,
+    0x99,0x88,0x17,0x39,0x55,0x9A,0x88,0x17,0x9A,0x88,0x1F,0x39,0x01,0x23,0xC0,0x0C,
+    0x3D,0xA2,0x88,0x39,0xC0,0x97,0x88,0x3D,0x1F,0x3D,0x23,0x10,0xA2,0x88,0x3D,0x2A,
+    0xC0,0x0C,0x2A,0x10,0x2A,0x1B,0x39,0x32,0x2E,0x17,0x39,0x3D,0x39,0x01,0x17,0x10,
+    0x1B,0x0C,0x32,0x17,0x39,0x3D,0x39,0x3D,0x10,0x1F,0x17,0x23,0x1F,0x23,0x1F,0x17,
+    0x32,0x01,0x2A,0x1F,0x17,0x0C,0x08,0x3D,0x1F,0x32,0x1F,0x17,0x23,0x0C,0x01,0x1F,
+    0x1B,0x10,0x01,0x23,0x39,0x3D,0x1B,0x23,0x2A,0x1B,0x1F,0x23,0x08,0x3D,0x2E,0x32,
+    0x1F,0x01,0x2A,0x08,0x10,0x32,0x01,0x17,0x08,0x39,0x2A,0x39,0x3D,0x1B,0x2A,0x08,
+    0x23,0x10,0x3D,0x39,0x23,0x39,0x23,0x1B,0x3D,0x17,0x2A,0x17,0xC0,0x01,0x23,0x08,
+    0x17,0x3D,0x39,0xFE,0xDC,0xAA,0x6D,0xC6,0x3D,0x10,0x01,0x10,0x32,0x2A,0x0C,0x1B,
+    0xC0,0x2E,0x39,0xC0,0x1F,0x10,0x1B,0x2A,0x1F,0x3D,0x10,0x39,0x1F,0x2A,0x1F,0x08,
+    0x01,0x08,0x39,0x1F,0x2E,0x2A,0x08,0x1F,0x1B,0x39,0x10,0x17,0x10,0x1B,0x39,0x23,
+    0x32,0x10,0x1F,0x01,0x08,0x2E,0x10,0x01,0x39,0xC0,0x23,0x2A,0x10,0x3D,0x1F,0xC0,
+    0x10,0x39,0x1F,0x3D,0x23,0x17,0x23,0x01,0x08,0x0C,0x3D,0x1F,0x2E,0x3D,0x17,0x2E,
+    0x2A,0x10,0x1F,0xC0,0x17,0x1F,0x0C,0x2A,0x01,0x17,0x2A,0x2E,0x01,0x3D,0x23,0x32,
+    0x1F,0x32,0x17,0x0C,0x10,0x0C,0x1F,0x23,0x1F,0x2E,0x23,0x08,0x69,0x55,0x40,0xA5,
+    0x88,0x9A,0x88,0xC1,0x1F,0x99,0x88,0x32,0xA2,0x88,0x14,0x1F,0x97,0x88,0x10,0x05,
+    0xC0,0x40,0x9D,0x88,0xC0,0x10,0x97,0x88,0x10,0x36,0xC0,0x32,0x05,0x10,0x05,0x3A,
+    0x05,0x9A,0x88,0x05,0x32,0x18,0x3A,0x18,0x10,0x14,0x05,0x09,0x01,0x09,0x18,0x32,
+    0x3A,0x10,0x36,0xC0,0xA3,0x88,0x14,0x1F,0xC0,0x09,0x05,0x01,0x14,0x32,0x09,0x2B,
+    0x23,0x18,0x01,0x18,0x1F,0x09,0x3A,0x27,0x23,0x2B,0xC0,0x36,0x27,0x18,0x2B,0x27,
+    0x01,0xC0,0x09,0xC0,0x3A,0x10,0x09,0x32,0x05,0x27,0x1F,0xC0,0x09,0x3A,0x18,0x1F,
+    0x09,0x32,0x05,0x18,0x1F,0x05,0x23,0x14,0x09,0x32,0x3A,0x1F,0x14,0x18,0xC0,0x3A,
+    0x01,0x09,0x18,0xC0,0x32,0xC0,0x10,0x09,0x23,0x27,0x3A,0x1F,0xC0,0x32,0x36,0x3A,
+    0x36,0x23,0x27,0x09,0x01,0x32,0x14,0x05,0x1F,0xFE,0xDE,0xAB,0x6C,0xC4,0x23,0x32,
+    0x10,0x23,0x18,0x09,0x23,0x32,0x3A,0x1F,0x05,0x10,0x05,0x36,0x18,0x14,0x01,0x23,
+    0x05,0x36,0x01,0x32,0x09,0x2B,0x1F,0x2B,0x36,0x32,0x14,0x09,0x01,0x10,0x14,0x32,
+    0x36,0xC0,0x09,0x14,0x18,0x23,0x14,0x23,0x27,0x32,0x18,0x09,0x32,0x18,0x27,0x3A,
+    0x01,0x3A,0x01,0x18,0x05,0x23,0x18,0x01,0x27,0x14,0x10,0x2B,0x05,0x18,0x01,0x10,
+    0x2B,0x27,0x10,0x27,0x32,0x18,0x05,0x2B,0x1F,0x14,0x36,0x05,0x18,0x01,0x3A,0x09,
+    0x23,0x2B,0x10,0x05,0x09,0x2B,0x23,0x14,0xC0,0x36,0x23,0x05,0x2B,0x01,0x32,0x01,
+    0x05,0xC0,0x18,0xA6,0x77,0x98,0x88,0x28,0xA2,0x88,0x30,0x06,0x99,0x88,0x06,0x9B,
+    0x88,0x30,0xA2,0x88,0xA5,0x88,0xA4,0x88,0x0E,0x19,0x0E,0xC0,0xA2,0x88,0x28,0x40,
+    0x15,0x96,0x88,0x28,0x3F,0xC0,0x15,0x0A,0x19,0x3B,0x1D,0x30,0x28,0x0A,0x1D,0x19,
+    0x1D,0x0E,0x1D,0xC0,0x28,0x06,0x3B,0x06,0x15,0x2C,0x19,0xA5,0x88,0xC0,0x9D,0x88,
+    0xC0,0x24,0x28,0x1D,0x24,0x1D,0x2C,0x3F,0x24,0x37,0x30,0x24,0x30,0x37,0x3B,0x3F,
+    0x24,0x28,0x06,0x0E,0x19,0x28,0x3F,0x0A,0x15,0x0E,0x28,0x30,0x24,0x15,0x0E,0x3B,
+    0x06,0x15,0x3B,0x19,0x15,0x1D,0x0A,0x19,0x24,0x3F,0x0A,0x3B,0x30,0x2C,0x1D,0x37,
+    0x3B,0xC0,0x06,0x30,0x3F,0x19,0x24,0xC0,0x0A,0x2C,0x15,0x0E,0x2C,0x15,0x06,0x1D,
+    0x15,0x3B,0xC0,0x1D,0x30,0xC1,0x15,0x0E,0x37,0x19,0x3B,0x15,0x30,0x2C,0x24,0x37,
+    0x28,0x2C,0x3F,0x15,0x06,0x1D,0x30,0x0E,0x24,0x0A,0x3B,0x2C,0x24,0x19,0x30,0x0A,
+    0x3F,0x2C,0x15,0x0A,0x24,0x1D,0xC0,0x28,0x37,0x0A,0x37,0x2C,0x30,0xC0,0x24,0x0E,
+    0x24,0x19,0x15,0x24,0x0E,0x3B,0x3F,0x37,0x1D,0x28,0x06,0x28,0x0E,0xC0,0x0A,0x0E,
+    0x37,0x15,0xC0,0x3B,0x1D,0x0E,0xC0,0x37,0x15,0x3F,0x0E,0x24,0x30,0x37,0x2C,0xC0,
+    0x3B,0x30,0x0E,0x15,0x30,0x3F,0x24,0x19,0x15,0x0A,0x15,0x0A,0x2C,0x06,0x0E,0x0A,
+    0xC0,0x24,0x3B,0x24,0x19,0x3B,0x2C,0x19,0x0E,0x2C,0x30,0x2C,0x1D,0x15,0x30,0x19,
+    0x30,0x24,0x30,0x3F,0x37,0x19,0x30,0x24,0x06,0x1D,0x0E,0x15,0x0A,0x24,0x69,0x40,
+    0x9D,0x88,0x9D,0x88,0x3F,0xC0,0x9B,0x88,0x40,0x1D,0x25,0x16,0x55,0xA4,0x88,0xC0,
+    0x07,0xC0,0xAB,0x88,0x9C,0x88,0x25,0xC0,0x03,0x2C,0x30,0xC0,0x55,0x2C,0xC0,0x1D,
+    0x07,0x12,0x3F,0x03,0x16,0xC0,0x3F,0x07,0x03,0x16,0xA8,0x88,0x21,0x3F,0x07,0x21,
+    0x12,0x25,0x07,0xC0,0x0E,0xC0,0x34,0x03,0x12,0x03,0x3F,0x03,0x12,0x30,0x3F,0xC0,
+    0x0E,0x07,0x25,0x12,0x03,0x30,0x1D,0x21,0x03,0x1D,0x07,0x21,0x03,0x9B,0x88,0x25,
+    0x34,0x12,0x0E,0xC0,0x16,0x25,0x34,0x1D,0x30,0x3F,0x38,0x16,0x3F,0x34,0x38,0x0E,
+    0x07,0x34,0x0E,0x3F,0x07,0x16,0x1D,0x0E,0x30,0x21,0x3F,0x25,0x21,0x12,0x38,0x16,
+    0x21,0x2C,0x03,0x30,0x34,0x1D,0x12,0x07,0x3F,0x12,0x16,0x0E,0x1D,0x30,0x25,0x12,
+    0x21,0x07,0x3F,0x1D,0x03,0x30,0xC0,0x16,0x38,0x1D,0x25,0xC0,0x38,0x03,0x25,0xC0,
+    0x1D,0x30,0xC0,0x0E,0x12,0x30,0x12,0x16,0x2C,0x25,0x38,0x25,0x30,0xC0,0x38,0x0E,
+    0x16,0x30,0x07,0x2C,0x38,0x16,0x30,0x34,0x25,0x03,0xC0,0x1D,0x16,0x07,0x34,0x12,
+    0x03,0x3F,0x38,0x30,0x38,0x0E,0x21,0x38,0x1D,0x0E,0x03,0x34,0xC0,0x0E,0x1D,0x12,
+    0x34,0x2C,0x12,0x21,0x34,0x0E,0x07,0x3F,0x0E,0xC0,0x38,0x1D,0x07,0x12,0x07,0x25,
+    0x07,0x0E,0x38,0x25,0x21,0x07,0x25,0x03,0x25,0x34,0xC0,0x21,0xC0,0x1D,0x30,0x3F,
+    0x1D,0x30,0x25,0x1D,0x21,0x12,0x07,0x1D,0x38,0x07,0x34,0x1D,0x3F,0x21,0x25,0x1D,
+    0x34,0x12,0x16,0x0E,0x3F,0x0E,0x9D,0x77,0xC0,0xA5,0x88,0x9C,0x88,0x9C,0x88,0xC0,
+    0x26,0x99,0x88,0xA4,0x88,0xC0,0x26,0xC0,0x40,0xA7,0x88,0x95,0x88,0xA8,0x88,0x22,
+    0xC0,0x55,0x31,0x0C,0x2A,0x22,0x26,0x17,0x2A,0x17,0x3D,0x22,0x97,0x88,0x31,0x22,
+    0x13,0x17,0xC0,0x08,0xA3,0x88,0x1B,0x31,0x0C,0x35,0x22,0x1B,0x3D,0x04,0x31,0x2A,
+    0x31,0x35,0xC0,0x22,0x26,0x13,0x39,0xC0,0x26,0x1B,0x3D,0x22,0x26,0x17,0x13,0xC0,
+    0x04,0x08,0x17,0x22,0x08,0x2A,0x31,0x39,0x2A,0x13,0x26,0x04,0x26,0x39,0x13,0x04,
+    0x17,0x39,0xC0,0x26,0x0C,0xC0,0x08,0x26,0x13,0xC0,0x39,0x35,0x2A,0x35,0x08,0x2A,
+    0x1B,0xC0,0x39,0x22,0x2A,0x17,0x3D,0x13,0x17,0xC0,0x2A,0x1B,0x0C,0xC0,0x1B,0x26,
+    0x04,0x22,0x17,0x31,0xC0,0x2A,0x39,0x04,0x17,0x39,0x3D,0x39,0x1B,0x0C,0x22,0x17,
+    0x39,0x22,0x13,0x39,0x22,0x17,0x35,0x3D,0x13,0x22,0x13,0x1B,0x0C,0x31,0x1B,0x35,
+    0x26,0x17,0x0C,0x3D,0x08,0x13,0x08,0x39,0x3D,0x39,0x31,0x26,0x3D,0x08,0x39,0x35,
+    0x13,0x2A,0x39,0x22,0x39,0x1B,0x39,0x35,0x08,0x35,0x0C,0x22,0x3D,0x1B,0xC0,0x17,
+    0x08,0xC0,0x31,0x26,0x1B,0x39,0x3D,0x31,0x39,0x3D,0x35,0x13,0x04,0xC0,0x3D,0x17,
+    0x35,0x26,0x31,0x3D,0x31,0x04,0x35,0x17,0x0C,0xC0,0x04,0xC0,0x3D,0x31,0x17,0x0C,
+    0x26,0x2A,0x08,0x04,0x3D,0x17,0x26,0x35,0x08,0x2A,0x3D,0x1B,0x26,0xC0,0x39,0x17,
+    0x13,0x35,0x0C,0x17,0x26,0x35,0xC0,0x39,0x31,0x0C,0x3D,0x17,0x1B,0x08,0x31,0xC0,
+    0x2A,0x54,0xA6,0x88,0x40,0x14,0xA8,0x88,0xC0,0x10,0xA7,0x88,0x40,0x14,0xA2,0x88,
+    0x0C,0x10,0x9D,0x88,0xC0,0x10,0x39,0x14,0x32,0xA8,0x88,0x39,0x98,0x88,0xA4,0x88,
+    0x0C,0x14,0x2E,0x0C,0x2E,0x3D,0x2E,0x55,0x10,0x3D,0x39,0x1B,0x3D,0x2E,0x39,0x23,
+    0x1B,0x23,0x40,0x23,0x01,0x23,0x1B,0xC0,0x23,0x32,0x39,0x23,0x2A,0x32,0x2E,0x39,
+    0x23,0x14,0x2E,0x3D,0xC0,0x1F,0xC0,0x0C,0x1B,0x2A,0x1F,0x3D,0x1B,0x3D,0x1B,0xC0,
+    0x1F,0x2E,0x01,0x2E,0x23,0x1B,0xC0,0x32,0x1F,0x05,0x01,0x0C,0x39,0x23,0x2E,0x32,
+    0x23,0x1F,0x2E,0x1B,0xC0,0x05,0x10,0x2A,0x32,0x1B,0x23,0x01,0x0C,0x39,0x1B,0x0C,
+    0x39,0x2E,0x10,0x23,0x39,0x0C,0x1B,0x2A,0x14,0x1B,0x0C,0x1F,0x1B,0x14,0xC0,0x05,
+    0xC0,0x1B,0x14,0xC0,0x23,0x3D,0x01,0x05,0x32,0x1F,0x10,0x1B,0x01,0x1B,0x10,0x32,
+    0x1B,0x23,0x1F,0x14,0x10,0x14,0x1F,0x2E,0x10,0x3D,0x14,0x05,0x1B,0x05,0x23,0x1F,
+    0x39,0x0C,0x2A,0x32,0xC0,0x14,0x1B,0x23,0x2E,0x3D,0x05,0x10,0x2A,0x39,0x0C,0x01,
+    0x1B,0x01,0x39,0x23,0x2E,0x05,0xC0,0x01,0x23,0x39,0x05,0x0C,0x10,0x05,0x23,0x01,
+    0x14,0x32,0x01,0x39,0x1B,0x0C,0x2E,0xC0,0x32,0x14,0x23,0x01,0x05,0x1B,0x32,0x23,
+    0x39,0x1B,0x23,0x32,0x0C,0xC0,0x2E,0x14,0x05,0x32,0x0C,0x10,0x1B,0xC0,0x23,0x01,
+    0x14,0xC0,0x01,0x32,0x1F,0x39,0x01,0x3D,0x23,0x01,0x23,0x01,0x3D,0x14,0x01,0x3D,
+    0x14,0x39,0xC0,0x32,0x2E,0x1F,0x1B,0x39,0x14,0x59,0xAC,0x88,0x9A,0x88,0x7F,0xA3,
+    0x88,0x0A,0xA4,0x88,0xA7,0x88,0x33,0xC0,0x40,0x9D,0x88,0x7F,0x33,0x7F,0x37,0x02,
+    0x2F,0x3E,0x02,0x20,0x37,0x28,0x24,0x2F,0xC0,0x37,0x2F,0x15,0x33,0x37,0x0A,0x37,
+    0x40,0x15,0x19,0x2F,0x0A,0x37,0x24,0x15,0x2F,0x24,0x33,0xC1,0x20,0x55,0x2F,0x11,
+    0x20,0xC0,0x33,0x15,0x0A,0x37,0x20,0x06,0x28,0x02,0x3E,0x2F,0x19,0x3E,0xC0,0x24,
+    0x37,0x15,0x19,0x0A,0x2F,0x20,0x37,0xC0,0x2F,0x3E,0x24,0x37,0x06,0xC0,0x20,0x3E,
+    0x15,0x37,0x0A,0x20,0x37,0x11,0x06,0xC0,0x28,0x3E,0x20,0x2F,0x19,0x0A,0x15,0x2F,
+    0x28,0x2F,0x11,0x3E,0x24,0x33,0xC0,0x3E,0x20,0x19,0x37,0x11,0x15,0x0A,0x19,0x37,
+    0x28,0x37,0x24,0x28,0x2F,0x24,0xC0,0x11,0x15,0x19,0x0A,0x02,0x33,0x3E,0x11,0x15,
+    0x06,0x2F,0x15,0x2F,0x3E,0x15,0xC0,0x0A,0x19,0x24,0x06,0xC0,0x0A,0x20,0x3E,0x02,
+    0x33,0x06,0x0A,0x33,0x15,0x2F,0x24,0x2F,0x33,0x11,0x02,0xC0,0x37,0x28,0x02,0x0A,
+    0x24,0x06,0x37,0x15,0x37,0x2F,0x19,0x11,0x28,0x24,0xC0,0x11,0x06,0x11,0x2F,0x28,
+    0x19,0x06,0x37,0x2F,0x06,0x11,0x28,0x33,0x24,0x0A,0x28,0x06,0x02,0x28,0xC0,0x24,
+    0x0A,0x33,0x02,0x2F,0x33,0x02,0x2F,0x0A,0x24,0x19,0x2F,0x3E,0x2F,0x06,0x24,0x33,
+    0x19,0x20,0x02,0x24,0x3E,0x24,0x0A,0x06,0x11,0x0A,0x06,0xC0,0x15,0x02,0x0A,0x28,
+    0x02,0x0A,0x37,0x15,0x2F,0x19,0x28,0x06,0x2F,0x24,0x02,0x3E,0x28,0x19,0xA8,0x87,
+    0x55,0x0A,0x99,0x88,0xA5,0x88,0x55,0xA5,0x88,0x98,0x88,0xAA,0x88,0x3B,0x2C,0xA3,
+    0x88,0x1D,0x28,0x9A,0x88,0x3B,0x0A,0x21,0x0A,0x30,0x40,0x28,0x21,0xA2,0x88,0x19,
+    0xC0,0xA2,0x88,0x1D,0x3B,0x0A,0x30,0x06,0x30,0x37,0x30,0x2C,0x06,0x12,0x21,0x1D,
+    0x28,0x37,0xC0,0x06,0x0E,0x28,0x0E,0x37,0x1D,0xC0,0x0E,0x2C,0xC0,0x3B,0xC0,0x1D,
+    0xC0,0x19,0x37,0x2C,0x30,0x06,0x30,0x37,0x3B,0x0E,0x28,0x37,0x0E,0x2C,0x19,0x3B,
+    0x19,0x12,0x0E,0x0A,0x06,0x3B,0x1D,0x3B,0x30,0x3B,0x30,0x28,0x37,0x3B,0x30,0x3F,
+    0x1D,0x06,0x21,0x28,0x0A,0x19,0xC0,0x1D,0x30,0x06,0x2C,0x28,0x2C,0x0E,0xC0,0x3F,
+    0x19,0x12,0x28,0x3B,0x1D,0x21,0x0E,0x3B,0x37,0x2C,0x3B,0x12,0x2C,0x0E,0x3B,0x0A,
+    0x30,0x1D,0x30,0x3F,0x37,0x2C,0x21,0xC0,0x06,0x1D,0x30,0x3B,0x28,0x0A,0x06,0x3B,
+    0x0A,0x30,0x3B,0x30,0x12,0x3F,0x37,0x2C,0x1D,0x28,0x37,0x0E,0x3B,0x0E,0x12,0x2C,
+    0x21,0x3F,0x12,0x19,0x1D,0x2C,0x06,0x0E,0x3F,0x0E,0x2C,0x1D,0x3B,0x1D,0x28,0x37,
+    0x0E,0x21,0x28,0x1D,0x12,0x0E,0x3F,0x37,0x19,0x21,0x19,0x37,0x0E,0x12,0x0E,0x1D,
+    0x21,0x2C,0x3B,0x0E,0x0A,0x0E,0x1D,0x30,0x3B,0x12,0x21,0x2C,0x3B,0x1D,0x12,0x3B,
+    0x28,0x3F,0x30,0x1D,0x30,0x3F,0x3B,0x30,0x0E,0x1D,0x3F,0x28,0x06,0x37,0x28,0x3F,
+    0x19,0x12,0x19,0x3B,0x06,0x0E,0x28,0xC0,0x3B,0xC1,0x1D,0x2C,0xC0,0x21,0x3F,0x1D,
+    0x12,0x1D,0x21,0x28,0x2C,0x0A,0x37,0x6E,0x9C,0x88,0x40,0x9D,0x88,0x7F,0x40,0xAB,
+    0x88,0x98,0x88,0x00,0xC1,0x22,0x00,0x7F,0x26,0x00,0xA2,0x88,0x13,0x3C,0x0F,0xA2,
+    0x88,0x26,0x3C,0x1E,0x0B,0x35,0xA4,0x88,0x26,0x3C,0x35,0x31,0x26,0x31,0x3C,0x0F,
+    0x04,0x35,0x40,0x0F,0x2D,0x1E,0x26,0xC1,0x2D,0x22,0x26,0x2D,0x1E,0x0F,0x2D,0x22,
+    0x31,0x2D,0x31,0x26,0x31,0x2D,0x00,0x13,0x3C,0x0B,0x31,0x00,0x31,0x1E,0x0F,0x1E,
+    0x35,0x00,0x1E,0x00,0x31,0x26,0x22,0x13,0x2D,0x35,0x13,0x2D,0x17,0x26,0x0B,0x35,
+    0x3C,0x2D,0x17,0xC0,0x22,0xC0,0x17,0x35,0x31,0x00,0x1E,0x17,0x31,0x0F,0x1E,0x31,
+    0x26,0x2D,0x31,0x17,0xC0,0x35,0x04,0x0F,0x00,0x2D,0x31,0x22,0x35,0x13,0x1E,0x35,
+    0x1E,0xC0,0x35,0x0F,0x35,0x0B,0x35,0x1E,0x04,0x3C,0x04,0x17,0x04,0x00,0x0F,0x00,
+    0x0B,0x22,0x00,0x2D,0x31,0x0F,0x17,0x31,0x04,0x3C,0x31,0x13,0x1E,0x17,0x0B,0x0F,
+    0x22,0x26,0x0B,0x0F,0x0B,0x04,0x31,0x13,0x35,0x0F,0x00,0x1E,0x0B,0x0F,0x22,0x13,
+    0x26,0x3C,0xC1,0x26,0x3C,0x22,0x31,0x00,0x22,0x31,0x2D,0x0F,0x00,0xC0,0x31,0x0F,
+    0x17,0xC0,0x00,0x22,0x0B,0x04,0x26,0x17,0x22,0x26,0x3C,0x35,0x3C,0x00,0x26,0x04,
+    0x35,0x00,0x3C,0x26,0x35,0x2D,0x13,0x0B,0x00,0x3C,0x22,0x35,0x04,0x17,0x13,0x2D,
+    0x00,0x0F,0xC0,0x00,0x1E,0x13,0x04,0x17,0x13,0x00,0x35,0x04,0xC0,0x35,0x13,0x26,
+    0x13,0x35,0x31,0x2D,0x0B,0xC0,0x1E,0x0B,0x13,0x3C,0x0B,0x97,0x87,0xA5,0x88,0x55,
+    0xA4,0x88,0x97,0x88,0xAB,0x88,0x99,0x88,0xA4,0x88,0x2A,0x40,0x9D,0x88,0x13,0x9C,
+    0x88,0x26,0x3D,0x08,0x26,0x3D,0xA2,0x88,0x39,0x3D,0x2A,0xC0,0x1B,0x1F,0x3D,0x0C,
+    0x1B,0x0C,0x35,0x1F,0xC0,0x35,0x1F,0x08,0x1B,0x0C,0x17,0x13,0x35,0x2E,0xAA,0x88,
+    0x2E,0x26,0x3D,0x0C,0x3D,0x1F,0x39,0x3D,0xC0,0x08,0x2A,0x1F,0x08,0x26,0x17,0x2A,
+    0x04,0x1B,0x26,0x3D,0x17,0x26,0x17,0x1F,0x0C,0x2E,0x08,0xC0,0x0C,0x17,0x2A,0x2E,
+    0x35,0x1B,0x3D,0x1B,0x35,0x39,0x1B,0x2E,0x1F,0xC0,0x2A,0x17,0x3D,0x1F,0x2A,0x3D,
+    0x1F,0xC1,0x1B,0x0C,0x1F,0x04,0x1B,0x08,0x04,0xC0,0x26,0x35,0x08,0x2A,0x26,0x2E,
+    0x0C,0x3D,0x2A,0x04,0xC0,0x2E,0x13,0x2A,0x3D,0x2A,0x0C,0x08,0x39,0x08,0x2A,0x26,
+    0xC0,0x2E,0x0C,0xC0,0x2E,0x0C,0x2E,0x04,0x1B,0x17,0x2A,0x2E,0xC0,0x26,0xC0,0x2A,
+    0x0C,0x17,0x1B,0x13,0x35,0x1B,0x13,0x2E,0x3D,0x04,0x39,0x0C,0x08,0x3D,0x13,0x0C,
+    0x2E,0x39,0x2E,0x39,0x3D,0x26,0x0C,0x1B,0xC0,0x26,0x17,0x04,0x26,0x08,0x39,0x2E,
+    0xC0,0x35,0x2A,0x08,0xC0,0x35,0x39,0x0C,0x26,0x2A,0x3D,0x35,0x1B,0x2A,0x35,0x0C,
+    0x26,0x1F,0x35,0x39,0x1B,0x2A,0x13,0x2E,0x35,0x3D,0x0C,0x2A,0x08,0x35,0x2A,0x26,
+    0x1F,0xC0,0x04,0x08,0x3D,0x08,0xC0,0x17,0x13,0x0C,0x13,0x1B,0xC0,0x26,0x3D,0x1B,
+    0x2E,0x2A,0x0C,0x2A,0xC0,0x0C,0x13,0x2E,0x39,0x0C,0x39,0x13,0x3D,0x17,0xC0,0x2E,
+    0x39,0x1F,0x39,0x3D,0x39,0x59,0xA4,0x88,0xA3,0x88,0x9C,0x88,0x40,0x2B,0x99,0x88,
+    0xA9,0x88,0x55,0x97,0x88,0x18,0x3A,0x1C,0x9B,0x88,0x18,0x11,0xA4,0x88,0xC0,0x3E,
+    0x18,0x09,0x2F,0x55,0x1C,0x98,0x88,0x1C,0x18,0x1C,0x09,0xC1,0x20,0x24,0x3E,0x09,
+    0x1C,0x3E,0x02,0xC0,0x2B,0x20,0x33,0x3E,0x33,0x09,0x0D,0x3E,0x24,0x0D,0x33,0x2B,
+    0x33,0x11,0x2F,0x3E,0x2B,0x3A,0xC0,0x2F,0xC0,0x09,0x3A,0x18,0x20,0x11,0x3E,0x02,
+    0x18,0x11,0x3A,0x3E,0x2B,0x09,0x24,0x11,0xC0,0x2B,0x02,0x2B,0x2F,0x02,0x33,0x18,
+    0x11,0x3E,0x24,0x1C,0x2F,0x1C,0x18,0x09,0x2F,0xC0,0x3A,0x09,0x3E,0x11,0x2F,0x18,
+    0x3E,0x33,0x11,0x0D,0x02,0x2F,0x3A,0x2F,0x33,0x0D,0x1C,0x18,0x3E,0xC0,0x18,0x20,
+    0x33,0x0D,0xC0,0x3A,0x02,0x20,0x09,0xC0,0x24,0x18,0x1C,0x2F,0x3E,0x11,0x2F,0x09,
+    0x0D,0x18,0x2F,0x0D,0x1C,0x18,0x24,0x02,0x18,0x09,0x18,0x11,0x18,0x09,0x33,0x11,
+    0x20,0x2F,0x11,0x2B,0x02,0x0D,0x2F,0xC0,0x09,0x24,0x09,0x3A,0x02,0x3E,0x1C,0x2F,
+    0xC0,0x3A,0x1C,0x2B,0x3E,0x20,0x1C,0x20,0x0D,0x33,0x24,0x33,0x1C,0x20,0x09,0x20,
+    0x18,0x11,0x3E,0x1C,0x2B,0x18,0x11,0xC0,0x20,0x33,0x3E,0xC0,0x3A,0x1C,0x20,0xC0,
+    0x2B,0x0D,0x33,0x3E,0x11,0x09,0x11,0x0D,0x33,0x1C,0x2F,0x2B,0x18,0x1C,0x33,0x24,
+    0x33,0x2F,0x11,0x0D,0x33,0x11,0x24,0x0D,0x02,0x33,0x3A,0x0D,0x33,0x18,0x24,0x02,
+    0x0D,0x02,0x09,0x0D,0x3E,0x0D,0x20,0x24,0x2B,0x20,0x1C,0x3A,0x33,0xA9,0x87,0x98,
+    0x88,0xA9,0x88,0x40,0xC0,0x33,0x9C,0x88,0x9B,0x88,0xA3,0x88,0x24,0x02,0x24,0x9A,
+    0x88,0x2C,0xAC,0x88,0x9A,0x88,0x2C,0x0A,0x37,0x02,0x06,0x24,0x20,0x3B,0x33,0x20,
+    0x9B,0x88,0x9D,0x88,0x37,0x19,0x06,0x15,0x3B,0x06,0x20,0x28,0x20,0x2C,0x02,0xC1,
+    0x3B,0x28,0xA7,0x88,0x19,0x33,0xC0,0x06,0x2C,0x06,0x3B,0x02,0x33,0x3B,0x19,0x3B,
+    0x06,0x24,0x15,0x24,0x28,0x24,0x20,0x2C,0x0A,0x15,0xC0,0x33,0x37,0x0A,0x24,0x3B,
+    0x19,0x28,0x24,0x20,0x2C,0x15,0x02,0xC0,0x33,0x15,0x0A,0xC0,0x37,0x06,0x15,0x28,
+    0x33,0x15,0x33,0x20,0x37,0x11,0x06,0x20,0x02,0x33,0xC0,0x3B,0x2C,0x19,0x24,0x19,
+    0xC0,0x33,0x02,0x37,0x06,0x24,0x20,0x3B,0xC0,0x2C,0x20,0x19,0x02,0x37,0x19,0x11,
+    0x19,0x24,0x0A,0x24,0x3B,0x24,0x0A,0x2C,0x28,0x02,0x28,0x33,0x11,0x02,0x37,0xC0,
+    0x06,0x37,0x20,0x19,0x2C,0x33,0xC0,0x15,0x0A,0xC0,0x06,0x2C,0x0A,0x2C,0x28,0x37,
+    0x20,0x19,0x06,0x02,0x19,0x20,0x19,0x06,0x02,0x33,0x19,0x06,0x33,0x06,0x2C,0x0A,
+    0x33,0x2C,0x02,0x19,0x3B,0x2C,0x28,0x0A,0x24,0x06,0x33,0x37,0x0A,0x33,0x20,0x02,
+    0x0A,0xC0,0x24,0x0A,0x15,0x02,0x3B,0x15,0x0A,0x20,0xC0,0x28,0xC0,0x37,0x15,0x19,
+    0x33,0x11,0x2C,0x11,0x19,0x02,0x19,0x20,0xC0,0x28,0x19,0x20,0x11,0xC0,0x06,0x11,
+    0xC0,0x28,0x11,0x19,0x37,0x20,0x15,0x06,0x20,0x19,0x15,0x24,0x02,0x24,0x20,0x37,
+    0x2C,0x19,0xC0,0x24,0x0A,0x06,0x3B,0x24,0x9A,0x77,0xAB,0x88,0x9A,0x88,0xC0,0xA2,
+    0x88,0x0B,0xA3,0x88,0x40,0x00,0x25,0x97,0x88,0x9D,0x88,0x0B,0x1E,0x29,0xA3,0x88,
+    0x1E,0x0B,0x29,0x16,0x29,0x16,0x38,0x29,0x38,0x1A,0x25,0x99,0x88,0xA5,0x88,0x00,
+    0x0B,0x07,0xC0,0x25,0x98,0x88,0x29,0x25,0x3C,0xC0,0x9D,0x88,0x0B,0x07,0x25,0x29,
+    0x1E,0xC0,0x00,0x1E,0x00,0x2D,0x07,0x0B,0x16,0x1E,0x1A,0x07,0x2D,0x31,0x0B,0x3C,
+    0x0B,0x1A,0x0B,0x1E,0x31,0x2D,0x1E,0x0F,0xC0,0x3C,0x07,0xC0,0x16,0x29,0x07,0x2D,
+    0x38,0xC0,0x1A,0x0B,0x07,0x2D,0x3C,0x16,0x3C,0x2D,0x1E,0x1A,0x0B,0x16,0x3C,0x31,
+    0x38,0x25,0x1E,0x25,0xC0,0x07,0x00,0x07,0xC0,0x0F,0x1E,0x3C,0x0F,0x16,0x29,0x1A,
+    0x25,0x0B,0x2D,0x31,0x0B,0x3C,0x0F,0x3C,0x00,0x1E,0x0B,0x1E,0x0B,0x38,0x29,0xC0,
+    0x00,0x07,0xC0,0x1A,0x1E,0x00,0x0F,0x25,0x0B,0x00,0x0B,0x25,0x29,0x38,0x16,0x25,
+    0xC0,0x1E,0x1A,0x25,0x1A,0x29,0x00,0x0F,0x25,0x31,0x3C,0x31,0x38,0x1A,0x0F,0x25,
+    0x1A,0x0B,0x1E,0x16,0x1E,0x38,0x31,0x3C,0x1E,0x1A,0x2D,0x16,0x0F,0x29,0x1A,0x29,
+    0x16,0x29,0x0B,0x31,0x0F,0x1E,0x31,0x2D,0x0B,0x16,0x00,0x0F,0x07,0x31,0x0B,0x2D,
+    0x29,0x0F,0x2D,0x0F,0xC0,0x2D,0x29,0x1E,0x25,0xC0,0x07,0x2D,0x25,0x1A,0x38,0x1E,
+    0x29,0x1E,0x16,0x31,0x1E,0x38,0x0B,0x3C,0xC0,0x07,0x0B,0x25,0x31,0x07,0x0B,0x00,
+    0x0F,0x1A,0x0F,0x3C,0x2D,0x0F,0x31,0x16,0x1A,0xC0,0x3C,0xC1,0x38,0x29,0x16,0x29,
+    0x1E,0x25,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+};
@@ -0,0 +1,1060 @@
+/**
+ * @file    img_landscape_rle.c
+ *
+ * @note    Generated by mkimage from landscape.ppm. Do not edit
+ */
+
+#include <stdint.h>
+
+const int img_landscape_rle_size = 16768;
+
+const uint8_t img_landscape_rle[] = {
+    0x52,0x4C,0x45,0x31,0xF0,0x00,0x88,0x00,0x02,0x00,0x00,0x00,0xFF,0x99,0x2A,0xEF,
+    0x99,0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xFF,0x98,
+    0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xFF,0x98,0x2A,0xAF,0x98,0x2A,
+    0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xFF,
+    0xB8,0x32,0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xFF,0xB8,0x32,0xAF,0xB8,0x32,0xFF,0xD7,
+    0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,
+    0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0xFF,0xD7,0x3A,0x9F,
+    0xD7,0x3A,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xFF,0xF7,
+    0x42,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xFF,0xF7,0x42,0xAF,0xF7,0x42,
+    0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,
+    0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,0x4B,0xFF,0x16,
+    0x4B,0x9F,0x16,0x4B,0xFF,0x36,0x53,0xFF,0x36,0x53,0xFF,0x36,0x53,0xFF,0x36,0x53,
+    0xFF,0x36,0x53,0xFF,0x36,0x53,0xFF,0x36,0x53,0xFF,0x36,0x53,0xFF,0x36,0x53,0xAF,
+    0x36,0x53,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,
+    0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,0xFF,0x55,0x5B,
+    0xFF,0x55,0x5B,0x9F,0x55,0x5B,0xFF,0x75,0x63,0xFF,0x75,0x63,0xFF,0x75,0x63,0xFF,
+    0x75,0x63,0xFF,0x75,0x63,0x83,0x75,0x63,0x0C,0xB4,0x6B,0xD2,0x9C,0xB1,0xBD,0x50,
+    0xDE,0xCF,0xEE,0x0F,0xFF,0x2F,0xFF,0x0F,0xFF,0xCF,0xEE,0x50,0xDE,0xB1,0xBD,0xD2,
+    0x9C,0xB4,0x6B,0xFF,0x75,0x63,0xE0,0x75,0x63,0x01,0x93,0x94,0x10,0xCE,0x8C,0x2F,
+    0xFF,0x01,0x10,0xCE,0x93,0x94,0xFF,0x75,0x63,0xDC,0x75,0x63,0x01,0x73,0x94,0x50,
+    0xDE,0x90,0x2F,0xFF,0x01,0x50,0xDE,0x73,0x94,0xBA,0x75,0x63,0xFF,0x94,0x6B,0x9E,
+    0x94,0x6B,0x00,0xB1,0xC5,0x94,0x2F,0xFF,0x00,0xB1,0xC5,0xFF,0x94,0x6B,0xD6,0x94,
+    0x6B,0x01,0x13,0x84,0x70,0xDE,0x96,0x2F,0xFF,0x01,0x70,0xDE,0x13,0x84,0xFF,0x94,
+    0x6B,0xD3,0x94,0x6B,0x01,0x53,0x8C,0xCF,0xEE,0x98,0x2F,0xFF,0x01,0xCF,0xEE,0x53,
+    0x8C,0xFF,0x94,0x6B,0xD1,0x94,0x6B,0x01,0x13,0x84,0xCF,0xEE,0x9A,0x2F,0xFF,0x01,
+    0xCF,0xEE,0x13,0x84,0xFF,0x94,0x6B,0xD0,0x94,0x6B,0x00,0x70,0xE6,0x9C,0x2F,0xFF,
+    0x00,0x70,0xE6,0xB5,0x94,0x6B,0xFF,0xB4,0x73,0x99,0xB4,0x73,0x00,0xB1,0xC5,0x9E,
+    0x2F,0xFF,0x00,0xB1,0xC5,0xFF,0xB4,0x73,0xCD,0xB4,0x73,0x00,0x92,0x9C,0xA0,0x2F,
+    0xFF,0x00,0x92,0x9C,0xFF,0xB4,0x73,0xCC,0xB4,0x73,0x00,0x50,0xDE,0xA0,0x2F,0xFF,
+    0x00,0x50,0xDE,0xFF,0xB4,0x73,0xCB,0xB4,0x73,0x00,0xB2,0x9C,0xA2,0x2F,0xFF,0x00,
+    0xB2,0x9C,0xFF,0xB4,0x73,0xCA,0xB4,0x73,0x00,0x10,0xD6,0xA2,0x2F,0xFF,0x00,0x10,
+    0xD6,0xFF,0xB4,0x73,0xC9,0xB4,0x73,0x00,0xF3,0x83,0xA4,0x2F,0xFF,0x00,0xF3,0x83,
+    0xB1,0xB4,0x73,0xFF,0xD3,0x7B,0x96,0xD3,0x7B,0x00,0xF2,0xA4,0xA4,0x2F,0xFF,0x00,
+    0xF2,0xA4,0xFF,0xD3,0x7B,0xC8,0xD3,0x7B,0x00,0xD0,0xC5,0xA4,0x2F,0xFF,0x00,0xD0,
+    0xC5,0xFF,0xD3,0x7B,0xC8,0xD3,0x7B,0x00,0x70,0xDE,0xA4,0x2F,0xFF,0x00,0x70,0xDE,
+    0xFF,0xD3,0x7B,0xC8,0xD3,0x7B,0x00,0xCF,0xF6,0xA4,0x2F,0xFF,0x00,0xCF,0xF6,0xFF,
+    0xD3,0x7B,0xC8,0xD3,0x7B,0x00,0x0F,0xFF,0xA4,0x2F,0xFF,0x00,0x0F,0xFF,0xB1,0xD3,
+    0x7B,0xFF,0xF3,0x83,0x96,0xF3,0x83,0xA6,0x2F,0xFF,0xFF,0xF3,0x83,0xC8,0xF3,0x83,
+    0x00,0x0F,0xFF,0xA4,0x2F,0xFF,0x00,0x0F,0xFF,0xFF,0xF3,0x83,0xC8,0xF3,0x83,0x00,
+    0xCF,0xF6,0xA4,0x2F,0xFF,0x00,0xCF,0xF6,0xFF,0xF3,0x83,0xC8,0xF3,0x83,0x00,0x6F,
+    0xE6,0xA4,0x2F,0xFF,0x00,0x6F,0xE6,0xFF,0xF3,0x83,0xC8,0xF3,0x83,0x00,0xD0,0xCD,
+    0xA4,0x2F,0xFF,0x00,0xD0,0xCD,0xFF,0xF3,0x83,0xC8,0xF3,0x83,0x00,0x11,0xB5,0xA4,
+    0x2F,0xFF,0x00,0x11,0xB5,0xB1,0xF3,0x83,0xFF,0x12,0x8C,0x96,0x12,0x8C,0x00,0x32,
+    0x94,0xA4,0x2F,0xFF,0x00,0x32,0x94,0xFF,0x12,0x8C,0xC9,0x12,0x8C,0x00,0x30,0xDE,
+    0xA2,0x2F,0xFF,0x00,0x30,0xDE,0xFF,0x12,0x8C,0xCA,0x12,0x8C,0x00,0x11,0xAD,0xA2,
+    0x2F,0xFF,0x00,0x11,0xAD,0xFF,0x12,0x8C,0xCB,0x12,0x8C,0x00,0x6F,0xE6,0xA0,0x2F,
+    0xFF,0x00,0x6F,0xE6,0xFF,0x12,0x8C,0xCC,0x12,0x8C,0x00,0xF1,0xAC,0xA0,0x2F,0xFF,
+    0x00,0xF1,0xAC,0xB3,0x12,0x8C,0xFF,0x32,0x94,0x99,0x32,0x94,0x00,0xF0,0xD5,0x9E,
+    0x2F,0xFF,0x00,0xF0,0xD5,0xFF,0x32,0x94,0xCF,0x32,0x94,0x00,0x8F,0xE6,0x9C,0x2F,
+    0xFF,0x00,0x8F,0xE6,0xFF,0x32,0x94,0xD0,0x32,0x94,0x01,0x91,0xA4,0xCF,0xF6,0x9A,
+    0x2F,0xFF,0x01,0xCF,0xF6,0x91,0xA4,0xFF,0x32,0x94,0xD1,0x32,0x94,0x01,0xD1,0xAC,
+    0xCF,0xF6,0x98,0x2F,0xFF,0x01,0xCF,0xF6,0xD1,0xAC,0xFF,0x32,0x94,0xD3,0x32,0x94,
+    0x01,0xB1,0xA4,0x8F,0xEE,0x96,0x2F,0xFF,0x01,0x8F,0xEE,0xB1,0xA4,0xFF,0x32,0x94,
+    0xD6,0x32,0x94,0x00,0xF0,0xD5,0x94,0x2F,0xFF,0x00,0xF0,0xD5,0xB9,0x32,0x94,0xFF,
+    0x51,0x9C,0x9F,0x51,0x9C,0x01,0x11,0xB5,0x6F,0xE6,0x90,0x2F,0xFF,0x01,0x6F,0xE6,
+    0x11,0xB5,0xFF,0x51,0x9C,0x05,0x51,0x9C,0x04,0x0A,0x25,0x12,0x45,0x1A,0x45,0x1A,
+    0xE4,0x09,0xD6,0x51,0x9C,0x01,0x30,0xBD,0x4F,0xDE,0x8C,0x2F,0xFF,0x01,0x4F,0xDE,
+    0x30,0xBD,0xFF,0x51,0x9C,0x81,0x51,0x9C,0x07,0x04,0x12,0x04,0x0A,0x25,0x12,0x45,
+    0x1A,0x25,0x12,0x25,0x12,0x45,0x12,0x25,0x12,0xD6,0x51,0x9C,0x0C,0x91,0xA4,0x50,
+    0xBD,0xF0,0xD5,0x8F,0xE6,0xEF,0xF6,0x0F,0xFF,0x2F,0xFF,0x0F,0xFF,0xEF,0xF6,0x8F,
+    0xE6,0xF0,0xD5,0x50,0xBD,0x91,0xA4,0xFF,0x51,0x9C,0x82,0x51,0x9C,0x09,0x65,0x1A,
+    0x04,0x12,0x04,0x0A,0x25,0x12,0x04,0x0A,0x25,0x12,0x25,0x12,0x45,0x12,0x65,0x1A,
+    0x65,0x1A,0xF6,0x51,0x9C,0x04,0x04,0x0A,0x45,0x1A,0x25,0x12,0x24,0x12,0x45,0x1A,
+    0xE8,0x51,0x9C,0x04,0x65,0x1A,0x24,0x12,0x45,0x12,0x04,0x0A,0x24,0x12,0x82,0x04,
+    0x0A,0x02,0x45,0x1A,0x45,0x12,0x04,0x0A,0xF5,0x51,0x9C,0x06,0x25,0x12,0x45,0x1A,
+    0x24,0x12,0x25,0x12,0x65,0x1A,0x04,0x0A,0x45,0x12,0xA4,0x51,0x9C,0xC1,0x71,0xA4,
+    0x01,0x24,0x12,0x65,0x1A,0x82,0x45,0x12,0x82,0x24,0x12,0x04,0x65,0x1A,0x24,0x12,
+    0x65,0x1A,0x45,0x12,0x24,0x12,0xF3,0x71,0xA4,0x08,0x04,0x0A,0x45,0x12,0x45,0x12,
+    0x65,0x1A,0x04,0x12,0x24,0x12,0x65,0x1A,0x65,0x1A,0x24,0x12,0xE4,0x71,0xA4,0x04,
+    0x24,0x12,0x65,0x1A,0x44,0x12,0x65,0x1A,0x65,0x1A,0x82,0x45,0x12,0x00,0x65,0x1A,
+    0x82,0x24,0x12,0x02,0x65,0x1A,0x45,0x12,0x45,0x12,0xF1,0x71,0xA4,0x0A,0x45,0x12,
+    0x65,0x1A,0x04,0x0A,0x45,0x12,0x24,0x12,0x65,0x1A,0x65,0x1A,0x45,0x12,0x45,0x12,
+    0x65,0x1A,0x24,0x12,0xE3,0x71,0xA4,0x0F,0x44,0x12,0x65,0x1A,0x65,0x1A,0x85,0x1A,
+    0x65,0x1A,0x65,0x1A,0x44,0x12,0x24,0x12,0x45,0x12,0x65,0x1A,0x65,0x1A,0x24,0x12,
+    0x85,0x1A,0x24,0x12,0x65,0x1A,0x45,0x12,0xEF,0x71,0xA4,0x06,0x44,0x12,0x45,0x12,
+    0x65,0x1A,0x24,0x12,0x45,0x12,0x24,0x12,0x44,0x12,0x83,0x65,0x1A,0x01,0x45,0x12,
+    0x65,0x1A,0xE1,0x71,0xA4,0x81,0x24,0x12,0x0E,0x65,0x1A,0x44,0x12,0x24,0x12,0x85,
+    0x1A,0x44,0x12,0x65,0x1A,0x65,0x1A,0x44,0x12,0x45,0x12,0x65,0x1A,0x44,0x12,0x65,
+    0x1A,0x44,0x12,0x65,0x12,0x44,0x12,0xEE,0x71,0xA4,0x82,0x65,0x1A,0x0A,0x85,0x1A,
+    0x24,0x12,0x45,0x12,0x85,0x1A,0x85,0x1A,0x65,0x1A,0x85,0x1A,0x24,0x12,0x65,0x1A,
+    0x85,0x1A,0x65,0x1A,0xE1,0x71,0xA4,0x0E,0x44,0x12,0x65,0x12,0x24,0x12,0x65,0x1A,
+    0x44,0x12,0x65,0x1A,0x65,0x1A,0x44,0x12,0x65,0x1A,0x65,0x12,0x65,0x1A,0x44,0x12,
+    0x65,0x12,0x44,0x12,0x24,0x12,0x82,0x65,0x1A,0xEC,0x71,0xA4,0x0F,0x85,0x1A,0x65,
+    0x1A,0x44,0x12,0x65,0x1A,0x65,0x1A,0x24,0x12,0x85,0x1A,0x44,0x12,0x85,0x1A,0x44,
+    0x12,0x65,0x1A,0x65,0x1A,0x44,0x12,0x24,0x12,0x85,0x1A,0x65,0x1A,0xDF,0x71,0xA4,
+    0x0A,0x85,0x1A,0x44,0x12,0x24,0x12,0x85,0x1A,0x44,0x12,0x44,0x12,0x24,0x12,0x65,
+    0x1A,0x24,0x12,0x85,0x1A,0x85,0x1A,0x83,0x44,0x12,0x81,0x85,0x1A,0x02,0x44,0x12,
+    0x64,0x12,0x44,0x12,0xEA,0x71,0xA4,0x83,0x44,0x12,0x0D,0x65,0x1A,0x44,0x12,0x85,
+    0x1A,0x44,0x12,0x85,0x1A,0x85,0x1A,0x44,0x12,0x65,0x1A,0x85,0x1A,0x64,0x12,0x65,
+    0x1A,0x65,0x1A,0x44,0x12,0x24,0x12,0x9F,0x71,0xA4,0xBE,0x90,0xAC,0x0D,0x64,0x12,
+    0x65,0x1A,0x64,0x12,0x65,0x1A,0xA5,0x1A,0x44,0x12,0x64,0x12,0x44,0x12,0x64,0x12,
+    0x85,0x1A,0x85,0x1A,0x44,0x12,0x85,0x1A,0x65,0x1A,0x82,0x44,0x12,0x02,0x65,0x1A,
+    0x44,0x12,0x44,0x12,0xE9,0x90,0xAC,0x02,0x85,0x1A,0x44,0x12,0x65,0x1A,0x82,0x85,
+    0x1A,0x0C,0x65,0x1A,0x85,0x1A,0x44,0x12,0x85,0x1A,0xA5,0x1A,0x85,0x1A,0x85,0x1A,
+    0x65,0x1A,0x44,0x12,0x85,0x1A,0x85,0x1A,0x44,0x12,0x65,0x1A,0xDD,0x90,0xAC,0x81,
+    0x85,0x1A,0x13,0xA5,0x1A,0x64,0x12,0x85,0x1A,0x85,0x1A,0x65,0x1A,0x44,0x12,0xA5,
+    0x1A,0x64,0x12,0x44,0x12,0x64,0x12,0x44,0x12,0x64,0x12,0x44,0x12,0x44,0x12,0x64,
+    0x12,0x64,0x12,0xA5,0x1A,0x44,0x12,0x65,0x1A,0x85,0x1A,0xE8,0x90,0xAC,0x13,0x64,
+    0x12,0x44,0x12,0x44,0x12,0x85,0x1A,0x44,0x12,0x85,0x1A,0x64,0x12,0x85,0x1A,0x85,
+    0x1A,0x44,0x12,0xA5,0x1A,0xA5,0x1A,0x85,0x1A,0x85,0x1A,0x44,0x12,0x65,0x1A,0x64,
+    0x12,0x64,0x12,0x44,0x12,0x64,0x12,0xDC,0x90,0xAC,0x16,0x85,0x1A,0xA5,0x1A,0x85,
+    0x1A,0x85,0x1A,0x64,0x12,0x85,0x1A,0x44,0x12,0xA5,0x1A,0x85,0x1A,0x64,0x12,0x85,
+    0x1A,0x85,0x1A,0x44,0x12,0x64,0x1A,0x85,0x1A,0x85,0x1A,0x64,0x12,0x44,0x12,0x64,
+    0x12,0x64,0x12,0x64,0x1A,0xA5,0x1A,0x85,0x1A,0xE6,0x90,0xAC,0x14,0xA5,0x1A,0x64,
+    0x12,0x64,0x1A,0x85,0x1A,0x64,0x12,0x64,0x12,0xA5,0x1A,0x44,0x12,0x85,0x1A,0x85,
+    0x1A,0x64,0x1A,0xA5,0x1A,0x85,0x1A,0x85,0x1A,0xA5,0x1A,0x85,0x1A,0x64,0x12,0x44,
+    0x12,0xA5,0x1A,0x44,0x12,0x44,0x12,0xDB,0x90,0xAC,0x82,0x64,0x12,0x07,0x85,0x1A,
+    0x64,0x12,0x64,0x12,0xA5,0x1A,0x84,0x1A,0xA5,0x1A,0x85,0x1A,0x64,0x12,0x82,0x84,
+    0x1A,0x82,0x64,0x12,0x82,0xA5,0x1A,0x03,0x85,0x1A,0x64,0x12,0xA5,0x1A,0x85,0x1A,
+    0xCA,0x90,0xAC,0x06,0xA5,0x1A,0x64,0x12,0x84,0x1A,0x44,0x12,0x85,0x1A,0x64,0x12,
+    0x85,0x1A,0x93,0x90,0xAC,0x04,0xA5,0x1A,0x64,0x12,0x64,0x12,0x84,0x1A,0x64,0x12,
+    0x82,0xA5,0x1A,0x0E,0x85,0x1A,0x64,0x12,0xA5,0x1A,0x85,0x1A,0x64,0x12,0xA5,0x1A,
+    0x64,0x12,0x64,0x12,0x84,0x1A,0x64,0x12,0xA5,0x1A,0x85,0x1A,0x64,0x12,0x85,0x1A,
+    0x64,0x12,0xDA,0x90,0xAC,0x0B,0x64,0x12,0xC5,0x22,0x64,0x12,0x84,0x1A,0x64,0x12,
+    0xA5,0x1A,0xA5,0x1A,0x64,0x12,0x64,0x12,0x85,0x1A,0x64,0x12,0xC5,0x22,0x82,0x64,
+    0x12,0x09,0xC5,0x22,0xA5,0x1A,0x85,0x1A,0x64,0x12,0x64,0x12,0x85,0x1A,0x64,0x12,
+    0xA5,0x1A,0x64,0x12,0x64,0x12,0xC7,0x90,0xAC,0x09,0xA5,0x1A,0x64,0x12,0x85,0x1A,
+    0x85,0x1A,0xC5,0x22,0xA5,0x1A,0x84,0x1A,0xA5,0x1A,0x84,0x1A,0xA5,0x1A,0x91,0x90,
+    0xAC,0x05,0x85,0x1A,0x84,0x1A,0x64,0x12,0x64,0x12,0xA5,0x1A,0x84,0x1A,0x82,0x64,
+    0x12,0x0E,0xC5,0x22,0x84,0x1A,0xA5,0x1A,0xA5,0x1A,0x84,0x1A,0x85,0x1A,0x85,0x1A,
+    0x84,0x1A,0x85,0x1A,0x64,0x12,0x64,0x12,0x84,0x1A,0xA5,0x1A,0x85,0x1A,0x64,0x12,
+    0x9D,0x90,0xAC,0xBB,0xB0,0xB4,0x17,0x84,0x1A,0x84,0x12,0xC5,0x22,0xA5,0x1A,0xC5,
+    0x22,0xA5,0x1A,0xC5,0x1A,0xA5,0x1A,0xA5,0x1A,0x84,0x1A,0x84,0x1A,0x64,0x12,0xA5,
+    0x1A,0x84,0x12,0x84,0x1A,0x84,0x12,0x84,0x12,0x84,0x1A,0x64,0x12,0x84,0x1A,0x64,
+    0x12,0xC5,0x22,0xA5,0x1A,0x64,0x12,0x82,0xA5,0x1A,0xC5,0xB0,0xB4,0x0C,0x84,0x1A,
+    0x84,0x12,0x85,0x1A,0x84,0x1A,0x64,0x12,0x84,0x1A,0x64,0x12,0x84,0x1A,0xC5,0x22,
+    0xA5,0x1A,0x84,0x1A,0x84,0x12,0x84,0x1A,0x8E,0xB0,0xB4,0x00,0x64,0x12,0x82,0xA5,
+    0x1A,0x15,0xC5,0x22,0xA5,0x1A,0x64,0x12,0x84,0x12,0x84,0x12,0x64,0x12,0xC5,0x22,
+    0x84,0x12,0x85,0x1A,0x64,0x12,0x84,0x1A,0xA5,0x1A,0x64,0x12,0xC5,0x1A,0x64,0x12,
+    0x64,0x12,0xA5,0x1A,0x64,0x12,0x84,0x1A,0xC5,0x22,0xC5,0x22,0x84,0x1A,0xD8,0xB0,
+    0xB4,0x81,0xA5,0x1A,0x19,0x84,0x12,0x64,0x12,0xA5,0x1A,0xC5,0x22,0xC5,0x22,0x84,
+    0x1A,0x64,0x12,0xA5,0x1A,0xC5,0x1A,0x84,0x12,0x84,0x12,0xC5,0x22,0x84,0x12,0x84,
+    0x12,0x84,0x1A,0x84,0x1A,0x64,0x12,0xC5,0x22,0xA5,0x1A,0xA5,0x1A,0x84,0x1A,0x84,
+    0x12,0x84,0x1A,0x84,0x12,0xA5,0x1A,0xC5,0x22,0xC4,0xB0,0xB4,0x0D,0x64,0x12,0xC5,
+    0x22,0x84,0x1A,0xA5,0x1A,0xC5,0x22,0xC5,0x1A,0xA5,0x1A,0xC5,0x22,0xC5,0x22,0x84,
+    0x1A,0x84,0x12,0x84,0x1A,0xA5,0x1A,0xA5,0x1A,0x8C,0xB0,0xB4,0x0D,0x84,0x12,0x64,
+    0x12,0xC5,0x22,0xC5,0x1A,0x84,0x1A,0x84,0x1A,0xC5,0x22,0x64,0x12,0xC5,0x1A,0xA5,
+    0x1A,0xC5,0x22,0xA5,0x1A,0xA5,0x1A,0x84,0x1A,0x83,0xA5,0x1A,0x08,0x64,0x12,0xA5,
+    0x1A,0x84,0x1A,0x84,0x12,0x84,0x1A,0xA5,0x1A,0x64,0x12,0xC5,0x22,0xC5,0x1A,0xD8,
+    0xB0,0xB4,0x1B,0xA5,0x1A,0xC5,0x1A,0x64,0x12,0x64,0x12,0xC5,0x22,0xA4,0x1A,0xC5,
+    0x1A,0x84,0x12,0xC5,0x1A,0x84,0x12,0x84,0x12,0x84,0x1A,0x84,0x1A,0xA5,0x1A,0xC5,
+    0x1A,0xA5,0x1A,0x84,0x12,0xC5,0x1A,0x84,0x12,0x84,0x1A,0xA5,0x1A,0x64,0x12,0x84,
+    0x12,0xA5,0x1A,0xA4,0x1A,0xA5,0x1A,0xC5,0x1A,0xA5,0x1A,0x92,0xB0,0xB4,0x81,0xC5,
+    0x1A,0x03,0xC5,0x22,0x84,0x1A,0x84,0x1A,0xA4,0x1A,0xAA,0xB0,0xB4,0x10,0xA5,0x1A,
+    0xC5,0x1A,0xA5,0x1A,0x84,0x1A,0xC5,0x22,0xA5,0x1A,0xA4,0x1A,0xA5,0x1A,0xC5,0x1A,
+    0xC5,0x22,0xC5,0x1A,0x84,0x1A,0xC5,0x1A,0x84,0x1A,0x64,0x12,0x84,0x12,0xC5,0x22,
+    0x89,0xB0,0xB4,0x06,0xA5,0x1A,0xC5,0x1A,0xA4,0x1A,0x84,0x12,0xA5,0x1A,0xC5,0x22,
+    0xC5,0x22,0x82,0x84,0x1A,0x04,0xC5,0x22,0x84,0x1A,0xA5,0x1A,0xA4,0x1A,0x84,0x12,
+    0x82,0xC5,0x22,0x0A,0xA5,0x1A,0xC5,0x1A,0x84,0x12,0x84,0x12,0xC5,0x1A,0xA5,0x1A,
+    0xC5,0x1A,0xA5,0x1A,0x84,0x12,0x84,0x12,0x84,0x1A,0xD6,0xB0,0xB4,0x1D,0xA5,0x1A,
+    0x84,0x1A,0xC5,0x1A,0xC5,0x22,0xE5,0x22,0xE5,0x22,0x84,0x12,0xA5,0x1A,0xC5,0x22,
+    0xA5,0x1A,0xC5,0x22,0xC5,0x22,0xA4,0x1A,0xA5,0x1A,0xC5,0x1A,0x84,0x1A,0xC5,0x1A,
+    0xC5,0x22,0x84,0x12,0xC5,0x1A,0x84,0x12,0xE5,0x22,0xA4,0x1A,0xC5,0x22,0x84,0x12,
+    0xA4,0x1A,0xC5,0x22,0x84,0x12,0x84,0x1A,0xE5,0x22,0x8F,0xB0,0xB4,0x00,0xC5,0x1A,
+    0x82,0xC5,0x22,0x04,0x84,0x12,0xA5,0x1A,0x84,0x1A,0xA5,0x1A,0xE5,0x22,0xA8,0xB0,
+    0xB4,0x81,0xA5,0x1A,0x11,0x84,0x1A,0xA4,0x1A,0xA5,0x1A,0x84,0x1A,0xC5,0x1A,0xA5,
+    0x1A,0x84,0x1A,0x84,0x12,0xA5,0x1A,0xC5,0x1A,0xC5,0x1A,0xA5,0x1A,0x84,0x12,0xC5,
+    0x22,0xA4,0x1A,0xA4,0x1A,0x84,0x1A,0xA5,0x1A,0x85,0xB0,0xB4,0x1E,0xC5,0x22,0xC5,
+    0x1A,0x84,0x12,0x84,0x1A,0xC5,0x1A,0xA5,0x1A,0xC5,0x1A,0x84,0x12,0x84,0x12,0xC5,
+    0x22,0xC5,0x1A,0x84,0x1A,0xA4,0x1A,0x84,0x1A,0x84,0x1A,0xA4,0x1A,0x84,0x1A,0xC5,
+    0x1A,0x84,0x1A,0xA4,0x1A,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xC5,0x22,0xA5,
+    0x1A,0xE5,0x22,0xE5,0x22,0x84,0x1A,0xC5,0x1A,0xA4,0x1A,0xD6,0xB0,0xB4,0x1E,0xC5,
+    0x1A,0xA5,0x1A,0x84,0x12,0xE5,0x22,0xA4,0x1A,0xC5,0x1A,0xA5,0x1A,0xA4,0x1A,0xA4,
+    0x1A,0xE5,0x22,0x84,0x12,0xE5,0x22,0x84,0x12,0x84,0x12,0xC5,0x1A,0xE5,0x22,0x84,
+    0x12,0xC5,0x1A,0xA4,0x1A,0xC5,0x22,0xE5,0x22,0xE5,0x22,0xC5,0x22,0x84,0x1A,0x84,
+    0x12,0xC5,0x1A,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xA5,0x1A,0x8C,0xB0,0xB4,
+    0x0B,0xC5,0x1A,0xC5,0x22,0xA4,0x1A,0xE5,0x22,0xC5,0x1A,0xA4,0x1A,0x84,0x12,0x84,
+    0x12,0xC5,0x1A,0xE5,0x22,0xC5,0x1A,0xA4,0x1A,0xA6,0xB0,0xB4,0x12,0xA4,0x1A,0xC5,
+    0x1A,0xA5,0x1A,0xA4,0x1A,0xE5,0x22,0xE5,0x22,0xC5,0x22,0xC5,0x1A,0xC5,0x1A,0x84,
+    0x12,0xC5,0x22,0xA5,0x1A,0xA5,0x1A,0xA4,0x1A,0xC5,0x1A,0x84,0x12,0xA4,0x1A,0xC5,
+    0x22,0xC5,0x1A,0x82,0xE5,0x22,0x01,0xC5,0x1A,0xA4,0x1A,0x82,0xC5,0x1A,0x15,0xA5,
+    0x1A,0xE5,0x22,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0x84,0x1A,0xC5,0x1A,0xC5,0x1A,0xC5,
+    0x22,0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0xC5,0x1A,0x84,0x12,0xC5,0x22,0xA5,0x1A,0xC5,
+    0x1A,0xA5,0x1A,0xA5,0x1A,0xA4,0x1A,0xC5,0x1A,0xC5,0x1A,0x82,0xE5,0x22,0x05,0x84,
+    0x12,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xC5,0x22,0xC5,0x22,0x9B,0xB0,0xB4,0xB9,0xCF,
+    0xBC,0x21,0xA4,0x1A,0xE5,0x22,0x84,0x12,0xC5,0x1A,0xE5,0x22,0xE5,0x22,0xA4,0x1A,
+    0xE5,0x22,0xE5,0x22,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0x84,0x1A,
+    0xE5,0x22,0xC5,0x22,0x84,0x12,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0xE5,0x22,0xC5,0x1A,
+    0xE5,0x22,0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0xC5,0x1A,0xA4,0x1A,0xC5,0x1A,0xA4,0x1A,
+    0xC5,0x1A,0xC5,0x1A,0x84,0x12,0x88,0xCF,0xBC,0x0E,0xA4,0x1A,0xC5,0x1A,0x84,0x1A,
+    0xE5,0x22,0xC5,0x22,0xC5,0x1A,0x84,0x1A,0xA4,0x1A,0x84,0x1A,0xE5,0x22,0xC5,0x1A,
+    0x84,0x12,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xA5,0xCF,0xBC,0x0A,0xA4,0x1A,0xE5,0x22,
+    0x84,0x1A,0xC5,0x1A,0xE5,0x22,0xE5,0x22,0xA4,0x1A,0xC5,0x22,0xA4,0x1A,0xA4,0x1A,
+    0xC5,0x1A,0x83,0xA4,0x1A,0x81,0x84,0x1A,0x03,0xE5,0x22,0xC5,0x1A,0xE5,0x22,0xA4,
+    0x1A,0x82,0xC5,0x1A,0x03,0xE5,0x22,0x84,0x12,0xA4,0x1A,0xA4,0x1A,0x82,0xE5,0x22,
+    0x05,0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0xC5,0x22,0xE5,0x22,0xA4,0x1A,0x82,0xC5,0x1A,
+    0x12,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xC5,0x22,0xA4,0x1A,0xE5,0x22,0xA4,
+    0x1A,0xA4,0x1A,0xC5,0x22,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0x84,0x12,0xC5,0x22,0xC5,
+    0x1A,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xD4,0xCF,0xBC,0x01,0xA4,0x1A,0xE5,0x22,0x82,
+    0xA4,0x1A,0x81,0xE5,0x22,0x19,0xA4,0x1A,0xE5,0x22,0xC5,0x1A,0xE5,0x22,0xE5,0x22,
+    0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xC5,0x1A,0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,
+    0xA4,0x1A,0xE5,0x22,0xC5,0x1A,0xC4,0x1A,0xA4,0x1A,0xE5,0x22,0xC5,0x1A,0xA4,0x1A,
+    0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0xE5,0x22,0x82,0xA4,0x1A,0x84,0xCF,0xBC,
+    0x11,0xA4,0x1A,0xC5,0x1A,0xC4,0x1A,0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0x84,0x12,0x84,
+    0x12,0xE5,0x22,0xE5,0x22,0x84,0x12,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0x84,0x12,0xC5,
+    0x1A,0xE5,0x22,0xC5,0x1A,0xA3,0xCF,0xBC,0x81,0xE5,0x22,0x06,0xC5,0x1A,0xC4,0x1A,
+    0xE5,0x22,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0xE5,0x22,0x82,0xA4,0x1A,0x01,0xC5,0x1A,
+    0xA4,0x1A,0x82,0xC5,0x1A,0x00,0xE5,0x22,0x83,0xA4,0x1A,0x81,0xC5,0x1A,0x08,0xE5,
+    0x22,0xC5,0x1A,0xA4,0x1A,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xC4,0x1A,0xC5,0x1A,0xE5,
+    0x22,0x82,0xA4,0x1A,0x81,0x84,0x12,0x15,0xE5,0x22,0x84,0x12,0xC5,0x1A,0xC4,0x1A,
+    0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xA4,0x1A,0xC5,0x1A,0xA4,0x1A,0xE5,0x22,0xE5,0x22,
+    0xA4,0x1A,0xE5,0x22,0x84,0x12,0x84,0x12,0xC5,0x1A,0xA4,0x1A,0xE5,0x22,0xC5,0x1A,
+    0x84,0x12,0xE5,0x22,0xD3,0xCF,0xBC,0x11,0xC5,0x1A,0xC4,0x1A,0xA4,0x1A,0xA4,0x1A,
+    0xC5,0x1A,0xE5,0x22,0xC4,0x1A,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xE5,0x22,
+    0xA4,0x1A,0xA4,0x1A,0xC4,0x1A,0x05,0x23,0xA4,0x1A,0xC5,0x1A,0x82,0xA4,0x1A,0x0F,
+    0xC5,0x1A,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0xC4,0x1A,0xE5,0x22,0xA4,0x1A,0xE5,0x22,
+    0xC5,0x1A,0xC5,0x1A,0xC4,0x1A,0xE5,0x22,0xC4,0x1A,0xC4,0x1A,0xE5,0x22,0xE5,0x22,
+    0x82,0xA4,0x1A,0x05,0xE5,0x22,0x05,0x23,0xE5,0x22,0xA4,0x1A,0xC4,0x1A,0xC5,0x1A,
+    0x84,0xE5,0x22,0x09,0xA4,0x1A,0xC4,0x1A,0xE5,0x22,0xC5,0x1A,0xE5,0x22,0xA4,0x1A,
+    0xE5,0x22,0xE5,0x22,0xC5,0x1A,0xE5,0x22,0xA2,0xCF,0xBC,0x02,0xA4,0x1A,0xE5,0x22,
+    0xC4,0x1A,0x82,0xE5,0x22,0x02,0x05,0x23,0xA4,0x1A,0xC4,0x1A,0x84,0xA4,0x1A,0x2E,
+    0xC5,0x1A,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xE5,0x22,0xC5,0x1A,0xE5,0x22,
+    0xC4,0x1A,0xA4,0x1A,0xC4,0x1A,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xC5,0x1A,
+    0xE5,0x22,0xA4,0x1A,0xC5,0x1A,0x05,0x23,0xE5,0x22,0xC5,0x1A,0xA4,0x1A,0xE5,0x22,
+    0xE5,0x22,0xC4,0x1A,0xA4,0x1A,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0xA4,0x1A,0xC4,0x1A,
+    0xA4,0x1A,0xC5,0x1A,0xA4,0x1A,0xE5,0x22,0xC4,0x1A,0xC4,0x1A,0xE5,0x22,0xA4,0x1A,
+    0xC4,0x1A,0x05,0x23,0xC5,0x1A,0x05,0x23,0xA4,0x1A,0xE5,0x22,0xC4,0x1A,0xD2,0xCF,
+    0xBC,0x04,0xA4,0x1A,0xC5,0x1A,0xC4,0x1A,0xE5,0x22,0xE5,0x22,0x82,0xC4,0x1A,0x25,
+    0xE5,0x22,0x05,0x23,0xC5,0x1A,0xE5,0x22,0xE5,0x1A,0xA4,0x1A,0xA4,0x1A,0xE5,0x22,
+    0xE5,0x1A,0xE5,0x22,0xE5,0x22,0x05,0x23,0xE5,0x22,0x05,0x23,0xE5,0x22,0xE5,0x22,
+    0xA4,0x1A,0xC4,0x1A,0x05,0x23,0xA4,0x1A,0xC4,0x1A,0xC4,0x1A,0xC5,0x1A,0xE5,0x22,
+    0xC4,0x1A,0xA4,0x1A,0xC5,0x1A,0xC4,0x1A,0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xA4,0x1A,
+    0xC4,0x1A,0x05,0x23,0xE5,0x22,0xE5,0x22,0xC4,0x1A,0xC5,0x1A,0x84,0xC4,0x1A,0x81,
+    0x05,0x23,0x81,0xE5,0x22,0x06,0xA4,0x1A,0xE5,0x22,0xA4,0x1A,0xA4,0x1A,0xC4,0x1A,
+    0x05,0x23,0xC4,0x1A,0xA0,0xCF,0xBC,0x0D,0x05,0x23,0xC4,0x1A,0xE5,0x22,0xA4,0x1A,
+    0xE5,0x1A,0xC4,0x1A,0xE5,0x1A,0xE5,0x1A,0xC4,0x1A,0x05,0x23,0xC5,0x1A,0xA4,0x1A,
+    0xE5,0x22,0x05,0x23,0x82,0xA4,0x1A,0x14,0xE5,0x22,0xE5,0x1A,0xE5,0x22,0xC4,0x1A,
+    0x05,0x23,0xC4,0x1A,0x05,0x23,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,
+    0xE5,0x22,0xC4,0x1A,0xC5,0x1A,0xC4,0x1A,0xE5,0x1A,0xE5,0x22,0xC4,0x1A,0xE5,0x22,
+    0xE5,0x22,0x82,0xA4,0x1A,0x03,0xC4,0x1A,0xE5,0x22,0xC4,0x1A,0xE5,0x22,0x82,0xA4,
+    0x1A,0x0D,0x05,0x23,0xC5,0x1A,0x05,0x23,0xE5,0x22,0xA4,0x1A,0x05,0x23,0xA4,0x1A,
+    0xE5,0x22,0xE5,0x22,0xC4,0x1A,0x05,0x23,0xA4,0x1A,0xC4,0x1A,0xC4,0x1A,0xD1,0xCF,
+    0xBC,0x12,0xA4,0x1A,0x05,0x23,0xE5,0x22,0xE5,0x22,0x05,0x23,0xA4,0x1A,0xA4,0x1A,
+    0x05,0x23,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0xE5,0x22,0xE5,0x1A,0xA4,0x1A,0xE5,0x22,
+    0xC4,0x1A,0xE5,0x22,0x05,0x23,0x05,0x23,0x82,0xC4,0x1A,0x81,0xE5,0x22,0x22,0xC4,
+    0x1A,0xE5,0x1A,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xE5,0x22,0xC4,0x1A,0x05,0x23,0xE5,
+    0x22,0x05,0x23,0xA4,0x1A,0xC4,0x1A,0xE5,0x1A,0xC4,0x1A,0xA4,0x1A,0x05,0x23,0xE5,
+    0x22,0x05,0x23,0xE5,0x1A,0xE5,0x22,0xE5,0x22,0xA4,0x1A,0xE5,0x1A,0xE5,0x22,0xE5,
+    0x22,0x05,0x23,0xE5,0x22,0xE5,0x22,0xE5,0x1A,0xA4,0x1A,0xC4,0x1A,0xE5,0x22,0xA4,
+    0x1A,0xC4,0x1A,0xC4,0x1A,0x82,0x05,0x23,0x00,0xA4,0x1A,0xA0,0xCF,0xBC,0x17,0xE5,
+    0x22,0xA4,0x1A,0xC4,0x1A,0xE5,0x22,0x05,0x23,0xC4,0x1A,0x05,0x23,0xE5,0x22,0x05,
+    0x23,0xE5,0x22,0xE5,0x22,0xC4,0x1A,0xE5,0x22,0xE5,0x1A,0xE5,0x22,0xE5,0x22,0xE5,
+    0x1A,0xE5,0x22,0x05,0x23,0xE5,0x22,0xC4,0x1A,0xE5,0x22,0xC4,0x1A,0xC4,0x1A,0x82,
+    0xE5,0x22,0x0F,0xC4,0x1A,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xA4,
+    0x1A,0xE5,0x1A,0x05,0x23,0x05,0x23,0xE5,0x22,0xA4,0x1A,0xC4,0x1A,0xE5,0x1A,0xE5,
+    0x1A,0xC4,0x1A,0x82,0x05,0x23,0x83,0xA4,0x1A,0x0C,0xE5,0x1A,0xC4,0x1A,0xE5,0x22,
+    0xC4,0x1A,0x05,0x23,0x05,0x23,0xC4,0x1A,0x05,0x23,0x05,0x23,0xE5,0x22,0x05,0x23,
+    0xC4,0x1A,0xE5,0x1A,0xD0,0xCF,0xBC,0x21,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xE5,0x22,
+    0xE4,0x1A,0xC4,0x1A,0xE5,0x1A,0xC4,0x1A,0xA4,0x1A,0xC4,0x1A,0xC4,0x1A,0xE4,0x1A,
+    0xC4,0x1A,0x05,0x23,0x05,0x23,0xC4,0x1A,0xE5,0x1A,0xC4,0x1A,0xE5,0x22,0xC4,0x1A,
+    0x05,0x23,0xE5,0x1A,0x05,0x23,0xC4,0x1A,0xE5,0x1A,0xE4,0x1A,0x05,0x23,0xE5,0x22,
+    0xC4,0x1A,0x05,0x23,0xE5,0x22,0xE5,0x1A,0x05,0x23,0xE5,0x1A,0x85,0xC4,0x1A,0x01,
+    0x05,0x23,0xA4,0x1A,0x82,0xC4,0x1A,0x12,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xE5,0x1A,
+    0x05,0x23,0x05,0x23,0xC4,0x1A,0xA4,0x1A,0xC4,0x1A,0xE5,0x1A,0x05,0x23,0xA4,0x1A,
+    0xE5,0x22,0xC4,0x1A,0xE5,0x22,0xE5,0x1A,0xE4,0x1A,0xA4,0x1A,0x05,0x23,0x9E,0xCF,
+    0xBC,0x0C,0xC4,0x1A,0x05,0x23,0xE5,0x22,0x05,0x23,0xE5,0x1A,0x05,0x23,0x05,0x23,
+    0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0xC4,0x1A,0xE5,0x22,0x82,0x05,0x23,0x23,
+    0xA4,0x1A,0x05,0x23,0xC4,0x1A,0x05,0x23,0x05,0x23,0xC4,0x1A,0xE5,0x1A,0xC4,0x1A,
+    0x05,0x23,0xE5,0x22,0xC4,0x1A,0x05,0x23,0xE5,0x22,0xE5,0x22,0xE5,0x1A,0xC4,0x1A,
+    0x05,0x23,0xE5,0x22,0xC4,0x1A,0xC4,0x1A,0xE5,0x1A,0x05,0x23,0x05,0x23,0xC4,0x1A,
+    0xC4,0x1A,0xE5,0x22,0xC4,0x1A,0xE5,0x1A,0x05,0x23,0xE5,0x22,0xC4,0x1A,0xE5,0x22,
+    0x05,0x23,0x05,0x23,0xE5,0x22,0xC4,0x1A,0x82,0x05,0x23,0x03,0xE4,0x1A,0xE5,0x22,
+    0xC4,0x1A,0xA4,0x1A,0x82,0x05,0x23,0x01,0xE4,0x1A,0x05,0x23,0x98,0xCF,0xBC,0xB6,
+    0xEF,0xC4,0x13,0xE4,0x1A,0xC4,0x1A,0x05,0x23,0x05,0x23,0xE5,0x22,0xE4,0x1A,0x25,
+    0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0xE4,0x1A,0x05,0x23,0xC4,0x1A,0xE5,
+    0x22,0xC4,0x1A,0xC4,0x1A,0xE4,0x1A,0xC4,0x1A,0xE5,0x22,0x82,0x05,0x23,0x00,0xC4,
+    0x1A,0x82,0x05,0x23,0x13,0xC4,0x1A,0xE5,0x22,0xE4,0x1A,0xE4,0x1A,0xE5,0x22,0x05,
+    0x23,0xE4,0x1A,0xE4,0x1A,0xE5,0x22,0xC4,0x1A,0xE5,0x22,0xE4,0x1A,0x05,0x23,0xE5,
+    0x22,0xC4,0x1A,0xE4,0x1A,0xC4,0x1A,0x05,0x23,0x25,0x23,0xC4,0x1A,0x82,0x05,0x23,
+    0x0E,0xE5,0x22,0x05,0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0x05,
+    0x23,0xC4,0x1A,0x05,0x23,0x25,0x23,0x25,0x23,0xC4,0x1A,0xE4,0x1A,0x05,0x23,0x9E,
+    0xEF,0xC4,0x81,0xE5,0x22,0x00,0xE4,0x1A,0x82,0xC4,0x1A,0x03,0x05,0x23,0xE4,0x1A,
+    0xC4,0x1A,0xC4,0x1A,0x82,0x05,0x23,0x07,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0x05,0x23,
+    0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0x82,0x05,0x23,0x10,0xE4,0x1A,0xE5,0x22,
+    0xE4,0x1A,0xC4,0x1A,0x25,0x23,0xC4,0x1A,0xE4,0x1A,0x05,0x23,0xC4,0x1A,0xC4,0x1A,
+    0x05,0x23,0xC4,0x1A,0xE4,0x1A,0x05,0x23,0x05,0x23,0xE4,0x1A,0xE4,0x1A,0x82,0x05,
+    0x23,0x13,0xE5,0x22,0xC4,0x1A,0xC4,0x1A,0xE4,0x1A,0xE4,0x1A,0xC4,0x1A,0xC4,0x1A,
+    0xE4,0x1A,0x25,0x23,0xC4,0x1A,0x05,0x23,0x05,0x23,0xC4,0x1A,0xE4,0x1A,0xC4,0x1A,
+    0xC4,0x1A,0x05,0x23,0xC4,0x1A,0xE4,0x1A,0xE4,0x1A,0xB2,0xEF,0xC4,0x00,0xE4,0x1A,
+    0x9B,0xEF,0xC4,0x03,0xE4,0x1A,0x05,0x23,0xC4,0x1A,0xE4,0x1A,0x82,0xC4,0x1A,0x17,
+    0xE5,0x22,0xE4,0x1A,0x25,0x23,0x05,0x23,0x25,0x23,0xE4,0x1A,0xC4,0x1A,0x05,0x23,
+    0xE4,0x1A,0xE4,0x1A,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0xC4,0x1A,0xE4,0x1A,0x25,0x23,
+    0x25,0x23,0x05,0x23,0x25,0x23,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0xE5,0x22,0xC4,0x1A,
+    0x82,0x05,0x23,0x00,0x25,0x23,0x82,0x05,0x23,0x1B,0xE5,0x22,0x05,0x23,0xE5,0x22,
+    0xE4,0x1A,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,
+    0x05,0x23,0xC4,0x1A,0xC4,0x1A,0xE4,0x1A,0xE4,0x1A,0xE5,0x22,0xE4,0x1A,0x05,0x23,
+    0xC4,0x1A,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0xC4,0x1A,
+    0xE5,0x22,0x9C,0xEF,0xC4,0x0B,0x25,0x23,0xC4,0x1A,0x25,0x23,0xE4,0x1A,0xC4,0x1A,
+    0x05,0x23,0x05,0x23,0xE4,0x1A,0x05,0x23,0x05,0x23,0x25,0x23,0x25,0x23,0x82,0x05,
+    0x23,0x04,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0x05,0x23,0x82,0xC4,0x1A,0x06,
+    0x05,0x23,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0x25,0x23,0x25,0x23,0x82,0xE4,
+    0x1A,0x81,0xC4,0x1A,0x1E,0x25,0x23,0xE5,0x22,0x05,0x23,0xE5,0x22,0xC4,0x1A,0x05,
+    0x23,0xC4,0x1A,0xE4,0x1A,0xE4,0x1A,0x05,0x23,0x05,0x23,0x25,0x23,0x05,0x23,0x05,
+    0x23,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0xE5,0x22,0x25,0x23,0x05,
+    0x23,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0x25,0x23,0xE5,0x22,0x05,0x23,0x05,0x23,0xE5,
+    0x22,0xE4,0x1A,0xAE,0xEF,0xC4,0x00,0xE4,0x22,0x83,0x05,0x23,0x81,0xC4,0x1A,0x97,
+    0xEF,0xC4,0x02,0x05,0x23,0x25,0x23,0xC4,0x1A,0x82,0x25,0x23,0x23,0xC4,0x1A,0x25,
+    0x23,0xC4,0x1A,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0x05,0x23,0x25,0x23,0xE4,
+    0x22,0x05,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0x25,0x23,0xE4,0x22,0x25,0x23,0x05,
+    0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0xE4,0x1A,0xC4,0x1A,0x05,0x23,0xE4,
+    0x22,0xE4,0x1A,0xC4,0x1A,0x25,0x23,0xC4,0x1A,0x25,0x23,0xE4,0x22,0x05,0x23,0x25,
+    0x23,0xE4,0x22,0xE4,0x1A,0x82,0x25,0x23,0x00,0xC4,0x1A,0x83,0x05,0x23,0x11,0xE4,
+    0x22,0xE4,0x1A,0x25,0x23,0xE4,0x22,0x05,0x23,0x25,0x23,0x25,0x23,0xE4,0x1A,0x25,
+    0x23,0x05,0x23,0x05,0x23,0xE4,0x1A,0xC4,0x1A,0xE4,0x22,0x25,0x23,0xC4,0x1A,0x05,
+    0x23,0xE4,0x1A,0x9B,0xEF,0xC4,0x1E,0x05,0x23,0x25,0x23,0x25,0x23,0x05,0x23,0xE4,
+    0x22,0x25,0x23,0x25,0x23,0xC4,0x1A,0x05,0x23,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,
+    0x23,0x25,0x23,0xE4,0x1A,0x05,0x23,0x25,0x23,0xE4,0x1A,0xC4,0x1A,0xE4,0x1A,0xE4,
+    0x22,0xE4,0x22,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0x05,0x23,0x25,0x23,0x05,
+    0x23,0xE4,0x22,0x05,0x23,0x83,0x25,0x23,0x00,0xE4,0x1A,0x83,0x05,0x23,0x02,0xC4,
+    0x1A,0x05,0x23,0x05,0x23,0x82,0xE4,0x1A,0x0E,0xC4,0x1A,0x05,0x23,0x05,0x23,0xC4,
+    0x1A,0x25,0x23,0xC4,0x1A,0x25,0x23,0xC4,0x1A,0xE4,0x1A,0x05,0x23,0x25,0x23,0x05,
+    0x23,0x25,0x23,0x05,0x23,0x25,0x23,0x82,0xE4,0x1A,0x01,0x05,0x23,0xC4,0x1A,0xAC,
+    0xEF,0xC4,0x03,0xE4,0x1A,0xC4,0x1A,0x05,0x23,0x05,0x23,0x84,0x25,0x23,0x01,0xE4,
+    0x1A,0x05,0x23,0x95,0xEF,0xC4,0x20,0x25,0x23,0x05,0x23,0xC4,0x1A,0x05,0x23,0x25,
+    0x23,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x04,0x23,0x25,0x23,0xE4,
+    0x1A,0xE4,0x1A,0x25,0x23,0x05,0x23,0x05,0x23,0xE4,0x1A,0xE4,0x1A,0x05,0x23,0x25,
+    0x23,0xC4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x25,0x23,0xC4,0x1A,0x05,
+    0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0x82,0x25,0x23,0x1F,0x05,0x23,0xE4,
+    0x1A,0xE4,0x1A,0x05,0x23,0x25,0x23,0x05,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0xC4,
+    0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0xC4,0x1A,0x05,
+    0x23,0xE4,0x1A,0x25,0x23,0xC4,0x1A,0xC4,0x1A,0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x25,
+    0x23,0x05,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x05,0x23,0x25,0x23,0x9A,0xEF,0xC4,
+    0x17,0x04,0x23,0x25,0x23,0x05,0x23,0x25,0x23,0x05,0x23,0x05,0x23,0x25,0x23,0x05,
+    0x23,0x05,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0x25,0x23,0x05,0x23,0x25,0x23,0xE4,
+    0x1A,0x05,0x23,0xE4,0x1A,0x04,0x23,0xE4,0x1A,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0xE4,
+    0x1A,0x82,0x25,0x23,0x03,0xE4,0x1A,0x25,0x23,0x04,0x23,0x04,0x23,0x83,0xE4,0x1A,
+    0x05,0x04,0x23,0x05,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0xC4,0x1A,0x85,0xE4,0x1A,
+    0x81,0x25,0x23,0x08,0x05,0x23,0x25,0x23,0xE4,0x1A,0x05,0x23,0x05,0x23,0x25,0x23,
+    0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x82,0x05,0x23,0x06,0x25,0x23,0xE4,0x1A,0xE4,0x1A,
+    0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x25,0x23,0xAA,0xEF,0xC4,0x03,0x25,0x23,0xE4,0x1A,
+    0xE4,0x1A,0x25,0x23,0x82,0x05,0x23,0x05,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,
+    0xE4,0x1A,0x25,0x23,0x93,0xEF,0xC4,0x81,0x25,0x23,0x81,0xE4,0x1A,0x41,0x05,0x23,
+    0xE4,0x1A,0x04,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0x05,0x23,0x04,0x23,0x25,0x23,
+    0xE4,0x1A,0xE4,0x1A,0x04,0x23,0x25,0x23,0xE4,0x1A,0x04,0x23,0x05,0x23,0x25,0x23,
+    0x04,0x23,0xE4,0x1A,0x25,0x23,0x04,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0xE4,0x1A,
+    0x04,0x23,0x45,0x2B,0x45,0x2B,0x25,0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x04,0x23,
+    0x45,0x2B,0x05,0x23,0x04,0x23,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x45,0x2B,0x04,0x23,
+    0xE4,0x1A,0x45,0x2B,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x05,0x23,0x25,0x23,
+    0x25,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0x05,0x23,0xE4,0x1A,
+    0x25,0x23,0xE4,0x1A,0x05,0x23,0x25,0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,
+    0x04,0x23,0x99,0xEF,0xC4,0x11,0x25,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x45,0x2B,
+    0xE4,0x1A,0x45,0x2B,0x25,0x23,0x05,0x23,0x25,0x23,0x05,0x23,0x25,0x23,0x25,0x23,
+    0xE4,0x1A,0x04,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x83,0x25,0x23,0x17,0xE4,0x1A,
+    0x05,0x23,0x04,0x23,0x45,0x2B,0x25,0x23,0x05,0x23,0x05,0x23,0x04,0x23,0x05,0x23,
+    0xE4,0x1A,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x05,0x23,0x45,0x2B,
+    0xE4,0x1A,0x05,0x23,0xE4,0x1A,0x05,0x23,0x25,0x23,0x25,0x23,0x04,0x23,0x82,0xE4,
+    0x1A,0x81,0x25,0x23,0x10,0xE4,0x1A,0x05,0x23,0x05,0x23,0xE4,0x1A,0xE4,0x1A,0x25,
+    0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x05,0x23,0x25,0x23,0x04,0x23,0xE4,0x1A,0xE4,
+    0x1A,0x04,0x23,0x25,0x23,0x25,0x23,0x96,0xEF,0xC4,0x00,0x45,0x2B,0x90,0x0E,0xCD,
+    0x0F,0x45,0x2B,0xE4,0x1A,0x04,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x25,0x23,0xE4,
+    0x1A,0xE4,0x1A,0x04,0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0xE4,0x1A,0x25,
+    0x23,0x92,0x0E,0xCD,0x03,0x05,0x23,0xE4,0x1A,0x05,0x23,0x45,0x2B,0x82,0x25,0x23,
+    0x0F,0x04,0x23,0x05,0x23,0x04,0x23,0x04,0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,
+    0x23,0xE4,0x1A,0x05,0x23,0x04,0x23,0x25,0x23,0x45,0x23,0x04,0x23,0x45,0x2B,0xE4,
+    0x1A,0x82,0x25,0x23,0x02,0x04,0x23,0xE4,0x1A,0x25,0x23,0x82,0x45,0x2B,0x0D,0x04,
+    0x23,0x05,0x23,0x05,0x23,0x25,0x23,0x45,0x2B,0xE4,0x1A,0x25,0x23,0x25,0x23,0xE4,
+    0x1A,0xE4,0x1A,0x25,0x23,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x82,0x04,0x23,0x14,0x45,
+    0x2B,0x25,0x23,0xE4,0x1A,0x25,0x23,0x04,0x23,0x25,0x23,0xE4,0x1A,0x25,0x23,0x25,
+    0x23,0xE4,0x1A,0x25,0x23,0x25,0x23,0x04,0x23,0x25,0x23,0x45,0x2B,0x25,0x23,0xE4,
+    0x1A,0xE4,0x1A,0x04,0x23,0x04,0x23,0x04,0x1B,0x98,0x0E,0xCD,0x08,0xE4,0x1A,0x25,
+    0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0x05,0x23,0x04,0x23,0x25,0x23,0x05,0x23,0x82,
+    0x04,0x23,0x2D,0x25,0x23,0x04,0x23,0xE4,0x1A,0x45,0x23,0xE4,0x1A,0x45,0x2B,0x25,
+    0x23,0x04,0x1B,0x45,0x2B,0x04,0x23,0x45,0x2B,0x05,0x23,0x25,0x23,0x04,0x23,0x25,
+    0x23,0x45,0x2B,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x45,0x23,0xE4,0x1A,0x04,0x23,0x05,
+    0x23,0xE4,0x1A,0xE4,0x1A,0x04,0x23,0x25,0x23,0x45,0x23,0x25,0x23,0x04,0x23,0x04,
+    0x1B,0x04,0x1B,0xE4,0x1A,0x04,0x23,0x45,0x23,0x25,0x23,0xE4,0x1A,0x45,0x23,0x25,
+    0x23,0x04,0x23,0x45,0x2B,0x45,0x2B,0x04,0x1B,0x25,0x23,0xE4,0x1A,0x25,0x23,0x82,
+    0x04,0x23,0x08,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x25,0x23,0x04,0x23,0x45,0x2B,0x45,
+    0x23,0xE4,0x1A,0xE4,0x1A,0x95,0x0E,0xCD,0x01,0x04,0x23,0x25,0x23,0x8E,0x0E,0xCD,
+    0x11,0x45,0x2B,0x04,0x1B,0x25,0x23,0xE4,0x1A,0x45,0x2B,0x25,0x23,0x45,0x2B,0x45,
+    0x23,0x45,0x23,0x25,0x23,0x25,0x23,0x04,0x1B,0x04,0x23,0x04,0x23,0xE4,0x1A,0x25,
+    0x23,0x04,0x1B,0x25,0x23,0x90,0x0E,0xCD,0x32,0x25,0x23,0xE4,0x1A,0x45,0x2B,0x04,
+    0x23,0x25,0x23,0x04,0x23,0x45,0x2B,0xE4,0x1A,0x04,0x23,0x25,0x23,0x04,0x23,0x25,
+    0x23,0x45,0x2B,0x04,0x23,0x04,0x23,0x45,0x23,0xE4,0x1A,0xE4,0x1A,0x25,0x23,0xE4,
+    0x1A,0x04,0x1B,0x04,0x23,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x04,0x23,0x45,0x2B,0xE4,
+    0x1A,0x25,0x23,0x04,0x1B,0xE4,0x1A,0x25,0x23,0x04,0x23,0x04,0x23,0x25,0x23,0x04,
+    0x23,0x04,0x23,0x25,0x23,0x25,0x23,0x04,0x23,0x04,0x23,0x25,0x23,0x45,0x23,0xE4,
+    0x1A,0x04,0x23,0x25,0x23,0x04,0x1B,0x04,0x23,0x45,0x23,0x25,0x23,0x04,0x23,0x83,
+    0x25,0x23,0x10,0x04,0x23,0xE4,0x1A,0x25,0x23,0xE4,0x1A,0xE4,0x1A,0x45,0x23,0x45,
+    0x23,0x25,0x23,0x45,0x23,0x25,0x23,0x25,0x23,0x45,0x2B,0x25,0x23,0x04,0x23,0x04,
+    0x23,0xE4,0x1A,0x45,0x23,0x97,0x0E,0xCD,0x04,0x25,0x23,0x04,0x23,0x45,0x2B,0x25,
+    0x23,0x45,0x2B,0x82,0x25,0x23,0x00,0x45,0x23,0x83,0x25,0x23,0x03,0x45,0x23,0x45,
+    0x2B,0x25,0x23,0x45,0x2B,0x82,0x25,0x23,0x07,0x04,0x1B,0x04,0x23,0x45,0x23,0x25,
+    0x23,0x04,0x23,0x25,0x23,0x45,0x2B,0x45,0x2B,0x82,0x25,0x23,0x82,0x04,0x23,0x23,
+    0xE4,0x1A,0x25,0x23,0x45,0x2B,0xE4,0x1A,0x45,0x2B,0x25,0x23,0x25,0x23,0x04,0x23,
+    0x04,0x23,0x25,0x23,0x25,0x23,0x04,0x23,0x45,0x2B,0x25,0x23,0x04,0x23,0x45,0x2B,
+    0x45,0x23,0x04,0x1B,0x25,0x23,0x25,0x23,0xE4,0x1A,0x45,0x23,0xE4,0x1A,0x04,0x23,
+    0x45,0x2B,0xE4,0x1A,0x04,0x23,0x45,0x2B,0x25,0x23,0x45,0x2B,0xE4,0x1A,0x04,0x23,
+    0x25,0x23,0xE4,0x1A,0x04,0x23,0x04,0x23,0x94,0x0E,0xCD,0x02,0x04,0x23,0x45,0x23,
+    0x45,0x2B,0x8D,0x0E,0xCD,0x13,0xE4,0x1A,0x04,0x23,0x45,0x2B,0x04,0x1B,0x24,0x23,
+    0x04,0x1B,0x45,0x23,0x45,0x23,0x04,0x1B,0x04,0x1B,0x45,0x2B,0x45,0x2B,0x04,0x23,
+    0x25,0x23,0x45,0x23,0x24,0x23,0x04,0x23,0xE4,0x1A,0x45,0x23,0x45,0x2B,0x8F,0x0E,
+    0xCD,0x01,0x45,0x2B,0x04,0x1B,0x82,0x45,0x2B,0x06,0x25,0x23,0x45,0x2B,0x45,0x23,
+    0x45,0x23,0x24,0x23,0x04,0x23,0x04,0x23,0x83,0x25,0x23,0x37,0x45,0x2B,0x04,0x1B,
+    0x04,0x23,0x25,0x23,0x04,0x23,0x45,0x23,0xE4,0x1A,0x45,0x23,0x04,0x23,0x45,0x23,
+    0x04,0x23,0x04,0x23,0x45,0x2B,0x25,0x23,0x25,0x23,0x04,0x23,0x45,0x23,0x04,0x1B,
+    0x45,0x2B,0x04,0x23,0x45,0x2B,0x45,0x2B,0x24,0x23,0xE4,0x1A,0x45,0x2B,0x45,0x2B,
+    0x45,0x23,0x04,0x23,0x25,0x23,0x25,0x23,0x04,0x1B,0x45,0x23,0x04,0x1B,0xE4,0x1A,
+    0x24,0x23,0x25,0x23,0x25,0x23,0x24,0x23,0x45,0x2B,0x25,0x23,0x25,0x23,0x24,0x23,
+    0x45,0x23,0x04,0x1B,0x45,0x23,0x45,0x23,0x04,0x23,0x45,0x2B,0x25,0x23,0x45,0x23,
+    0x04,0x23,0x25,0x23,0xE4,0x1A,0x04,0x23,0x45,0x2B,0x04,0x1B,0x96,0x0E,0xCD,0x10,
+    0x45,0x23,0x25,0x23,0x04,0x1B,0x25,0x23,0x04,0x23,0x45,0x23,0x45,0x2B,0x45,0x23,
+    0x45,0x2B,0x04,0x23,0x25,0x23,0x24,0x23,0x45,0x2B,0x04,0x23,0xE4,0x1A,0x04,0x1B,
+    0x45,0x23,0x82,0x25,0x23,0x81,0x04,0x1B,0x0B,0x04,0x23,0xE4,0x1A,0x04,0x1B,0x04,
+    0x23,0xE4,0x1A,0x45,0x23,0xE4,0x1A,0x25,0x23,0x45,0x2B,0x45,0x2B,0xE4,0x1A,0x04,
+    0x1B,0x82,0xE4,0x1A,0x09,0x25,0x23,0x24,0x23,0x24,0x23,0x45,0x2B,0xE4,0x1A,0x45,
+    0x23,0xE4,0x1A,0x25,0x23,0x04,0x23,0x25,0x23,0x82,0x04,0x23,0x15,0x45,0x23,0x25,
+    0x23,0x25,0x23,0x04,0x23,0x04,0x23,0x04,0x1B,0x04,0x23,0x25,0x23,0xE4,0x1A,0x04,
+    0x23,0x25,0x23,0x45,0x2B,0x25,0x23,0xE4,0x1A,0x24,0x23,0x24,0x23,0x25,0x23,0x04,
+    0x1B,0xE4,0x1A,0x45,0x23,0x04,0x1B,0x25,0x23,0x92,0x0E,0xCD,0x04,0x45,0x23,0x04,
+    0x1B,0x65,0x2B,0x04,0x23,0x04,0x23,0x8B,0x0E,0xCD,0x81,0x04,0x23,0x13,0x24,0x23,
+    0x65,0x2B,0x04,0x1B,0x04,0x1B,0x65,0x2B,0x24,0x23,0x45,0x2B,0x04,0x23,0x04,0x1B,
+    0x25,0x23,0x04,0x23,0x04,0x23,0x04,0x1B,0x45,0x2B,0x24,0x23,0x24,0x23,0x04,0x1B,
+    0x45,0x23,0x04,0x1B,0x25,0x23,0x8D,0x0E,0xCD,0x1C,0x04,0x23,0x65,0x2B,0x04,0x23,
+    0x45,0x2B,0x04,0x23,0x04,0x1B,0x04,0x1B,0x04,0x23,0x04,0x1B,0x45,0x2B,0x45,0x2B,
+    0x04,0x1B,0x04,0x1B,0x65,0x2B,0x65,0x2B,0x45,0x2B,0x04,0x23,0x24,0x23,0x45,0x2B,
+    0x24,0x23,0x45,0x23,0x25,0x23,0x04,0x23,0x45,0x2B,0x04,0x1B,0x45,0x2B,0x24,0x23,
+    0x65,0x2B,0x04,0x23,0x82,0x24,0x23,0x1C,0x25,0x23,0x65,0x2B,0x45,0x2B,0x45,0x23,
+    0x25,0x23,0x45,0x2B,0x25,0x23,0x04,0x1B,0x25,0x23,0x04,0x23,0x25,0x23,0x24,0x23,
+    0x04,0x23,0x45,0x23,0x45,0x2B,0x04,0x1B,0x04,0x23,0x04,0x1B,0x65,0x2B,0x65,0x2B,
+    0x25,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x25,0x23,
+    0x25,0x23,0x82,0x24,0x23,0x81,0x25,0x23,0x07,0x45,0x23,0x04,0x1B,0x24,0x23,0x04,
+    0x23,0x24,0x23,0x04,0x23,0x24,0x23,0x45,0x23,0x95,0x0E,0xCD,0x08,0x04,0x23,0x45,
+    0x23,0x45,0x2B,0x45,0x2B,0x04,0x23,0x04,0x23,0x25,0x23,0x45,0x2B,0x45,0x2B,0x82,
+    0x04,0x23,0x3B,0x04,0x1B,0x45,0x23,0x24,0x23,0x04,0x23,0x24,0x23,0x45,0x2B,0x24,
+    0x23,0x04,0x23,0x24,0x23,0x25,0x23,0x24,0x23,0x04,0x1B,0x25,0x23,0x04,0x23,0x45,
+    0x23,0x24,0x23,0x25,0x23,0x04,0x1B,0x04,0x23,0x45,0x2B,0x24,0x23,0x04,0x1B,0x45,
+    0x2B,0x04,0x23,0x25,0x23,0x45,0x23,0x04,0x1B,0x04,0x1B,0x45,0x2B,0x04,0x23,0x45,
+    0x2B,0x24,0x23,0x45,0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x65,0x2B,0x45,0x23,0x45,
+    0x2B,0x65,0x2B,0x45,0x2B,0x24,0x23,0x24,0x23,0x45,0x2B,0x04,0x1B,0x04,0x23,0x25,
+    0x23,0x04,0x1B,0x24,0x23,0x45,0x23,0x45,0x2B,0x65,0x2B,0x04,0x23,0x04,0x1B,0x04,
+    0x23,0x24,0x23,0x24,0x23,0x45,0x23,0x25,0x23,0x04,0x23,0x91,0x0E,0xCD,0x06,0x24,
+    0x23,0x65,0x2B,0x04,0x1B,0x24,0x23,0x24,0x23,0x65,0x2B,0x45,0x23,0x89,0x0E,0xCD,
+    0x0C,0x04,0x1B,0x24,0x23,0x04,0x1B,0x04,0x23,0x24,0x23,0x24,0x23,0x45,0x23,0x24,
+    0x23,0x04,0x23,0x04,0x23,0x24,0x23,0x04,0x1B,0x24,0x23,0x85,0x45,0x23,0x01,0x65,
+    0x2B,0x25,0x23,0x82,0x45,0x23,0x8B,0x0E,0xCD,0x07,0x45,0x23,0x04,0x23,0x45,0x23,
+    0x24,0x23,0x24,0x23,0x25,0x23,0x65,0x2B,0x04,0x1B,0x82,0x24,0x23,0x3F,0x65,0x2B,
+    0x04,0x23,0x04,0x23,0x65,0x2B,0x24,0x23,0x04,0x1B,0x04,0x23,0x45,0x23,0x24,0x23,
+    0x04,0x23,0x04,0x1B,0x65,0x2B,0x24,0x23,0x04,0x1B,0x45,0x23,0x24,0x23,0x45,0x2B,
+    0x65,0x2B,0x24,0x23,0x04,0x1B,0x45,0x23,0x45,0x2B,0x45,0x2B,0x24,0x23,0x45,0x23,
+    0x24,0x23,0x04,0x23,0x45,0x23,0x65,0x2B,0x45,0x2B,0x65,0x2B,0x04,0x1B,0x24,0x23,
+    0x24,0x23,0x45,0x23,0x45,0x23,0x04,0x1B,0x04,0x1B,0x24,0x23,0x45,0x23,0x45,0x23,
+    0x24,0x23,0x04,0x23,0x45,0x23,0x04,0x1B,0x45,0x23,0x24,0x23,0x45,0x2B,0x65,0x2B,
+    0x45,0x23,0x45,0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x65,0x2B,0x45,0x23,0x04,0x1B,
+    0x45,0x23,0x24,0x23,0x25,0x23,0x04,0x1B,0x24,0x23,0x04,0x1B,0x45,0x2B,0x94,0x0E,
+    0xCD,0x03,0x45,0x2B,0x24,0x23,0x04,0x1B,0x04,0x23,0x85,0x24,0x23,0x0B,0x45,0x23,
+    0x25,0x23,0x04,0x1B,0x24,0x23,0x04,0x23,0x45,0x2B,0x24,0x23,0x04,0x1B,0x04,0x1B,
+    0x25,0x23,0x25,0x23,0x45,0x23,0x82,0x24,0x23,0x02,0x65,0x2B,0x45,0x2B,0x65,0x2B,
+    0x82,0x45,0x23,0x1D,0x24,0x23,0x45,0x23,0x24,0x23,0x45,0x2B,0x04,0x23,0x24,0x23,
+    0x04,0x23,0x24,0x23,0x04,0x1B,0x25,0x23,0x24,0x23,0x45,0x23,0x65,0x2B,0x45,0x23,
+    0x65,0x2B,0x24,0x23,0x25,0x23,0x45,0x23,0x04,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,
+    0x04,0x1B,0x65,0x2B,0x45,0x2B,0x24,0x23,0x04,0x1B,0x65,0x2B,0x04,0x1B,0x04,0x1B,
+    0x84,0x45,0x23,0x07,0x65,0x2B,0x24,0x23,0x45,0x23,0x65,0x2B,0x04,0x23,0x45,0x23,
+    0x65,0x2B,0x45,0x23,0x8F,0x0E,0xCD,0x08,0x25,0x23,0x04,0x1B,0x25,0x23,0x45,0x23,
+    0x65,0x2B,0x45,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x86,0x0E,0xCD,0x81,0x45,0x2B,
+    0x06,0x24,0x23,0x04,0x1B,0x65,0x2B,0x24,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x82,
+    0x65,0x2B,0x04,0x45,0x23,0x24,0x23,0x04,0x23,0x45,0x23,0x65,0x2B,0x83,0x24,0x23,
+    0x05,0x45,0x23,0x04,0x1B,0x24,0x23,0x45,0x2B,0x24,0x23,0x65,0x2B,0x89,0x0E,0xCD,
+    0x10,0x24,0x23,0x45,0x2B,0x45,0x23,0x45,0x23,0x04,0x1B,0x45,0x2B,0x24,0x23,0x45,
+    0x2B,0x04,0x1B,0x45,0x23,0x65,0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x45,0x23,0x45,
+    0x23,0x04,0x23,0x86,0x24,0x23,0x81,0x65,0x2B,0x05,0x45,0x2B,0x45,0x23,0x24,0x23,
+    0x24,0x23,0x45,0x23,0x65,0x2B,0x84,0x45,0x23,0x81,0x24,0x23,0x15,0x45,0x23,0x45,
+    0x2B,0x45,0x23,0x24,0x23,0x45,0x2B,0x65,0x2B,0x24,0x23,0x24,0x23,0x65,0x2B,0x24,
+    0x23,0x65,0x2B,0x04,0x1B,0x24,0x23,0x04,0x23,0x45,0x23,0x45,0x23,0x65,0x2B,0x65,
+    0x2B,0x45,0x23,0x65,0x2B,0x24,0x23,0x45,0x2B,0x83,0x45,0x23,0x81,0x24,0x23,0x09,
+    0x04,0x1B,0x04,0x23,0x65,0x2B,0x04,0x23,0x04,0x23,0x45,0x23,0x45,0x23,0x24,0x23,
+    0x45,0x23,0x45,0x23,0x93,0x0E,0xCD,0x00,0x24,0x23,0x82,0x45,0x23,0x04,0x45,0x2B,
+    0x04,0x1B,0x45,0x2B,0x24,0x23,0x45,0x2B,0x82,0x45,0x23,0x81,0x24,0x23,0x81,0x65,
+    0x2B,0x1D,0x24,0x23,0x45,0x2B,0x24,0x23,0x24,0x23,0x65,0x2B,0x04,0x1B,0x45,0x23,
+    0x04,0x1B,0x65,0x2B,0x65,0x2B,0x04,0x23,0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,
+    0x45,0x23,0x24,0x23,0x65,0x2B,0x04,0x23,0x45,0x23,0x04,0x1B,0x65,0x2B,0x45,0x23,
+    0x24,0x23,0x45,0x23,0x45,0x23,0x24,0x23,0x45,0x23,0x04,0x23,0x24,0x23,0x82,0x45,
+    0x23,0x03,0x45,0x2B,0x65,0x2B,0x45,0x23,0x45,0x23,0x84,0x24,0x23,0x10,0x45,0x2B,
+    0x24,0x23,0x24,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,
+    0x04,0x23,0x65,0x2B,0x04,0x23,0x45,0x23,0x04,0x1B,0x45,0x23,0x24,0x23,0x24,0x23,
+    0x8E,0x0E,0xCD,0x0A,0x45,0x23,0x24,0x23,0x24,0x23,0x45,0x23,0x04,0x1B,0x45,0x23,
+    0x45,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x65,0x2B,0x82,0x2E,0xD5,0x06,0x65,0x2B,
+    0x24,0x23,0x65,0x2B,0x65,0x2B,0x45,0x23,0x44,0x23,0x65,0x2B,0x82,0x24,0x23,0x14,
+    0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,
+    0x45,0x23,0x44,0x23,0x44,0x23,0x45,0x23,0x65,0x2B,0x45,0x23,0x65,0x2B,0x44,0x23,
+    0x65,0x2B,0x65,0x2B,0x44,0x23,0x45,0x23,0x65,0x2B,0x86,0x2E,0xD5,0x06,0x65,0x2B,
+    0x45,0x23,0x44,0x23,0x45,0x23,0x65,0x2B,0x45,0x23,0x45,0x23,0x82,0x24,0x23,0x0C,
+    0x45,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x04,0x1B,0x65,0x2B,0x44,0x23,0x65,0x2B,
+    0x65,0x2B,0x04,0x1B,0x44,0x23,0x45,0x23,0x04,0x1B,0x82,0x44,0x23,0x82,0x65,0x2B,
+    0x0F,0x45,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x24,0x23,0x44,0x23,0x45,0x23,0x65,
+    0x2B,0x45,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x04,0x1B,0x45,0x23,0x65,0x2B,0x44,
+    0x23,0x83,0x65,0x2B,0x82,0x24,0x23,0x19,0x65,0x2B,0x44,0x23,0x45,0x23,0x24,0x23,
+    0x65,0x2B,0x24,0x23,0x24,0x23,0x45,0x23,0x04,0x1B,0x65,0x2B,0x44,0x23,0x24,0x23,
+    0x65,0x2B,0x45,0x23,0x24,0x23,0x24,0x23,0x45,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,
+    0x65,0x2B,0x44,0x23,0x24,0x23,0x45,0x23,0x45,0x23,0x44,0x23,0x92,0x2E,0xD5,0x03,
+    0x45,0x23,0x65,0x2B,0x65,0x2B,0x45,0x23,0x84,0x24,0x23,0x00,0x45,0x23,0x82,0x24,
+    0x23,0x06,0x45,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x44,0x23,
+    0x84,0x65,0x2B,0x05,0x44,0x23,0x65,0x2B,0x24,0x23,0x04,0x1B,0x44,0x23,0x65,0x2B,
+    0x82,0x24,0x23,0x29,0x65,0x2B,0x45,0x23,0x65,0x2B,0x45,0x23,0x04,0x1B,0x65,0x2B,
+    0x24,0x23,0x24,0x23,0x45,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,0x24,0x23,0x44,0x23,
+    0x65,0x2B,0x24,0x23,0x24,0x23,0x65,0x2B,0x44,0x23,0x24,0x23,0x45,0x23,0x45,0x23,
+    0x04,0x1B,0x45,0x23,0x45,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x24,0x23,0x65,0x2B,
+    0x65,0x2B,0x04,0x1B,0x65,0x2B,0x65,0x2B,0x24,0x23,0x04,0x1B,0x24,0x23,0x45,0x23,
+    0x24,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x8D,0x2E,0xD5,0x81,0x65,0x2B,0x04,0x24,
+    0x23,0x45,0x23,0x44,0x23,0x24,0x23,0x45,0x23,0x84,0x65,0x2B,0x08,0x45,0x23,0x65,
+    0x2B,0x44,0x23,0x24,0x23,0x45,0x23,0x44,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x82,
+    0x45,0x23,0x01,0x44,0x23,0x65,0x2B,0x87,0x24,0x23,0x06,0x65,0x2B,0x45,0x23,0x45,
+    0x23,0x85,0x2B,0x65,0x2B,0x45,0x23,0x65,0x2B,0x82,0x24,0x23,0x03,0x65,0x2B,0x24,
+    0x23,0x24,0x23,0x45,0x23,0x82,0x2E,0xD5,0x30,0x85,0x2B,0x44,0x23,0x45,0x23,0x24,
+    0x23,0x24,0x23,0x65,0x2B,0x85,0x2B,0x65,0x2B,0x44,0x23,0x45,0x23,0x85,0x2B,0x44,
+    0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x65,0x2B,0x65,
+    0x2B,0x44,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x24,0x23,0x24,0x23,0x65,0x2B,0x65,
+    0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x85,0x2B,0x24,0x23,0x44,0x23,0x24,0x23,0x24,
+    0x23,0x44,0x23,0x24,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x85,
+    0x2B,0x85,0x2B,0x65,0x2B,0x45,0x23,0x24,0x23,0x45,0x23,0x82,0x65,0x2B,0x81,0x24,
+    0x23,0x82,0x65,0x2B,0x00,0x45,0x23,0x82,0x65,0x2B,0x07,0x45,0x23,0x24,0x23,0x65,
+    0x2B,0x45,0x23,0x45,0x23,0x65,0x2B,0x44,0x23,0x45,0x23,0x82,0x24,0x23,0x82,0x65,
+    0x2B,0x05,0x44,0x23,0x24,0x23,0x24,0x23,0x44,0x23,0x24,0x23,0x24,0x23,0x91,0x2E,
+    0xD5,0x00,0x24,0x23,0x82,0x65,0x2B,0x81,0x24,0x23,0x30,0x65,0x2B,0x45,0x23,0x24,
+    0x23,0x24,0x23,0x44,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,0x65,0x2B,0x45,0x23,0x65,
+    0x2B,0x44,0x23,0x45,0x23,0x65,0x2B,0x24,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x44,
+    0x23,0x65,0x2B,0x45,0x23,0x45,0x23,0x24,0x23,0x44,0x23,0x44,0x23,0x85,0x2B,0x45,
+    0x23,0x45,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x65,0x2B,0x24,0x23,0x65,0x2B,0x65,
+    0x2B,0x45,0x23,0x45,0x23,0x44,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x44,0x23,0x65,
+    0x2B,0x65,0x2B,0x45,0x23,0x85,0x2B,0x65,0x2B,0x65,0x2B,0x45,0x23,0x82,0x65,0x2B,
+    0x81,0x45,0x23,0x03,0x85,0x2B,0x65,0x2B,0x24,0x23,0x44,0x23,0x82,0x24,0x23,0x01,
+    0x45,0x23,0x24,0x23,0x82,0x44,0x23,0x04,0x85,0x2B,0x65,0x2B,0x44,0x23,0x24,0x23,
+    0x24,0x23,0x8B,0x2E,0xD5,0x24,0x65,0x2B,0x24,0x23,0x45,0x23,0x24,0x23,0x45,0x23,
+    0x45,0x23,0x85,0x2B,0x65,0x2B,0x44,0x23,0x65,0x2B,0x44,0x23,0x24,0x23,0x85,0x2B,
+    0x24,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x85,0x2B,0x24,0x23,
+    0x85,0x2B,0x65,0x23,0x44,0x23,0x24,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x65,0x2B,
+    0x85,0x2B,0x24,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x24,0x23,0x65,0x2B,0x44,0x23,
+    0x82,0x65,0x2B,0x81,0x85,0x2B,0x4C,0x65,0x2B,0x65,0x23,0x24,0x23,0x65,0x2B,0x65,
+    0x23,0x65,0x2B,0x44,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x44,0x23,0x24,0x23,0x24,
+    0x23,0x65,0x2B,0x24,0x23,0x85,0x2B,0x24,0x23,0x24,0x23,0x65,0x2B,0x65,0x2B,0x44,
+    0x23,0x85,0x2B,0x85,0x2B,0x44,0x23,0x24,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x44,
+    0x23,0x24,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x65,0x2B,0x45,0x23,0x44,0x23,0x65,
+    0x2B,0x24,0x23,0x44,0x23,0x65,0x2B,0x85,0x2B,0x44,0x23,0x24,0x23,0x65,0x2B,0x44,
+    0x23,0x24,0x23,0x24,0x23,0x45,0x23,0x65,0x2B,0x44,0x23,0x65,0x23,0x45,0x23,0x45,
+    0x23,0x85,0x2B,0x24,0x23,0x24,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x24,0x23,0x65,
+    0x2B,0x85,0x2B,0x45,0x23,0x45,0x23,0x44,0x23,0x44,0x23,0x65,0x2B,0x24,0x23,0x24,
+    0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0x85,0x2B,0x24,0x23,0x44,0x23,0x24,0x23,0x65,
+    0x23,0x83,0x44,0x23,0x0A,0x24,0x23,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x45,0x23,0x24,
+    0x23,0x65,0x23,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x8F,0x2E,0xD5,0x03,0x24,
+    0x23,0x65,0x23,0x44,0x23,0x44,0x23,0x82,0x85,0x2B,0x81,0x44,0x23,0x22,0x85,0x2B,
+    0x24,0x23,0x85,0x2B,0x65,0x2B,0x45,0x23,0x65,0x2B,0x24,0x23,0x85,0x2B,0x85,0x2B,
+    0x45,0x23,0x65,0x23,0x65,0x2B,0x24,0x23,0x24,0x23,0x44,0x23,0x65,0x23,0x65,0x2B,
+    0x24,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x45,0x23,0x44,0x23,0x65,0x2B,0x44,0x23,
+    0x24,0x23,0x44,0x23,0x44,0x23,0x65,0x23,0x65,0x2B,0x24,0x23,0x24,0x23,0x65,0x23,
+    0x44,0x23,0x85,0x2B,0x83,0x65,0x2B,0x81,0x45,0x23,0x1C,0x65,0x2B,0x45,0x23,0x85,
+    0x2B,0x24,0x23,0x65,0x2B,0x45,0x23,0x24,0x23,0x45,0x23,0x24,0x23,0x24,0x23,0x44,
+    0x23,0x45,0x23,0x65,0x2B,0x45,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x65,0x2B,0x44,
+    0x23,0x65,0x23,0x65,0x2B,0x45,0x23,0x44,0x23,0x65,0x2B,0x85,0x2B,0x24,0x23,0x44,
+    0x23,0x85,0x2B,0x24,0x23,0x89,0x2E,0xD5,0x37,0x65,0x2B,0x85,0x2B,0x65,0x2B,0x85,
+    0x2B,0x44,0x23,0x65,0x2B,0x65,0x2B,0x24,0x23,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x24,
+    0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x24,0x23,0x44,0x23,0x44,
+    0x23,0x85,0x2B,0x24,0x23,0x65,0x23,0x85,0x2B,0x65,0x23,0x24,0x23,0x65,0x2B,0x65,
+    0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x65,0x23,0x65,0x2B,0x85,
+    0x2B,0x85,0x2B,0x44,0x23,0x65,0x2B,0x24,0x23,0x65,0x23,0x85,0x2B,0x24,0x23,0x65,
+    0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x85,0x2B,0x24,0x23,0x65,0x2B,0x24,0x23,0x44,
+    0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x85,0x2B,0x83,0x24,0x23,0x00,0x65,0x2B,0x82,
+    0x44,0x23,0x00,0x24,0x23,0x82,0x65,0x2B,0x81,0x44,0x23,0x09,0x85,0x2B,0x44,0x23,
+    0x85,0x2B,0x44,0x23,0x65,0x2B,0x44,0x23,0x44,0x23,0x65,0x2B,0x44,0x23,0x44,0x23,
+    0x82,0x85,0x2B,0x82,0x44,0x23,0x0A,0x65,0x2B,0x44,0x23,0x85,0x2B,0x44,0x23,0x65,
+    0x2B,0x24,0x23,0x85,0x2B,0x65,0x2B,0x44,0x23,0x85,0x2B,0x85,0x2B,0x83,0x44,0x23,
+    0x02,0x24,0x23,0x44,0x23,0x65,0x23,0x82,0x44,0x23,0x1B,0x65,0x2B,0x85,0x2B,0x65,
+    0x2B,0x24,0x23,0x44,0x23,0x65,0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0x24,0x23,0x65,
+    0x2B,0x44,0x23,0x65,0x23,0x85,0x2B,0x24,0x23,0x85,0x2B,0x44,0x23,0x85,0x2B,0x44,
+    0x23,0x85,0x2B,0x85,0x2B,0x44,0x23,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x44,
+    0x23,0x24,0x23,0x8F,0x2E,0xD5,0x81,0x24,0x23,0x0F,0x44,0x23,0x24,0x23,0x65,0x2B,
+    0x65,0x2B,0x85,0x2B,0x65,0x2B,0x65,0x2B,0x24,0x23,0x65,0x2B,0x44,0x23,0x65,0x2B,
+    0x65,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x24,0x23,0x82,0x44,0x23,0x81,0x65,0x2B,
+    0x85,0x44,0x23,0x82,0x24,0x23,0x81,0x85,0x2B,0x2D,0x65,0x2B,0x24,0x23,0x44,0x23,
+    0x24,0x23,0x44,0x23,0x65,0x2B,0x85,0x2B,0x44,0x23,0x24,0x23,0x44,0x23,0x85,0x2B,
+    0x24,0x23,0x44,0x23,0x24,0x23,0x44,0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x65,0x2B,
+    0x85,0x2B,0x85,0x2B,0x24,0x23,0x65,0x2B,0x85,0x2B,0x24,0x23,0x65,0x2B,0x44,0x23,
+    0x65,0x2B,0x44,0x23,0x65,0x2B,0x24,0x23,0x44,0x23,0x44,0x23,0x24,0x23,0x24,0x23,
+    0x44,0x23,0x44,0x23,0x65,0x2B,0x24,0x23,0x65,0x2B,0x65,0x2B,0x44,0x23,0x44,0x23,
+    0x65,0x23,0x24,0x23,0x65,0x2B,0x87,0x2E,0xD5,0x82,0x44,0x23,0x02,0x65,0x2B,0x65,
+    0x23,0x65,0x23,0x83,0x65,0x2B,0x82,0x44,0x23,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,
+    0x65,0x23,0x44,0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x24,0x23,0x65,0x2B,0x24,0x23,
+    0x64,0x23,0x44,0x23,0x44,0x23,0x64,0x23,0x65,0x23,0x24,0x23,0x65,0x23,0x85,0x2B,
+    0x85,0x2B,0x65,0x2B,0x65,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0x85,0x2B,0x24,0x23,
+    0x44,0x23,0x65,0x2B,0x65,0x23,0x65,0x2B,0x65,0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,
+    0x24,0x23,0x82,0x44,0x23,0x0B,0x85,0x2B,0x65,0x23,0x44,0x23,0x65,0x2B,0x24,0x23,
+    0x85,0x2B,0x44,0x23,0x44,0x23,0x65,0x2B,0x65,0x2B,0x85,0x2B,0x65,0x2B,0x83,0x44,
+    0x23,0x17,0x65,0x2B,0x44,0x23,0x24,0x23,0x85,0x2B,0x65,0x23,0x44,0x23,0x24,0x23,
+    0x44,0x23,0x85,0x2B,0x44,0x23,0x24,0x23,0x85,0x2B,0x85,0x2B,0x65,0x23,0x65,0x2B,
+    0x44,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,
+    0x65,0x23,0x82,0x44,0x23,0x00,0x64,0x23,0x83,0x65,0x2B,0x10,0x85,0x2B,0x64,0x23,
+    0x65,0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x44,0x23,0x65,0x23,0x64,0x23,0x65,0x23,
+    0x85,0x2B,0x85,0x2B,0x44,0x23,0x65,0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0x83,0x85,
+    0x2B,0x09,0x64,0x23,0x44,0x23,0x24,0x23,0x65,0x23,0x85,0x2B,0x65,0x2B,0x24,0x23,
+    0x85,0x2B,0x65,0x2B,0x44,0x23,0x82,0x85,0x2B,0x02,0x44,0x23,0x65,0x2B,0x64,0x23,
+    0x8D,0x2E,0xD5,0x19,0x65,0x2B,0x44,0x23,0x64,0x23,0x85,0x2B,0x24,0x23,0x44,0x23,
+    0x85,0x2B,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x64,0x23,0x44,0x23,0x85,0x2B,0x44,0x23,
+    0x65,0x23,0x85,0x2B,0x44,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x44,0x23,0x65,0x2B,
+    0x85,0x2B,0x65,0x23,0x24,0x23,0x65,0x2B,0x83,0x44,0x23,0x06,0x24,0x23,0x85,0x2B,
+    0x44,0x23,0x64,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x82,0x44,0x23,0x13,0x85,0x2B,
+    0x44,0x23,0x44,0x23,0x65,0x2B,0x64,0x23,0x65,0x23,0x85,0x2B,0x85,0x2B,0x65,0x2B,
+    0x85,0x2B,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0x65,0x2B,
+    0x85,0x2B,0x44,0x23,0x85,0x2B,0x82,0x24,0x23,0x01,0x44,0x23,0x24,0x23,0x82,0x44,
+    0x23,0x81,0x65,0x2B,0x82,0x85,0x2B,0x08,0x64,0x23,0x24,0x23,0x65,0x2B,0x64,0x23,
+    0x44,0x23,0x44,0x23,0x64,0x23,0x85,0x2B,0x85,0x2B,0x84,0x2E,0xD5,0x81,0x24,0x23,
+    0x81,0x65,0x2B,0x01,0x44,0x23,0x65,0x23,0x83,0x44,0x23,0x05,0x65,0x2B,0x44,0x23,
+    0x44,0x23,0x64,0x23,0x44,0x23,0x65,0x2B,0x82,0x85,0x2B,0x81,0x44,0x23,0x09,0x65,
+    0x2B,0x44,0x23,0x64,0x23,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x44,0x23,0x44,0x23,0x85,
+    0x2B,0x85,0x2B,0x82,0x65,0x2B,0x11,0x85,0x2B,0x65,0x2B,0x64,0x23,0x65,0x2B,0x64,
+    0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x44,
+    0x23,0x65,0x2B,0x44,0x23,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0x83,0x85,0x2B,0x11,0x44,
+    0x23,0x64,0x23,0x65,0x2B,0x85,0x2B,0x65,0x2B,0x64,0x23,0x64,0x23,0x85,0x2B,0x65,
+    0x2B,0x65,0x2B,0x85,0x2B,0x65,0x2B,0x64,0x23,0x44,0x23,0x64,0x23,0x85,0x2B,0x85,
+    0x2B,0xA5,0x2B,0x82,0x85,0x2B,0x11,0x44,0x23,0x64,0x23,0x44,0x23,0x85,0x2B,0x44,
+    0x23,0x64,0x23,0x85,0x2B,0x65,0x2B,0x44,0x23,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x85,
+    0x2B,0x64,0x23,0x65,0x2B,0x44,0x23,0x44,0x23,0x65,0x2B,0x83,0x44,0x23,0x00,0x65,
+    0x2B,0x83,0x44,0x23,0x00,0x65,0x2B,0x82,0x85,0x2B,0x1C,0x65,0x2B,0xA5,0x2B,0x44,
+    0x23,0x44,0x23,0x64,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x44,
+    0x23,0x64,0x23,0x85,0x2B,0x65,0x2B,0x44,0x23,0x64,0x23,0x64,0x23,0x65,0x2B,0x85,
+    0x2B,0x65,0x2B,0x64,0x23,0x44,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0x64,
+    0x23,0x65,0x2B,0x65,0x2B,0x82,0x85,0x2B,0x8B,0x4D,0xDD,0x02,0x65,0x2B,0x85,0x2B,
+    0x64,0x23,0x82,0x44,0x23,0x81,0x64,0x23,0x12,0x65,0x2B,0x44,0x23,0x85,0x2B,0x85,
+    0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x85,
+    0x2B,0x44,0x23,0x85,0x2B,0x44,0x23,0x65,0x2B,0x85,0x2B,0x44,0x23,0x64,0x23,0x83,
+    0x85,0x2B,0x07,0x44,0x23,0xA5,0x2B,0x44,0x23,0x64,0x23,0x44,0x23,0x85,0x2B,0x44,
+    0x23,0x85,0x2B,0x82,0x65,0x2B,0x07,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x44,0x23,0x85,
+    0x2B,0x44,0x23,0x44,0x23,0x64,0x23,0x82,0x44,0x23,0x81,0x65,0x2B,0x81,0x85,0x2B,
+    0x0E,0x64,0x23,0x65,0x2B,0x85,0x2B,0x64,0x23,0x65,0x2B,0x64,0x23,0x44,0x23,0x85,
+    0x2B,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x44,0x23,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x85,
+    0x44,0x23,0x04,0x64,0x23,0x44,0x23,0x85,0x2B,0x65,0x2B,0x65,0x2B,0x82,0x85,0x2B,
+    0x28,0x64,0x23,0x85,0x2B,0x85,0x2B,0x64,0x23,0x85,0x2B,0x65,0x2B,0x44,0x23,0x85,
+    0x2B,0x65,0x2B,0x65,0x2B,0x44,0x23,0x44,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x44,
+    0x23,0x85,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0xA5,0x2B,0x65,0x2B,0x85,0x2B,0x44,
+    0x23,0x64,0x23,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x85,
+    0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0xA5,
+    0x2B,0x65,0x2B,0x82,0xA5,0x2B,0x00,0x44,0x23,0x83,0x85,0x2B,0x32,0xA5,0x2B,0x85,
+    0x2B,0x44,0x23,0x65,0x2B,0x65,0x2B,0xA5,0x2B,0x44,0x23,0x85,0x2B,0x44,0x23,0x44,
+    0x23,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x65,0x2B,0xA5,0x2B,0x64,0x23,0x44,0x23,0x65,
+    0x2B,0xA5,0x2B,0x44,0x23,0x44,0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x85,
+    0x2B,0x65,0x2B,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0x64,
+    0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x44,0x23,0xA5,
+    0x2B,0x65,0x2B,0x85,0x2B,0x85,0x2B,0x65,0x2B,0x44,0x23,0x64,0x23,0x44,0x23,0x85,
+    0x2B,0x65,0x2B,0x82,0x85,0x2B,0x03,0x44,0x23,0x85,0x2B,0x85,0x2B,0x44,0x23,0x82,
+    0x85,0x2B,0x1F,0x65,0x2B,0x64,0x23,0x65,0x2B,0x85,0x2B,0xA5,0x2B,0x44,0x23,0xA5,
+    0x2B,0x85,0x2B,0xA5,0x2B,0x64,0x23,0x44,0x23,0x85,0x2B,0x64,0x23,0x65,0x2B,0x64,
+    0x23,0x44,0x23,0x64,0x23,0x44,0x23,0x44,0x23,0x85,0x2B,0xA5,0x2B,0x44,0x23,0x85,
+    0x2B,0x44,0x23,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x44,0x23,0x64,0x23,0x44,
+    0x23,0x44,0x23,0x8B,0x4D,0xDD,0x13,0x44,0x23,0xA5,0x2B,0x44,0x23,0x85,0x2B,0x85,
+    0x2B,0x44,0x23,0x44,0x23,0x64,0x23,0x65,0x2B,0x44,0x23,0x64,0x23,0x44,0x23,0x44,
+    0x23,0xA5,0x2B,0x65,0x2B,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x64,0x23,0x44,0x23,0x82,
+    0x85,0x2B,0x50,0x44,0x23,0x64,0x23,0x85,0x2B,0x65,0x2B,0x85,0x2B,0xA5,0x2B,0xA5,
+    0x2B,0x85,0x2B,0x85,0x2B,0x44,0x23,0x64,0x23,0x85,0x2B,0x44,0x23,0x85,0x2B,0xA5,
+    0x2B,0xA5,0x2B,0x44,0x23,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x44,0x23,0x85,
+    0x2B,0x44,0x23,0x44,0x23,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x64,
+    0x23,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x65,0x2B,0x44,
+    0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x64,0x23,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0x44,
+    0x23,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0x44,0x23,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x44,
+    0x23,0x65,0x2B,0xA5,0x2B,0x85,0x2B,0x44,0x23,0x64,0x23,0x44,0x23,0x64,0x23,0x64,
+    0x23,0xA5,0x2B,0x64,0x23,0x64,0x23,0x85,0x2B,0x44,0x23,0x85,0x2B,0x64,0x23,0x85,
+    0x2B,0x44,0x23,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x2B,0xA5,0x2B,0x64,0x23,0x85,
+    0x2B,0xA5,0x2B,0x64,0x2B,0x82,0x85,0x2B,0x07,0x44,0x23,0x64,0x23,0x44,0x23,0x85,
+    0x2B,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x2B,0x82,0x64,0x23,0x1C,0xA5,0x2B,0x64,
+    0x23,0x85,0x2B,0x64,0x2B,0x64,0x23,0x44,0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0x64,
+    0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0x44,
+    0x23,0x64,0x23,0x44,0x23,0x85,0x2B,0x85,0x2B,0x64,0x23,0x44,0x23,0xA5,0x2B,0x85,
+    0x2B,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x83,0x64,0x23,0x4D,0x64,0x2B,0xA5,0x2B,0x64,
+    0x2B,0x64,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0x44,0x23,0x64,
+    0x23,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x44,0x23,0x64,0x2B,0x44,
+    0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0x44,
+    0x23,0x85,0x2B,0xA5,0x2B,0x64,0x2B,0xA5,0x2B,0x64,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,
+    0x23,0x44,0x23,0x44,0x23,0x85,0x2B,0x64,0x2B,0x85,0x2B,0x64,0x2B,0xA5,0x2B,0xA5,
+    0x2B,0x85,0x2B,0x64,0x2B,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,
+    0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x2B,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x85,
+    0x2B,0x64,0x23,0x85,0x2B,0x85,0x2B,0x64,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x44,
+    0x23,0x44,0x23,0x85,0x2B,0x85,0x2B,0x44,0x23,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x64,
+    0x23,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x89,0x4D,0xDD,0x00,0x64,0x23,0x82,0x85,0x2B,
+    0x81,0x44,0x23,0x2C,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x85,0x2B,
+    0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x44,0x23,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,
+    0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,
+    0x44,0x23,0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x85,0x2B,
+    0x64,0x23,0x85,0x2B,0x64,0x23,0x85,0x2B,0x64,0x2B,0x85,0x2B,0x64,0x2B,0x64,0x23,
+    0x64,0x23,0x44,0x23,0x64,0x23,0x85,0x2B,0x85,0x2B,0x64,0x23,0x85,0x2B,0x84,0x64,
+    0x23,0x32,0xA5,0x2B,0x64,0x2B,0x64,0x23,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,
+    0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0x44,0x23,0x85,0x2B,
+    0x64,0x23,0x64,0x2B,0x44,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0x44,0x23,0x85,0x2B,
+    0xA5,0x2B,0x44,0x23,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x2B,0x64,0x23,0x44,0x23,
+    0x64,0x2B,0x64,0x23,0x85,0x2B,0x64,0x2B,0x85,0x2B,0x85,0x2B,0xA5,0x2B,0x64,0x23,
+    0x85,0x2B,0x44,0x23,0x44,0x23,0x64,0x2B,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x44,0x23,
+    0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x82,0xA5,0x2B,0x07,0x64,0x23,0xA5,0x2B,
+    0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x44,0x23,0x44,0x23,0x82,0x85,0x2B,0x81,
+    0xA5,0x2B,0x30,0x64,0x23,0x85,0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0x64,0x23,0x84,
+    0x2B,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x85,
+    0x2B,0xA5,0x2B,0x64,0x23,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x64,
+    0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x85,
+    0x2B,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x44,0x23,0x64,0x23,0x44,
+    0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x85,
+    0x2B,0xA5,0x2B,0x85,0x2B,0x82,0x64,0x23,0x13,0xA5,0x2B,0x44,0x23,0x85,0x2B,0x64,
+    0x23,0x64,0x23,0x85,0x2B,0x64,0x23,0x64,0x23,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x85,
+    0x2B,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x44,0x23,0xA5,0x2B,0x85,0x2B,0x84,
+    0x2B,0x82,0x64,0x23,0x81,0xA5,0x2B,0x82,0x64,0x23,0x84,0xA5,0x2B,0x81,0x85,0x2B,
+    0x81,0xA5,0x2B,0x08,0x44,0x23,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x44,0x23,0xA5,0x2B,
+    0x44,0x23,0x85,0x2B,0x85,0x2B,0x83,0xA5,0x2B,0x05,0x64,0x23,0x44,0x23,0xA5,0x2B,
+    0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x87,0x4D,0xDD,0x00,0x85,0x2B,0x83,0x64,0x23,0x00,
+    0xA5,0x2B,0x82,0x85,0x2B,0x1E,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x64,0x23,
+    0x85,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,
+    0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x2B,0xA5,0x2B,
+    0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,
+    0xA5,0x2B,0x44,0x23,0x83,0x64,0x23,0x09,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x64,0x23,
+    0xA5,0x2B,0xA5,0x2B,0x44,0x23,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x82,0x64,0x23,0x0F,
+    0xA5,0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0xA5,0x2B,0x44,0x23,0x64,0x23,0xA5,0x2B,
+    0x85,0x2B,0x85,0x2B,0x64,0x23,0x84,0x2B,0x85,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,
+    0x82,0x64,0x23,0x0A,0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,
+    0xA5,0x2B,0x84,0x2B,0x64,0x23,0x85,0x2B,0x44,0x23,0x82,0x64,0x23,0x08,0xA5,0x2B,
+    0x85,0x2B,0x64,0x23,0x85,0x2B,0x64,0x23,0x44,0x23,0x64,0x23,0x84,0x2B,0x44,0x23,
+    0x82,0xA5,0x2B,0x01,0x85,0x2B,0xC5,0x33,0x82,0x85,0x2B,0x1A,0xC5,0x33,0x84,0x2B,
+    0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0xC5,0x33,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x85,0x2B,
+    0x84,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x84,0x2B,
+    0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0x64,0x23,0x85,0x2B,0x64,0x23,0x85,0x2B,
+    0xA5,0x2B,0x82,0x64,0x23,0x28,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,
+    0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,
+    0x85,0x2B,0xC5,0x33,0xC5,0x33,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,
+    0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0xC5,0x33,0x64,0x23,
+    0x64,0x23,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x64,0x23,0x84,0x2B,0x84,0x2B,0x64,0x23,
+    0x64,0x23,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x82,0x64,0x23,0x06,0xA5,0x2B,0x64,0x23,
+    0xA5,0x2B,0x85,0x2B,0x84,0x2B,0xC5,0x33,0xC5,0x33,0x82,0x64,0x23,0x0D,0xC5,0x33,
+    0x64,0x23,0xA5,0x2B,0x85,0x2B,0x64,0x23,0xC5,0x33,0x85,0x2B,0xA5,0x2B,0x85,0x2B,
+    0x64,0x23,0xA5,0x2B,0x64,0x23,0xC5,0x33,0x85,0x2B,0x82,0x64,0x23,0x00,0xA5,0x2B,
+    0x82,0x64,0x23,0x82,0xA5,0x2B,0x11,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x64,0x23,0xC5,
+    0x33,0xC5,0x33,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0x64,
+    0x23,0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0xC5,0x33,0x85,0x4D,0xDD,0x83,0xA5,
+    0x2B,0x81,0x64,0x23,0x81,0xA5,0x2B,0x56,0x64,0x23,0xC5,0x33,0x85,0x2B,0xA5,0x2B,
+    0x85,0x2B,0x84,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0x84,0x2B,
+    0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x64,0x23,0xC5,0x33,0x64,0x23,0x84,0x2B,0xA5,0x2B,
+    0x85,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x84,0x2B,0x84,0x2B,
+    0x64,0x23,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,
+    0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,0x84,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,
+    0xA5,0x2B,0x64,0x23,0x85,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x85,0x2B,
+    0xA5,0x2B,0x64,0x23,0x85,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x2B,
+    0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x64,0x23,0xC5,0x33,0x85,0x2B,
+    0x84,0x2B,0x85,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x64,0x23,
+    0xA5,0x2B,0x85,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0x85,0x2B,0x85,0x2B,0x84,0x2B,
+    0xA5,0x2B,0x85,0x2B,0x64,0x23,0x82,0xA5,0x2B,0x81,0x85,0x2B,0x75,0x64,0x23,0xA5,
+    0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x84,0x23,0xA5,0x2B,0x84,
+    0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0xC5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,
+    0x23,0x84,0x2B,0xA5,0x2B,0x85,0x2B,0xC5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0x64,
+    0x23,0xC5,0x2B,0x85,0x2B,0xA5,0x2B,0x84,0x2B,0x84,0x23,0x64,0x23,0xA5,0x2B,0x85,
+    0x2B,0x84,0x23,0xA5,0x2B,0x84,0x23,0x64,0x23,0x84,0x23,0x84,0x23,0xA5,0x2B,0xA5,
+    0x2B,0x84,0x2B,0xA5,0x2B,0xC5,0x2B,0x84,0x2B,0xA5,0x2B,0xC5,0x33,0xC5,0x33,0xA5,
+    0x2B,0xA5,0x2B,0xC5,0x33,0xA5,0x2B,0x84,0x23,0xC5,0x33,0x84,0x23,0x84,0x2B,0x64,
+    0x23,0xC5,0x33,0xA5,0x2B,0x64,0x23,0xC5,0x33,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x64,
+    0x23,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x85,
+    0x2B,0xC5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0xC5,0x33,0xC5,0x2B,0x64,0x23,0x84,
+    0x2B,0xA5,0x2B,0xC5,0x2B,0x84,0x2B,0xA5,0x2B,0xC5,0x2B,0x84,0x23,0x85,0x2B,0xA5,
+    0x2B,0xC5,0x33,0x64,0x23,0x85,0x2B,0x84,0x2B,0x64,0x23,0x84,0x2B,0x84,0x23,0xA5,
+    0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x64,0x23,0xA5,0x2B,0xC5,0x33,0xC5,
+    0x33,0x85,0x2B,0x84,0x2B,0xC5,0x2B,0x64,0x23,0x84,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,
+    0x23,0xC5,0x2B,0x84,0x2B,0x84,0x2B,0x84,0x23,0x82,0x64,0x23,0x32,0xC5,0x2B,0x64,
+    0x23,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xC5,0x2B,0x64,0x23,0x84,0x2B,0xC5,0x33,0xA5,
+    0x2B,0xA5,0x2B,0x84,0x2B,0x64,0x23,0xC5,0x2B,0xA5,0x2B,0x84,0x23,0x64,0x23,0x64,
+    0x23,0xC5,0x33,0x85,0x2B,0x84,0x2B,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0x64,0x23,0x85,
+    0x2B,0x64,0x23,0x84,0x2B,0xC5,0x2B,0x85,0x2B,0xC5,0x33,0x84,0x23,0x84,0x23,0xA5,
+    0x2B,0xA5,0x2B,0x85,0x2B,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x64,0x23,0xC5,0x33,0x64,
+    0x23,0xC5,0x33,0xA5,0x2B,0xC5,0x2B,0xC5,0x33,0x64,0x23,0x84,0x2B,0x64,0x23,0xA5,
+    0x2B,0x84,0x23,0x82,0xA5,0x2B,0x81,0x64,0x23,0x0F,0x85,0x2B,0x64,0x23,0xA5,0x2B,
+    0xC5,0x2B,0xC5,0x2B,0x84,0x2B,0x84,0x23,0x64,0x23,0x64,0x23,0xA5,0x2B,0xC5,0x2B,
+    0x64,0x23,0x64,0x23,0xC5,0x33,0x64,0x23,0xA5,0x2B,0x82,0x84,0x2B,0x81,0x64,0x23,
+    0x3C,0xC5,0x2B,0x64,0x23,0x64,0x23,0xC5,0x33,0xA5,0x2B,0xC5,0x2B,0x85,0x2B,0xC5,
+    0x2B,0x85,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x85,0x2B,0x85,0x2B,0xC5,0x33,0x84,
+    0x2B,0xC5,0x33,0xA5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x2B,0x64,
+    0x23,0x84,0x2B,0x84,0x23,0xC5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,0xC5,0x33,0x64,
+    0x23,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0xC5,0x33,0xA5,0x2B,0x84,0x23,0x64,
+    0x23,0xC5,0x2B,0x85,0x2B,0xC5,0x33,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,
+    0x2B,0xA5,0x2B,0x84,0x2B,0x84,0x23,0xC5,0x33,0x84,0x2B,0x84,0x23,0x64,0x23,0x84,
+    0x2B,0x84,0x2B,0x64,0x23,0x64,0x23,0xC5,0x33,0xA5,0x2B,0x82,0x84,0x2B,0x00,0xC5,
+    0x33,0x82,0xA5,0x2B,0x82,0xC5,0x33,0x1A,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,
+    0x84,0x23,0x84,0x23,0xA5,0x2B,0x64,0x23,0x84,0x2B,0x84,0x23,0xC5,0x2B,0xA5,0x2B,
+    0xA5,0x2B,0x64,0x23,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x64,0x23,0xC5,0x2B,
+    0xC5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0x83,0xA5,
+    0x2B,0x26,0xC5,0x2B,0x64,0x23,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0xC5,0x33,
+    0xA5,0x2B,0x84,0x2B,0xC5,0x33,0x64,0x23,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x84,0x2B,
+    0x84,0x2B,0xA5,0x2B,0xC5,0x2B,0xC5,0x2B,0x84,0x23,0x84,0x2B,0x84,0x2B,0xC5,0x33,
+    0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x23,0xA5,0x2B,0x84,0x2B,0x64,0x23,0xC5,0x2B,
+    0x64,0x23,0x84,0x2B,0xC5,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x23,0xC5,0x33,0xC5,0x2B,
+    0x82,0xA5,0x2B,0x21,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x23,0xA5,0x2B,
+    0xC5,0x33,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0x64,0x23,0xA5,0x2B,
+    0xA5,0x2B,0x84,0x23,0xC5,0x2B,0xC5,0x33,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,
+    0x64,0x23,0xA5,0x2B,0xC5,0x33,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x84,0x23,0x64,0x23,
+    0xC5,0x33,0x84,0x2B,0x84,0x2B,0x64,0x23,0x82,0x84,0x2B,0x03,0xC5,0x33,0xA5,0x2B,
+    0xA5,0x2B,0xC5,0x2B,0x82,0xA5,0x2B,0x0F,0x84,0x23,0xC5,0x33,0x84,0x2B,0x64,0x23,
+    0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0xC5,0x2B,0x84,0x23,0xA5,0x2B,0x64,0x23,
+    0xC5,0x33,0x64,0x23,0x84,0x23,0xA5,0x2B,0x83,0x84,0x2B,0x0E,0xC5,0x33,0x84,0x23,
+    0x64,0x23,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0xA5,0x2B,0x64,0x23,
+    0xC5,0x2B,0xA5,0x2B,0x64,0x23,0xC5,0x33,0xC5,0x2B,0x82,0x84,0x2B,0x18,0xC5,0x2B,
+    0xC5,0x33,0xA5,0x2B,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xC5,0x2B,
+    0x64,0x23,0xA5,0x2B,0xC5,0x2B,0xC5,0x2B,0x64,0x23,0xC5,0x33,0x64,0x23,0xA5,0x2B,
+    0x64,0x23,0x84,0x2B,0x64,0x23,0xC5,0x2B,0x64,0x23,0x84,0x2B,0xA5,0x2B,0x64,0x23,
+    0x84,0x84,0x2B,0x81,0xA5,0x2B,0x55,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0xC5,0x33,0xA5,
+    0x2B,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x64,0x23,0xC5,0x33,0x64,0x23,0x64,
+    0x23,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xC5,0x33,0x84,0x2B,0xA5,
+    0x2B,0x84,0x23,0xC5,0x2B,0xA5,0x2B,0xC5,0x2B,0xA5,0x2B,0xA5,0x2B,0xC5,0x33,0xA5,
+    0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x64,0x23,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0xA5,
+    0x2B,0xA4,0x2B,0xC5,0x33,0x84,0x23,0xC5,0x2B,0xC5,0x33,0xC5,0x33,0xC5,0x2B,0xC5,
+    0x33,0x84,0x23,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0x64,
+    0x23,0xC5,0x33,0x84,0x23,0xC5,0x33,0xC5,0x33,0xC5,0x2B,0xA5,0x2B,0xA5,0x2B,0xA4,
+    0x2B,0xA5,0x2B,0x84,0x23,0xC5,0x33,0x84,0x23,0xA5,0x2B,0xC5,0x33,0x84,0x23,0x64,
+    0x23,0xC5,0x2B,0xC5,0x33,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0xC5,0x33,0xA5,
+    0x2B,0xC5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x23,0x64,0x23,0xC5,0x33,0xA5,
+    0x2B,0xA5,0x2B,0x82,0xC5,0x2B,0x29,0xA4,0x2B,0xA5,0x2B,0xC5,0x33,0xA4,0x2B,0x84,
+    0x2B,0xC5,0x33,0x84,0x2B,0x84,0x2B,0xC5,0x2B,0xA5,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,
+    0x2B,0xC5,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x23,0x84,
+    0x23,0xA4,0x2B,0xA5,0x2B,0xC5,0x2B,0xC5,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,
+    0x2B,0xA4,0x2B,0x84,0x2B,0x84,0x23,0x84,0x23,0x84,0x2B,0xC5,0x33,0x84,0x2B,0xA5,
+    0x2B,0x64,0x23,0xC5,0x2B,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0x83,0x84,0x23,0x1F,0xA5,
+    0x2B,0xC5,0x2B,0xC5,0x33,0xA5,0x2B,0xC5,0x33,0xC5,0x33,0x84,0x2B,0x84,0x2B,0xC5,
+    0x2B,0xA5,0x2B,0x84,0x2B,0x64,0x23,0x84,0x2B,0x84,0x23,0x84,0x23,0xC5,0x33,0xA5,
+    0x2B,0x84,0x2B,0xC5,0x33,0xC5,0x2B,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0x64,
+    0x23,0xC5,0x2B,0xC5,0x33,0xC5,0x2B,0x84,0x23,0x84,0x23,0xC5,0x33,0x84,0x23,0x82,
+    0xA5,0x2B,0x28,0x84,0x23,0x64,0x23,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x2B,0x64,
+    0x23,0x84,0x2B,0xC5,0x33,0xA5,0x2B,0x64,0x23,0xA4,0x2B,0x84,0x2B,0xA5,0x2B,0xC5,
+    0x2B,0x84,0x2B,0x84,0x2B,0xC5,0x33,0x84,0x2B,0x84,0x23,0x84,0x2B,0xA5,0x2B,0xA4,
+    0x2B,0xA5,0x2B,0x84,0x23,0xC5,0x33,0x64,0x23,0x84,0x23,0x84,0x23,0xA5,0x2B,0xA4,
+    0x2B,0xA4,0x2B,0xC5,0x33,0xA5,0x2B,0x84,0x23,0x84,0x2B,0x64,0x23,0xC5,0x33,0x84,
+    0x2B,0x64,0x23,0xA5,0x2B,0x82,0xC5,0x2B,0x00,0x64,0x23,0x82,0xA5,0x2B,0x12,0xC5,
+    0x33,0x64,0x23,0xC5,0x33,0xC5,0x2B,0xA5,0x2B,0xA5,0x2B,0x84,0x23,0x84,0x23,0xC5,
+    0x2B,0xC5,0x2B,0x64,0x23,0xC5,0x33,0xA5,0x2B,0x84,0x23,0xA5,0x2B,0x84,0x2B,0xA4,
+    0x2B,0xC5,0x2B,0x64,0x23,0x82,0xA5,0x2B,0x0A,0xA4,0x2B,0x84,0x2B,0x64,0x23,0x84,
+    0x23,0xA5,0x2B,0xA5,0x2B,0x84,0x2B,0xA5,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,0x23,0x83,
+    0xA5,0x2B,0x7D,0x84,0x2B,0xC5,0x33,0x84,0x23,0x64,0x23,0xA5,0x2B,0x84,0x23,0xA4,
+    0x2B,0xC5,0x33,0xC5,0x33,0x84,0x2B,0x84,0x23,0xA5,0x2B,0xA4,0x2B,0x84,0x23,0xC5,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x33,0x84,0x23,0x84,0x2B,0xC5,0x2B,0xA4,
+    0x2B,0x84,0x2B,0x84,0x2B,0xA4,0x2B,0xE5,0x33,0x84,0x23,0x84,0x2B,0xC5,0x33,0xE5,
+    0x33,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0x84,0x23,0xA5,0x2B,0xC5,0x2B,0xA5,0x2B,0xC5,
+    0x2B,0xA5,0x2B,0xA5,0x2B,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x33,0xC5,0x2B,0xA5,
+    0x2B,0xE5,0x33,0x84,0x2B,0xC5,0x33,0x84,0x2B,0x84,0x23,0x84,0x2B,0xA4,0x2B,0x84,
+    0x2B,0xC5,0x33,0xC5,0x33,0x84,0x2B,0x84,0x2B,0xE5,0x33,0x84,0x2B,0xC5,0x33,0x84,
+    0x2B,0xA5,0x2B,0xE5,0x33,0x84,0x2B,0x84,0x23,0xA5,0x2B,0xC5,0x2B,0xC5,0x2B,0xA5,
+    0x2B,0xA5,0x2B,0xC5,0x2B,0xC5,0x33,0xC5,0x33,0xA5,0x2B,0xC5,0x2B,0xC5,0x33,0xC5,
+    0x2B,0xC5,0x33,0xC5,0x33,0xA5,0x2B,0xA5,0x2B,0xA4,0x2B,0xA5,0x2B,0x84,0x2B,0xC5,
+    0x33,0xC5,0x33,0x84,0x2B,0xA5,0x2B,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0x84,
+    0x2B,0xA5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0xC5,0x33,0xC5,0x33,0x84,
+    0x23,0xA4,0x2B,0xC5,0x33,0x84,0x2B,0xC5,0x33,0x84,0x2B,0xA4,0x2B,0xC5,0x2B,0xE5,
+    0x33,0xC5,0x33,0xC5,0x2B,0xE5,0x33,0xA5,0x2B,0xA4,0x2B,0x84,0x2B,0xE5,0x33,0xC5,
+    0x2B,0xC5,0x33,0xC5,0x33,0x84,0x23,0xC5,0x33,0xC5,0x2B,0xA5,0x2B,0xC5,0x33,0x83,
+    0x84,0x23,0x7F,0xC5,0x33,0x84,0x23,0x84,0x23,0x84,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,
+    0x23,0x84,0x2B,0xA5,0x2B,0xA4,0x2B,0xC5,0x33,0xA4,0x2B,0xC5,0x33,0xA4,0x2B,0x84,
+    0x2B,0xC5,0x33,0x84,0x2B,0xA5,0x2B,0x84,0x23,0xA4,0x2B,0x84,0x23,0xA5,0x2B,0xA5,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0x84,0x23,0x84,0x23,0xC5,0x33,0x84,0x23,0x84,0x2B,0xA5,
+    0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x33,0x84,0x2B,0x84,0x2B,0x84,0x23,0xC5,0x33,0x84,
+    0x2B,0xA5,0x2B,0xC5,0x2B,0x84,0x23,0xA4,0x2B,0xC5,0x33,0xE5,0x33,0xC5,0x2B,0xA4,
+    0x2B,0xC5,0x33,0xA4,0x2B,0xE5,0x33,0x84,0x2B,0xA5,0x2B,0x84,0x23,0x84,0x23,0xA4,
+    0x2B,0x84,0x2B,0xE5,0x33,0x84,0x23,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0x84,0x2B,0xA4,
+    0x2B,0x84,0x23,0x84,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x33,0xC5,0x2B,0xA5,0x2B,0xA5,
+    0x2B,0x84,0x2B,0x84,0x23,0x84,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x33,0x84,0x2B,0x84,
+    0x2B,0xE5,0x33,0xC5,0x33,0x84,0x2B,0x84,0x2B,0xC5,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,
+    0x23,0x84,0x23,0x84,0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x33,0xC5,0x33,0x84,0x2B,0xA4,
+    0x2B,0x84,0x23,0x84,0x23,0xA4,0x2B,0x84,0x2B,0xA5,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,
+    0x2B,0x84,0x2B,0xA4,0x2B,0x84,0x2B,0xA4,0x2B,0xC5,0x2B,0x84,0x23,0xA4,0x2B,0xC5,
+    0x2B,0x84,0x23,0xE5,0x33,0xE5,0x33,0x84,0x2B,0xA5,0x2B,0xA5,0x2B,0xC5,0x33,0xE5,
+    0x33,0x84,0x23,0x84,0x23,0xE5,0x33,0xA5,0x2B,0xC5,0x2B,0xC5,0x33,0x84,0x23,0xA4,
+    0x2B,0xE5,0x33,0x81,0xC5,0x2B,0x20,0xA4,0x2B,0x84,0x2B,0xA4,0x2B,0xC5,0x2B,0xC5,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,0x33,0xC5,0x2B,0xC5,0x33,0xA4,0x2B,0x84,
+    0x2B,0xA5,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xA4,
+    0x2B,0x84,0x23,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0x84,0x23,0xE5,0x33,0x84,0x23,0xA4,
+    0x2B,0xA5,0x2B,0xA4,0x2B,0xE5,0x33,0xA5,0x2B,0x82,0xC5,0x2B,0x1E,0xC5,0x33,0xC5,
+    0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x33,0xC5,0x33,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xA4,
+    0x2B,0xC5,0x33,0xA4,0x2B,0x84,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,0x33,0x84,0x23,0xE5,
+    0x33,0xE5,0x33,0xA5,0x2B,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0x84,0x23,0xE5,0x33,0xC5,
+    0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA5,0x2B,0x82,0xA4,0x2B,0x49,0xC5,
+    0x33,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x33,0xA4,0x2B,0xC5,0x2B,0xA4,
+    0x2B,0xA4,0x2B,0x84,0x2B,0xE5,0x33,0xC5,0x33,0xE5,0x33,0x84,0x23,0x84,0x23,0xA4,
+    0x2B,0xE5,0x33,0x84,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xA5,0x2B,0xC5,0x2B,0xC5,
+    0x2B,0xE5,0x33,0xC5,0x33,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0x84,
+    0x23,0xA4,0x2B,0x84,0x2B,0xA4,0x2B,0xA5,0x2B,0x84,0x2B,0xE5,0x33,0xA5,0x2B,0xA5,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0x84,0x23,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,
+    0x2B,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xA4,
+    0x2B,0x84,0x23,0x84,0x23,0xA5,0x2B,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x33,0xE5,
+    0x33,0xC5,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xA5,
+    0x2B,0xE5,0x33,0x83,0xC5,0x2B,0x04,0xA4,0x2B,0x84,0x2B,0xC5,0x2B,0x84,0x23,0xA5,
+    0x2B,0x83,0xA4,0x2B,0x24,0xE5,0x33,0x84,0x23,0xC5,0x2B,0x84,0x2B,0xA5,0x2B,0xA5,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0x84,0x2B,0x84,0x23,0xA4,0x2B,0xA4,
+    0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0x84,0x2B,0xC5,0x2B,0xA5,0x2B,0x84,0x23,0x84,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0x84,0x2B,0x84,0x2B,0xA5,0x2B,0x84,0x23,0xC5,0x2B,0xC5,
+    0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0x84,0x23,0xA5,0x2B,0x84,0x23,0x82,
+    0xE5,0x33,0x0C,0xA4,0x2B,0xA5,0x2B,0xC5,0x2B,0x84,0x23,0xC5,0x33,0xC5,0x2B,0xA5,
+    0x2B,0xE5,0x33,0xA5,0x2B,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0x84,0x23,0x82,0xA4,0x2B,
+    0x10,0xC5,0x2B,0x84,0x23,0x84,0x2B,0xC5,0x2B,0x84,0x23,0xA4,0x2B,0xA4,0x2B,0xE5,
+    0x33,0x84,0x23,0x84,0x2B,0xA4,0x2B,0xE5,0x33,0xA5,0x2B,0xC5,0x2B,0xE5,0x33,0x84,
+    0x2B,0x84,0x23,0x82,0xC5,0x2B,0x24,0x84,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,
+    0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,0xC5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,
+    0x2B,0xC5,0x2B,0x84,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xE5,0x33,0x84,0x2B,0xA4,
+    0x2B,0xC5,0x33,0xC5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,
+    0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0x84,0x23,0x84,0x2B,0xA4,
+    0x2B,0x83,0xE5,0x33,0x03,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0x82,0xA4,0x2B,
+    0x83,0xC5,0x2B,0x81,0xA4,0x2B,0x1C,0xC5,0x33,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,
+    0x33,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,
+    0x2B,0xC5,0x33,0xC5,0x2B,0xC5,0x33,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xC5,
+    0x2B,0x82,0xA4,0x2B,0x0B,0xE5,0x33,0x84,0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x33,0xC5,
+    0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0x82,0xA4,0x2B,
+    0x0F,0xC5,0x33,0x84,0x23,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0x84,0x2B,0xA4,0x2B,0xC5,
+    0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,0x84,0x23,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0xC5,
+    0x2B,0x83,0xA4,0x2B,0x22,0xE5,0x33,0xC5,0x2B,0x84,0x2B,0x84,0x2B,0xE5,0x33,0xA4,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,0xA4,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,
+    0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x2B,0x84,0x2B,0xA4,
+    0x2B,0x84,0x23,0xC5,0x33,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0x82,0xA4,0x2B,0x1A,0xC5,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0x84,0x2B,0xE5,
+    0x33,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x33,0x84,0x2B,0xC5,
+    0x33,0xE5,0x33,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0xA4,0x2B,0x84,0x2B,0xC5,0x2B,0xC5,
+    0x2B,0xA4,0x2B,0xC5,0x2B,0x82,0xA4,0x2B,0x08,0xC5,0x2B,0x84,0x23,0x84,0x2B,0xC5,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x2B,0xE5,0x33,0x84,0xA4,0x2B,0x00,0xC5,
+    0x2B,0x83,0xA4,0x2B,0x83,0xE5,0x33,0x08,0xA4,0x2B,0xC5,0x33,0x84,0x23,0xC5,0x33,
+    0xC5,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0x82,0xC5,0x2B,0x0F,0xA4,0x2B,
+    0xC5,0x2B,0xC5,0x2B,0x84,0x2B,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0x84,0x2B,
+    0xE5,0x33,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,0x33,0xC5,0x2B,0xC4,0x2B,0x82,0xA4,
+    0x2B,0x01,0xE5,0x33,0xA4,0x2B,0x82,0xC5,0x2B,0x0A,0xC4,0x2B,0xC5,0x2B,0xC5,0x2B,
+    0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,
+    0x82,0xE5,0x33,0x0F,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,
+    0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xC5,0x2B,
+    0xE5,0x33,0xE5,0x33,0x82,0xA4,0x2B,0x11,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xE5,0x33,
+    0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xC4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,
+    0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0x82,0xC5,0x2B,0x3F,
+    0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,
+    0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0x84,0x23,
+    0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0x84,0x23,0x84,0x23,0xC4,0x2B,
+    0xC4,0x2B,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0x84,0x23,0xC5,0x2B,
+    0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0x84,0x23,0x84,0x23,
+    0xA4,0x2B,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xC4,0x2B,0xA4,0x2B,
+    0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,
+    0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0x84,0x23,0xA4,0x2B,
+    0x82,0xC5,0x2B,0x20,0xE5,0x33,0xC4,0x2B,0xC5,0x2B,0xE5,0x33,0xC5,0x2B,0xC5,0x2B,
+    0x84,0x23,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0x84,0x23,
+    0xE5,0x33,0xC5,0x2B,0xC4,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,
+    0xC5,0x2B,0xA4,0x2B,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,0x33,0xC5,0x2B,
+    0xC4,0x2B,0xA4,0x2B,0xA4,0x2B,0x82,0xE5,0x33,0x07,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xC5,0x2B,0xC5,0x2B,0xC4,0x2B,0xC5,0x2B,0xE5,0x33,0x84,0xC5,0x2B,0x81,0x84,0x23,
+    0x0B,0xC5,0x2B,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xC4,0x2B,0xA4,
+    0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0x82,0xA4,0x2B,0x0E,0xC5,0x2B,0xE5,
+    0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xC4,
+    0x2B,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0xE5,0x33,0x83,0xC5,0x2B,0x05,0xE5,
+    0x33,0xA4,0x2B,0xA4,0x2B,0x84,0x23,0xA4,0x2B,0xC5,0x2B,0x87,0xA4,0x2B,0x00,0xC5,
+    0x2B,0x84,0xE5,0x33,0x17,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xC5,
+    0x2B,0xE5,0x33,0xA4,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xA4,
+    0x2B,0x05,0x34,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,0xC4,
+    0x2B,0xC5,0x2B,0xA4,0x2B,0x82,0xC4,0x2B,0x82,0xA4,0x2B,0x10,0xC4,0x2B,0xA4,0x2B,
+    0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xC4,0x2B,0xA4,0x2B,
+    0xE5,0x33,0x05,0x34,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0x83,0xA4,
+    0x2B,0x0D,0xC5,0x2B,0xA4,0x2B,0xA4,0x2B,0xC5,0x2B,0xC4,0x2B,0xA4,0x2B,0xC5,0x2B,
+    0xE5,0x33,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0x82,0xE5,
+    0x33,0x82,0xA4,0x2B,0x81,0xC5,0x2B,0x0A,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,
+    0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x33,0xC5,0x2B,0xC4,0x2B,0x82,0xA4,
+    0x2B,0x04,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xC4,0x2B,0x83,0xA4,0x2B,0x05,
+    0xC4,0x2B,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xC5,0x2B,0x83,0xE5,0x33,0x02,
+    0xC5,0x2B,0xC4,0x2B,0xE5,0x33,0x82,0xA4,0x2B,0x08,0xC4,0x2B,0xE5,0x33,0xE5,0x33,
+    0xA4,0x2B,0x05,0x34,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,0x82,0xC5,0x2B,0x02,
+    0xC4,0x2B,0xE5,0x33,0xE5,0x33,0x85,0xA4,0x2B,0x21,0xE5,0x33,0xC4,0x2B,0xE5,0x33,
+    0xC4,0x2B,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xE5,0x33,
+    0xC4,0x2B,0x05,0x34,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,
+    0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0x05,0x34,0xA4,0x2B,0xA4,0x2B,0xC5,0x2B,
+    0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0x83,0xE5,
+    0x33,0x81,0xC5,0x2B,0x81,0xA4,0x2B,0x5F,0xE5,0x33,0xC4,0x2B,0xC5,0x2B,0xC5,0x2B,
+    0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xC4,0x2B,
+    0xC4,0x2B,0x05,0x34,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xC4,0x2B,0xC5,0x2B,
+    0xE5,0x33,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,
+    0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0x05,0x34,0xC4,0x2B,0xC4,0x2B,
+    0xE5,0x33,0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,
+    0xA4,0x2B,0x05,0x34,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0x05,0x34,0xA4,0x2B,
+    0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0xC5,0x2B,
+    0xC4,0x2B,0xE5,0x33,0x05,0x34,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0xA4,0x2B,0x05,0x34,
+    0xE5,0x33,0xA4,0x2B,0x05,0x34,0xE5,0x33,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xC4,0x2B,
+    0xE5,0x2B,0xE5,0x2B,0xC5,0x2B,0x05,0x34,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,
+    0xA4,0x2B,0xE5,0x33,0x05,0x34,0xE5,0x33,0x82,0x05,0x34,0x17,0xC4,0x2B,0xA4,0x2B,
+    0xC5,0x2B,0x05,0x34,0xE5,0x33,0xC5,0x2B,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xA4,0x2B,0xC5,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x2B,
+    0xA4,0x2B,0xE5,0x33,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0xC5,0x2B,0x82,0xE5,0x33,0x81,
+    0xC4,0x2B,0x4E,0x05,0x34,0xE5,0x33,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0xC5,0x2B,0xA4,
+    0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x33,0xC5,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0xC4,
+    0x2B,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xA4,0x2B,0x05,
+    0x34,0xC4,0x2B,0xC5,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0x05,0x34,0x05,
+    0x34,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xC5,0x2B,0xC4,0x2B,0xC4,0x2B,0x05,
+    0x34,0xC5,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,
+    0x2B,0xA4,0x2B,0xE5,0x2B,0xE5,0x33,0x05,0x34,0xC5,0x2B,0xC5,0x2B,0x05,0x34,0xC4,
+    0x2B,0xA4,0x2B,0xE5,0x2B,0xE5,0x2B,0xE5,0x33,0xA4,0x2B,0xC4,0x2B,0x05,0x34,0x05,
+    0x34,0xA4,0x2B,0x05,0x34,0xE5,0x33,0xC4,0x2B,0xC5,0x2B,0xC4,0x2B,0xC4,0x2B,0x05,
+    0x34,0xE5,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0xA4,
+    0x2B,0x82,0x05,0x34,0x03,0xC4,0x2B,0x05,0x34,0x05,0x34,0xA4,0x2B,0x83,0xC4,0x2B,
+    0x0D,0xE5,0x33,0xA4,0x2B,0xE5,0x2B,0xC4,0x2B,0xC4,0x2B,0x05,0x34,0xA4,0x2B,0x05,
+    0x34,0xE5,0x33,0xA4,0x2B,0xC5,0x2B,0xE5,0x33,0xC4,0x2B,0xC4,0x2B,0x82,0xE5,0x33,
+    0x04,0xC5,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x2B,0x82,0xA4,0x2B,0x09,0xE5,
+    0x33,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,
+    0x33,0x05,0x34,0x82,0xC4,0x2B,0x14,0xA4,0x2B,0xC5,0x2B,0xC5,0x2B,0xE5,0x33,0xE5,
+    0x33,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0xE5,0x2B,0xA4,0x2B,0xC5,0x2B,0xC4,0x2B,0x05,
+    0x34,0xC4,0x2B,0xE5,0x2B,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xE5,
+    0x33,0x82,0xA4,0x2B,0x81,0xC4,0x2B,0x1C,0xE5,0x2B,0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,
+    0xE5,0x2B,0xA4,0x2B,0xA4,0x2B,0xE5,0x33,0xE5,0x2B,0xA4,0x2B,0x05,0x34,0xA4,0x2B,
+    0xA4,0x2B,0xE5,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x2B,0xC5,0x2B,0xE5,0x2B,0xC4,0x2B,
+    0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xA4,0x2B,
+    0x05,0x34,0x82,0xE5,0x33,0x14,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x33,0x05,0x34,
+    0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,
+    0x05,0x34,0xE5,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0xE5,0x33,0x05,0x34,0xE5,0x33,
+    0x82,0xC4,0x2B,0x07,0xE5,0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x2B,0x05,0x34,0xC4,0x2B,
+    0x05,0x34,0xA4,0x2B,0x82,0x05,0x34,0x0F,0xA4,0x2B,0xC4,0x2B,0x05,0x34,0xC4,0x2B,
+    0xE5,0x33,0xE5,0x33,0xE5,0x2B,0xA4,0x2B,0xE5,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x33,
+    0xA4,0x2B,0xC4,0x2B,0xA4,0x2B,0xE5,0x2B,0x82,0xE5,0x33,0x04,0xC4,0x2B,0xE5,0x33,
+    0x05,0x34,0xA4,0x2B,0xC4,0x2B,0x82,0xE5,0x33,0x81,0xC4,0x2B,0x0B,0xE5,0x33,0xA4,
+    0x2B,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0xE5,0x33,0x05,0x34,0x05,
+    0x34,0xE5,0x33,0xE5,0x33,0x82,0xC4,0x2B,0x02,0xE5,0x2B,0xE5,0x33,0xC4,0x2B,0x82,
+    0xE5,0x33,0x13,0x05,0x34,0xC4,0x2B,0x05,0x34,0xE5,0x2B,0x05,0x34,0x05,0x34,0xE5,
+    0x33,0xE5,0x33,0xA4,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0xC4,0x2B,0xE5,
+    0x33,0x05,0x34,0xC4,0x2B,0xE5,0x2B,0xE5,0x33,0x05,0x34,0x82,0xA4,0x2B,0x1A,0x05,
+    0x34,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x33,0xC4,
+    0x2B,0xE5,0x33,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0x05,0x34,0xC4,
+    0x2B,0xE5,0x33,0x05,0x34,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0xE5,0x2B,0xC4,0x2B,0x05,
+    0x34,0xC4,0x2B,0xA4,0x2B,0x82,0xE5,0x33,0x81,0xC4,0x2B,0x30,0xE5,0x2B,0xA4,0x2B,
+    0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x2B,0x05,0x34,
+    0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x2B,0x05,0x34,0xE5,0x33,0xC4,0x2B,0xE5,0x2B,
+    0xE5,0x33,0xE5,0x2B,0xA4,0x2B,0xC4,0x2B,0xE5,0x33,0xA4,0x2B,0x05,0x34,0xC4,0x2B,
+    0xA4,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0xE5,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xC4,0x2B,0xE5,0x33,0x05,0x34,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xE5,0x33,0x05,0x34,0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0x05,0x34,0x05,0x34,0x82,0xC4,
+    0x2B,0x0C,0xE5,0x33,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xA4,0x2B,0x05,0x34,0xC4,0x2B,
+    0x05,0x34,0xC4,0x2B,0x05,0x34,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0x82,0x05,0x34,0x38,
+    0xE5,0x2B,0x05,0x34,0x05,0x34,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0x05,0x34,
+    0xE5,0x33,0xE5,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x33,0xE5,0x33,0x05,0x34,0xE5,0x33,
+    0x05,0x34,0xC4,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0xE5,0x2B,
+    0xA4,0x2B,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xE5,0x2B,0xE5,0x2B,0xE5,0x33,0xE5,0x2B,
+    0x05,0x34,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0xA4,0x2B,0xE5,0x2B,0xC4,0x2B,
+    0xE5,0x33,0x05,0x34,0xC4,0x2B,0xE5,0x2B,0xE5,0x33,0x05,0x34,0xE5,0x33,0x05,0x34,
+    0x05,0x34,0xE5,0x33,0x05,0x34,0xE5,0x33,0x05,0x34,0xE4,0x2B,0x05,0x34,0xC4,0x2B,
+    0xE5,0x2B,0x82,0x05,0x34,0x09,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xE4,0x2B,0xE4,0x2B,
+    0xC4,0x2B,0xE5,0x2B,0x05,0x34,0x05,0x34,0xE5,0x33,0x85,0xC4,0x2B,0x0E,0x05,0x34,
+    0xE5,0x2B,0x05,0x34,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xC4,0x2B,0xA4,0x2B,0xE5,0x2B,
+    0xE4,0x2B,0xE5,0x2B,0xE5,0x33,0xE5,0x2B,0xC4,0x2B,0xA4,0x2B,0x83,0xC4,0x2B,0x00,
+    0xE4,0x2B,0x82,0x05,0x34,0x15,0xE5,0x33,0x05,0x34,0xC4,0x2B,0x05,0x34,0x05,0x34,
+    0xE5,0x33,0xE5,0x2B,0x05,0x34,0xC4,0x2B,0xE4,0x2B,0x05,0x34,0xE4,0x2B,0xC4,0x2B,
+    0xC4,0x2B,0xE5,0x33,0xE5,0x2B,0x05,0x34,0xE4,0x2B,0xA4,0x2B,0x05,0x34,0x05,0x34,
+    0xC4,0x2B,0x82,0x05,0x34,0x1D,0xC4,0x2B,0x05,0x34,0x05,0x34,0xC4,0x2B,0xC4,0x2B,
+    0xE4,0x2B,0xC4,0x2B,0x05,0x34,0xE5,0x33,0xE5,0x33,0x05,0x34,0xE5,0x2B,0xC4,0x2B,
+    0xA4,0x2B,0xE5,0x2B,0xE4,0x2B,0xC4,0x2B,0xE4,0x2B,0xC4,0x2B,0xC4,0x2B,0xE5,0x2B,
+    0xC4,0x2B,0xE5,0x2B,0x05,0x34,0xE5,0x33,0xE5,0x33,0xC4,0x2B,0x05,0x34,0x05,0x34,
+    0xE5,0x33,0x82,0xC4,0x2B,0x05,0x05,0x34,0xE5,0x2B,0xC4,0x2B,0xE5,0x2B,0x05,0x34,
+    0xE5,0x33,0x83,0x05,0x34,0x1B,0xC4,0x2B,0xE5,0x33,0x05,0x34,0xE5,0x33,0xE5,0x33,
+    0xC4,0x2B,0xC4,0x2B,0x05,0x34,0xA4,0x2B,0xE4,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x33,
+    0xC4,0x2B,0x05,0x34,0xE5,0x33,0xE5,0x2B,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0x05,0x34,
+    0xA4,0x2B,0xE4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xC4,0x2B,0x82,0xE5,
+    0x33,0x10,0x05,0x34,0xE5,0x33,0xE5,0x2B,0xA4,0x2B,0xC4,0x2B,0xC4,0x2B,0xA4,0x2B,
+    0xC4,0x2B,0xE5,0x2B,0x05,0x34,0xC4,0x2B,0xC4,0x2B,0x05,0x34,0xA4,0x2B,0xE5,0x2B,
+    0xC4,0x2B,0xE5,0x33,0x84,0xC4,0x2B,0x01,0xE5,0x33,0xC4,0x2B,0x82,0x05,0x34,0x1E,
+    0xC4,0x2B,0x05,0x34,0xE5,0x33,0x05,0x34,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,0x05,0x34,
+    0xA4,0x2B,0xC4,0x2B,0x05,0x34,0xE5,0x2B,0xE4,0x2B,0xE4,0x2B,0x05,0x34,0xE5,0x2B,
+    0x05,0x34,0xA4,0x2B,0x05,0x34,0xE5,0x2B,0xC4,0x2B,0xC4,0x2B,0xE5,0x33,0xC4,0x2B,
+    0xE4,0x2B,0xC4,0x2B,0xC4,0x2B,0xA4,0x2B,0x05,0x34,0xE5,0x33,0xE5,0x33,0x82,0xE4,
+    0x2B,0x06,0x05,0x34,0xE5,0x33,0x05,0x34,0xE5,0x33,0xC4,0x2B,0x05,0x34,0xE5,0x33,
+};
@@ -0,0 +1,949 @@
+/**
+ * @file    jpeg.c
+ *
+ * @note    Baseline JPEG decoder (ITU T.81, Huffman coded, 8-bit samples)
+ *
+ * @note    The image is decoded one MCU (minimal coded unit, up to 16x16 pixels) at
+ *          a time. The blocks of each component are dequantized and transformed by
+ *          an integer IDCT, chroma is upsampled by replication, converted to
+ *          ARGB8888 and the MCU is copied into the surface with Pixel_ConvertSurface,
+ *          that converts to the surface format and clips. Only the tables and the
+ *          buffers for one MCU are needed (see Jpeg_GetWorkAreaSize).
+ *
+ * @note    The IDCT is the islow algorithm of the IJG library (jidctint.c), with 13
+ *          bit constants and 2 extra bits between the passes. For scaled decoding
+ *          the reduced IDCTs of jidctred.c are used: 4x4 and 2x2 outputs are
+ *          calculated from the low frequency coefficients and 1/8 uses only DC. The
+ *          color conversion uses the same fixed point factors, so the results are
+ *          the same as libjpeg with JDCT_ISLOW and no fancy upsampling.
+ *
+ * @note    Huffman codes up to 8 bits are decoded with a lookup table. The bit
+ *          buffer is refilled a byte at a time, removing the stuffed 0x00 after
+ *          0xFF. When a marker is found, zeros are returned until the next restart.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+#include "pixel.h"
+#include "image.h"
+#include "jpeg.h"
+
+/**
+ * @brief   Markers
+ */
+///@{
+#define M_SOF0                  0xC0
+#define M_SOF1                  0xC1
+#define M_APP14                 0xEE
+#define M_DHT                   0xC4
+#define M_RST0                  0xD0
+#define M_SOI                   0xD8
+#define M_EOI                   0xD9
+#define M_SOS                   0xDA
+#define M_DQT                   0xDB
+#define M_DRI                   0xDD
+///@}
+
+/**
+ * @brief   Fixed point constants of the IDCT (value*2^13)
+ */
+///@{
+#define CONST_BITS              13
+#define PASS1_BITS              2
+#define FIX_0_211164243         1730
+#define FIX_0_298631336         2446
+#define FIX_0_390180644         3196
+#define FIX_0_509795579         4176
+#define FIX_0_541196100         4433
+#define FIX_0_601344887         4926
+#define FIX_0_720959822         5906
+#define FIX_0_765366865         6270
+#define FIX_0_850430095         6967
+#define FIX_0_899976223         7373
+#define FIX_1_061594337         8697
+#define FIX_1_175875602         9633
+#define FIX_1_272758580         10426
+#define FIX_1_451774981         11893
+#define FIX_1_501321110         12299
+#define FIX_1_847759065         15137
+#define FIX_1_961570560         16069
+#define FIX_2_053119869         16819
+#define FIX_2_172734803         17799
+#define FIX_2_562915447         20995
+#define FIX_3_072711026         25172
+#define FIX_3_624509785         29692
+#define DESCALE(X,N)            (((X)+(1<<((N)-1)))>>(N))
+///@}
+
+/**
+ * @brief   Huffman table
+ *
+ * @note    look has the length in bits 15-8 and the symbol in bits 7-0 for codes up
+ *          to 8 bits (0 = longer code). Longer codes are found using maxcode.
+ */
+typedef struct {
+    int32_t     maxcode[18];        ///< Largest code of each length (-1 = none)
+    int32_t     valoffset[17];      ///< Index in huffval minus first code of each length
+    uint16_t    look[256];
+    uint8_t     huffval[256];
+} HuffTable_t;
+
+/**
+ * @brief   Component
+ */
+typedef struct {
+    int         id;
+    int         h,v;                ///< Sampling factors
+    int         hshift,vshift;      ///< 1 when upsampled by 2
+    int         bs;                 ///< Block size after scaling
+    int         tq;                 ///< Quantization table
+    int         td,ta;              ///< Huffman tables (DC and AC)
+    int         pred;               ///< DC prediction
+    int         stride;             ///< Line size in samples
+    uint8_t     samples[256];       ///< Samples of the MCU
+} Component_t;
+
+/**
+ * @brief   Decoder state (work area)
+ */
+static struct {
+    Image_Reader       *r;
+    uint16_t            qt[4][64];          ///< Quantization tables (zigzag order)
+    HuffTable_t         ht[4];              ///< DC0, DC1, AC0, AC1
+    Component_t         comp[3];
+    int                 ncomp;
+    int                 w,h;
+    int                 hmax,vmax;
+    int                 restartinterval;
+    int                 transform;          ///< -1 = unknown, 0 = RGB, 1 = YCbCr
+    uint32_t            bits;               ///< Bit buffer (MSB first)
+    int                 nbits;              ///< Bits in buffer
+    int                 marker;             ///< Marker found in data (0 = none)
+    int32_t             coef[64];           ///< Dequantized coefficients (natural order)
+    int32_t             ws[64];             ///< IDCT work space
+    uint32_t            mcu[16*16];         ///< MCU in ARGB8888
+    Jpeg_RowCallback    rowcb;
+    void               *rowctx;
+} jpeg;
+
+/**
+ * @brief   Position of coefficient k of the zigzag sequence in the 8x8 block
+ */
+static const uint8_t zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/**
+ * @brief   Limit to 0-255
+ */
+static inline int clamp(int v) {
+
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/////////////////////////////////// Markers ///////////////////////////////////////////////////////
+
+/*
+ * @brief   Read a 16-bit big endian value
+ */
+static int get16(void) {
+int v;
+
+    v = Image_GetByte(jpeg.r)<<8;
+    return v|Image_GetByte(jpeg.r);
+}
+
+/*
+ * @brief   Skip n bytes
+ */
+static void skip(int n) {
+
+    while( (n-- > 0) && !jpeg.r->eof )
+        Image_GetByte(jpeg.r);
+}
+
+/*
+ * @brief   Find next marker
+ */
+static int nextmarker(void) {
+int c;
+
+    do {
+        c = Image_GetByte(jpeg.r);
+    } while( (c != 0xFF) && !jpeg.r->eof );
+    do {
+        c = Image_GetByte(jpeg.r);
+    } while( (c == 0xFF) && !jpeg.r->eof );
+    return jpeg.r->eof ? -1 : c;
+}
+
+/*
+ * @brief   Define quantization tables
+ */
+static int readdqt(int len) {
+int pq,tq,k;
+
+    while( len > 0 ) {
+        tq = Image_GetByte(jpeg.r);
+        pq = tq>>4;
+        tq &= 15;
+        if( tq > 3 )
+            return -1;
+        for(k=0;k<64;k++)
+            jpeg.qt[tq][k] = pq ? get16() : Image_GetByte(jpeg.r);
+        len -= 65+64*pq;
+    }
+    return jpeg.r->eof ? -1 : 0;
+}
+
+/*
+ * @brief   Build a Huffman table (ITU T.81 Annex C)
+ */
+static int buildhuffman(HuffTable_t *t, const uint8_t counts[16]) {
+int code = 0, k = 0;
+int l,i,j;
+
+    memset(t->look,0,sizeof(t->look));
+    for(l=1;l<=16;l++) {
+        t->valoffset[l] = k-code;
+        for(i=0;i<counts[l-1];i++) {
+            if( code >= (1<<l) )
+                return -1;
+            if( l <= 8 )
+                for(j=0;j<(1<<(8-l));j++)
+                    t->look[(code<<(8-l))+j] = (l<<8)|t->huffval[k];
+            code++;
+            k++;
+        }
+        t->maxcode[l] = counts[l-1] ? code-1 : -1;
+        code <<= 1;
+    }
+    t->maxcode[17] = 0x7FFFFFFF;
+    return 0;
+}
+
+/*
+ * @brief   Define Huffman tables
+ */
+static int readdht(int len) {
+uint8_t counts[16];
+int tc,th,i,n;
+HuffTable_t *t;
+
+    while( len > 0 ) {
+        tc = Image_GetByte(jpeg.r);
+        th = tc&15;
+        tc >>= 4;
+        if( (tc > 1) || (th > 1) )
+            return -1;
+        t = &jpeg.ht[tc*2+th];
+        n = 0;
+        for(i=0;i<16;i++) {
+            counts[i] = Image_GetByte(jpeg.r);
+            n += counts[i];
+        }
+        if( n > 256 )
+            return -1;
+        for(i=0;i<n;i++)
+            t->huffval[i] = Image_GetByte(jpeg.r);
+        if( buildhuffman(t,counts) < 0 )
+            return -1;
+        len -= 17+n;
+    }
+    return jpeg.r->eof ? -1 : 0;
+}
+
+/*
+ * @brief   Start of frame
+ */
+static int readsof(void) {
+int p,i,hv;
+Component_t *c;
+
+    p         = Image_GetByte(jpeg.r);
+    jpeg.h    = get16();
+    jpeg.w    = get16();
+    jpeg.ncomp = Image_GetByte(jpeg.r);
+    if( (p != 8) || (jpeg.w == 0) || (jpeg.h == 0) )
+        return -2;
+    if( (jpeg.ncomp != 1) && (jpeg.ncomp != 3) )
+        return -2;
+    jpeg.hmax = jpeg.vmax = 1;
+    for(i=0;i<jpeg.ncomp;i++) {
+        c     = &jpeg.comp[i];
+        c->id = Image_GetByte(jpeg.r);
+        hv    = Image_GetByte(jpeg.r);
+        c->tq = Image_GetByte(jpeg.r)&3;
+        c->h  = hv>>4;
+        c->v  = hv&15;
+        if( jpeg.ncomp == 1 )           // not interleaved: one block per MCU
+            c->h = c->v = 1;
+        if( (c->h < 1) || (c->h > 2) || (c->v < 1) || (c->v > 2) )
+            return -2;
+        if( c->h > jpeg.hmax )
+            jpeg.hmax = c->h;
+        if( c->v > jpeg.vmax )
+            jpeg.vmax = c->v;
+    }
+    return jpeg.r->eof ? -1 : 0;
+}
+
+/*
+ * @brief   Adobe marker
+ *
+ * @note    The transform flag tells if the components are RGB or YCbCr
+ */
+static void readadobe(int len) {
+uint8_t b[12];
+int i;
+
+    for(i=0;(i<12)&&(i<len);i++)
+        b[i] = Image_GetByte(jpeg.r);
+    if( (i == 12) && (memcmp(b,"Adobe",5) == 0) )
+        jpeg.transform = b[11];
+    skip(len-i);
+}
+
+/*
+ * @brief   Start of scan
+ */
+static int readsos(void) {
+int n,i,j,id,t;
+
+    n = Image_GetByte(jpeg.r);
+    if( n != jpeg.ncomp )               // only interleaved scans with all components
+        return -2;
+    for(i=0;i<n;i++) {
+        id = Image_GetByte(jpeg.r);
+        t  = Image_GetByte(jpeg.r);
+        for(j=0;j<jpeg.ncomp;j++)
+            if( jpeg.comp[j].id == id )
+                break;
+        if( (j == jpeg.ncomp) || ((t>>4) > 1) || ((t&15) > 1) )
+            return -2;
+        jpeg.comp[j].td = t>>4;
+        jpeg.comp[j].ta = 2+(t&15);
+    }
+    skip(3);                            // Ss, Se, Ah/Al (fixed for baseline)
+    return jpeg.r->eof ? -1 : 0;
+}
+
+/////////////////////////////////// Entropy decoding //////////////////////////////////////////////
+
+/*
+ * @brief   Fill the bit buffer with at least 25 bits
+ */
+static void fillbits(void) {
+int c,c2;
+
+    while( jpeg.nbits <= 24 ) {
+        c = 0;
+        if( !jpeg.marker ) {
+            c = Image_GetByte(jpeg.r);
+            if( c == 0xFF ) {
+                do {
+                    c2 = Image_GetByte(jpeg.r);
+                } while( (c2 == 0xFF) && !jpeg.r->eof );
+                if( c2 != 0 ) {
+                    jpeg.marker = c2;
+                    c = 0;
+                }
+            }
+            if( jpeg.r->eof )
+                jpeg.marker = -1;
+        }
+        jpeg.bits  |= (uint32_t) c<<(24-jpeg.nbits);
+        jpeg.nbits += 8;
+    }
+}
+
+/*
+ * @brief   Get n bits (n <= 16)
+ */
+static inline int getbits(int n) {
+int v;
+
+    if( n == 0 )
+        return 0;
+    if( jpeg.nbits < n )
+        fillbits();
+    v = jpeg.bits>>(32-n);
+    jpeg.bits <<= n;
+    jpeg.nbits -= n;
+    return v;
+}
+
+/*
+ * @brief   Convert n bits into a signed value (ITU T.81 F.2.2.1)
+ */
+static inline int extend(int v, int n) {
+
+    return v < (1<<(n-1)) ? v-(1<<n)+1 : v;
+}
+
+/*
+ * @brief   Decode a Huffman coded symbol
+ */
+static int decodehuffman(const HuffTable_t *t) {
+int l,code,look;
+
+    if( jpeg.nbits < 16 )
+        fillbits();
+    look = t->look[jpeg.bits>>24];
+    if( look ) {
+        l = look>>8;
+        jpeg.bits <<= l;
+        jpeg.nbits -= l;
+        return look&0xFF;
+    }
+    for(l=9;l<=16;l++) {
+        code = jpeg.bits>>(32-l);
+        if( code <= t->maxcode[l] )
+            break;
+    }
+    if( l > 16 )                        // corrupt data
+        return 0;
+    jpeg.bits <<= l;
+    jpeg.nbits -= l;
+    return t->huffval[code+t->valoffset[l]];
+}
+
+/*
+ * @brief   Decode the coefficients of a block
+ *
+ * @note    When dconly is set, the AC coefficients are decoded but not stored
+ */
+static void decodeblock(Component_t *c, int dconly) {
+const uint16_t *q = jpeg.qt[c->tq];
+const HuffTable_t *ac = &jpeg.ht[c->ta];
+int k,rs,s;
+
+    if( !dconly )
+        memset(jpeg.coef,0,sizeof(jpeg.coef));
+    s = decodehuffman(&jpeg.ht[c->td])&15;
+    if( s )
+        c->pred += extend(getbits(s),s);
+    jpeg.coef[0] = c->pred*q[0];
+
+    for(k=1;k<64;k++) {
+        rs = decodehuffman(ac);
+        s  = rs&15;
+        if( s == 0 ) {
+            if( rs != 0xF0 )            // end of block
+                break;
+            k += 15;
+            continue;
+        }
+        k += rs>>4;
+        if( k > 63 )
+            break;
+        s = extend(getbits(s),s);
+        if( !dconly )
+            jpeg.coef[zigzag[k]] = s*q[k];
+    }
+}
+
+/*
+ * @brief   Process a restart marker
+ */
+static void restart(void) {
+int i;
+
+    if( !jpeg.marker )
+        nextmarker();
+    jpeg.marker = 0;
+    jpeg.bits   = 0;
+    jpeg.nbits  = 0;
+    for(i=0;i<jpeg.ncomp;i++)
+        jpeg.comp[i].pred = 0;
+}
+
+/////////////////////////////////// IDCT //////////////////////////////////////////////////////////
+
+/*
+ * @brief   8x8 IDCT (islow of jidctint.c)
+ */
+static void idct8x8(uint8_t *out, int stride) {
+int32_t *in = jpeg.coef, *ws = jpeg.ws;
+int32_t tmp0,tmp1,tmp2,tmp3,tmp10,tmp11,tmp12,tmp13,z1,z2,z3,z4,z5;
+int i,dc;
+
+    // Columns
+    for(i=0;i<8;i++,in++,ws++) {
+        if( (in[8] | in[16] | in[24] | in[32] | in[40] | in[48] | in[56]) == 0 ) {
+            dc = in[0]*(1<<PASS1_BITS);
+            ws[0] = ws[8] = ws[16] = ws[24] = ws[32] = ws[40] = ws[48] = ws[56] = dc;
+            continue;
+        }
+        z2    = in[16];
+        z3    = in[48];
+        z1    = (z2+z3)*FIX_0_541196100;
+        tmp2  = z1-z3*FIX_1_847759065;
+        tmp3  = z1+z2*FIX_0_765366865;
+        tmp0  = (in[0]+in[32])*(1<<CONST_BITS);
+        tmp1  = (in[0]-in[32])*(1<<CONST_BITS);
+        tmp10 = tmp0+tmp3;
+        tmp13 = tmp0-tmp3;
+        tmp11 = tmp1+tmp2;
+        tmp12 = tmp1-tmp2;
+
+        tmp0  = in[56];
+        tmp1  = in[40];
+        tmp2  = in[24];
+        tmp3  = in[8];
+        z1    = tmp0+tmp3;
+        z2    = tmp1+tmp2;
+        z3    = tmp0+tmp2;
+        z4    = tmp1+tmp3;
+        z5    = (z3+z4)*FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1    = z1*-FIX_0_899976223;
+        z2    = z2*-FIX_2_562915447;
+        z3    = z3*-FIX_1_961570560+z5;
+        z4    = z4*-FIX_0_390180644+z5;
+        tmp0 += z1+z3;
+        tmp1 += z2+z4;
+        tmp2 += z2+z3;
+        tmp3 += z1+z4;
+
+        ws[0]  = DESCALE(tmp10+tmp3,CONST_BITS-PASS1_BITS);
+        ws[56] = DESCALE(tmp10-tmp3,CONST_BITS-PASS1_BITS);
+        ws[8]  = DESCALE(tmp11+tmp2,CONST_BITS-PASS1_BITS);
+        ws[48] = DESCALE(tmp11-tmp2,CONST_BITS-PASS1_BITS);
+        ws[16] = DESCALE(tmp12+tmp1,CONST_BITS-PASS1_BITS);
+        ws[40] = DESCALE(tmp12-tmp1,CONST_BITS-PASS1_BITS);
+        ws[24] = DESCALE(tmp13+tmp0,CONST_BITS-PASS1_BITS);
+        ws[32] = DESCALE(tmp13-tmp0,CONST_BITS-PASS1_BITS);
+    }
+
+    // Rows
+    ws = jpeg.ws;
+    for(i=0;i<8;i++,ws+=8,out+=stride) {
+        if( (ws[1] | ws[2] | ws[3] | ws[4] | ws[5] | ws[6] | ws[7]) == 0 ) {
+            dc = clamp(DESCALE(ws[0],PASS1_BITS+3)+128);
+            memset(out,dc,8);
+            continue;
+        }
+        z2    = ws[2];
+        z3    = ws[6];
+        z1    = (z2+z3)*FIX_0_541196100;
+        tmp2  = z1-z3*FIX_1_847759065;
+        tmp3  = z1+z2*FIX_0_765366865;
+        tmp0  = (ws[0]+ws[4])*(1<<CONST_BITS);
+        tmp1  = (ws[0]-ws[4])*(1<<CONST_BITS);
+        tmp10 = tmp0+tmp3;
+        tmp13 = tmp0-tmp3;
+        tmp11 = tmp1+tmp2;
+        tmp12 = tmp1-tmp2;
+
+        tmp0  = ws[7];
+        tmp1  = ws[5];
+        tmp2  = ws[3];
+        tmp3  = ws[1];
+        z1    = tmp0+tmp3;
+        z2    = tmp1+tmp2;
+        z3    = tmp0+tmp2;
+        z4    = tmp1+tmp3;
+        z5    = (z3+z4)*FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1    = z1*-FIX_0_899976223;
+        z2    = z2*-FIX_2_562915447;
+        z3    = z3*-FIX_1_961570560+z5;
+        z4    = z4*-FIX_0_390180644+z5;
+        tmp0 += z1+z3;
+        tmp1 += z2+z4;
+        tmp2 += z2+z3;
+        tmp3 += z1+z4;
+
+        out[0] = clamp(DESCALE(tmp10+tmp3,CONST_BITS+PASS1_BITS+3)+128);
+        out[7] = clamp(DESCALE(tmp10-tmp3,CONST_BITS+PASS1_BITS+3)+128);
+        out[1] = clamp(DESCALE(tmp11+tmp2,CONST_BITS+PASS1_BITS+3)+128);
+        out[6] = clamp(DESCALE(tmp11-tmp2,CONST_BITS+PASS1_BITS+3)+128);
+        out[2] = clamp(DESCALE(tmp12+tmp1,CONST_BITS+PASS1_BITS+3)+128);
+        out[5] = clamp(DESCALE(tmp12-tmp1,CONST_BITS+PASS1_BITS+3)+128);
+        out[3] = clamp(DESCALE(tmp13+tmp0,CONST_BITS+PASS1_BITS+3)+128);
+        out[4] = clamp(DESCALE(tmp13-tmp0,CONST_BITS+PASS1_BITS+3)+128);
+    }
+}
+
+/*
+ * @brief   4x4 IDCT (jidctred.c). Coefficients in row and column 4 are not used
+ */
+static void idct4x4(uint8_t *out, int stride) {
+int32_t *in = jpeg.coef, *ws = jpeg.ws;
+int32_t tmp0,tmp2,tmp10,tmp12;
+int i,dc;
+
+    // Columns
+    for(i=0;i<8;i++,in++,ws++) {
+        if( i == 4 )
+            continue;
+        if( (in[8] | in[16] | in[24] | in[40] | in[48] | in[56]) == 0 ) {
+            dc = in[0]*(1<<PASS1_BITS);
+            ws[0] = ws[8] = ws[16] = ws[24] = dc;
+            continue;
+        }
+        tmp0  = in[0]*(1<<(CONST_BITS+1));
+        tmp2  = in[16]*FIX_1_847759065-in[48]*FIX_0_765366865;
+        tmp10 = tmp0+tmp2;
+        tmp12 = tmp0-tmp2;
+        tmp0  = -in[56]*FIX_0_211164243+in[40]*FIX_1_451774981
+                -in[24]*FIX_2_172734803+in[8]*FIX_1_061594337;
+        tmp2  = -in[56]*FIX_0_509795579-in[40]*FIX_0_601344887
+                +in[24]*FIX_0_899976223+in[8]*FIX_2_562915447;
+        ws[0]  = DESCALE(tmp10+tmp2,CONST_BITS-PASS1_BITS+1);
+        ws[24] = DESCALE(tmp10-tmp2,CONST_BITS-PASS1_BITS+1);
+        ws[8]  = DESCALE(tmp12+tmp0,CONST_BITS-PASS1_BITS+1);
+        ws[16] = DESCALE(tmp12-tmp0,CONST_BITS-PASS1_BITS+1);
+    }
+
+    // Rows
+    ws = jpeg.ws;
+    for(i=0;i<4;i++,ws+=8,out+=stride) {
+        if( (ws[1] | ws[2] | ws[3] | ws[5] | ws[6] | ws[7]) == 0 ) {
+            dc = clamp(DESCALE(ws[0],PASS1_BITS+3)+128);
+            out[0] = out[1] = out[2] = out[3] = dc;
+            continue;
+        }
+        tmp0  = ws[0]*(1<<(CONST_BITS+1));
+        tmp2  = ws[2]*FIX_1_847759065-ws[6]*FIX_0_765366865;
+        tmp10 = tmp0+tmp2;
+        tmp12 = tmp0-tmp2;
+        tmp0  = -ws[7]*FIX_0_211164243+ws[5]*FIX_1_451774981
+                -ws[3]*FIX_2_172734803+ws[1]*FIX_1_061594337;
+        tmp2  = -ws[7]*FIX_0_509795579-ws[5]*FIX_0_601344887
+                +ws[3]*FIX_0_899976223+ws[1]*FIX_2_562915447;
+        out[0] = clamp(DESCALE(tmp10+tmp2,CONST_BITS+PASS1_BITS+3+1)+128);
+        out[3] = clamp(DESCALE(tmp10-tmp2,CONST_BITS+PASS1_BITS+3+1)+128);
+        out[1] = clamp(DESCALE(tmp12+tmp0,CONST_BITS+PASS1_BITS+3+1)+128);
+        out[2] = clamp(DESCALE(tmp12-tmp0,CONST_BITS+PASS1_BITS+3+1)+128);
+    }
+}
+
+/*
+ * @brief   2x2 IDCT (jidctred.c). Only odd rows and columns and DC are used
+ */
+static void idct2x2(uint8_t *out, int stride) {
+int32_t *in = jpeg.coef, *ws = jpeg.ws;
+int32_t tmp0,tmp10;
+int i,dc;
+
+    // Columns
+    for(i=0;i<8;i++,in++,ws++) {
+        if( (i == 2) || (i == 4) || (i == 6) )
+            continue;
+        if( (in[8] | in[24] | in[40] | in[56]) == 0 ) {
+            ws[0] = ws[8] = in[0]*(1<<PASS1_BITS);
+            continue;
+        }
+        tmp10 = in[0]*(1<<(CONST_BITS+2));
+        tmp0  = -in[56]*FIX_0_720959822+in[40]*FIX_0_850430095
+                -in[24]*FIX_1_272758580+in[8]*FIX_3_624509785;
+        ws[0] = DESCALE(tmp10+tmp0,CONST_BITS-PASS1_BITS+2);
+        ws[8] = DESCALE(tmp10-tmp0,CONST_BITS-PASS1_BITS+2);
+    }
+
+    // Rows
+    ws = jpeg.ws;
+    for(i=0;i<2;i++,ws+=8,out+=stride) {
+        if( (ws[1] | ws[3] | ws[5] | ws[7]) == 0 ) {
+            dc = clamp(DESCALE(ws[0],PASS1_BITS+3)+128);
+            out[0] = out[1] = dc;
+            continue;
+        }
+        tmp10 = ws[0]*(1<<(CONST_BITS+2));
+        tmp0  = -ws[7]*FIX_0_720959822+ws[5]*FIX_0_850430095
+                -ws[3]*FIX_1_272758580+ws[1]*FIX_3_624509785;
+        out[0] = clamp(DESCALE(tmp10+tmp0,CONST_BITS+PASS1_BITS+3+2)+128);
+        out[1] = clamp(DESCALE(tmp10-tmp0,CONST_BITS+PASS1_BITS+3+2)+128);
+    }
+}
+
+/////////////////////////////////// MCU ///////////////////////////////////////////////////////////
+
+/*
+ * @brief   Decode the blocks of all components of a MCU
+ */
+static void decodemcu(void) {
+Component_t *c;
+uint8_t *out;
+int i,bx,by,bs;
+
+    for(i=0;i<jpeg.ncomp;i++) {
+        c  = &jpeg.comp[i];
+        bs = c->bs;
+        for(by=0;by<c->v;by++) {
+            for(bx=0;bx<c->h;bx++) {
+                decodeblock(c,bs == 1);
+                out = c->samples+by*bs*c->stride+bx*bs;
+                switch(bs) {
+                case 8: idct8x8(out,c->stride);                            break;
+                case 4: idct4x4(out,c->stride);                            break;
+                case 2: idct2x2(out,c->stride);                            break;
+                case 1: *out = clamp(DESCALE(jpeg.coef[0],3)+128);        break;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * @brief   Check if the components are RGB
+ *
+ * @note    From the Adobe marker or, without it, the component ids 'R', 'G', 'B'
+ */
+static int isrgb(void) {
+
+    if( jpeg.transform >= 0 )
+        return jpeg.transform == 0;
+    return (jpeg.comp[0].id == 'R') && (jpeg.comp[1].id == 'G') && (jpeg.comp[2].id == 'B');
+}
+
+/*
+ * @brief   Convert the samples of the MCU into ARGB8888
+ *
+ * @note    Same fixed point conversion as libjpeg (jdcolor.c)
+ */
+static void convertmcu(int w, int h) {
+const Component_t *cy = &jpeg.comp[0], *cb = &jpeg.comp[1], *cr = &jpeg.comp[2];
+const uint8_t *py,*pb,*pr;
+uint32_t *out = jpeg.mcu;
+int i,j,y,u,v;
+
+    if( jpeg.ncomp == 1 ) {
+        for(j=0;j<h;j++) {
+            py = cy->samples+j*cy->stride;
+            for(i=0;i<w;i++) {
+                y = py[i];
+                *out++ = 0xFF000000|(y<<16)|(y<<8)|y;
+            }
+        }
+        return;
+    }
+    if( isrgb() ) {
+        for(j=0;j<h;j++) {
+            py = cy->samples+(j>>cy->vshift)*cy->stride;
+            pb = cb->samples+(j>>cb->vshift)*cb->stride;
+            pr = cr->samples+(j>>cr->vshift)*cr->stride;
+            for(i=0;i<w;i++)
+                *out++ = 0xFF000000|(py[i>>cy->hshift]<<16)|(pb[i>>cb->hshift]<<8)
+                        |pr[i>>cr->hshift];
+        }
+        return;
+    }
+    for(j=0;j<h;j++) {
+        py = cy->samples+(j>>cy->vshift)*cy->stride;
+        pb = cb->samples+(j>>cb->vshift)*cb->stride;
+        pr = cr->samples+(j>>cr->vshift)*cr->stride;
+        for(i=0;i<w;i++) {
+            y = py[i>>cy->hshift];
+            u = pb[i>>cb->hshift]-128;
+            v = pr[i>>cr->hshift]-128;
+            *out++ = 0xFF000000
+                    |(clamp(y+((91881*v+32768)>>16))<<16)
+                    |(clamp(y+((-22554*u-46802*v+32768)>>16))<<8)
+                    |clamp(y+((116130*u+32768)>>16));
+        }
+    }
+}
+
+/////////////////////////////////// API ///////////////////////////////////////////////////////////
+
+/**
+ * @brief   Jpeg_ReadHeader
+ *
+ * @note    Reads the markers until the start of scan. APPn and COM markers are
+ *          skipped.
+ *
+ * @return  0 if OK, -1 if not a JPEG image, -2 if not supported (progressive,
+ *          12-bit, arithmetic coding, not interleaved, etc.)
+ */
+int
+Jpeg_ReadHeader(Image_Reader *r, Jpeg_Info *info) {
+int m,len,rc;
+int frame = 0;
+
+    jpeg.r               = r;
+    jpeg.restartinterval = 0;
+    jpeg.transform       = -1;
+    if( (Image_GetByte(r) != 0xFF) || (Image_GetByte(r) != M_SOI) )
+        return -1;
+
+    for(;;) {
+        m = nextmarker();
+        if( m < 0 )
+            return -1;
+        len = get16()-2;
+        if( len < 0 )
+            return -1;
+        switch(m) {
+        case M_SOF0:
+        case M_SOF1:
+            rc = readsof();
+            frame = 1;
+            break;
+        case M_DHT:
+            rc = readdht(len);
+            break;
+        case M_DQT:
+            rc = readdqt(len);
+            break;
+        case M_DRI:
+            jpeg.restartinterval = get16();
+            rc = 0;
+            break;
+        case M_APP14:
+            readadobe(len);
+            rc = 0;
+            break;
+        case M_SOS:
+            if( !frame )
+                return -1;
+            rc = readsos();
+            if( rc < 0 )
+                return rc;
+            info->w          = jpeg.w;
+            info->h          = jpeg.h;
+            info->components = jpeg.ncomp;
+            info->hs         = jpeg.hmax;
+            info->vs         = jpeg.vmax;
+            return 0;
+        case M_EOI:
+            return -1;
+        default:
+            if( (m >= 0xC2) && (m <= 0xCF) && (m != 0xC8) )
+                return -2;              // other SOFn (progressive, lossless, arithmetic)
+            skip(len);
+            rc = jpeg.r->eof ? -1 : 0;
+            break;
+        }
+        if( rc < 0 )
+            return rc;
+    }
+}
+
+/**
+ * @brief   Jpeg_DecodeData
+ *
+ * @note    Decode the scan (after Jpeg_ReadHeader) into s with its top left corner at
+ *          (x,y), clipped against the surface. scale is 1, 2, 4 or 8: the image
+ *          is (w+scale-1)/scale x (h+scale-1)/scale pixels.
+ *
+ * @return  0 if OK, -1 if scale is wrong, -3 if the data ended too soon
+ */
+int
+Jpeg_DecodeData(Image_Reader *r, const LCD_Surface *s, int x, int y, int scale) {
+LCD_Surface blk;
+Component_t *c;
+int bs,mcuw,mcuh,w,h,cw,ch,mx,my,i;
+int restarts;
+
+    if( (scale != 1) && (scale != 2) && (scale != 4) && (scale != 8) )
+        return -1;
+    bs   = 8/scale;
+    mcuw = jpeg.hmax*bs;
+    mcuh = jpeg.vmax*bs;
+    w    = (jpeg.w+scale-1)/scale;
+    h    = (jpeg.h+scale-1)/scale;
+
+    jpeg.r      = r;
+    jpeg.bits   = 0;
+    jpeg.nbits  = 0;
+    jpeg.marker = 0;
+    for(i=0;i<jpeg.ncomp;i++) {
+        c         = &jpeg.comp[i];
+        c->pred   = 0;
+        c->hshift = c->h < jpeg.hmax;
+        c->vshift = c->v < jpeg.vmax;
+        c->bs     = bs;
+        if( c->hshift && c->vshift && (bs < 8) ) {
+            // subsampled in both directions: a larger IDCT gives the chroma at
+            // full resolution instead of upsampling (as libjpeg)
+            c->bs     = 2*bs;
+            c->hshift = 0;
+            c->vshift = 0;
+        }
+        c->stride = c->h*c->bs;
+    }
+    restarts = jpeg.restartinterval;
+
+    for(my=0;my*mcuh<h;my++) {
+        ch = h-my*mcuh;
+        if( ch > mcuh )
+            ch = mcuh;
+        for(mx=0;mx*mcuw<w;mx++) {
+            if( jpeg.restartinterval ) {
+                if( restarts == 0 ) {
+                    restart();
+                    restarts = jpeg.restartinterval;
+                }
+                restarts--;
+            }
+            decodemcu();
+            cw = w-mx*mcuw;
+            if( cw > mcuw )
+                cw = mcuw;
+            convertmcu(cw,ch);
+            LCD_InitSurface(&blk,jpeg.mcu,LCD_FORMAT_ARGB8888,x+mx*mcuw,y+my*mcuh,cw,ch,0);
+            Pixel_ConvertSurface(s,blk.x,blk.y,&blk);
+        }
+        if( r->eof )
+            return -3;
+        if( jpeg.rowcb )
+            jpeg.rowcb(jpeg.rowctx,y+my*mcuh,ch);
+    }
+    return 0;
+}
+
+/**
+ * @brief   Jpeg_Decode
+ *
+ * @note    Read header and decode image into s at (x,y) with scale 1, 2, 4 or 8
+ *
+ * @return  0 if OK, negative values as Jpeg_ReadHeader and Jpeg_DecodeData
+ */
+int
+Jpeg_Decode(Image_Reader *r, const LCD_Surface *s, int x, int y, int scale) {
+Jpeg_Info info;
+int rc;
+
+    rc = Jpeg_ReadHeader(r,&info);
+    if( rc < 0 )
+        return rc;
+    return Jpeg_DecodeData(r,s,x,y,scale);
+}
+
+/**
+ * @brief   Jpeg_SetRowCallback
+ *
+ * @note    cb is called after each MCU row is written into the surface (0 = none)
+ */
+void
+Jpeg_SetRowCallback(Jpeg_RowCallback cb, void *ctx) {
+
+    jpeg.rowcb  = cb;
+    jpeg.rowctx = ctx;
+}
+
+/**
+ * @brief   Jpeg_GetWorkAreaSize
+ *
+ * @note    Returns the size in bytes of the decoder state (tables and buffers)
+ */
+int
+Jpeg_GetWorkAreaSize(void) {
+
+    return sizeof(jpeg);
+}
@@ -0,0 +1,49 @@
+#ifndef JPEG_H
+#define JPEG_H
+/**
+ * @file    jpeg.h
+ *
+ * @note    Baseline JPEG decoder
+ *
+ * @note    Huffman coded, 8-bit, grayscale, YCbCr or RGB with 4:4:4, 4:2:2, 4:4:0 or 4:2:0
+ *          sampling, with or without restart markers. Progressive and arithmetic
+ *          coded images are not supported.
+ *
+ * @note    The image is decoded one MCU at a time and written into a surface in
+ *          any LCD_FORMAT_*. It can be scaled by 1/2, 1/4 or 1/8 while decoding.
+ *          The work area (tables and buffers) is less than 8 KB in .bss.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "image.h"
+
+/**
+ * @brief   Image information (from SOF marker)
+ */
+typedef struct {
+    int         w;                  ///< Width in pixels
+    int         h;                  ///< Height in pixels
+    int         components;         ///< 1 (gray) or 3 (YCbCr)
+    int         hs,vs;              ///< Luminance sampling factors (MCU size / 8)
+} Jpeg_Info;
+
+/**
+ * @brief   Function called after each MCU row is written
+ *
+ * @note    y and h are the lines of the surface written. It can be used to copy or
+ *          convert the lines elsewhere. The surface can be changed in the callback, so
+ *          a band surface of one MCU row (8*vs lines) can be moved down after each row
+ *          and the image decoded without a buffer for all of it.
+ */
+typedef void (*Jpeg_RowCallback)(void *ctx, int y, int h);
+
+int  Jpeg_ReadHeader(Image_Reader *r, Jpeg_Info *info);
+int  Jpeg_DecodeData(Image_Reader *r, const LCD_Surface *s, int x, int y, int scale);
+int  Jpeg_Decode(Image_Reader *r, const LCD_Surface *s, int x, int y, int scale);
+void Jpeg_SetRowCallback(Jpeg_RowCallback cb, void *ctx);
+int  Jpeg_GetWorkAreaSize(void);
+
+#endif
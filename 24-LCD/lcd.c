@@ -8,6 +8,7 @@
 #include "stm32f746xx.h"
 #include "system_stm32f746.h"
 #include "lcd.h"
+#include "pixel.h"
 
 
 #define BIT(N)          (1U<<(N))
@@ -192,9 +193,109 @@ static const int pixelsize[] = {
         2,  // 100: ARGB4444
         1,  // 101: L8 (8-bit luminance)
         1,  // 110: AL44 (4-bit alpha, 4-bit luminance)
-        1   // 111: AL88 (8-bit alpha, 8-bit luminance)
+        2   // 111: AL88 (8-bit alpha, 8-bit luminance)
 };
 
+/**
+ * @brief   LTDC interrupts
+ *
+ * @note    The event interrupt (register reload, line) has IRQ number 88 and is
+ *          served by LCD_TFT_EV_IRQHandler. The error interrupt (FIFO underrun,
+ *          transfer error) has IRQ number 89 and is served by LCD_TFT_ER_IRQHandler.
+ */
+///@{
+#define LCD_EV_IRQ              (88)
+#define LCD_EV_PRIO             (6)
+#define LCD_ER_IRQ              (89)
+#define LCD_ER_PRIO             (7)
+///@}
+
+/**
+ * @brief   Page flipping (double buffering) information of a layer
+ *
+ * @note    buffer[back] is where the drawing routines write. The other one is shown.
+ *          When buffer[1] is null, double buffering is disabled and drawing is done
+ *          directly in the buffer shown (CFBAR).
+ *
+ * @note    pending is set when a new CFBAR value was written to the shadow register
+ *          and cleared by the register reload interrupt, i.e., when it is really in use.
+ */
+typedef struct {
+    void               *buffer[2];      ///< Frame buffers
+    int                 back;           ///< Index of the buffer used for drawing
+    volatile int        pending;        ///< Flip queued but not yet done
+} PageFlipInfo_t;
+
+static PageFlipInfo_t pageflipinfo[3];
+
+/**
+ * @brief   Frame counters
+ *
+ * @note    vsyncs is incremented by the line interrupt at the start of the vertical
+ *          blanking period. It is used as time base for frame pacing.
+ */
+///@{
+static volatile uint32_t vsyncs     = 0;
+static volatile uint32_t presented  = 0;
+static volatile uint32_t underruns  = 0;
+static volatile uint32_t transfererrors = 0;
+static uint32_t          dropped    = 0;
+///@}
+
+/**
+ * @brief   Frame pacing parameters
+ *
+ * @note    A new frame is shown every framedivider vertical blankings
+ */
+///@{
+static uint32_t          framedivider = 1;
+static uint32_t          nextframe    = 0;
+static int               pacing       = 0;
+///@}
+
+/**
+ * @brief   Function called when a queued flip is done
+ */
+static LCD_FlipCallback  flipcallback = 0;
+
+/**
+ * @brief   CLUT information for each layer
+ *
+ * @note    Entries first to last must be written into the LTDC at next vertical blanking
+ */
+typedef struct {
+    LCD_CLUT       *clut;
+    volatile int    first;
+    volatile int    last;
+} CLUTInfo_t;
+
+static CLUTInfo_t clutinfo[3] = { {0,0,-1}, {0,0,-1}, {0,0,-1} };
+
+/**
+ * @brief   Window information for each layer (compositor)
+ *
+ * @note    A window is a buffer with any size shown at a position that can be partially
+ *          or totally outside the display. The visible part is calculated when it is
+ *          moved and the register values are written by the line interrupt at the start
+ *          of the vertical blanking, so all of them are used in the same frame.
+ */
+typedef struct {
+    void           *area;           ///< Buffer (0 = layer is not a window)
+    int             format;         ///< Pixel format
+    int             x,y;            ///< Screen position of top left corner
+    int             w,h;            ///< Size in pixels
+    int             pitch;          ///< Distance in bytes between lines
+    uint32_t        cfbar;          ///< Register values for visible part
+    uint32_t        cfblr;
+    uint32_t        cfblnr;
+    uint32_t        whpcr;
+    uint32_t        wvpcr;
+    int             visible;        ///< Some part is inside display
+    volatile int    dirty;          ///< Registers must be written
+} WindowInfo_t;
+
+static WindowInfo_t windowinfo[3];
+
 /**
  *  @brief Pin Configuration for LCD
  *
@@ -782,8 +883,19 @@ void LCD_Init(void) {
     // Set background color
     LTDC->BCCR = BACKGROUND_COLOR;
 
-    /* Enable interrupts */
-    //LTDC->IER  |= (LTDC_IER_RRIE|LTDC_IER_TERRIE|LTDC_IER_FUIE|LTDC_IER_LIE);
+    /* Line interrupt at the first line of the vertical front porch (start of blanking) */
+    LTDC->LIPCR = (VSH+VBP+VAH)<<LTDC_LIPCR_LIPOS_Pos;
+
+    /* Enable interrupts used for page flipping and frame pacing */
+    LTDC->ICR   = LTDC_ICR_CRRIF|LTDC_ICR_CLIF|LTDC_ICR_CFUIF|LTDC_ICR_CTERRIF;
+    LTDC->IER  |= (LTDC_IER_RRIE|LTDC_IER_LIE);
+    NVIC_SetPriority(LCD_EV_IRQ,LCD_EV_PRIO);
+    NVIC_EnableIRQ(LCD_EV_IRQ);
+
+    /* Count FIFO underruns and transfer errors (see LCD_GetFrameStatistics) */
+    LTDC->IER  |= (LTDC_IER_FUIE|LTDC_IER_TERRIE);
+    NVIC_SetPriority(LCD_ER_IRQ,LCD_ER_PRIO);
+    NVIC_EnableIRQ(LCD_ER_IRQ);
 
 
     LCD_PutDisplayOperation();
@@ -828,12 +940,22 @@ void  LCD_DisableLayer(int layer) {
     LTDC->SRCR |= LTDC_SRCR_IMR;
 }
 
+/**
+ * @brief   Swap layers
+ *
+ * @note    The new configuration is only used in the next vertical blanking period
+ *          to avoid tearing. When the controller is disabled, there is no vertical
+ *          blanking and the reload is immediate.
+ */
 void  LCD_SwapLayers(void) {
 
-    LTDC_Layer[0]->CR ^= LTDC_LxCR_LEN;
     LTDC_Layer[1]->CR ^= LTDC_LxCR_LEN;
+    LTDC_Layer[2]->CR ^= LTDC_LxCR_LEN;
     // Reload parameters
-    LTDC->SRCR |= LTDC_SRCR_IMR;
+    if( LTDC->GCR&LTDC_GCR_LTDCEN )
+        LTDC->SRCR |= LTDC_SRCR_VBR;
+    else
+        LTDC->SRCR |= LTDC_SRCR_IMR;
 }
 
 
@@ -859,6 +981,479 @@ void  LCD_ReloadLayerByVerticalBlanking(int layer) {
     LTDC->SRCR |= LTDC_SRCR_VBR;
 }
 
+/**
+ * @brief   Wait until a pending reload of the shadow registers is done
+ *
+ * @note    VBR and IMR are cleared by the hardware after the reload. Until then, the
+ *          LTDC uses the previous values (e.g. the previous frame buffer address).
+ */
+void  LCD_WaitForReload(void) {
+
+    while( LTDC->SRCR&(LTDC_SRCR_VBR|LTDC_SRCR_IMR) ) {}
+}
+
+
+//////////////////////////// Page flipping /////////////////////////////////////////////////////////
+
+/**
+ * @brief   LTDC Event Interrupt Handler
+ *
+ * @note    Register reload: the queued frame buffers are now in use. The
+ *          former front buffers can be used for drawing.
+ *
+ * @note    Line: start of vertical blanking. Used as a time base. Modified CLUT
+ *          entries and windows moved are written here.
+ */
+static void writeclut(int layer);
+static void writewindow(int layer);
+
+/**
+ * @brief   Register reload done: the pending flips are done
+ */
+static void flipsdone(void) {
+int layer;
+
+    LTDC->ICR = LTDC_ICR_CRRIF;
+    for(layer=1;layer<=2;layer++) {
+        if( pageflipinfo[layer].pending ) {
+            pageflipinfo[layer].pending = 0;
+            presented++;
+            if( flipcallback )
+                flipcallback(layer);
+        }
+    }
+}
+
+void LCD_TFT_EV_IRQHandler(void) {
+uint32_t isr = LTDC->ISR;
+int layer;
+
+    if( isr&LTDC_ISR_RRIF )
+        flipsdone();
+    if( isr&LTDC_ISR_LIF ) {
+        LTDC->ICR = LTDC_ICR_CLIF;
+        vsyncs++;
+        for(layer=1;layer<=2;layer++) {
+            if( clutinfo[layer].last >= clutinfo[layer].first )
+                writeclut(layer);
+            if( windowinfo[layer].dirty )
+                writewindow(layer);
+        }
+    }
+}
+
+/**
+ * @brief   LTDC Error Interrupt Handler
+ *
+ * @note    A FIFO underrun happens when the LTDC cannot read the frame buffer fast
+ *          enough, usually because the DMA2D or the CPU keep the SDRAM busy.
+ */
+void LCD_TFT_ER_IRQHandler(void) {
+uint32_t isr = LTDC->ISR;
+
+    if( isr&LTDC_ISR_FUIF )
+        underruns++;
+    if( isr&LTDC_ISR_TERRIF )
+        transfererrors++;
+    LTDC->ICR = LTDC_ICR_CFUIF|LTDC_ICR_CTERRIF;
+}
+
+/**
+ * @brief   Enable/Disable double buffering for a layer
+ *
+ * @note    The frame buffer set by LCD_SetFullSizeFrameBuffer or LCD_SetFrameBuffer
+ *          is the first one. The second one must have the same size and pitch.
+ *
+ * @note    After enabling, all drawing routines write into the back buffer.
+ */
+///@{
+void  LCD_EnableDoubleBuffering(int layer, void *area) {
+PageFlipInfo_t *pf = &pageflipinfo[layer];
+
+    pf->buffer[0] = (void *) LTDC_Layer[layer]->CFBAR;
+    pf->buffer[1] = area;
+    pf->back      = 1;
+    pf->pending   = 0;
+}
+
+void  LCD_DisableDoubleBuffering(int layer) {
+PageFlipInfo_t *pf = &pageflipinfo[layer];
+
+    LCD_WaitForFlip(layer);
+    pf->buffer[0] = 0;
+    pf->buffer[1] = 0;
+    pf->back      = 0;
+}
+///@}
+
+/**
+ * @brief   Get address of the buffer used for drawing
+ *
+ * @note    It is the back buffer when double buffering is enabled, otherwise the
+ *          frame buffer shown.
+ */
+void *LCD_GetBackBufferAddress(int layer) {
+PageFlipInfo_t *pf = &pageflipinfo[layer];
+
+    if( pf->buffer[1] )
+        return pf->buffer[pf->back];
+    return (void *) LTDC_Layer[layer]->CFBAR;
+}
+
+/**
+ * @brief   Queue a page flip
+ *
+ * @note    The back buffer address is written to the CFBAR shadow register and will be
+ *          used from the next vertical blanking on. No tearing.
+ *
+ * @note    Drawing can start at once in the new back buffer, but it is still being
+ *          shown until the flip is done. Call LCD_WaitForFlip before overwriting it.
+ *
+ * @note    CFBAR, VBR and pending are set with the interrupts masked. A reload already
+ *          done (of a flip of the other layer) is handled before, so its interrupt
+ *          cannot clear pending before this CFBAR is in use.
+ *
+ * @return  0 if OK, -1 if double buffering is not enabled, -2 if a flip is pending
+ */
+int   LCD_FlipFrameBuffer(int layer) {
+PageFlipInfo_t *pf = &pageflipinfo[layer];
+uint32_t primask;
+
+    if( pf->buffer[1] == 0 )
+        return -1;
+    if( pf->pending )
+        return -2;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if( LTDC->ISR&LTDC_ISR_RRIF )
+        flipsdone();
+    LTDC_Layer[layer]->CFBAR = (uint32_t) pf->buffer[pf->back];
+    pf->back ^= 1;
+    if( LTDC->GCR&LTDC_GCR_LTDCEN ) {
+        LTDC->SRCR |= LTDC_SRCR_VBR;
+        pf->pending = 1;
+    } else {
+        // No vertical blanking. Reload now and do not wait for interrupt
+        LTDC->SRCR |= LTDC_SRCR_IMR;
+        presented++;
+    }
+    __set_PRIMASK(primask);
+    return 0;
+}
+
+/**
+ * @brief   Wait until the queued flip is done
+ */
+void  LCD_WaitForFlip(int layer) {
+
+    while( pageflipinfo[layer].pending ) {}
+}
+
+/**
+ * @brief   Register a function to be called (in interrupt context) when a flip is done
+ */
+void  LCD_SetFlipCallback(LCD_FlipCallback cb) {
+
+    flipcallback = cb;
+}
+
+/**
+ * @brief   Get refresh rate in Hz
+ *
+ * @note    Calculated from the pixel clock and the total width and height of the
+ *          display (including synchronization and porches). About 55 Hz for the RK043.
+ */
+int   LCD_GetRefreshRate(void) {
+uint32_t total;
+
+    total = (HSW+HBP+HAW+HFP)*(VSH+VBP+VAH+VFP);
+
+    return (LCD_FREQ+total/2)/total;
+}
+
+/**
+ * @brief   Set target frame rate used by LCD_WaitNextFrame
+ *
+ * @note    The frame rate is rounded to refresh rate divided by an integer
+ *          (55, 27, 18, 13, ...) because a new frame can only be shown in the vertical
+ *          blanking.
+ */
+void  LCD_SetFrameRate(int fps) {
+int refresh = LCD_GetRefreshRate();
+
+    if( fps <= 0 || fps > refresh )
+        fps = refresh;
+    framedivider = (refresh+fps/2)/fps;
+    if( framedivider == 0 )
+        framedivider = 1;
+    nextframe = vsyncs + framedivider;
+    pacing = 1;
+}
+
+/**
+ * @brief   Frame pacing
+ *
+ * @note    Wait for the start of the next frame period and returns the number of frames
+ *          dropped, i.e., periods missed because rendering took too long. The missed
+ *          periods are skipped and not recovered.
+ *
+ * @note    Typical main loop:
+ *
+ *              LCD_SetFrameRate(30);
+ *              for(;;) {
+ *                  LCD_WaitForFlip(1);
+ *                  Draw(...);
+ *                  LCD_FlipFrameBuffer(1);
+ *                  LCD_WaitNextFrame();
+ *              }
+ */
+int   LCD_WaitNextFrame(void) {
+int32_t late;
+int missed = 0;
+
+    if( !pacing )
+        LCD_SetFrameRate(0);
+
+    late = (int32_t) (vsyncs - nextframe);
+    if( late > 0 ) {
+        missed = late/framedivider+1;
+        dropped += missed;
+        nextframe += missed*framedivider;
+    }
+    while( (int32_t) (vsyncs-nextframe) < 0 ) {}
+    nextframe += framedivider;
+
+    return missed;
+}
+
+/**
+ * @brief   Get frame counters
+ */
+void  LCD_GetFrameStatistics(LCD_FrameStatistics *st) {
+
+    st->vsyncs    = vsyncs;
+    st->presented = presented;
+    st->dropped   = dropped;
+    st->underruns = underruns;
+    st->transfererrors = transfererrors;
+}
+
+
+/**
+ * @brief   LCD_InitCLUT
+ *
+ * @note    colors in RGB888. Entries not given are black
+ */
+void  LCD_InitCLUT(LCD_CLUT *clut, const uint32_t *colors, int n) {
+int i;
+
+    if( n > 256 )
+        n = 256;
+    for(i=0;i<256;i++)
+        clut->color[i] = (i < n) ? (colors[i]&0xFFFFFF) : 0;
+    clut->n = (n > 0) ? n : 1;
+    for(i=0;i<4096/32;i++)
+        clut->valid[i] = 0;
+}
+
+/**
+ * @brief   LCD_SetCLUTEntries
+ *
+ * @note    Change n entries starting at first. The inverse map is cleared. Nothing is
+ *          done when first is not an entry.
+ */
+void  LCD_SetCLUTEntries(LCD_CLUT *clut, int first, int n, const uint32_t *colors) {
+int i;
+
+    if( (first < 0) || (first >= 256) || (n <= 0) )
+        return;
+    for(i=0;(i<n)&&(first+i<256);i++)
+        clut->color[first+i] = colors[i]&0xFFFFFF;
+    if( first+i > clut->n )
+        clut->n = first+i;
+    for(i=0;i<4096/32;i++)
+        clut->valid[i] = 0;
+}
+
+/**
+ * @brief   LCD_RotateCLUT
+ *
+ * @note    Rotate n entries starting at first by step positions (color cycling).
+ *          The inverse map is cleared.
+ */
+void  LCD_RotateCLUT(LCD_CLUT *clut, int first, int n, int step) {
+uint32_t tmp[256];
+int i;
+
+    if( (n <= 1) || (first < 0) || (first+n > 256) )
+        return;
+    step %= n;
+    if( step < 0 )
+        step += n;
+    for(i=0;i<n;i++)
+        tmp[(i+step)%n] = clut->color[first+i];
+    for(i=0;i<n;i++)
+        clut->color[first+i] = tmp[i];
+    for(i=0;i<4096/32;i++)
+        clut->valid[i] = 0;
+}
+
+/*
+ * @brief   Index of the entry nearest to the center of a RGB444 cell among the first n
+ */
+static int nearestentry(const LCD_CLUT *clut, uint32_t key, int n) {
+int r,g,b,dr,dg,db,i,best;
+uint32_t d,dmin;
+
+    // center of the RGB444 cell
+    r = ((key>>4)&0xF0)|8;
+    g = (key&0xF0)|8;
+    b = ((key<<4)&0xF0)|8;
+    best = 0;
+    dmin = 0xFFFFFFFF;
+    for(i=0;i<n;i++) {
+        dr = r-(int) ((clut->color[i]>>16)&0xFF);
+        dg = g-(int) ((clut->color[i]>>8)&0xFF);
+        db = b-(int) (clut->color[i]&0xFF);
+        d  = 2*dr*dr+4*dg*dg+3*db*db;
+        if( d < dmin ) {
+            dmin = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief   LCD_FindCLUTIndex
+ *
+ * @note    Returns the index of the entry nearest to rgb
+ *
+ * @note    The search uses the color with 4 bits per component. The result is stored
+ *          in the inverse map, so next time the search is a table look-up.
+ */
+int   LCD_FindCLUTIndex(LCD_CLUT *clut, uint32_t rgb) {
+uint32_t key;
+int best;
+
+    key = ((rgb>>12)&0xF00)|((rgb>>8)&0xF0)|((rgb>>4)&0xF);
+    if( clut->valid[key>>5]&(1U<<(key&31)) )
+        return clut->invmap[key];
+
+    best = nearestentry(clut,key,clut->n);
+    clut->invmap[key] = best;
+    clut->valid[key>>5] |= 1U<<(key&31);
+    return best;
+}
+
+/**
+ * @brief   LCD_FindCLUTIndexN
+ *
+ * @note    Like LCD_FindCLUTIndex, but only the first n entries are searched (e.g. 16
+ *          for AL44). The inverse map is only used when it covers the same entries.
+ */
+int   LCD_FindCLUTIndexN(LCD_CLUT *clut, uint32_t rgb, int n) {
+
+    if( n >= clut->n )
+        return LCD_FindCLUTIndex(clut,rgb);
+    if( n <= 0 )
+        return 0;
+    return nearestentry(clut,((rgb>>12)&0xF00)|((rgb>>8)&0xF0)|((rgb>>4)&0xF),n);
+}
+
+/*
+ * @brief   Write modified CLUT entries of a layer into the LTDC
+ */
+static void writeclut(int layer) {
+LTDC_Layer_TypeDef *p = LTDC_Layer[layer];
+CLUTInfo_t *ci = &clutinfo[layer];
+int i;
+
+    if( ci->clut ) {
+        for(i=ci->first;i<=ci->last;i++)
+            p->CLUTWR = (i<<LTDC_LxCLUTWR_CLUTADD_Pos)|ci->clut->color[i];
+    }
+    ci->first = 0;
+    ci->last  = -1;
+}
+
+/**
+ * @brief   LCD_SetLayerCLUT
+ *
+ * @note    Set palette of layer and enable the CLUT. When the controller or the layer
+ *          is disabled, the CLUT is written immediately, otherwise at vertical blanking.
+ *          A null palette disables the CLUT.
+ *
+ * @note    The palette is used by the surfaces of the layer.
+ */
+void  LCD_SetLayerCLUT(int layer, LCD_CLUT *clut) {
+
+    clutinfo[layer].clut = clut;
+    if( !clut ) {
+        LCD_DisableCLUT(layer);
+        return;
+    }
+    LCD_UpdateLayerCLUT(layer,0,256);
+    LCD_EnableCLUT(layer);
+}
+
+/**
+ * @brief   LCD_UpdateLayerCLUT
+ *
+ * @note    Entries first to first+n-1 of the palette are written into the LTDC at
+ *          next vertical blanking (or now when the layer is not displayed)
+ */
+void  LCD_UpdateLayerCLUT(int layer, int first, int n) {
+CLUTInfo_t *ci = &clutinfo[layer];
+int last = first+n-1;
+
+    if( last > 255 )
+        last = 255;
+    if( first < 0 )
+        first = 0;
+    if( last < first )
+        return;
+
+    NVIC_DisableIRQ(LCD_EV_IRQ);
+    if( ci->last < ci->first ) {
+        ci->first = first;
+        ci->last  = last;
+    } else {
+        if( first < ci->first ) ci->first = first;
+        if( last > ci->last )   ci->last  = last;
+    }
+    if( ((LTDC->GCR&LTDC_GCR_LTDCEN) == 0) || ((LTDC_Layer[layer]->CR&LTDC_LxCR_LEN) == 0) )
+        writeclut(layer);
+    NVIC_EnableIRQ(LCD_EV_IRQ);
+}
+
+/**
+ * @brief   LCD_GetLayerCLUT
+ */
+LCD_CLUT *LCD_GetLayerCLUT(int layer) {
+
+    return clutinfo[layer].clut;
+}
+
+/**
+ * @brief   LCD_EnableCLUT
+ */
+void  LCD_EnableCLUT(int layer) {
+
+    LTDC_Layer[layer]->CR |= LTDC_LxCR_CLUTEN;
+    LTDC->SRCR |= LTDC_SRCR_VBR;
+}
+
+/**
+ * @brief   LCD_DisableCLUT
+ */
+void  LCD_DisableCLUT(int layer) {
+
+    LTDC_Layer[layer]->CR &= ~LTDC_LxCR_CLUTEN;
+    LTDC->SRCR |= LTDC_SRCR_VBR;
+}
+
 
 /*
  * @brief   LCD Set Default Color for layer
@@ -880,37 +1475,95 @@ void  LCD_SetFormat(int layer, int format) {
 
 
 
+/*
+ * @brief   Reload shadow registers at next vertical blanking
+ *
+ * @note    When the controller is disabled, there is no vertical blanking and the
+ *          reload is immediate.
+ */
+static void reloadlayers(void) {
+
+    if( LTDC->GCR&LTDC_GCR_LTDCEN )
+        LTDC->SRCR |= LTDC_SRCR_VBR;
+    else
+        LTDC->SRCR |= LTDC_SRCR_IMR;
+}
+
 /*
  * @brief   LCD SetLayerOpacity
  *
- * @note    Set of constant alpha opacity
+ * @note    Set of constant alpha opacity (0=transparent, 255=opaque). How it is
+ *          combined with the pixel alpha is set by LCD_SetLayerBlending.
  */
 void  LCD_SetLayerOpacity(int layer, int opacity) {
-uint32_t bfcr;
 
     if( opacity > 255 ) opacity = 255;
+    if( opacity < 0 )   opacity = 0;
 
     LTDC_Layer[layer]->CACR = opacity;
+    reloadlayers();
+}
 
-    bfcr = LTDC_Layer[layer]->BFCR;
-    if( layer == 1 ) {
-        LTDC_Layer[layer]->BFCR = (bfcr&~LTDC_LxBFCR_BF1_Msk)|(4<<LTDC_LxBFCR_BF1_Pos);
-    } else if ( layer == 2 ) {
-        LTDC_Layer[layer]->BFCR = (bfcr&~LTDC_LxBFCR_BF2_Msk)|(4<<LTDC_LxBFCR_BF2_Pos);
-    }
+/*
+ * @brief   LCD SetLayerBlending
+ *
+ * @note    The LTDC calculates C = BF1*Clayer + BF2*Cbelow. With LCD_BLEND_CONSTANT,
+ *          BF1 is the constant alpha and BF2 is 1-BF1. With LCD_BLEND_PIXEL, BF1 is
+ *          the pixel alpha multiplied by the constant alpha (reset configuration).
+ */
+void  LCD_SetLayerBlending(int layer, int mode) {
 
+    if( mode == LCD_BLEND_CONSTANT )
+        LTDC_Layer[layer]->BFCR = (4<<LTDC_LxBFCR_BF1_Pos)|(5<<LTDC_LxBFCR_BF2_Pos);
+    else
+        LTDC_Layer[layer]->BFCR = (6<<LTDC_LxBFCR_BF1_Pos)|(7<<LTDC_LxBFCR_BF2_Pos);
+    reloadlayers();
 }
 
 /*
  * @brief   LCD Set Color Key for layer
+ *
+ * @note    c is a RGB888 color. Pixels with this color are transparent when the color
+ *          keying is enabled
  */
 
 void
 LCD_SetColorKey(int layer,  uint32_t c ) {
 
-    LTDC_Layer[layer]->CKCR = c;
+    LTDC_Layer[layer]->CKCR = c&0xFFFFFF;
+    reloadlayers();
 }
 
+/*
+ * @brief   LCD Enable/Disable Color Keying for layer
+ */
+///@{
+void  LCD_EnableColorKey(int layer) {
+
+    LTDC_Layer[layer]->CR |= LTDC_LxCR_COLKEN;
+    reloadlayers();
+}
+
+void  LCD_DisableColorKey(int layer) {
+
+    LTDC_Layer[layer]->CR &= ~LTDC_LxCR_COLKEN;
+    reloadlayers();
+}
+///@}
+
+
+/*
+ * @brief   LCD Set Frame Buffer Address of a specified layer
+ *
+ * @note    Only the start address is changed, at next vertical blanking. It can be
+ *          used for hardware scrolling, moving the address through a larger buffer.
+ */
+void
+LCD_SetFrameBufferAddress(int layer, void *area) {
+
+    LTDC_Layer[layer]->CFBAR = (uint32_t) area;
+    reloadlayers();
+}
 
 /*
  * @brief   LCD Get Frame Buffer Address of a specified layer
@@ -963,6 +1616,9 @@ uint32_t ps,w,h,ws,hs,pitch,dw,dh;
     ps        = pixelsize[format];
     h         = display->height;
     w         = display->width;
+    pageflipinfo[layer].buffer[1] = 0;
+    windowinfo[layer].area  = 0;
+    windowinfo[layer].dirty = 0;
     p->PFCR   = format;
     pitch     = display->pitch[ps];
     p->CFBAR  = (uint32_t) area;
@@ -990,7 +1646,7 @@ uint32_t ps,w,h,ws,hs,pitch,dw,dh;
 void
 LCD_SetFrameBuffer(int layer, void *a, int f, int x, int y, int w, int h, int pi ) {
 LTDC_Layer_TypeDef *const p = LTDC_Layer[layer];
-uint32_t ps,uf,uw,uh,pitch,dw,dh,hmax,wmax;
+uint32_t ps,uw,uh,pitch,dw,dh,hmax,wmax;
 
     hmax      = display->height;
     wmax      = display->width;
@@ -998,13 +1654,16 @@ uint32_t ps,uf,uw,uh,pitch,dw,dh,hmax,wmax;
     pitch     = pi;
     // Avoid extrapolation
     if ( (x+w) > wmax )
-        w = (wmax-x)-1;
+        w = wmax-x;
     if ( (y+h) > hmax )
-        h = (hmax-y)-1;
+        h = hmax-y;
 
     // Configure dimensions
     uh        = h;
     uw        = w;
+    pageflipinfo[layer].buffer[1] = 0;
+    windowinfo[layer].area  = 0;
+    windowinfo[layer].dirty = 0;
     p->PFCR   = f;
     p->CFBAR  = (uint32_t) a;
     p->CFBLR  = (pitch<<LTDC_LxCFBLR_CFBP_Pos) | ((uw*ps+3)<<LTDC_LxCFBLR_CFBLL_Pos);
@@ -1025,6 +1684,150 @@ uint32_t ps,uf,uw,uh,pitch,dw,dh,hmax,wmax;
     LTDC->SRCR |= LTDC_SRCR_IMR;
 }
 
+//////////////////////////// Layer composition /////////////////////////////////////////////////
+
+/*
+ * @brief   Calculate register values for the visible part of a window
+ *
+ * @note    The LTDC window must be inside the display, so the window is clipped and
+ *          the frame buffer address is moved to the first visible pixel.
+ */
+static void calcwindow(int layer) {
+WindowInfo_t *wi = &windowinfo[layer];
+int x0,y0,x1,y1,ps,dw,dh;
+
+    x0 = wi->x;
+    y0 = wi->y;
+    x1 = wi->x+wi->w;
+    y1 = wi->y+wi->h;
+    if( x0 < 0 )                    x0 = 0;
+    if( y0 < 0 )                    y0 = 0;
+    if( x1 > (int) display->width ) x1 = display->width;
+    if( y1 > (int) display->height) y1 = display->height;
+
+    wi->visible = (x0 < x1) && (y0 < y1);
+    if( !wi->visible )
+        return;
+
+    ps = pixelsize[wi->format];
+    dw = (LTDC->BPCR&LTDC_BPCR_AHBP_Msk)>>LTDC_BPCR_AHBP_Pos;
+    dh = (LTDC->BPCR&LTDC_BPCR_AVBP_Msk)>>LTDC_BPCR_AVBP_Pos;
+
+    wi->cfbar  = (uint32_t) wi->area+(y0-wi->y)*wi->pitch+(x0-wi->x)*ps;
+    wi->cfblr  = (wi->pitch<<LTDC_LxCFBLR_CFBP_Pos)|(((x1-x0)*ps+3)<<LTDC_LxCFBLR_CFBLL_Pos);
+    wi->cfblnr = (y1-y0)<<LTDC_LxCFBLNR_CFBLNBR_Pos;
+    wi->whpcr  = ((x1+dw)<<LTDC_LxWHPCR_WHSPPOS_Pos)|((x0+dw+1)<<LTDC_LxWHPCR_WHSTPOS_Pos);
+    wi->wvpcr  = ((y1+dh)<<LTDC_LxWVPCR_WVSPPOS_Pos)|((y0+dh+1)<<LTDC_LxWVPCR_WVSTPOS_Pos);
+}
+
+/*
+ * @brief   Write window registers of a layer and reload them
+ *
+ * @note    Called in the vertical blanking, so the immediate reload is safe. A window
+ *          totally outside the display is shown by disabling the layer.
+ */
+static void writewindow(int layer) {
+LTDC_Layer_TypeDef *p = LTDC_Layer[layer];
+WindowInfo_t *wi = &windowinfo[layer];
+
+    if( wi->visible ) {
+        p->CFBAR  = wi->cfbar;
+        p->CFBLR  = wi->cfblr;
+        p->CFBLNR = wi->cfblnr;
+        p->WHPCR  = wi->whpcr;
+        p->WVPCR  = wi->wvpcr;
+        p->CR    |= LTDC_LxCR_LEN;
+    } else {
+        p->CR    &= ~LTDC_LxCR_LEN;
+    }
+    LTDC->SRCR |= LTDC_SRCR_IMR;
+    wi->dirty = 0;
+}
+
+/**
+ * @brief   LCD_SetLayerWindow
+ *
+ * @note    Use a buffer of size w x h as a window of the layer with its top left corner
+ *          at (x,y). The window can be partially or totally outside the display.
+ *          pitch = 0 means w*pixelsize rounded up to a multiple of 4.
+ *
+ * @note    Draw into the window using LCD_GetLayerSurface. Coordinates are relative
+ *          to the window. Double buffering is disabled.
+ */
+void  LCD_SetLayerWindow(int layer, void *area, int format, int x, int y, int w, int h, int pitch) {
+WindowInfo_t *wi = &windowinfo[layer];
+
+    if( pitch == 0 )
+        pitch = (w*pixelsize[format]+3)&~3;
+
+    NVIC_DisableIRQ(LCD_EV_IRQ);
+    pageflipinfo[layer].buffer[1] = 0;
+    LTDC_Layer[layer]->PFCR = format;
+    wi->area   = area;
+    wi->format = format;
+    wi->x      = x;
+    wi->y      = y;
+    wi->w      = w;
+    wi->h      = h;
+    wi->pitch  = pitch;
+    calcwindow(layer);
+    // Nothing shown yet. Configure now
+    writewindow(layer);
+    NVIC_EnableIRQ(LCD_EV_IRQ);
+}
+
+/**
+ * @brief   LCD_SetLayerPosition
+ *
+ * @note    Move the layer window to (hp,vp). The new position is used from the next
+ *          frame on. Only register values are changed, nothing is redrawn.
+ *
+ * @note    For a layer set by LCD_SetFullSizeFrameBuffer or LCD_SetFrameBuffer, the
+ *          frame buffer becomes a window. The layer is enabled when some part of the
+ *          window is visible and disabled otherwise.
+ */
+void  LCD_SetLayerPosition(int layer, int hp, int vp) {
+WindowInfo_t *wi = &windowinfo[layer];
+
+    NVIC_DisableIRQ(LCD_EV_IRQ);
+    if( wi->area == 0 ) {
+        pageflipinfo[layer].buffer[1] = 0;
+        wi->area   = LCD_GetFrameBufferAddress(layer);
+        wi->format = LCD_GetFormat(layer);
+        wi->w      = LCD_GetWidth(layer);
+        wi->h      = LCD_GetHeight(layer);
+        wi->pitch  = LCD_GetPitch(layer);
+    }
+    wi->x = hp;
+    wi->y = vp;
+    calcwindow(layer);
+    if( LTDC->GCR&LTDC_GCR_LTDCEN )
+        wi->dirty = 1;
+    else
+        writewindow(layer);
+    NVIC_EnableIRQ(LCD_EV_IRQ);
+}
+
+/**
+ * @brief   LCD_GetLayerPosition
+ *
+ * @note    Position of the top left corner of the layer window
+ */
+void  LCD_GetLayerPosition(int layer, int *hp, int *vp) {
+LTDC_Layer_TypeDef *p = LTDC_Layer[layer];
+int dw,dh;
+
+    if( windowinfo[layer].area ) {
+        *hp = windowinfo[layer].x;
+        *vp = windowinfo[layer].y;
+        return;
+    }
+    dw  = (LTDC->BPCR&LTDC_BPCR_AHBP_Msk)>>LTDC_BPCR_AHBP_Pos;
+    dh  = (LTDC->BPCR&LTDC_BPCR_AVBP_Msk)>>LTDC_BPCR_AVBP_Pos;
+    *hp = ((p->WHPCR&LTDC_LxWHPCR_WHSTPOS_Msk)>>LTDC_LxWHPCR_WHSTPOS_Pos)-dw-1;
+    *vp = ((p->WVPCR&LTDC_LxWVPCR_WVSTPOS_Msk)>>LTDC_LxWVPCR_WVSTPOS_Pos)-dh-1;
+}
+
 /**
  * @brief Get Framebuffer height
  *
@@ -1074,11 +1877,13 @@ LCD_GetPitch(int layer) {
  *
  * @note    It uses the pitch information to calculate the start position
  *          of a line in buffer
+ *
+ * @note    When double buffering is enabled, it is a line of the back buffer
  */
 void *LCD_GetLineAddress(int layer, int line) {
 LTDC_Layer_TypeDef *p = LTDC_Layer[layer];
 
-    uint32_t base = p->CFBAR;
+    uint32_t base = (uint32_t) LCD_GetBackBufferAddress(layer);
     uint32_t pitch = p->CFBLR>>LTDC_LxCFBLR_CFBP_Pos;
 
     return (void *) (base + line*pitch);
@@ -1247,6 +2052,335 @@ uint32_t *q;
 }
 
 
+typedef void (*FillFunction)(void *area, int n, unsigned c);
+
+static const FillFunction fillfunction[] = { 0, fill1, fill2, fill3, fill4 };
+
+//////////////////////////// Surface routines //////////////////////////////////////////////////////
+
+/*
+ * @brief   LCD Get Pixel Size in bytes of the format specified
+ */
+int   LCD_GetFormatPixelSize(int format) {
+
+    return pixelsize[format];
+}
+
+/*
+ * @brief   LCD_InitSurface
+ *
+ * @note    If pitch is zero, lines are packed and word aligned
+ */
+void
+LCD_InitSurface(LCD_Surface *s, void *area, int format, int x, int y, int w, int h, int pitch) {
+
+    if( pitch == 0 )
+        pitch = (w*pixelsize[format]+3)&~3;
+
+    s->area   = area;
+    s->format = format;
+    s->x      = x;
+    s->y      = y;
+    s->w      = w;
+    s->h      = h;
+    s->pitch  = pitch;
+    s->clut   = 0;
+}
+
+/*
+ * @brief   LCD_GetLayerSurface
+ *
+ * @note    The surface describes the back buffer when double buffering is enabled
+ *
+ * @note    Screen coordinates are relative to the layer window
+ */
+void
+LCD_GetLayerSurface(int layer, LCD_Surface *s) {
+WindowInfo_t *wi = &windowinfo[layer];
+
+    if( wi->area )
+        LCD_InitSurface(s, wi->area, wi->format, 0, 0, wi->w, wi->h, wi->pitch);
+    else
+        LCD_InitSurface(s, LCD_GetBackBufferAddress(layer), LCD_GetFormat(layer),
+                        0, 0, LCD_GetWidth(layer), LCD_GetHeight(layer), LCD_GetPitch(layer));
+    s->clut = clutinfo[layer].clut;
+}
+
+/*
+ * @brief   LCD_GetSurfacePixelAddress
+ *
+ * @note    No clipping. (x,y) must be inside surface
+ */
+void *
+LCD_GetSurfacePixelAddress(const LCD_Surface *s, int x, int y) {
+
+    return (char *) s->area + (y-s->y)*s->pitch + (x-s->x)*pixelsize[s->format];
+}
+
+/*
+ * @brief   LCD_SurfacePutPixel
+ *
+ * @note    Pixel is stored in little endian order (the LTDC order)
+ */
+void
+LCD_SurfacePutPixel(const LCD_Surface *s, int x, int y, unsigned color) {
+uint8_t *p;
+
+    if( (x < s->x) || (x >= s->x+s->w) || (y < s->y) || (y >= s->y+s->h) )
+        return;
+
+    p = (uint8_t *) LCD_GetSurfacePixelAddress(s,x,y);
+    switch(pixelsize[s->format]) {
+    case 4: p[3] = (color>>24)&0xFF;
+    case 3: p[2] = (color>>16)&0xFF;
+    case 2: p[1] = (color>>8)&0xFF;
+    case 1: p[0] = color&0xFF;
+    }
+}
+
+/*
+ * @brief   LCD_SurfaceFillSpan
+ *
+ * @note    Fill n pixels of line y starting at x using the word fill routines
+ */
+void
+LCD_SurfaceFillSpan(const LCD_Surface *s, int x, int y, int n, unsigned color) {
+int ps;
+
+    if( (y < s->y) || (y >= s->y+s->h) )
+        return;
+    if( x < s->x ) {
+        n -= s->x-x;
+        x  = s->x;
+    }
+    if( x+n > s->x+s->w )
+        n = s->x+s->w-x;
+    if( n <= 0 )
+        return;
+
+    ps = pixelsize[s->format];
+    fillfunction[ps](LCD_GetSurfacePixelAddress(s,x,y),n*ps,color);
+}
+
+/*
+ * @brief   LCD_SurfaceFillRect
+ *
+ * @note    Fill a w x h rectangle with top left corner at (x,y)
+ */
+void
+LCD_SurfaceFillRect(const LCD_Surface *s, int x, int y, int w, int h, unsigned color) {
+int i;
+
+    if( y < s->y ) {
+        h -= s->y-y;
+        y  = s->y;
+    }
+    if( y+h > s->y+s->h )
+        h = s->y+s->h-y;
+
+    for(i=0;i<h;i++)
+        LCD_SurfaceFillSpan(s,x,y+i,w,color);
+}
+
+//////////////////////////// Blending routines /////////////////////////////////////////////////////
+
+/*
+ * @brief   Interpolate two ARGB8888 values
+ *
+ * @note    a is in range 0-256. Two channels are processed in each multiplication.
+ */
+static uint32_t lerp8888(uint32_t d, uint32_t s, unsigned a) {
+uint32_t rb,ag;
+
+    rb = (((s&0x00FF00FF)*a+(d&0x00FF00FF)*(256-a))>>8)&0x00FF00FF;
+    ag = ((((s>>8)&0x00FF00FF)*a+((d>>8)&0x00FF00FF)*(256-a)))&0xFF00FF00;
+    return rb|ag;
+}
+
+/*
+ * @brief   Blend one pixel at address p
+ *
+ * @note    c is the color already converted to ARGB8888, color is the raw value
+ *
+ * @note    Formats using CLUT (L8, AL44, AL88) are interpolated in RGB and the result
+ *          is mapped to the nearest palette entry. Without a palette, the pixel is
+ *          written when alpha is at least 128.
+ */
+static void blendpixel(uint8_t *p, int format, LCD_CLUT *clut, uint32_t color, uint32_t c,
+                       unsigned alpha) {
+uint32_t d;
+
+    if( alpha == 0 )
+        return;
+    if( alpha >= 255 ) {
+        Pixel_Write(p,format,color);
+        return;
+    }
+    if( format >= LCD_FORMAT_L8 ) {
+        if( clut ) {
+            d = Pixel_Unpack(format,Pixel_Read(p,format),clut->color);
+            d = lerp8888(d,c,alpha+(alpha>>7));
+            Pixel_Write(p,format,Pixel_PackCLUT(format,d,clut));
+        } else if( alpha >= 128 ) {
+            Pixel_Write(p,format,color);
+        }
+        return;
+    }
+    d = Pixel_Unpack(format,Pixel_Read(p,format),0);
+    d = lerp8888(d,c,alpha+(alpha>>7));
+    Pixel_Write(p,format,Pixel_Pack(format,d));
+}
+
+/*
+ * @brief   Color of a surface converted to ARGB8888
+ */
+static inline uint32_t surfacecolor(const LCD_Surface *s, uint32_t color) {
+
+    return Pixel_Unpack(s->format,color,s->clut?s->clut->color:0);
+}
+
+/*
+ * @brief   LCD_SurfaceGetPixel
+ *
+ * @note    Returns 0 when outside surface
+ */
+unsigned
+LCD_SurfaceGetPixel(const LCD_Surface *s, int x, int y) {
+
+    if( (x < s->x) || (x >= s->x+s->w) || (y < s->y) || (y >= s->y+s->h) )
+        return 0;
+
+    return Pixel_Read(LCD_GetSurfacePixelAddress(s,x,y),s->format);
+}
+
+/*
+ * @brief   LCD_SurfaceBlendPixel
+ *
+ * @note    Mix color into the pixel. alpha=0 keeps the pixel, alpha=255 replaces it
+ */
+void
+LCD_SurfaceBlendPixel(const LCD_Surface *s, int x, int y, unsigned color, unsigned alpha) {
+
+    if( (x < s->x) || (x >= s->x+s->w) || (y < s->y) || (y >= s->y+s->h) )
+        return;
+
+    blendpixel(LCD_GetSurfacePixelAddress(s,x,y),s->format,s->clut,color,
+               surfacecolor(s,color),alpha);
+}
+
+/*
+ * @brief   LCD_SurfaceBlendSpan
+ *
+ * @note    Blend n pixels of line y with the same alpha
+ */
+void
+LCD_SurfaceBlendSpan(const LCD_Surface *s, int x, int y, int n, unsigned color, unsigned alpha) {
+uint8_t *p;
+uint32_t c;
+int ps;
+
+    if( alpha >= 255 ) {
+        LCD_SurfaceFillSpan(s,x,y,n,color);
+        return;
+    }
+    if( (alpha == 0) || (y < s->y) || (y >= s->y+s->h) )
+        return;
+    if( x < s->x ) {
+        n -= s->x-x;
+        x  = s->x;
+    }
+    if( x+n > s->x+s->w )
+        n = s->x+s->w-x;
+
+    ps = pixelsize[s->format];
+    p  = (uint8_t *) LCD_GetSurfacePixelAddress(s,x,y);
+    c  = surfacecolor(s,color);
+    while( n-- > 0 ) {
+        blendpixel(p,s->format,s->clut,color,c,alpha);
+        p += ps;
+    }
+}
+
+/*
+ * @brief   LCD_SurfaceBlendMask
+ *
+ * @note    Blend n pixels of line y using one alpha value for each pixel
+ *
+ * @note    Runs of opaque pixels are filled with the word fill routines and
+ *          runs of transparent pixels are skipped.
+ */
+void
+LCD_SurfaceBlendMask(const LCD_Surface *s, int x, int y, int n, unsigned color, const uint8_t *mask) {
+uint8_t *p;
+uint32_t c;
+int ps,i,k;
+
+    if( (y < s->y) || (y >= s->y+s->h) )
+        return;
+    if( x < s->x ) {
+        n    -= s->x-x;
+        mask += s->x-x;
+        x     = s->x;
+    }
+    if( x+n > s->x+s->w )
+        n = s->x+s->w-x;
+    if( n <= 0 )
+        return;
+
+    ps = pixelsize[s->format];
+    p  = (uint8_t *) LCD_GetSurfacePixelAddress(s,x,y);
+    c  = surfacecolor(s,color);
+    i  = 0;
+    while( i < n ) {
+        if( mask[i] == 255 ) {
+            for(k=i+1;(k<n)&&(mask[k]==255);k++) {}
+            fillfunction[ps](p+i*ps,(k-i)*ps,color);
+            i = k;
+        } else if( mask[i] == 0 ) {
+            i++;
+        } else {
+            blendpixel(p+i*ps,s->format,s->clut,color,c,mask[i]);
+            i++;
+        }
+    }
+}
+
+/*
+ * @brief   LCD_SurfaceDrawLine
+ *
+ * @note    Bresenham algorithm for all octants. Points outside surface are clipped.
+ */
+void
+LCD_SurfaceDrawLine(const LCD_Surface *s, int x0, int y0, int x1, int y1, unsigned color) {
+int dx,dy,sx,sy,err,e2;
+
+    // Trivial rejection
+    if( ((x0 < s->x) && (x1 < s->x)) || ((x0 >= s->x+s->w) && (x1 >= s->x+s->w))
+      ||((y0 < s->y) && (y1 < s->y)) || ((y0 >= s->y+s->h) && (y1 >= s->y+s->h)) )
+        return;
+
+    dx  = (x1>x0)?(x1-x0):(x0-x1);
+    dy  = (y1>y0)?(y0-y1):(y1-y0);
+    sx  = (x0<x1)?1:-1;
+    sy  = (y0<y1)?1:-1;
+    err = dx+dy;
+    for(;;) {
+        LCD_SurfacePutPixel(s,x0,y0,color);
+        if( (x0 == x1) && (y0 == y1) )
+            break;
+        e2 = 2*err;
+        if( e2 >= dy ) {
+            err += dy;
+            x0  += sx;
+        }
+        if( e2 <= dx ) {
+            err += dx;
+            y0  += sy;
+        }
+    }
+}
+
+
 /*
  * @brief   LCD_FillFrameBuffer
  *
@@ -1254,14 +2388,13 @@ uint32_t *q;
  */
 void
 LCD_FillFrameBuffer(int layer, unsigned color ) {
-LTDC_Layer_TypeDef *p = LTDC_Layer[layer];
 int  ps;
 char *area,*lineaddr;
 int  w,h,pitch;
 int i;
 
     ps     = LCD_GetPixelSize(layer);
-    area   = (char *) LCD_GetFrameBufferAddress(layer);
+    area   = (char *) LCD_GetBackBufferAddress(layer);
     w      = LCD_GetWidth(layer);
     h      = LCD_GetHeight(layer);
     pitch  = LCD_GetPitch(layer);
@@ -1371,13 +2504,12 @@ uint8_t c1,c2,c3,c4;
  */
 void
 LCD_DrawVerticalLine(int layer, int x, int y, int size, unsigned color) {
-int  ps,w,h,i;
+int  ps,h,i;
 char *lineaddr;
 char *q;
 uint8_t c1,c2,c3,c4;
 
     ps     = LCD_GetPixelSize(layer);
-    w      = LCD_GetWidth(layer);
     h      = LCD_GetHeight(layer);
 
     if( (y+size) > h )
@@ -1394,7 +2526,6 @@ uint8_t c1,c2,c3,c4;
         }
         break;
     case 2:
-        q = lineaddr + x*2;
         c1 = color&0xFF;
         c2 = (color>>8)&0xFF;
         for(i=0;i<size;i++) {
@@ -1406,7 +2537,6 @@ uint8_t c1,c2,c3,c4;
         }
         break;
     case 3:
-        q = lineaddr + x*3;
         c1 = color&0xFF;
         c2 = (color>>8)&0xFF;
         c3 = (color>>16)&0xFF;
@@ -1445,9 +2575,7 @@ uint8_t c1,c2,c3,c4;
 void
 LCD_DrawBox(int layer, int x, int y, int sizew, int sizeh, unsigned color, unsigned bordercolor) {
 int  ps,w,h,i;
-char *lineaddr;
 char *q;
-uint8_t c1,c2,c3,c4;
 
     ps     = LCD_GetPixelSize(layer);
     w      = LCD_GetWidth(layer);
@@ -1489,151 +2617,15 @@ uint8_t c1,c2,c3,c4;
     }
 }
 
-/*
- * @brief Mark point
- */
-static void plot(char *p, int ps, unsigned color ) {
-
-    switch(ps) {
-    case 4: *p++ = (color>>24)&0xFF;
-    case 3: *p++ = (color>>16)&0xFF;
-    case 2: *p++ = (color>>8)&0xFF;
-    case 1: *p++ = color&0xFF;
-    }
-}
 /*
  * @brief   LCD_DrawLine
  *
- * @note    Draw an vertical line from point (x,y) with size 'size'
+ * @note    Draw a line from point (x,y) to point (x+dx,y+dy)
  */
-
-#define ABS(X)  ((X)>0?(X):-(X))
-
 void
 LCD_DrawLine(int layer, int x, int y, int dx, int dy, unsigned color) {
-enum   { Q0=0, Q1=1, Q2=5, Q3=4, Q4=6, Q5= 7, Q6=3, Q7=2 } octantcode;
-int xi,yi;
-int x1,x2,y1,y2;
-int key;
-int eps;
-int ps,w,h,pitch;
-char *lineaddr;
-
-    ps       = LCD_GetPixelSize(layer);
-    w        = LCD_GetWidth(layer);
-    h        = LCD_GetHeight(layer);
-    pitch    = LCD_GetPitch(layer);
-    lineaddr = (char *) LCD_GetLineAddress(layer,y);
+LCD_Surface s;
 
-    if( (x+dx) > w )
-        dx = w-x;
-    if( (y+dy) > h )
-        dy = h-y;
-
-    // Build oct value setting bits according octant
-    key = 0;
-    // find quadrant first
-    if( dx < 0 ) key |= 4;
-    if( dy < 0 ) key |= 2;
-    // find octant using rules according each quadrant
-    if( ABS(dy) > ABS(dx) ) key |= 1;
-    eps = 0;
-    x1 = x;
-    y1 = y;
-    x2 = x+dx;
-    y2 = y+dy;
-    xi = x1;
-    yi = y1;
-    lineaddr = (char *) LCD_GetLineAddress(layer,yi);
-    switch(key){
-    case Q0: // 1st octant
-        for(xi=x; xi<=x2;xi++) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps += dy;
-            if( (eps<<1) >= dx ) {
-                yi++;
-                eps -= dx;
-                lineaddr += pitch;
-            }
-        }
-        break;
-    case Q1: // 2nd octant
-        for(yi=y1; yi<=y2;yi++) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps += dx;
-            if( (eps<<1) >= dy ) {
-                xi++;
-                eps -= dy;
-            }
-            lineaddr += pitch;
-        }
-        break;
-    case Q2: // 3rd octant
-        for(yi=y1; yi<=y2;yi++) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps -= dx;
-            if( (eps<<1) >= dy ) {
-                xi--;
-                eps -= dy;
-            }
-            lineaddr += pitch;
-        }
-        break;
-    case Q3: // 4th octant
-        for(xi=x; xi>=x2;xi--) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps += dy;
-            if( (eps<<1) >= -dx ) {
-                yi++;
-                eps += dx;
-                lineaddr += pitch;
-            }
-        }
-        break;
-    case Q4: // 5th octant
-        for(xi=x; xi>=x2;xi--) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps -= dy;
-            if( (eps<<1) >= -dx ) {
-                yi--;
-                eps += dx;
-                lineaddr -= pitch;
-            }
-        }
-        break;
-    case Q5: // 6th octant
-        for(yi=y1; yi>=y2;yi--) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps -= dx;
-            if( (eps<<1) >= -dy ) {
-                xi--;
-                eps += dy;
-            }
-            lineaddr -= pitch;
-        }
-        break;
-    case Q6: // 7th octant
-        for(yi=y1; yi>=y2;yi--) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps += dx;
-            if( (eps<<1) >= -dy ) {
-                xi++;
-                eps += dy;
-            }
-            lineaddr -= pitch;
-        }
-        break;
-    case Q7: // 8th octant
-        for(xi=x; xi<=x2;xi++) {
-            plot(lineaddr+xi*ps,ps,color);
-            eps -= dy;
-            if( (eps<<1) >= dx ) {
-                yi--;
-                eps -= dx;
-                lineaddr -= pitch;
-            }
-        }
-        break;
-    }
+    LCD_GetLayerSurface(layer,&s);
+    LCD_SurfaceDrawLine(&s,x,y,x+dx,y+dy,color);
 }
-
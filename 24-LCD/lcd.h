@@ -20,13 +20,31 @@
 #define RGB(R,G,B)     ( (((uint32_t) (R))<<16)         \
                         |(((uint32_t) (G))<<8)          \
                         |(((uint32_t) (B))<<0) )
-#define RGB565(R,G,B)  ( (((uint16_t)((R)&0x1F))<<8)    \
-                        |(((uint16_t)((G)&0x3F))<<3)    \
-                        |(((uint16_t)((B)&0x1F))>>3) )
-#define RGB555(R,G,B)  ( (((uint16_t)((R)&0x1F))<<7)    \
-                        |(((uint16_t)((G)&0x1F))<<3)    \
-                        |(((uint16_t)((B)&0x1F))>>3) )
-#define RGBA(R,G,B)    ( (((uint32_t) (A))<<24)         \
+
+/**
+ * @brief   Create a color in the 16-bit formats
+ *
+ * @note    R, G and B are 8-bit values (0-255). Low order bits are discarded
+ */
+///@{
+#define RGB565(R,G,B)  ( (((uint16_t)((R)&0xF8))<<8)    \
+                        |(((uint16_t)((G)&0xFC))<<3)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+#define RGB555(R,G,B)  ( (((uint16_t)((R)&0xF8))<<7)    \
+                        |(((uint16_t)((G)&0xF8))<<2)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+#define ARGB1555(A,R,G,B) ( (((uint16_t)((A)&0x80))<<8) \
+                        |RGB555(R,G,B) )
+#define ARGB4444(A,R,G,B) ( (((uint16_t)((A)&0xF0))<<8) \
+                        |(((uint16_t)((R)&0xF0))<<4)    \
+                        |(((uint16_t)((G)&0xF0))<<0)    \
+                        |(((uint16_t)((B)&0xF0))>>4) )
+///@}
+
+/**
+ * @brief   Create a ARGB8888 color
+ */
+#define RGBA(R,G,B,A)  ( (((uint32_t) (A))<<24)         \
                         |(((uint32_t) (R))<<16)         \
                         |(((uint32_t) (G))<<8)          \
                         |(((uint32_t) (B))<<0) )
@@ -43,6 +61,14 @@
 #define LCD_FORMAT_AL44             (6)
 #define LCD_FORMAT_AL88             (7)
 
+/**
+ * @brief   Layer blending modes
+ */
+///@{
+#define LCD_BLEND_CONSTANT          (0)     ///< Constant alpha only
+#define LCD_BLEND_PIXEL             (1)     ///< Pixel alpha times constant alpha (default)
+///@}
+
 /**
  * @brief   Active area
  */
@@ -57,6 +83,55 @@ typedef struct {
     uint8_t     R;
 } RGB_t;
 
+/**
+ * @brief   Frame counters
+ */
+typedef struct {
+    uint32_t    vsyncs;             ///< Vertical blankings since initialization
+    uint32_t    presented;          ///< Frames shown by page flipping
+    uint32_t    dropped;            ///< Frame periods missed by LCD_WaitNextFrame
+    uint32_t    underruns;          ///< FIFO underruns of the LTDC
+    uint32_t    transfererrors;     ///< Bus errors of the LTDC
+} LCD_FrameStatistics;
+
+/**
+ * @brief   Color look-up table (palette) for L8, AL44 and AL88 formats
+ *
+ * @note    invmap caches the nearest entry for colors with 4 bits per component.
+ *          It is filled on demand and valid has one bit for each entry.
+ */
+typedef struct {
+    uint32_t    color[256];         ///< Colors in RGB888
+    int         n;                  ///< Number of entries used
+    uint8_t     invmap[4096];       ///< Inverse map (RGB444 to index)
+    uint32_t    valid[4096/32];     ///< Valid bits of inverse map
+} LCD_CLUT;
+
+/**
+ * @brief   Drawing surface
+ *
+ * @note    It describes a memory area where drawing is done. It can be the
+ *          (back) buffer of a layer or an off-screen area, like a tile.
+ *
+ * @note    x and y are the screen coordinates of the first pixel. Drawing routines
+ *          use screen coordinates and clip against the surface limits.
+ */
+typedef struct {
+    void       *area;               ///< Address of first pixel
+    int         format;             ///< Pixel format (LCD_FORMAT_*)
+    int         x;                  ///< Horizontal position of first pixel
+    int         y;                  ///< Vertical position of first pixel
+    int         w;                  ///< Width in pixels
+    int         h;                  ///< Height in lines
+    int         pitch;              ///< Distance in bytes between lines
+    LCD_CLUT   *clut;               ///< Palette for L8, AL44 and AL88 (0 = gray)
+} LCD_Surface;
+
+/**
+ * @brief   Function called when a page flip is done (interrupt context)
+ */
+typedef void (*LCD_FlipCallback)(int layer);
+
 
 void  LCD_Init(void);
 
@@ -89,20 +164,87 @@ void  LCD_DisableLayer(int layer);
 void  LCD_SwapLayers(void);
 void  LCD_ReloadLayerImmediately(int layer);
 void  LCD_ReloadLayerByVerticalBlanking(int layer);
-void  LCD_SetLayerPosition(int layer, int hp, int vp);
+void  LCD_WaitForReload(void);
 void  LCD_SetLayerOpacity(int layer, int opacity);
 
+/**
+ * @brief Layer composition
+ *
+ * @note  Static content stays in layer 1 and moving or partial size content (cursors,
+ *        popups, panels) goes to layer 2. Moving a window or changing its opacity
+ *        only changes LTDC registers at vertical blanking. Nothing is redrawn.
+ */
+void  LCD_SetLayerWindow(int layer, void *area, int format, int x, int y, int w, int h, int pitch);
+void  LCD_SetLayerPosition(int layer, int hp, int vp);
+void  LCD_GetLayerPosition(int layer, int *hp, int *vp);
+void  LCD_SetLayerBlending(int layer, int mode);
+void  LCD_EnableColorKey(int layer);
+void  LCD_DisableColorKey(int layer);
+
+/**
+ * @brief Page flipping and frame pacing
+ *
+ * @note  With double buffering enabled, drawing is done in the back buffer and
+ *        LCD_FlipFrameBuffer queues a switch of the buffers at vertical blanking.
+ */
+void  LCD_EnableDoubleBuffering(int layer, void *area);
+void  LCD_DisableDoubleBuffering(int layer);
+void *LCD_GetBackBufferAddress(int layer);
+int   LCD_FlipFrameBuffer(int layer);
+void  LCD_WaitForFlip(int layer);
+void  LCD_SetFlipCallback(LCD_FlipCallback cb);
+int   LCD_GetRefreshRate(void);
+void  LCD_SetFrameRate(int fps);
+int   LCD_WaitNextFrame(void);
+void  LCD_GetFrameStatistics(LCD_FrameStatistics *st);
+
+/**
+ * @brief CLUT (palette) management
+ *
+ * @note  The layer CLUT is written at vertical blanking, so colors can be animated
+ *        without artifacts by changing entries and calling LCD_UpdateLayerCLUT.
+ */
+void  LCD_InitCLUT(LCD_CLUT *clut, const uint32_t *colors, int n);
+void  LCD_SetCLUTEntries(LCD_CLUT *clut, int first, int n, const uint32_t *colors);
+void  LCD_RotateCLUT(LCD_CLUT *clut, int first, int n, int step);
+int   LCD_FindCLUTIndex(LCD_CLUT *clut, uint32_t rgb);
+int   LCD_FindCLUTIndexN(LCD_CLUT *clut, uint32_t rgb, int n);
+void  LCD_SetLayerCLUT(int layer, LCD_CLUT *clut);
+void  LCD_UpdateLayerCLUT(int layer, int first, int n);
+LCD_CLUT *LCD_GetLayerCLUT(int layer);
+void  LCD_EnableCLUT(int layer);
+void  LCD_DisableCLUT(int layer);
+
 void *LCD_GetLineAddress(int layer, int line);
 int   LCD_GetHeight(int layer);
 int   LCD_GetWidth(int layer);
 int   LCD_GetPitch(int layer);
 void *LCD_GetFrameBufferAddress(int layer);
+void  LCD_SetFrameBufferAddress(int layer, void *area);
 void  LCD_SetFormat(int layer, int format);
 int   LCD_GetFormat(int layer);
 int   LCD_GetPixelSize(int layer);
 
 int   LCD_GetMinimalFullFrameBufferSize(int format);
 
+/**
+ * @brief Surface routines
+ *
+ * @note  They use screen coordinates and clip against the surface.
+ */
+int   LCD_GetFormatPixelSize(int format);
+void  LCD_InitSurface(LCD_Surface *s, void *area, int format, int x, int y, int w, int h, int pitch);
+void  LCD_GetLayerSurface(int layer, LCD_Surface *s);
+void *LCD_GetSurfacePixelAddress(const LCD_Surface *s, int x, int y);
+void  LCD_SurfacePutPixel(const LCD_Surface *s, int x, int y, unsigned color);
+void  LCD_SurfaceFillSpan(const LCD_Surface *s, int x, int y, int n, unsigned color);
+void  LCD_SurfaceFillRect(const LCD_Surface *s, int x, int y, int w, int h, unsigned color);
+unsigned LCD_SurfaceGetPixel(const LCD_Surface *s, int x, int y);
+void  LCD_SurfaceBlendPixel(const LCD_Surface *s, int x, int y, unsigned color, unsigned alpha);
+void  LCD_SurfaceBlendSpan(const LCD_Surface *s, int x, int y, int n, unsigned color, unsigned alpha);
+void  LCD_SurfaceBlendMask(const LCD_Surface *s, int x, int y, int n, unsigned color, const uint8_t *mask);
+void  LCD_SurfaceDrawLine(const LCD_Surface *s, int x0, int y0, int x1, int y1, unsigned color);
+
 void LCD_DrawHorizontalLine(int layer, int x, int y, int size, unsigned color);
 void LCD_DrawVerticalLine(int layer, int x, int y, int size, unsigned color);
 void LCD_DrawBox(int layer, int x, int y, int sw, int sh, unsigned color, unsigned bordercolor);
@@ -13,12 +13,23 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "stm32f746xx.h"
 #include "system_stm32f746.h"
 #include "led.h"
 #include "sdram.h"
 #include "buddy.h"
 #include "lcd.h"
+#include "tile.h"
+#include "bench.h"
+#include "draw.h"
+#include "poly.h"
+#include "font.h"
+#include "pixel.h"
+#include "console.h"
+#include "image.h"
+#include "jpeg.h"
+#include "blit.h"
 
 
 
@@ -141,6 +152,814 @@ char *q;
 }
 
 
+/*
+ * @brief   Moves a box using page flipping and frame pacing
+ *
+ * @note    Drawing is done in the back buffer and the buffers are switched in the
+ *          vertical blanking. No tearing.
+ */
+void pageflipdemo(void *fbarea, int fbsize, int format) {
+void *fbback;
+LCD_FrameStatistics st;
+int x, dx, frame;
+
+    fbback = Buddy_Alloc(fbsize);
+    if( !fbback ) {
+        message("Could not allocate back buffer");
+        return;
+    }
+
+    LCD_EnableDoubleBuffering(1,fbback);
+    LCD_SetFrameRate(30);
+
+    x  = 0;
+    dx = 4;
+    for(frame=0;frame<300;frame++) {
+        LCD_WaitForFlip(1);
+        LCD_FillFrameBuffer(1,RGB(0,0,0));
+        LCD_DrawBox(1,x,100,60,60,RGB(255,0,0),RGB(255,255,255));
+        LCD_FlipFrameBuffer(1);
+        LCD_WaitNextFrame();
+        x += dx;
+        if( (x <= 0) || (x >= LCD_DW-62) )
+            dx = -dx;
+    }
+
+    LCD_GetFrameStatistics(&st);
+    printf("Refresh rate = %d Hz\n",LCD_GetRefreshRate());
+    printf("VSYNCs = %u Presented = %u Dropped = %u\n",
+                (unsigned) st.vsyncs,(unsigned) st.presented,(unsigned) st.dropped);
+
+    LCD_DisableDoubleBuffering(1);
+    LCD_SetFullSizeFrameBuffer(1,fbarea,format);
+    Buddy_Free(fbback);
+}
+
+
+/**
+ * @brief   Scene used to compare direct and tiled rendering
+ *
+ * @note    Background and overlapping boxes. The pixels written are counted to
+ *          estimate the SDRAM traffic of direct rendering.
+ */
+typedef struct {
+    int         frame;
+    uint32_t    pixels;
+} SceneInfo;
+
+static void countrect(const LCD_Surface *s, SceneInfo *info, int x, int y, int w, int h) {
+
+    if( x < s->x ) { w -= s->x-x; x = s->x; }
+    if( y < s->y ) { h -= s->y-y; y = s->y; }
+    if( x+w > s->x+s->w ) w = s->x+s->w-x;
+    if( y+h > s->y+s->h ) h = s->y+s->h-y;
+    if( (w > 0) && (h > 0) )
+        info->pixels += w*h;
+}
+
+static void drawscene(const LCD_Surface *s, void *data) {
+SceneInfo *info = (SceneInfo *) data;
+int i,x,y;
+
+    LCD_SurfaceFillRect(s,0,0,LCD_DW,LCD_DH,RGB(0,0,64));
+    countrect(s,info,0,0,LCD_DW,LCD_DH);
+    for(i=0;i<24;i++) {
+        x = (i*37+info->frame*(1+i%3))%(LCD_DW-80);
+        y = (i*23+info->frame*(1+i%2))%(LCD_DH-60);
+        LCD_SurfaceFillRect(s,x,y,80,60,RGB(40*(i%6),255-10*i,20*(i%12)));
+        countrect(s,info,x,y,80,60);
+    }
+}
+
+/*
+ * @brief   Compares direct rendering into SDRAM and tiled rendering
+ *
+ * @note    Prints average frame time and bytes written into the frame buffer
+ */
+void tiledemo(void) {
+SceneInfo info;
+LCD_Surface s;
+Tile_Statistics st;
+uint32_t start,direct,tiled;
+uint32_t directbytes;
+int ps;
+const int nframes = 50;
+
+    Bench_Init();
+    LCD_GetLayerSurface(1,&s);
+    ps = LCD_GetFormatPixelSize(s.format);
+
+    info.pixels = 0;
+    start = Bench_GetCycles();
+    for(info.frame=0;info.frame<nframes;info.frame++) {
+        drawscene(&s,&info);
+    }
+    direct = Bench_GetCycles()-start;
+    directbytes = info.pixels/nframes*ps;
+
+    start = Bench_GetCycles();
+    for(info.frame=0;info.frame<nframes;info.frame++) {
+        Tile_Render(&s,drawscene,&info);
+    }
+    tiled = Bench_GetCycles()-start;
+    Tile_GetStatistics(&st);
+
+    printf("Direct: %u us/frame %u bytes/frame\n",
+            (unsigned) Bench_CyclesToMicroseconds(direct/nframes),(unsigned) directbytes);
+    printf("Tiled:  %u us/frame %u bytes/frame (%u tiles)\n",
+            (unsigned) Bench_CyclesToMicroseconds(tiled/nframes),
+            (unsigned) st.byteswritten,(unsigned) st.tiles);
+}
+
+
+/*
+ * @brief   Draws a gauge using anti-aliased primitives
+ */
+void gaugedemo(int value) {
+LCD_Surface s;
+int cx,cy,r,a,i;
+
+    LCD_GetLayerSurface(1,&s);
+    cx = LCD_DW/2;
+    cy = LCD_DH/2+20;
+    r  = 100;
+
+    LCD_FillFrameBuffer(1,RGB(0,0,0));
+    Draw_ArcAA(&s,cx,cy,r,12,135,405,RGB(64,64,64));
+    Draw_ArcAA(&s,cx,cy,r,12,135,135+value*270/100,RGB(0,200,0));
+    for(i=0;i<=10;i++) {
+        a = 135+i*27;
+        Draw_LineAA(&s,cx+(r-20)*Draw_Cos(a)/32768,cy+(r-20)*Draw_Sin(a)/32768,
+                       cx+(r-10)*Draw_Cos(a)/32768,cy+(r-10)*Draw_Sin(a)/32768,
+                       RGB(255,255,255));
+    }
+    a = 135+value*270/100;
+    Draw_ThickLineAA(&s,cx,cy,cx+(r-25)*Draw_Cos(a)/32768,cy+(r-25)*Draw_Sin(a)/32768,
+                        5,RGB(255,0,0));
+    Draw_FilledCircleAA(&s,cx,cy,8,RGB(200,200,200));
+    Draw_CircleAA(&s,cx,cy,r+10,RGB(255,255,255));
+}
+
+
+/*
+ * @brief   Pseudo random number in range 0 to m-1 (LCG)
+ */
+static uint32_t seed = 12345;
+
+static int nextrandom(int m) {
+
+    seed = seed*1103515245+12345;
+    return (int) ((seed>>16)%m);
+}
+
+/*
+ * @brief   Measures the polygon fill rate
+ *
+ * @note    Pseudo random triangles with about 40x40 pixels. Prints triangles per second
+ */
+void polydemo(void) {
+LCD_Surface s;
+uint32_t start,cycles,us;
+int i,x,y,x0,y0,r,g,b;
+const int ntriangles = 1000;
+
+    Bench_Init();
+    LCD_GetLayerSurface(1,&s);
+    LCD_FillFrameBuffer(1,RGB(0,0,0));
+    start = Bench_GetCycles();
+    for(i=0;i<ntriangles;i++) {
+        x  = nextrandom(LCD_DW-40);
+        y  = nextrandom(LCD_DH-40);
+        x0 = x+nextrandom(40);
+        y0 = y+nextrandom(40);
+        r  = nextrandom(256);
+        g  = nextrandom(256);
+        b  = nextrandom(256);
+        Poly_FillTriangle(&s,POLY_FIX(x0),POLY_FIX(y),POLY_FIX(x),POLY_FIX(y0),
+                          POLY_FIX(x+40),POLY_FIX(y+40),RGB(r,g,b));
+    }
+    cycles = Bench_GetCycles()-start;
+    us = Bench_CyclesToMicroseconds(cycles);
+    if( us == 0 )
+        us = 1;
+    printf("%d triangles in %u us = %u triangles/s\n",ntriangles,(unsigned) us,
+                (unsigned) ((uint64_t) ntriangles*1000000/us));
+}
+
+
+extern const Font_Info font_sourcecode16;
+
+/*
+ * @brief   Measures text rendering for each pixel format
+ *
+ * @note    Text is drawn into an off-screen surface. Prints characters per second
+ */
+void fontdemo(void) {
+static const int formats[] = {
+    LCD_FORMAT_ARGB8888, LCD_FORMAT_RGB888, LCD_FORMAT_RGB565,
+    LCD_FORMAT_ARGB1555, LCD_FORMAT_ARGB4444, LCD_FORMAT_L8
+};
+static const char *names[] = { "ARGB8888", "RGB888", "RGB565", "ARGB1555", "ARGB4444", "L8" };
+static const char text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+LCD_Surface s,fb;
+Font_CacheStatistics st;
+void *area;
+uint32_t start,us;
+int i,line,nchars;
+
+    area = Buddy_Alloc(LCD_DW*LCD_DH*4);
+    if( !area ) {
+        message("Could not allocate surface");
+        return;
+    }
+
+    Bench_Init();
+    for(i=0;i<(int) (sizeof(formats)/sizeof(formats[0]));i++) {
+        LCD_InitSurface(&s,area,formats[i],0,0,LCD_DW,LCD_DH,0);
+        LCD_SurfaceFillRect(&s,0,0,LCD_DW,LCD_DH,0);
+        Font_FlushCache();
+        nchars = 0;
+        start = Bench_GetCycles();
+        for(line=0;line+font_sourcecode16.height<=LCD_DH;line+=font_sourcecode16.height) {
+            Font_DrawString(&s,&font_sourcecode16,0,line,text,0xFFFFFFFF);
+            nchars += sizeof(text)-1;
+        }
+        us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+        if( us == 0 )
+            us = 1;
+        Font_GetCacheStatistics(&st);
+        printf("%-8s: %u chars/s (cache hits %u misses %u)\n",names[i],
+                (unsigned) ((uint64_t) nchars*1000000/us),(unsigned) st.hits,(unsigned) st.misses);
+    }
+    Buddy_Free(area);
+
+    LCD_GetLayerSurface(1,&fb);
+    LCD_FillFrameBuffer(1,RGB(0,0,0));
+    Font_DrawString(&fb,&font_sourcecode16,10,10,text,RGB(255,255,255));
+    Font_DrawString(&fb,&font_sourcecode16,10,40,"Anti-aliased text\nin any format",RGB(255,255,0));
+}
+
+
+/*
+ * @brief   Measures pixel format conversion
+ *
+ * @note    Converts a full screen image between formats. Prints thousand pixels per second
+ */
+void convdemo(void) {
+static const struct { int src, dst; const char *name; } pairs[] = {
+    { LCD_FORMAT_ARGB8888, LCD_FORMAT_RGB565,   "ARGB8888->RGB565"   },
+    { LCD_FORMAT_RGB565,   LCD_FORMAT_ARGB8888, "RGB565->ARGB8888"   },
+    { LCD_FORMAT_ARGB8888, LCD_FORMAT_RGB888,   "ARGB8888->RGB888"   },
+    { LCD_FORMAT_RGB888,   LCD_FORMAT_ARGB8888, "RGB888->ARGB8888"   },
+    { LCD_FORMAT_RGB888,   LCD_FORMAT_RGB565,   "RGB888->RGB565"     },
+    { LCD_FORMAT_L8,       LCD_FORMAT_RGB888,   "L8->RGB888"         },
+    { LCD_FORMAT_AL44,     LCD_FORMAT_ARGB8888, "AL44->ARGB8888"     },
+    { LCD_FORMAT_ARGB4444, LCD_FORMAT_ARGB1555, "ARGB4444->ARGB1555" },
+    { LCD_FORMAT_ARGB8888, LCD_FORMAT_L8,       "ARGB8888->L8"       }
+};
+LCD_Surface src,dst;
+void *a1,*a2;
+uint32_t start,us;
+int i;
+
+    a1 = Buddy_Alloc(LCD_DW*LCD_DH*4);
+    a2 = Buddy_Alloc(LCD_DW*LCD_DH*4);
+    if( !a1 || !a2 ) {
+        message("Could not allocate surfaces");
+        if( a1 ) Buddy_Free(a1);
+        if( a2 ) Buddy_Free(a2);
+        return;
+    }
+
+    Bench_Init();
+    for(i=0;i<(int) (sizeof(pairs)/sizeof(pairs[0]));i++) {
+        LCD_InitSurface(&src,a1,pairs[i].src,0,0,LCD_DW,LCD_DH,0);
+        LCD_InitSurface(&dst,a2,pairs[i].dst,0,0,LCD_DW,LCD_DH,0);
+        start = Bench_GetCycles();
+        Pixel_ConvertSurface(&dst,0,0,&src);
+        us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+        if( us == 0 )
+            us = 1;
+        printf("%-20s: %u us %u kpixels/s\n",pairs[i].name,(unsigned) us,
+                (unsigned) ((uint64_t) LCD_DW*LCD_DH*1000/us));
+    }
+    Buddy_Free(a2);
+    Buddy_Free(a1);
+}
+
+
+/*
+ * @brief   Color cycling in L8 format
+ *
+ * @note    Concentric rings use palette entries 16 to 255. Rotating these entries
+ *          animates the image without redrawing it. The anti-aliased circle blends
+ *          using the nearest palette entries.
+ */
+void palettedemo(void *fbarea, int format) {
+static LCD_CLUT clut;
+uint32_t colors[256];
+LCD_Surface s;
+void *area;
+int i,r,frame;
+
+    area = Buddy_Alloc(LCD_GetMinimalFullFrameBufferSize(LCD_FORMAT_L8));
+    if( !area ) {
+        message("Could not allocate frame buffer");
+        return;
+    }
+
+    for(i=0;i<16;i++)
+        colors[i] = RGB(i*17,i*17,i*17);
+    for(i=0;i<240;i++) {
+        r = i%80;
+        switch(i/80) {
+        case 0:  colors[16+i] = RGB(255-r*255/80,r*255/80,0);   break;
+        case 1:  colors[16+i] = RGB(0,255-r*255/80,r*255/80);   break;
+        default: colors[16+i] = RGB(r*255/80,0,255-r*255/80);   break;
+        }
+    }
+    LCD_InitCLUT(&clut,colors,256);
+
+    LCD_SetFullSizeFrameBuffer(1,area,LCD_FORMAT_L8);
+    LCD_SetLayerCLUT(1,&clut);
+    LCD_GetLayerSurface(1,&s);
+
+    LCD_SurfaceFillRect(&s,0,0,LCD_DW,LCD_DH,0);
+    for(r=LCD_DW/2;r>0;r-=2)
+        Draw_FilledCircle(&s,LCD_DW/2,LCD_DH/2,r,16+(r%240));
+    Draw_FilledCircleAA(&s,LCD_DW/2,LCD_DH/2,40,0);
+    Draw_CircleAA(&s,LCD_DW/2,LCD_DH/2,40,15);
+
+    LCD_SetFrameRate(30);
+    for(frame=0;frame<300;frame++) {
+        LCD_RotateCLUT(&clut,16,240,1);
+        LCD_UpdateLayerCLUT(1,16,240);
+        LCD_WaitNextFrame();
+    }
+
+    LCD_SetLayerCLUT(1,0);
+    LCD_SetFullSizeFrameBuffer(1,fbarea,format);
+    Buddy_Free(area);
+}
+
+
+/*
+ * @brief   Copies a rectangle of the background into the frame buffer (clipped)
+ */
+static void restorerect(const LCD_Surface *fb, const LCD_Surface *bg, int x, int y, int w, int h) {
+LCD_Surface sub;
+
+    if( x < bg->x ) { w -= bg->x-x; x = bg->x; }
+    if( y < bg->y ) { h -= bg->y-y; y = bg->y; }
+    if( x+w > bg->x+bg->w ) w = bg->x+bg->w-x;
+    if( y+h > bg->y+bg->h ) h = bg->y+bg->h-y;
+    if( (w <= 0) || (h <= 0) )
+        return;
+    LCD_InitSurface(&sub,LCD_GetSurfacePixelAddress(bg,x,y),bg->format,x,y,w,h,bg->pitch);
+    Pixel_ConvertSurface(fb,x,y,&sub);
+}
+
+/*
+ * @brief   Slides a panel and moves a cursor over a static background
+ *
+ * @note    First it is done by software: the background under the old position is
+ *          restored from a copy and the panel or cursor is drawn at the new position.
+ *          Then they are windows of layer 2, using the constant alpha and color key
+ *          (panel) or the pixel alpha (cursor) of the LTDC. Moving is only a change of
+ *          registers. Prints the CPU time per frame for both.
+ */
+#define PANEL_W     160
+#define PANEL_H     200
+#define CURSOR_S    24
+#define SLIDEFRAMES 40
+void compositordemo(void) {
+LCD_Surface fb,bg,panel,cursor;
+void *bgarea,*panelarea,*cursorarea;
+uint32_t start,swcycles,hwcycles;
+uint32_t key565 = RGB565(255,0,255);
+int frame,x,y,oldx,oldy,pass;
+
+    gaugedemo(70);
+    LCD_GetLayerSurface(1,&fb);
+    bgarea     = Buddy_Alloc(fb.pitch*fb.h);
+    panelarea  = Buddy_Alloc(PANEL_W*PANEL_H*2);
+    cursorarea = Buddy_Alloc(CURSOR_S*CURSOR_S*2);
+    if( !bgarea || !panelarea || !cursorarea ) {
+        message("Could not allocate buffers");
+        if( bgarea )     Buddy_Free(bgarea);
+        if( panelarea )  Buddy_Free(panelarea);
+        if( cursorarea ) Buddy_Free(cursorarea);
+        return;
+    }
+    LCD_InitSurface(&bg,bgarea,fb.format,0,0,fb.w,fb.h,fb.pitch);
+    Pixel_ConvertSurface(&bg,0,0,&fb);
+
+    // Panel with rounded corners. The key color is transparent
+    LCD_InitSurface(&panel,panelarea,LCD_FORMAT_RGB565,0,0,PANEL_W,PANEL_H,0);
+    LCD_SurfaceFillRect(&panel,0,0,PANEL_W,PANEL_H,key565);
+    LCD_SurfaceFillRect(&panel,16,0,PANEL_W-32,PANEL_H,RGB565(32,48,96));
+    LCD_SurfaceFillRect(&panel,0,16,PANEL_W,PANEL_H-32,RGB565(32,48,96));
+    Draw_FilledCircle(&panel,16,16,16,RGB565(32,48,96));
+    Draw_FilledCircle(&panel,PANEL_W-17,16,16,RGB565(32,48,96));
+    Draw_FilledCircle(&panel,16,PANEL_H-17,16,RGB565(32,48,96));
+    Draw_FilledCircle(&panel,PANEL_W-17,PANEL_H-17,16,RGB565(32,48,96));
+    Font_DrawString(&panel,&font_sourcecode16,16,16,"Settings",RGB565(255,255,255));
+    Font_DrawString(&panel,&font_sourcecode16,16,48,"Brightness\nVolume\nWi-Fi",
+                    RGB565(200,200,200));
+
+    // Cursor with transparent background
+    LCD_InitSurface(&cursor,cursorarea,LCD_FORMAT_ARGB4444,0,0,CURSOR_S,CURSOR_S,0);
+    LCD_SurfaceFillRect(&cursor,0,0,CURSOR_S,CURSOR_S,ARGB4444(0,0,0,0));
+    Draw_FilledCircleAA(&cursor,CURSOR_S/2,CURSOR_S/2,CURSOR_S/2-2,ARGB4444(160,255,255,0));
+    Draw_CircleAA(&cursor,CURSOR_S/2,CURSOR_S/2,CURSOR_S/2-2,ARGB4444(255,0,0,0));
+
+    Bench_Init();
+    LCD_SetFrameRate(30);
+    y = (LCD_DH-PANEL_H)/2;
+    for(pass=0;pass<2;pass++) {
+        if( pass == 1 ) {
+            LCD_SetLayerWindow(2,panelarea,LCD_FORMAT_RGB565,LCD_DW,y,PANEL_W,PANEL_H,0);
+            LCD_SetColorKey(2,Pixel_Unpack(LCD_FORMAT_RGB565,key565,0));
+            LCD_EnableColorKey(2);
+            LCD_SetLayerBlending(2,LCD_BLEND_CONSTANT);
+            LCD_SetLayerOpacity(2,224);
+        }
+        swcycles = hwcycles = 0;
+        oldx = LCD_DW;
+        for(frame=0;frame<=2*SLIDEFRAMES;frame++) {
+            x = LCD_DW-(frame<=SLIDEFRAMES?frame:2*SLIDEFRAMES-frame)*PANEL_W/SLIDEFRAMES;
+            start = Bench_GetCycles();
+            if( pass == 0 ) {
+                restorerect(&fb,&bg,oldx,y,PANEL_W,PANEL_H);
+                Pixel_ConvertSurface(&fb,x,y,&panel);
+                swcycles += Bench_GetCycles()-start;
+            } else {
+                LCD_SetLayerPosition(2,x,y);
+                hwcycles += Bench_GetCycles()-start;
+            }
+            oldx = x;
+            LCD_WaitNextFrame();
+        }
+        if( pass == 0 )
+            printf("Panel  (software): %u us/frame\n",
+                (unsigned) Bench_CyclesToMicroseconds(swcycles/(2*SLIDEFRAMES+1)));
+        else
+            printf("Panel  (layer 2) : %u us/frame\n",
+                (unsigned) Bench_CyclesToMicroseconds(hwcycles/(2*SLIDEFRAMES+1)));
+    }
+
+    LCD_DisableColorKey(2);
+    LCD_SetLayerBlending(2,LCD_BLEND_PIXEL);
+    LCD_SetLayerOpacity(2,255);
+    for(pass=0;pass<2;pass++) {
+        if( pass == 1 )
+            LCD_SetLayerWindow(2,cursorarea,LCD_FORMAT_ARGB4444,LCD_DW/2,LCD_DH/2,
+                               CURSOR_S,CURSOR_S,0);
+        else
+            LCD_DisableLayer(2);
+        swcycles = hwcycles = 0;
+        oldx = LCD_DW/2;
+        oldy = LCD_DH/2;
+        for(frame=0;frame<120;frame++) {
+            x = LCD_DW/2+200*Draw_Cos(frame*3)/32768;
+            y = LCD_DH/2+100*Draw_Sin(frame*6)/32768;
+            start = Bench_GetCycles();
+            if( pass == 0 ) {
+                restorerect(&fb,&bg,oldx-CURSOR_S/2,oldy-CURSOR_S/2,CURSOR_S,CURSOR_S);
+                Draw_FilledCircleAA(&fb,x,y,CURSOR_S/2-2,RGB(255,255,0));
+                Draw_CircleAA(&fb,x,y,CURSOR_S/2-2,RGB(0,0,0));
+                swcycles += Bench_GetCycles()-start;
+            } else {
+                LCD_SetLayerPosition(2,x-CURSOR_S/2,y-CURSOR_S/2);
+                hwcycles += Bench_GetCycles()-start;
+            }
+            oldx = x;
+            oldy = y;
+            LCD_WaitNextFrame();
+        }
+        if( pass == 0 ) {
+            restorerect(&fb,&bg,oldx-CURSOR_S/2,oldy-CURSOR_S/2,CURSOR_S,CURSOR_S);
+            printf("Cursor (software): %u us/frame\n",
+                (unsigned) Bench_CyclesToMicroseconds(swcycles/120));
+        } else {
+            printf("Cursor (layer 2) : %u us/frame\n",
+                (unsigned) Bench_CyclesToMicroseconds(hwcycles/120));
+        }
+    }
+
+    LCD_DisableLayer(2);
+    Buddy_Free(cursorarea);
+    Buddy_Free(panelarea);
+    Buddy_Free(bgarea);
+}
+
+
+/*
+ * @brief   Text console with hardware scrolling
+ *
+ * @note    Compares the lines per second of the console with redrawing all the text
+ *          for each new line. Then printf output is shown in the console.
+ */
+#define CONSOLELINES    300
+#define REDRAWLINES     50
+void consoledemo(void *fbarea, int format) {
+static char text[LCD_DH/16][64];
+LCD_Surface fb;
+void *area;
+char line[64];
+uint32_t start,us;
+int i,j,rows;
+
+    area = Buddy_Alloc(Console_GetBufferSize(LCD_FORMAT_RGB565,&font_sourcecode16));
+    if( !area ) {
+        message("Could not allocate console buffer");
+        return;
+    }
+
+    Bench_Init();
+
+    // Full redraw: text is kept in memory and the screen is redrawn for each line
+    LCD_SetFullSizeFrameBuffer(1,area,LCD_FORMAT_RGB565);
+    LCD_GetLayerSurface(1,&fb);
+    rows = LCD_DH/font_sourcecode16.height;
+    for(i=0;i<rows;i++)
+        text[i][0] = '\0';
+    start = Bench_GetCycles();
+    for(i=0;i<REDRAWLINES;i++) {
+        for(j=0;j<rows-1;j++)
+            strcpy(text[j],text[j+1]);
+        snprintf(text[rows-1],sizeof(text[0]),"Line %d: the quick brown fox jumps",i);
+        LCD_SurfaceFillRect(&fb,0,0,fb.w,fb.h,RGB565(0,0,64));
+        for(j=0;j<rows;j++)
+            Font_DrawString(&fb,&font_sourcecode16,0,j*font_sourcecode16.height,text[j],
+                            RGB565(255,255,255));
+    }
+    us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+    printf("Full redraw: %u lines/s\n",(unsigned) ((uint64_t) REDRAWLINES*1000000/(us?us:1)));
+
+    // Hardware scrolling
+    Console_Init(1,area,LCD_FORMAT_RGB565,&font_sourcecode16,RGB565(255,255,255),RGB565(0,0,64));
+    start = Bench_GetCycles();
+    for(i=0;i<CONSOLELINES;i++) {
+        j = snprintf(line,sizeof(line),"Line %d: the quick brown fox jumps\n",i);
+        Console_Write(line,j);
+    }
+    us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+    printf("Console    : %u lines/s\n",(unsigned) ((uint64_t) CONSOLELINES*1000000/(us?us:1)));
+
+    Console_Attach();
+    Console_SetColors(RGB565(255,255,0),RGB565(0,0,64));
+    printf("printf output is shown in the console\n");
+    for(i=0;i<40;i++) {
+        printf("%d\t%d\t%d\n",i,i*i,i*i*i);
+        ms_delay(50);
+    }
+    Console_Detach();
+
+    ms_delay(2000);
+    LCD_SetFullSizeFrameBuffer(1,fbarea,format);
+    Buddy_Free(area);
+}
+
+
+/*
+ * @brief   Compressed images (generated by tools/mkimage)
+ */
+///@{
+extern const uint8_t img_landscape_qoi[];
+extern const int     img_landscape_qoi_size;
+extern const uint8_t img_landscape_rle[];
+extern const int     img_landscape_rle_size;
+///@}
+
+/*
+ * @brief   Chunked reader that copies from memory (simulates a file)
+ */
+typedef struct {
+    const uint8_t  *data;
+    int             size;
+    int             pos;
+} ChunkSource;
+
+static int readchunk(void *ctx, uint8_t *buf, int n) {
+ChunkSource *cs = (ChunkSource *) ctx;
+
+    if( n > cs->size-cs->pos )
+        n = cs->size-cs->pos;
+    memcpy(buf,cs->data+cs->pos,n);
+    cs->pos += n;
+    return n;
+}
+
+/*
+ * @brief   Decodes QOI and RLE images into layer 1
+ *
+ * @note    Prints megapixels per second (x100) for the memory and the chunked readers
+ */
+void imagedemo(void) {
+static const struct { const uint8_t *data; const int *size; const char *name; } images[] = {
+    { img_landscape_qoi, &img_landscape_qoi_size, "QOI"          },
+    { img_landscape_rle, &img_landscape_rle_size, "RLE (RGB565)" }
+};
+LCD_Surface fb;
+Image_Reader r;
+Image_Info info;
+ChunkSource cs;
+uint32_t start,us1,us2;
+int i,rc;
+
+    LCD_GetLayerSurface(1,&fb);
+    LCD_FillFrameBuffer(1,RGB(0,0,0));
+    Bench_Init();
+    for(i=0;i<(int) (sizeof(images)/sizeof(images[0]));i++) {
+        Image_InitMemoryReader(&r,images[i].data,*images[i].size);
+        Image_ReadHeader(&r,&info);
+        Image_InitMemoryReader(&r,images[i].data,*images[i].size);
+        start = Bench_GetCycles();
+        rc = Image_Decode(&r,&fb,i*LCD_DW/2,0);
+        us1 = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+
+        cs.data = images[i].data;
+        cs.size = *images[i].size;
+        cs.pos  = 0;
+        Image_InitStreamReader(&r,readchunk,&cs);
+        start = Bench_GetCycles();
+        rc |= Image_Decode(&r,&fb,i*LCD_DW/2,LCD_DH/2);
+        us2 = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+
+        if( rc ) {
+            printf("%s: decode error %d\n",images[i].name,rc);
+            continue;
+        }
+        printf("%-12s: %dx%d %d bytes ratio x100 = %d. Memory %u us %u MP/s x100. "
+               "Chunks %u us %u MP/s x100\n",
+               images[i].name,info.w,info.h,*images[i].size,
+               info.w*info.h*LCD_GetFormatPixelSize(LCD_FORMAT_RGB888)*100/(*images[i].size),
+               (unsigned) us1,(unsigned) (info.w*info.h*100/(us1?us1:1)),
+               (unsigned) us2,(unsigned) (info.w*info.h*100/(us2?us2:1)));
+    }
+}
+
+
+/*
+ * @brief   JPEG image (tools/mkimage -t raw)
+ */
+///@{
+extern const uint8_t img_landscape_jpg[];
+extern const int     img_landscape_jpg_size;
+///@}
+
+/*
+ * @brief   Band used to decode a JPEG image one MCU row at a time
+ */
+typedef struct {
+    LCD_Surface     band;               ///< Lines of the image being decoded
+    LCD_Surface    *fb;
+    int             x,y;                ///< Position of the image in fb
+} JpegBand;
+
+/*
+ * @brief   Copies the band into the frame buffer and moves it down
+ */
+static void copyband(void *ctx, int y, int h) {
+JpegBand *jb = (JpegBand *) ctx;
+
+    Pixel_ConvertSurface(jb->fb,jb->x,jb->y+y,&jb->band);
+    jb->band.y += jb->band.h;
+}
+
+/*
+ * @brief   Decodes a JPEG image with all scales into layer 1
+ *
+ * @note    Prints decoding time and megapixels per second (x100). Then the image is
+ *          decoded into a band of 16 lines that is copied into the frame buffer by
+ *          the row callback.
+ */
+void jpegdemo(void) {
+LCD_Surface fb;
+Image_Reader r;
+Jpeg_Info info;
+JpegBand jb;
+uint32_t start,us;
+int scale,x,w,h,rc;
+
+    LCD_GetLayerSurface(1,&fb);
+    LCD_FillFrameBuffer(1,RGB(0,0,0));
+    Bench_Init();
+
+    Image_InitMemoryReader(&r,img_landscape_jpg,img_landscape_jpg_size);
+    rc = Jpeg_ReadHeader(&r,&info);
+    if( rc < 0 ) {
+        printf("JPEG: header error %d\n",rc);
+        return;
+    }
+    printf("JPEG: %dx%d %d components MCU %dx%d work area %d bytes\n",
+            info.w,info.h,info.components,8*info.hs,8*info.vs,Jpeg_GetWorkAreaSize());
+
+    x = 0;
+    for(scale=1;scale<=8;scale*=2) {
+        Image_InitMemoryReader(&r,img_landscape_jpg,img_landscape_jpg_size);
+        start = Bench_GetCycles();
+        rc = Jpeg_Decode(&r,&fb,x,0,scale);
+        us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+        w  = (info.w+scale-1)/scale;
+        h  = (info.h+scale-1)/scale;
+        if( rc ) {
+            printf("1/%d: decode error %d\n",scale,rc);
+            continue;
+        }
+        printf("1/%d: %dx%d %u us %u MP/s x100\n",scale,w,h,
+                (unsigned) us,(unsigned) (w*h*100/(us?us:1)));
+        x += w;
+    }
+
+    // Band of one MCU row
+    h = 8*info.vs;
+    jb.fb = &fb;
+    jb.x  = 0;
+    jb.y  = LCD_DH/2;
+    LCD_InitSurface(&jb.band,Buddy_Alloc(info.w*h*4),LCD_FORMAT_ARGB8888,0,0,info.w,h,0);
+    if( !jb.band.area )
+        return;
+    Jpeg_SetRowCallback(copyband,&jb);
+    Image_InitMemoryReader(&r,img_landscape_jpg,img_landscape_jpg_size);
+    start = Bench_GetCycles();
+    rc = Jpeg_Decode(&r,&jb.band,0,0,1);
+    us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+    Jpeg_SetRowCallback(0,0);
+    printf("Band of %d lines: rc %d %u us\n",h,rc,(unsigned) us);
+    Buddy_Free(jb.band.area);
+}
+
+
+/*
+ * @brief   Scaling and rotation blits
+ *
+ * @note    The landscape image is decoded into a surface in SDRAM with the format
+ *          of the frame buffer (pixels are copied) and in RGB565 (pixels are
+ *          converted). Prints output pixels per second (x1000) for each mode.
+ */
+void blitdemo(void) {
+static const struct { int w, h, filter; const char *name; } scales[] = {
+    { 2, 1, BLIT_NEAREST,  "Nearest x2"  },
+    { 2, 1, BLIT_BILINEAR, "Bilinear x2" },
+    { 1, 2, BLIT_NEAREST,  "Nearest /2"  },
+    { 1, 2, BLIT_BILINEAR, "Bilinear /2" }
+};
+static const char *rotations[] = { "Rotate 0", "Rotate 90", "Rotate 180", "Rotate 270" };
+LCD_Surface fb,src[2];
+Image_Reader r;
+Image_Info info;
+uint32_t start,us;
+int i,k,w,h,n;
+
+    LCD_GetLayerSurface(1,&fb);
+    Image_InitMemoryReader(&r,img_landscape_qoi,img_landscape_qoi_size);
+    Image_ReadHeader(&r,&info);
+    LCD_InitSurface(&src[0],Buddy_Alloc(info.w*info.h*4),fb.format,0,0,info.w,info.h,0);
+    LCD_InitSurface(&src[1],Buddy_Alloc(info.w*info.h*2),LCD_FORMAT_RGB565,0,0,info.w,info.h,0);
+    if( !src[0].area || !src[1].area ) {
+        message("Could not allocate source images");
+        return;
+    }
+    for(k=0;k<2;k++) {
+        Image_InitMemoryReader(&r,img_landscape_qoi,img_landscape_qoi_size);
+        Image_Decode(&r,&src[k],0,0);
+    }
+
+    Bench_Init();
+    for(k=0;k<2;k++) {
+        printf("Source format %d, destination format %d\n",src[k].format,fb.format);
+        for(i=0;i<(int) (sizeof(scales)/sizeof(scales[0]));i++) {
+            LCD_FillFrameBuffer(1,RGB(0,0,0));
+            w = info.w*scales[i].w/scales[i].h;
+            h = info.h*scales[i].w/scales[i].h;
+            start = Bench_GetCycles();
+            Blit_Scale(&fb,0,0,w,h,&src[k],scales[i].filter);
+            us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+            printf("%-12s: %dx%d %u us %u Kpixels/s\n",scales[i].name,w,h,(unsigned) us,
+                    (unsigned) ((uint64_t) w*h*1000/(us?us:1)));
+            ms_delay(500);
+        }
+        n = info.w*info.h;
+        for(i=BLIT_ROTATE_0;i<=BLIT_ROTATE_270;i++) {
+            LCD_FillFrameBuffer(1,RGB(0,0,0));
+            w = (i&1) ? info.h : info.w;
+            h = (i&1) ? info.w : info.h;
+            start = Bench_GetCycles();
+            Blit_Rotate(&fb,(LCD_DW-w)/2,(LCD_DH-h)/2,&src[k],i);
+            us = Bench_CyclesToMicroseconds(Bench_GetCycles()-start);
+            printf("%-12s: %u us %u Kpixels/s\n",rotations[i],(unsigned) us,
+                    (unsigned) ((uint64_t) n*1000/(us?us:1)));
+            ms_delay(500);
+        }
+    }
+
+    Buddy_Free(src[1].area);
+    Buddy_Free(src[0].area);
+}
+
+
 /**
  * @brief   main
  *
@@ -244,6 +1063,42 @@ int format = LCD_FORMAT_RGB888;
     LCD_DisableLayer(2);
     LCD_EnableLayer(1);
 
+    messagewithconfirm("animate a box using page flipping");
+    pageflipdemo(fbarea1,fbsize,format);
+
+    messagewithconfirm("compare direct and tiled rendering");
+    tiledemo();
+
+    messagewithconfirm("draw a gauge using anti-aliased primitives");
+    gaugedemo(70);
+
+    messagewithconfirm("fill triangles");
+    polydemo();
+
+    messagewithconfirm("draw text");
+    fontdemo();
+
+    messagewithconfirm("convert pixel formats");
+    convdemo();
+
+    messagewithconfirm("animate the palette of a L8 frame buffer");
+    palettedemo(fbarea1,format);
+
+    messagewithconfirm("move a panel and a cursor using layer 2");
+    compositordemo();
+
+    messagewithconfirm("show printf output in a scrolling console");
+    consoledemo(fbarea1,format);
+
+    messagewithconfirm("decode compressed images");
+    imagedemo();
+
+    messagewithconfirm("decode a JPEG image with scaling");
+    jpegdemo();
+
+    messagewithconfirm("scale and rotate images");
+    blitdemo();
+
     /*
      * Show some screens
      */
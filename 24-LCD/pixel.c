@@ -0,0 +1,533 @@
+/**
+ * @file    pixel.c
+ *
+ * @note    Pixel format conversion for all LCD_FORMAT_* formats
+ *
+ * @note    Formats (little endian, bit 0 first)
+ *
+ *          Format    | Size | Bits
+ *          ----------|------|--------------------------------------
+ *          ARGB8888  |  4   | B[7:0] G[15:8] R[23:16] A[31:24]
+ *          RGB888    |  3   | B[7:0] G[15:8] R[23:16]
+ *          RGB565    |  2   | B[4:0] G[10:5] R[15:11]
+ *          ARGB1555  |  2   | B[4:0] G[9:5] R[14:10] A[15]
+ *          ARGB4444  |  2   | B[3:0] G[7:4] R[11:8] A[15:12]
+ *          L8        |  1   | L[7:0]
+ *          AL44      |  1   | L[3:0] A[7:4]
+ *          AL88      |  2   | L[7:0] A[15:8]
+ *
+ * @note    Conversion is done a row at a time. There are special kernels for the most
+ *          used pairs. They process many pixels with each word access. Sources with
+ *          one byte pixels (L8 and AL44) use a table with 256 pixels in destination
+ *          format. The other pairs are converted through ARGB8888.
+ *
+ * @note    The table is static, so the routines are not reentrant.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "pixel.h"
+
+/**
+ * @brief   Pixel size in bytes for each format
+ */
+static const uint8_t pixelsize[] = { 4, 3, 2, 2, 2, 1, 1, 2 };
+
+/**
+ * @brief   Pixels of a one byte source format converted to destination format
+ */
+static uint32_t table[256];
+
+/**
+ * @brief   Buffer for conversion through ARGB8888
+ */
+#define BUFFERSIZE  64
+static uint32_t buffer[BUFFERSIZE];
+
+/*
+ * @brief   Luminance (ITU-R BT.601)
+ */
+static inline uint32_t luminance(uint32_t c) {
+
+    return (77*((c>>16)&0xFF)+150*((c>>8)&0xFF)+29*(c&0xFF))>>8;
+}
+
+/**
+ * @brief   Pixel_Pack
+ *
+ * @note    Convert an ARGB8888 color to a pixel. For L8, AL44 and AL88 the luminance
+ *          is used.
+ */
+uint32_t
+Pixel_Pack(int format, uint32_t c) {
+uint32_t a,r,g,b;
+
+    a = (c>>24)&0xFF;
+    r = (c>>16)&0xFF;
+    g = (c>>8)&0xFF;
+    b = c&0xFF;
+    switch(format) {
+    case LCD_FORMAT_ARGB8888:
+        return c;
+    case LCD_FORMAT_RGB888:
+        return c&0xFFFFFF;
+    case LCD_FORMAT_RGB565:
+        return ((r>>3)<<11)|((g>>2)<<5)|(b>>3);
+    case LCD_FORMAT_ARGB1555:
+        return ((a>>7)<<15)|((r>>3)<<10)|((g>>3)<<5)|(b>>3);
+    case LCD_FORMAT_ARGB4444:
+        return ((a>>4)<<12)|((r>>4)<<8)|((g>>4)<<4)|(b>>4);
+    case LCD_FORMAT_L8:
+        return luminance(c);
+    case LCD_FORMAT_AL44:
+        return ((a>>4)<<4)|(luminance(c)>>4);
+    case LCD_FORMAT_AL88:
+        return (a<<8)|luminance(c);
+    }
+    return c;
+}
+
+/**
+ * @brief   Pixel_PackCLUT
+ *
+ * @note    Like Pixel_Pack, but for L8, AL44 and AL88 the nearest color of the
+ *          palette is used (AL44: of the first 16 entries, the ones it can address).
+ *          When clut is null, it is the same as Pixel_Pack.
+ */
+uint32_t
+Pixel_PackCLUT(int format, uint32_t c, LCD_CLUT *clut) {
+uint32_t a = (c>>24)&0xFF;
+
+    if( !clut )
+        return Pixel_Pack(format,c);
+    switch(format) {
+    case LCD_FORMAT_L8:
+        return LCD_FindCLUTIndex(clut,c);
+    case LCD_FORMAT_AL44:
+        return ((a>>4)<<4)|LCD_FindCLUTIndexN(clut,c,16);
+    case LCD_FORMAT_AL88:
+        return (a<<8)|LCD_FindCLUTIndex(clut,c);
+    }
+    return Pixel_Pack(format,c);
+}
+
+/**
+ * @brief   Pixel_Unpack
+ *
+ * @note    Convert a pixel to ARGB8888. clut is used for L8, AL44 and AL88. When it is
+ *          null, L is a gray level.
+ */
+uint32_t
+Pixel_Unpack(int format, uint32_t v, const uint32_t *clut) {
+uint32_t a,r,g,b,l;
+
+    switch(format) {
+    case LCD_FORMAT_ARGB8888:
+        return v;
+    case LCD_FORMAT_RGB888:
+        return v|0xFF000000;
+    case LCD_FORMAT_RGB565:
+        r = (v>>11)&0x1F;
+        g = (v>>5)&0x3F;
+        b = v&0x1F;
+        r = (r<<3)|(r>>2);
+        g = (g<<2)|(g>>4);
+        b = (b<<3)|(b>>2);
+        return 0xFF000000|(r<<16)|(g<<8)|b;
+    case LCD_FORMAT_ARGB1555:
+        a = (v&0x8000)?0xFF:0;
+        r = (v>>10)&0x1F;
+        g = (v>>5)&0x1F;
+        b = v&0x1F;
+        r = (r<<3)|(r>>2);
+        g = (g<<3)|(g>>2);
+        b = (b<<3)|(b>>2);
+        return (a<<24)|(r<<16)|(g<<8)|b;
+    case LCD_FORMAT_ARGB4444:
+        a = ((v>>12)&0xF)*0x11;
+        r = ((v>>8)&0xF)*0x11;
+        g = ((v>>4)&0xF)*0x11;
+        b = (v&0xF)*0x11;
+        return (a<<24)|(r<<16)|(g<<8)|b;
+    case LCD_FORMAT_L8:
+        a = 0xFF;
+        l = v&0xFF;
+        break;
+    case LCD_FORMAT_AL44:
+        a = ((v>>4)&0xF)*0x11;
+        l = v&0xF;
+        break;
+    case LCD_FORMAT_AL88:
+        a = (v>>8)&0xFF;
+        l = v&0xFF;
+        break;
+    default:
+        return v;
+    }
+    // CLUT formats
+    if( clut )
+        return (a<<24)|(clut[l]&0xFFFFFF);
+    if( format == LCD_FORMAT_AL44 )
+        l *= 0x11;
+    return (a<<24)|(l<<16)|(l<<8)|l;
+}
+
+/**
+ * @brief   Pixel_Color
+ *
+ * @note    Color with 8-bit components in the format specified
+ */
+uint32_t
+Pixel_Color(int format, unsigned a, unsigned r, unsigned g, unsigned b) {
+
+    return Pixel_Pack(format,((a&0xFF)<<24)|((r&0xFF)<<16)|((g&0xFF)<<8)|(b&0xFF));
+}
+
+/**
+ * @brief   Pixel_Read
+ */
+uint32_t
+Pixel_Read(const void *p, int format) {
+const uint8_t *q = (const uint8_t *) p;
+
+    switch(pixelsize[format]) {
+    case 4: return q[0]|(q[1]<<8)|(q[2]<<16)|((uint32_t) q[3]<<24);
+    case 3: return q[0]|(q[1]<<8)|(q[2]<<16);
+    case 2: return q[0]|(q[1]<<8);
+    case 1: return q[0];
+    }
+    return 0;
+}
+
+/**
+ * @brief   Pixel_Write
+ */
+void
+Pixel_Write(void *p, int format, uint32_t v) {
+uint8_t *q = (uint8_t *) p;
+
+    switch(pixelsize[format]) {
+    case 4: q[3] = (v>>24)&0xFF;
+    case 3: q[2] = (v>>16)&0xFF;
+    case 2: q[1] = (v>>8)&0xFF;
+    case 1: q[0] = v&0xFF;
+    }
+}
+
+///////////////////////////////// Kernels //////////////////////////////////////////////////////////
+
+/*
+ * @brief   ARGB8888 to RGB565
+ *
+ * @note    Two pixels are packed in a word when the destination is word aligned
+ */
+static void argb8888_to_rgb565(void *dst, const void *src, int n) {
+const uint32_t *s = (const uint32_t *) src;
+uint16_t *d = (uint16_t *) dst;
+uint32_t c0,c1;
+
+#define TO565(C) ((((C)>>8)&0xF800)|(((C)>>5)&0x07E0)|(((C)>>3)&0x001F))
+    if( (((uintptr_t) d)&2) && (n > 0) ) {
+        c0 = *s++;
+        *d++ = TO565(c0);
+        n--;
+    }
+    while( n >= 2 ) {
+        c0 = s[0];
+        c1 = s[1];
+        *(uint32_t *) d = TO565(c0)|(TO565(c1)<<16);
+        s += 2;
+        d += 2;
+        n -= 2;
+    }
+    if( n > 0 ) {
+        c0 = *s;
+        *d = TO565(c0);
+    }
+#undef TO565
+}
+
+/*
+ * @brief   RGB565 to ARGB8888
+ *
+ * @note    Two source pixels are read with a word access when aligned
+ */
+static void rgb565_to_argb8888(void *dst, const void *src, int n) {
+const uint16_t *s = (const uint16_t *) src;
+uint32_t *d = (uint32_t *) dst;
+uint32_t w;
+
+#define FROM565(V) (0xFF000000                                          \
+                   |((((V)&0xF800)<<8)|(((V)&0xE000)<<3))               \
+                   |((((V)&0x07E0)<<5)|(((V)&0x0600)>>1))               \
+                   |((((V)&0x001F)<<3)|(((V)&0x001C)>>2)))
+    if( (((uintptr_t) s)&2) && (n > 0) ) {
+        w = *s++;
+        *d++ = FROM565(w);
+        n--;
+    }
+    while( n >= 2 ) {
+        w = *(const uint32_t *) s;
+        d[0] = FROM565(w&0xFFFF);
+        d[1] = FROM565(w>>16);
+        s += 2;
+        d += 2;
+        n -= 2;
+    }
+    if( n > 0 ) {
+        w = *s;
+        *d = FROM565(w);
+    }
+#undef FROM565
+}
+
+/*
+ * @brief   ARGB8888 to RGB888
+ *
+ * @note    Four pixels are written with three word stores when aligned
+ */
+static void argb8888_to_rgb888(void *dst, const void *src, int n) {
+const uint32_t *s = (const uint32_t *) src;
+uint8_t *d = (uint8_t *) dst;
+uint32_t *q;
+uint32_t c0,c1,c2,c3;
+
+    while( (n > 0) && (((uintptr_t) d)&3) ) {
+        c0 = *s++;
+        d[0] = c0; d[1] = c0>>8; d[2] = c0>>16;
+        d += 3;
+        n--;
+    }
+    q = (uint32_t *) d;
+    while( n >= 4 ) {
+        c0 = s[0]&0xFFFFFF;
+        c1 = s[1]&0xFFFFFF;
+        c2 = s[2]&0xFFFFFF;
+        c3 = s[3]&0xFFFFFF;
+        q[0] = c0|(c1<<24);
+        q[1] = (c1>>8)|(c2<<16);
+        q[2] = (c2>>16)|(c3<<8);
+        q += 3;
+        s += 4;
+        n -= 4;
+    }
+    d = (uint8_t *) q;
+    while( n > 0 ) {
+        c0 = *s++;
+        d[0] = c0; d[1] = c0>>8; d[2] = c0>>16;
+        d += 3;
+        n--;
+    }
+}
+
+/*
+ * @brief   RGB888 to ARGB8888
+ *
+ * @note    Four pixels are read with three word loads when aligned
+ */
+static void rgb888_to_argb8888(void *dst, const void *src, int n) {
+const uint8_t *s = (const uint8_t *) src;
+const uint32_t *q;
+uint32_t *d = (uint32_t *) dst;
+uint32_t w0,w1,w2;
+
+    while( (n > 0) && (((uintptr_t) s)&3) ) {
+        *d++ = 0xFF000000|s[0]|(s[1]<<8)|(s[2]<<16);
+        s += 3;
+        n--;
+    }
+    q = (const uint32_t *) s;
+    while( n >= 4 ) {
+        w0 = q[0];
+        w1 = q[1];
+        w2 = q[2];
+        d[0] = 0xFF000000|w0;
+        d[1] = 0xFF000000|(w0>>24)|(w1<<8);
+        d[2] = 0xFF000000|(w1>>16)|(w2<<16);
+        d[3] = 0xFF000000|(w2>>8);
+        q += 3;
+        d += 4;
+        n -= 4;
+    }
+    s = (const uint8_t *) q;
+    while( n > 0 ) {
+        *d++ = 0xFF000000|s[0]|(s[1]<<8)|(s[2]<<16);
+        s += 3;
+        n--;
+    }
+}
+
+/*
+ * @brief   One byte source format using the table
+ */
+static void lookup(void *dst, int dstformat, const uint8_t *src, int n) {
+uint8_t *d8;
+uint16_t *d16;
+uint32_t *d32;
+uint32_t v;
+
+    switch(pixelsize[dstformat]) {
+    case 4:
+        d32 = (uint32_t *) dst;
+        while( n-- > 0 )
+            *d32++ = table[*src++];
+        break;
+    case 2:
+        d16 = (uint16_t *) dst;
+        while( n-- > 0 )
+            *d16++ = table[*src++];
+        break;
+    case 1:
+        d8 = (uint8_t *) dst;
+        while( n-- > 0 )
+            *d8++ = table[*src++];
+        break;
+    case 3:
+        d8 = (uint8_t *) dst;
+        while( n-- > 0 ) {
+            v = table[*src++];
+            d8[0] = v; d8[1] = v>>8; d8[2] = v>>16;
+            d8 += 3;
+        }
+        break;
+    }
+}
+
+/*
+ * @brief   Fill table for a one byte source format
+ */
+static void filltable(int dstformat, int srcformat, const uint32_t *clut, LCD_CLUT *dclut) {
+int i;
+
+    for(i=0;i<256;i++)
+        table[i] = Pixel_PackCLUT(dstformat,Pixel_Unpack(srcformat,i,clut),dclut);
+}
+
+/*
+ * @brief   Generic conversion through ARGB8888
+ */
+static void generic(uint8_t *dst, int dstformat, const uint8_t *src, int srcformat, int n,
+                    const uint32_t *clut, LCD_CLUT *dclut) {
+int i,k;
+int dps = pixelsize[dstformat];
+int sps = pixelsize[srcformat];
+
+    while( n > 0 ) {
+        k = (n > BUFFERSIZE) ? BUFFERSIZE : n;
+        if( srcformat == LCD_FORMAT_RGB565 ) {
+            rgb565_to_argb8888(buffer,src,k);
+        } else if( srcformat == LCD_FORMAT_RGB888 ) {
+            rgb888_to_argb8888(buffer,src,k);
+        } else {
+            for(i=0;i<k;i++)
+                buffer[i] = Pixel_Unpack(srcformat,Pixel_Read(src+i*sps,srcformat),clut);
+        }
+        if( dstformat == LCD_FORMAT_RGB565 ) {
+            argb8888_to_rgb565(dst,buffer,k);
+        } else if( dstformat == LCD_FORMAT_RGB888 ) {
+            argb8888_to_rgb888(dst,buffer,k);
+        } else {
+            for(i=0;i<k;i++)
+                Pixel_Write(dst+i*dps,dstformat,Pixel_PackCLUT(dstformat,buffer[i],dclut));
+        }
+        src += k*sps;
+        dst += k*dps;
+        n   -= k;
+    }
+}
+
+/*
+ * @brief   Convert a block of h rows with n pixels
+ *
+ * @note    The table for one byte source formats is built only once for the block
+ *
+ * @note    clut is the source palette and dclut the destination palette. Pixels are
+ *          copied when the formats and the palettes are the same.
+ */
+static void convertrows(uint8_t *dst, int dstformat, int dpitch,
+                        const uint8_t *src, int srcformat, int spitch,
+                        int n, int h, const uint32_t *clut, LCD_CLUT *dclut) {
+int i;
+int usetable = 0;
+
+    if( (srcformat == LCD_FORMAT_L8) || (srcformat == LCD_FORMAT_AL44) ) {
+        if( n*h >= 256 ) {
+            filltable(dstformat,srcformat,clut,dclut);
+            usetable = 1;
+        }
+    }
+
+    for(i=0;i<h;i++) {
+        if( (dstformat == srcformat) && ((dclut == 0) || (dclut->color == clut)) ) {
+            // plain copy (same palette or none)
+            uint8_t *d = dst;
+            const uint8_t *s = src;
+            int k = n*pixelsize[srcformat];
+            while( k-- > 0 )
+                *d++ = *s++;
+        } else if( usetable ) {
+            lookup(dst,dstformat,src,n);
+        } else if( (srcformat == LCD_FORMAT_ARGB8888) && (dstformat == LCD_FORMAT_RGB565) ) {
+            argb8888_to_rgb565(dst,src,n);
+        } else if( (srcformat == LCD_FORMAT_RGB565) && (dstformat == LCD_FORMAT_ARGB8888) ) {
+            rgb565_to_argb8888(dst,src,n);
+        } else if( (srcformat == LCD_FORMAT_ARGB8888) && (dstformat == LCD_FORMAT_RGB888) ) {
+            argb8888_to_rgb888(dst,src,n);
+        } else if( (srcformat == LCD_FORMAT_RGB888) && (dstformat == LCD_FORMAT_ARGB8888) ) {
+            rgb888_to_argb8888(dst,src,n);
+        } else {
+            generic(dst,dstformat,src,srcformat,n,clut,dclut);
+        }
+        dst += dpitch;
+        src += spitch;
+    }
+}
+
+/**
+ * @brief   Pixel_ConvertRow
+ *
+ * @note    Convert n pixels. Source and destination must not overlap
+ */
+void
+Pixel_ConvertRow(void *dst, int dstformat, const void *src, int srcformat, int n,
+                 const uint32_t *clut) {
+
+    convertrows(dst,dstformat,0,src,srcformat,0,n,1,clut,0);
+}
+
+/**
+ * @brief   Pixel_ConvertSurface
+ *
+ * @note    Copy src into dst with its top left corner at (x,y), converting the
+ *          pixel format. The copy is clipped against dst.
+ *
+ * @note    The palettes of the surfaces are used for L8, AL44 and AL88. When the
+ *          destination has a palette, colors are mapped to the nearest entry.
+ */
+void
+Pixel_ConvertSurface(const LCD_Surface *dst, int x, int y, const LCD_Surface *src) {
+int sx = 0, sy = 0, w = src->w, h = src->h;
+
+    if( x < dst->x ) {
+        sx = dst->x-x;
+        w -= sx;
+        x  = dst->x;
+    }
+    if( y < dst->y ) {
+        sy = dst->y-y;
+        h -= sy;
+        y  = dst->y;
+    }
+    if( x+w > dst->x+dst->w )
+        w = dst->x+dst->w-x;
+    if( y+h > dst->y+dst->h )
+        h = dst->y+dst->h-y;
+    if( (w <= 0) || (h <= 0) )
+        return;
+
+    convertrows(LCD_GetSurfacePixelAddress(dst,x,y),dst->format,dst->pitch,
+                LCD_GetSurfacePixelAddress(src,src->x+sx,src->y+sy),src->format,src->pitch,
+                w,h,src->clut?src->clut->color:0,dst->clut);
+}
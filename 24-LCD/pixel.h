@@ -0,0 +1,29 @@
+#ifndef PIXEL_H
+#define PIXEL_H
+/**
+ * @file    pixel.h
+ *
+ * @note    Pixel format conversion
+ *
+ * @note    Colors are exchanged in ARGB8888. Formats using a CLUT (L8, AL44 and AL88)
+ *          are converted using a table with 256 ARGB8888 entries. When no table is
+ *          given, the luminance is used as gray level. Conversion into a surface with
+ *          a palette (LCD_CLUT) maps colors to the nearest entry.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+
+uint32_t Pixel_Pack(int format, uint32_t argb);
+uint32_t Pixel_PackCLUT(int format, uint32_t argb, LCD_CLUT *clut);
+uint32_t Pixel_Unpack(int format, uint32_t pixel, const uint32_t *clut);
+uint32_t Pixel_Color(int format, unsigned a, unsigned r, unsigned g, unsigned b);
+uint32_t Pixel_Read(const void *p, int format);
+void     Pixel_Write(void *p, int format, uint32_t pixel);
+void     Pixel_ConvertRow(void *dst, int dstformat, const void *src, int srcformat, int n,
+                          const uint32_t *clut);
+void     Pixel_ConvertSurface(const LCD_Surface *dst, int x, int y, const LCD_Surface *src);
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * @file    poly.c
+ *
+ * @note    Scanline polygon fill using an edge table
+ *
+ * @note    The polygon can be convex, concave or self-intersecting. The even-odd or the
+ *          nonzero winding rule decides what is inside.
+ *
+ * @note    A pixel is filled when its center is inside the polygon. Vertices have
+ *          4 bits of sub-pixel precision and intersections are computed in 16.16
+ *          fixed point. Pixels centers exactly on a left or top edge are filled and
+ *          on a right or bottom edge are not, so adjacent polygons do not overlap.
+ *
+ * @note    Each interior run becomes a call to LCD_SurfaceFillSpan, that writes
+ *          words.
+ *
+ * @note    The edge table is static, so the routines are not reentrant.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "poly.h"
+
+#define MIN(A,B) ((A)<(B)?(A):(B))
+#define MAX(A,B) ((A)>(B)?(A):(B))
+
+/**
+ * @brief   Edge information
+ */
+typedef struct {
+    int32_t     x;              ///< Intersection with current line (16.16)
+    int32_t     dxdy;           ///< Increment of x for each line (16.16)
+    int         ystart;         ///< First line
+    int         yend;           ///< Line after the last one
+    int         dir;            ///< +1 going down, -1 going up
+} Edge;
+
+/**
+ * @brief   Intersection of a line with an edge
+ */
+typedef struct {
+    int32_t     x;
+    int         dir;
+} Crossing;
+
+static Edge     edgetable[POLY_MAXEDGES];
+static Edge    *active[POLY_MAXEDGES];
+static Crossing crossing[POLY_MAXEDGES];
+
+/**
+ * @brief   Poly_Fill
+ *
+ * @note    p has n vertices in sub-pixel units. The last vertex is connected to the
+ *          first one.
+ *
+ * @note    Returns 0 when OK and -1 when there are more than POLY_MAXEDGES edges
+ */
+int
+Poly_Fill(const LCD_Surface *s, const Poly_Point *p, int n, unsigned color, int rule) {
+int nedges,nactive,ncross;
+int i,j,k,y,ymin,ymax,x0,y0,x1,y1,dir,winding,xs,xe;
+Edge *e,etmp;
+Crossing ctmp;
+
+    if( n > POLY_MAXEDGES )
+        return -1;
+
+    // Build edge table. Horizontal edges do not cross any line and are ignored
+    nedges = 0;
+    ymin = INT32_MAX;
+    ymax = INT32_MIN;
+    for(i=0;i<n;i++) {
+        x0 = p[i].x;
+        y0 = p[i].y;
+        x1 = p[(i+1)%n].x;
+        y1 = p[(i+1)%n].y;
+        dir = 1;
+        if( y0 > y1 ) {
+            k = x0; x0 = x1; x1 = k;
+            k = y0; y0 = y1; y1 = k;
+            dir = -1;
+        }
+        e = &edgetable[nedges];
+        e->ystart = (y0+(1<<POLY_SUBPIXEL_BITS)-1)>>POLY_SUBPIXEL_BITS;
+        e->yend   = (y1+(1<<POLY_SUBPIXEL_BITS)-1)>>POLY_SUBPIXEL_BITS;
+        if( e->ystart >= e->yend )
+            continue;
+        e->dxdy = (int32_t) (((int64_t) (x1-x0)*65536)/(y1-y0));
+        e->x    = x0*(1<<(16-POLY_SUBPIXEL_BITS))
+                + (int32_t) (((int64_t) (e->ystart*(1<<POLY_SUBPIXEL_BITS)-y0)*e->dxdy)
+                             >>POLY_SUBPIXEL_BITS);
+        e->dir  = dir;
+        ymin = MIN(ymin,e->ystart);
+        ymax = MAX(ymax,e->yend);
+        // Keep table sorted by first line (insertion sort)
+        for(j=nedges;(j>0)&&(edgetable[j-1].ystart>edgetable[j].ystart);j--) {
+            etmp = edgetable[j];
+            edgetable[j] = edgetable[j-1];
+            edgetable[j-1] = etmp;
+        }
+        nedges++;
+    }
+    if( nedges == 0 )
+        return 0;
+
+    ymin = MAX(ymin,s->y);
+    ymax = MIN(ymax,s->y+s->h);
+
+    k = 0;
+    nactive = 0;
+    for(y=ymin;y<ymax;y++) {
+        // Remove edges that ended
+        for(i=0,j=0;i<nactive;i++) {
+            if( active[i]->yend > y )
+                active[j++] = active[i];
+        }
+        nactive = j;
+        // Add edges that start at this line (or above, when clipped)
+        while( (k < nedges) && (edgetable[k].ystart <= y) ) {
+            e = &edgetable[k++];
+            if( e->yend <= y )
+                continue;
+            if( e->ystart < y )
+                e->x += (y-e->ystart)*e->dxdy;
+            active[nactive++] = e;
+        }
+
+        // Sort crossings by x
+        ncross = 0;
+        for(i=0;i<nactive;i++) {
+            crossing[ncross].x   = active[i]->x;
+            crossing[ncross].dir = active[i]->dir;
+            for(j=ncross;(j>0)&&(crossing[j-1].x>crossing[j].x);j--) {
+                ctmp = crossing[j];
+                crossing[j] = crossing[j-1];
+                crossing[j-1] = ctmp;
+            }
+            ncross++;
+            active[i]->x += active[i]->dxdy;
+        }
+
+        // Fill spans
+        winding = 0;
+        for(i=0;i<ncross-1;i++) {
+            if( rule == POLY_NONZERO )
+                winding += crossing[i].dir;
+            else
+                winding ^= 1;
+            if( winding == 0 )
+                continue;
+            xs = (crossing[i].x+0xFFFF)>>16;
+            xe = (crossing[i+1].x+0xFFFF)>>16;
+            if( xe > xs )
+                LCD_SurfaceFillSpan(s,xs,y,xe-xs,color);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Poly_FillTriangle
+ *
+ * @note    Vertices in sub-pixel units, like Poly_Fill (use POLY_FIX to convert pixels)
+ */
+void
+Poly_FillTriangle(const LCD_Surface *s, int x0, int y0, int x1, int y1, int x2, int y2,
+                  unsigned color) {
+Poly_Point p[3];
+
+    p[0].x = x0;
+    p[0].y = y0;
+    p[1].x = x1;
+    p[1].y = y1;
+    p[2].x = x2;
+    p[2].y = y2;
+    Poly_Fill(s,p,3,color,POLY_EVENODD);
+}
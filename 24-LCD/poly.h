@@ -0,0 +1,50 @@
+#ifndef POLY_H
+#define POLY_H
+/**
+ * @file    poly.h
+ *
+ * @note    Scanline polygon fill
+ *
+ * @author  Hans
+ */
+
+#include "lcd.h"
+
+/**
+ * @brief   Sub-pixel precision of vertex coordinates
+ *
+ * @note    Vertex coordinates are in 1/16 pixel. Use POLY_FIX to convert pixels.
+ */
+///@{
+#define POLY_SUBPIXEL_BITS  4
+#define POLY_FIX(X)         ((X)*(1<<POLY_SUBPIXEL_BITS))
+///@}
+
+/**
+ * @brief   Maximal number of edges of a polygon
+ */
+#ifndef POLY_MAXEDGES
+#define POLY_MAXEDGES       64
+#endif
+
+/**
+ * @brief   Fill rules
+ */
+///@{
+#define POLY_EVENODD        0
+#define POLY_NONZERO        1
+///@}
+
+/**
+ * @brief   Vertex (sub-pixel coordinates)
+ */
+typedef struct {
+    int     x;
+    int     y;
+} Poly_Point;
+
+int  Poly_Fill(const LCD_Surface *s, const Poly_Point *p, int n, unsigned color, int rule);
+void Poly_FillTriangle(const LCD_Surface *s, int x0, int y0, int x1, int y1, int x2, int y2,
+                       unsigned color);
+
+#endif
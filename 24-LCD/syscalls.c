@@ -37,6 +37,7 @@
  *    int _unlink(char *name);
  *    int _wait(int *status);
  *    int _write(int file, char *ptr, int len);
+ *    void _setwritehook(int (*hook)(const char *ptr, int len));
  *
  * @note    Data list
  *    extern char *__env[1];
@@ -310,6 +311,18 @@ int _wait(int *status) {
     return -1;
 }
 
+/**
+ * @brief   Additional output for stdout and stderr
+ *
+ * @note    Used to show the output in other devices too, e.g. the LCD console
+ */
+static int (*writehook)(const char *ptr, int len) = 0;
+
+void _setwritehook(int (*hook)(const char *ptr, int len)) {
+
+    writehook = hook;
+}
+
 /**
  * @brief   write
  *
@@ -324,5 +337,7 @@ int _wait(int *status) {
 
 int _write(int file, char *ptr, int len) {
 
+    if( writehook && ((file == 1) || (file == 2)) )
+        writehook(ptr,len);
     return tty_write(0,ptr,len);
 }
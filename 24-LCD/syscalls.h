@@ -29,5 +29,6 @@ int _times(struct tms *buf);
 int _unlink(char *name);
 int _wait(int *status);
 int _write(int file, char *ptr, int len);
+void _setwritehook(int (*hook)(const char *ptr, int len));
 
 #endif
@@ -0,0 +1,150 @@
+/**
+ * @file    tile.c
+ *
+ * @note    Tiled rendering
+ *
+ * @note    The frame buffers are in the SDRAM, that has a 16-bit bus and is shared
+ *          with the LTDC. Drawing directly there means many single and partial
+ *          writes and each pixel can be written many times (overdraw).
+ *
+ * @note    Here the scene is drawn into a tile in the internal RAM (DTCM) and
+ *          then each line of the tile is copied to the frame buffer using
+ *          8-word bursts (LDM/STM). So every pixel of the frame buffer is
+ *          written only once.
+ *
+ * @note    The tile buffer is in the .dtcm section, that the linker script places at
+ *          the start of RAM, before .data and .bss, so it is always in DTCM.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+#include "tile.h"
+
+/**
+ * @brief   Tile buffer
+ *
+ * @note    Sized for the largest pixel (4 bytes). Word aligned. It is not initialized:
+ *          the draw function writes every pixel of each tile.
+ */
+static uint32_t tilebuffer[TILE_WIDTH*TILE_HEIGHT] __attribute__((section(".dtcm")));
+
+/**
+ * @brief   Statistics
+ */
+static Tile_Statistics stats = { 0, 0 };
+
+/**
+ * @brief   Tile_BurstCopy
+ *
+ * @note    Copy n bytes. After aligning the destination, it copies blocks of
+ *          8 words, that the compiler translates to LDM/STM pairs. This gives
+ *          the FMC full bursts.
+ *
+ * @note    When source and destination can not be both word aligned, it falls
+ *          back to a byte copy.
+ */
+void
+Tile_BurstCopy(void *dst, const void *src, int n) {
+uint8_t *d = (uint8_t *) dst;
+const uint8_t *s = (const uint8_t *) src;
+uint32_t *dw;
+const uint32_t *sw;
+uint32_t w0,w1,w2,w3,w4,w5,w6,w7;
+
+    while( (n > 0) && (((uintptr_t) d)&3) ) {
+        *d++ = *s++;
+        n--;
+    }
+
+    if( (((uintptr_t) s)&3) == 0 ) {
+        dw = (uint32_t *) d;
+        sw = (const uint32_t *) s;
+        while( n >= 32 ) {
+            w0 = sw[0]; w1 = sw[1]; w2 = sw[2]; w3 = sw[3];
+            w4 = sw[4]; w5 = sw[5]; w6 = sw[6]; w7 = sw[7];
+            dw[0] = w0; dw[1] = w1; dw[2] = w2; dw[3] = w3;
+            dw[4] = w4; dw[5] = w5; dw[6] = w6; dw[7] = w7;
+            dw += 8;
+            sw += 8;
+            n  -= 32;
+        }
+        while( n >= 4 ) {
+            *dw++ = *sw++;
+            n -= 4;
+        }
+        d = (uint8_t *) dw;
+        s = (const uint8_t *) sw;
+    }
+
+    while( n > 0 ) {
+        *d++ = *s++;
+        n--;
+    }
+}
+
+/**
+ * @brief   Tile_Render
+ *
+ * @note    The target surface is split in tiles. For each tile, the draw function
+ *          is called with a surface describing the tile and then the tile is
+ *          copied to the target.
+ */
+void
+Tile_Render(const LCD_Surface *target, Tile_DrawFunction draw, void *data) {
+LCD_Surface tile;
+int ps,tx,ty,tw,th,i;
+char *src,*dst;
+
+    ps = LCD_GetFormatPixelSize(target->format);
+    stats.tiles        = 0;
+    stats.byteswritten = 0;
+
+    for(ty=target->y;ty<target->y+target->h;ty+=TILE_HEIGHT) {
+        th = target->y+target->h-ty;
+        if( th > TILE_HEIGHT )
+            th = TILE_HEIGHT;
+        for(tx=target->x;tx<target->x+target->w;tx+=TILE_WIDTH) {
+            tw = target->x+target->w-tx;
+            if( tw > TILE_WIDTH )
+                tw = TILE_WIDTH;
+
+            LCD_InitSurface(&tile,tilebuffer,target->format,tx,ty,tw,th,0);
+            tile.clut = target->clut;
+            draw(&tile,data);
+
+            src = (char *) tile.area;
+            dst = (char *) LCD_GetSurfacePixelAddress(target,tx,ty);
+            for(i=0;i<th;i++) {
+                Tile_BurstCopy(dst,src,tw*ps);
+                src += tile.pitch;
+                dst += target->pitch;
+            }
+            stats.tiles++;
+            stats.byteswritten += tw*th*ps;
+        }
+    }
+}
+
+/**
+ * @brief   Tile_RenderLayer
+ *
+ * @note    Render into the (back) buffer of a layer
+ */
+void
+Tile_RenderLayer(int layer, Tile_DrawFunction draw, void *data) {
+LCD_Surface s;
+
+    LCD_GetLayerSurface(layer,&s);
+    Tile_Render(&s,draw,data);
+}
+
+/**
+ * @brief   Tile_GetStatistics
+ */
+void
+Tile_GetStatistics(Tile_Statistics *st) {
+
+    *st = stats;
+}
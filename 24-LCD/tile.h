@@ -0,0 +1,49 @@
+#ifndef TILE_H
+#define TILE_H
+/**
+ * @file    tile.h
+ *
+ * @note    Tiled rendering. The scene is drawn into a small tile in internal RAM
+ *          and the finished tile is copied to the frame buffer with burst writes.
+ *
+ * @author  Hans
+ */
+
+#include "lcd.h"
+
+/**
+ * @brief   Tile size
+ *
+ * @note    The tile buffer has TILE_WIDTH*TILE_HEIGHT*4 bytes and must fit in DTCM
+ */
+///@{
+#ifndef TILE_WIDTH
+#define TILE_WIDTH          240
+#endif
+#ifndef TILE_HEIGHT
+#define TILE_HEIGHT         32
+#endif
+///@}
+
+/**
+ * @brief   Function that draws the scene
+ *
+ * @note    It is called once for each tile. It must draw the complete scene using
+ *          screen coordinates. Everything outside the tile is clipped.
+ */
+typedef void (*Tile_DrawFunction)(const LCD_Surface *tile, void *data);
+
+/**
+ * @brief   Statistics of last rendering
+ */
+typedef struct {
+    uint32_t    tiles;              ///< Number of tiles rendered
+    uint32_t    byteswritten;       ///< Bytes copied to the target surface
+} Tile_Statistics;
+
+void  Tile_Render(const LCD_Surface *target, Tile_DrawFunction draw, void *data);
+void  Tile_RenderLayer(int layer, Tile_DrawFunction draw, void *data);
+void  Tile_GetStatistics(Tile_Statistics *st);
+void  Tile_BurstCopy(void *dst, const void *src, int n);
+
+#endif
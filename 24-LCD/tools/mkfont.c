@@ -0,0 +1,581 @@
+/**
+ * @file    mkfont.c
+ *
+ * @note    Host tool. Converts a TrueType (.ttf) or BDF (.bdf) font to a C file
+ *          with a Font_Info structure (see font.h)
+ *
+ * @note    Usage
+ *              mkfont [-b bpp] [-s size] [-f first] [-l last] [-n name] font > file.c
+ *
+ *              -b  bits per pixel of glyphs (1, 4 or 8). Default 4
+ *              -s  size in pixels (only TTF). Default 16
+ *              -f  first character. Default 32
+ *              -l  last character. Default 126
+ *              -n  name of Font_Info variable. Default font
+ *
+ * @note    Build
+ *              gcc -O2 -o mkfont mkfont.c -lm
+ *
+ * @note    TTF glyphs are rasterized with 16x16 samples per pixel. Only quadratic
+ *          outlines (glyf table) and cmap format 4 are supported. BDF glyphs have
+ *          only 0 or full alpha.
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define MAXCHARS        65536
+#define SUBSAMPLES      16
+
+/**
+ * @brief   Glyph as generated (A8)
+ */
+typedef struct {
+    int             present;
+    int             w,h;
+    int             xoff,yoff;
+    int             advance;
+    unsigned char  *alpha;
+} Glyph;
+
+static Glyph glyphs[MAXCHARS];
+static int   ascent  = 0;
+static int   height  = 0;
+
+/////////////////////////////////// Output ////////////////////////////////////////////////////////
+
+static void writefont(FILE *out, const char *name, const char *source, int first, int last, int bpp) {
+int c,i,x,y,ls,v,offset,col;
+unsigned char *line;
+Glyph *g;
+
+    fprintf(out,"/**\n * @file    %s.c\n *\n * @note    Generated by mkfont from %s. Do not edit\n */\n\n",name,source);
+    fprintf(out,"#include \"font.h\"\n\n");
+    fprintf(out,"static const uint8_t %s_bitmap[] = {\n",name);
+    col = 0;
+    for(c=first;c<=last;c++) {
+        g = &glyphs[c];
+        if( !g->present )
+            continue;
+        ls = (g->w*bpp+7)/8;
+        line = calloc(ls?ls:1,1);
+        for(y=0;y<g->h;y++) {
+            memset(line,0,ls);
+            for(x=0;x<g->w;x++) {
+                v = g->alpha[y*g->w+x];
+                switch(bpp) {
+                case 1: if( v >= 128 ) line[x/8] |= 0x80>>(x%8); break;
+                case 4: line[x/2] |= ((v+8)/17)<<((x&1)*4); break;
+                case 8: line[x] = v; break;
+                }
+            }
+            for(i=0;i<ls;i++) {
+                fprintf(out,"%s0x%02X,",col==0?"    ":"",line[i]);
+                if( ++col == 16 ) {
+                    fprintf(out,"\n");
+                    col = 0;
+                }
+            }
+        }
+        free(line);
+    }
+    fprintf(out,"%s};\n\n",col?"\n":"");
+
+    fprintf(out,"static const Font_Glyph %s_glyph[] = {\n",name);
+    offset = 0;
+    for(c=first;c<=last;c++) {
+        g = &glyphs[c];
+        if( !g->present ) {
+            fprintf(out,"    { %6d, %3d, %3d, %4d, %4d, %3d },\n",0,0,0,0,0,0);
+            continue;
+        }
+        fprintf(out,"    { %6d, %3d, %3d, %4d, %4d, %3d },",offset,g->w,g->h,g->xoff,g->yoff,g->advance);
+        if( c >= 32 && c < 127 && c != '\\' )
+            fprintf(out,"     // '%c'\n",c);
+        else
+            fprintf(out,"     // %d\n",c);
+        offset += g->h*((g->w*bpp+7)/8);
+    }
+    fprintf(out,"};\n\n");
+
+    fprintf(out,"const Font_Info %s = {\n",name);
+    fprintf(out,"    %s_bitmap,\n    %s_glyph,\n",name,name);
+    fprintf(out,"    %d, %d, %d, %d, %d\n};\n",first,last,bpp,height,ascent);
+}
+
+///////////////////////////////////// BDF /////////////////////////////////////////////////////////
+
+static int readbdf(FILE *in, int first, int last) {
+char buf[1024];
+int c = -1,adv = 0,w = 0,h = 0,xo = 0,yo = 0,fa = 0,fd = 0,y,x,v;
+Glyph *g;
+
+    while( fgets(buf,sizeof(buf),in) ) {
+        if( sscanf(buf,"FONT_ASCENT %d",&fa) == 1 ) continue;
+        if( sscanf(buf,"FONT_DESCENT %d",&fd) == 1 ) continue;
+        if( sscanf(buf,"ENCODING %d",&c) == 1 ) continue;
+        if( sscanf(buf,"DWIDTH %d",&adv) == 1 ) continue;
+        if( sscanf(buf,"BBX %d %d %d %d",&w,&h,&xo,&yo) == 4 ) continue;
+        if( strncmp(buf,"BITMAP",6) == 0 ) {
+            if( c < first || c > last ) {
+                c = -1;
+                continue;
+            }
+            g = &glyphs[c];
+            g->present = 1;
+            g->w       = w;
+            g->h       = h;
+            g->xoff    = xo;
+            g->yoff    = yo+h;
+            g->advance = adv;
+            g->alpha   = calloc(w*h+1,1);
+            for(y=0;y<h;y++) {
+                if( !fgets(buf,sizeof(buf),in) )
+                    return -1;
+                for(x=0;x<w;x++) {
+                    sscanf(buf+(x/8)*2,"%2x",&v);
+                    g->alpha[y*w+x] = (v&(0x80>>(x%8)))?255:0;
+                }
+            }
+        }
+    }
+    ascent = fa;
+    height = fa+fd;
+    return 0;
+}
+
+///////////////////////////////////// TTF /////////////////////////////////////////////////////////
+
+static unsigned char *ttf;
+static long ttfsize;
+
+#define U8(P)   (ttf[(P)])
+#define U16(P)  ((ttf[(P)]<<8)|ttf[(P)+1])
+#define S16(P)  ((short) U16(P))
+#define U32(P)  (((unsigned) U16(P)<<16)|U16((P)+2))
+
+static long findtable(const char *tag) {
+int i,n = U16(4);
+
+    for(i=0;i<n;i++) {
+        if( memcmp(ttf+12+16*i,tag,4) == 0 )
+            return U32(12+16*i+8);
+    }
+    return -1;
+}
+
+static long head,loca,glyf,hmtx,hhea,cmap,maxp;
+static int  unitsperem,locformat,nhmetrics,nglyphs;
+
+static int glyphindex(int c) {
+long sub = -1;
+int i,n,segs,p,start,end,delta,rangeoffset;
+
+    n = U16(cmap+2);
+    for(i=0;i<n;i++) {
+        p = cmap+4+8*i;
+        if( (U16(p) == 3 && (U16(p+2) == 1 || U16(p+2) == 0)) || U16(p) == 0 ) {
+            if( U16(cmap+U32(p+4)) == 4 ) {
+                sub = cmap+U32(p+4);
+                break;
+            }
+        }
+    }
+    if( sub < 0 )
+        return 0;
+    segs = U16(sub+6)/2;
+    for(i=0;i<segs;i++) {
+        end   = U16(sub+14+2*i);
+        start = U16(sub+16+2*segs+2*i);
+        if( c > end )
+            continue;
+        if( c < start )
+            return 0;
+        delta = S16(sub+16+4*segs+2*i);
+        p = sub+16+6*segs+2*i;
+        rangeoffset = U16(p);
+        if( rangeoffset == 0 )
+            return (c+delta)&0xFFFF;
+        p += rangeoffset+2*(c-start);
+        return U16(p) ? (U16(p)+delta)&0xFFFF : 0;
+    }
+    return 0;
+}
+
+static long glyphoffset(int gi, long *len) {
+long a,b;
+
+    if( locformat == 0 ) {
+        a = 2*U16(loca+2*gi);
+        b = 2*U16(loca+2*gi+2);
+    } else {
+        a = U32(loca+4*gi);
+        b = U32(loca+4*gi+4);
+    }
+    *len = b-a;
+    return glyf+a;
+}
+
+/**
+ * @brief   Line segments of the outline (pixel units, y down)
+ */
+typedef struct { double x0,y0,x1,y1; } Segment;
+
+static Segment *segs = 0;
+static int nsegs = 0, maxsegs = 0;
+
+static void addsegment(double x0, double y0, double x1, double y1) {
+
+    if( nsegs == maxsegs ) {
+        maxsegs = maxsegs ? 2*maxsegs : 256;
+        segs = realloc(segs,maxsegs*sizeof(Segment));
+    }
+    segs[nsegs].x0 = x0; segs[nsegs].y0 = y0;
+    segs[nsegs].x1 = x1; segs[nsegs].y1 = y1;
+    nsegs++;
+}
+
+static void addquad(double x0, double y0, double cx, double cy, double x1, double y1) {
+int i;
+const int n = 8;
+double t,px = x0,py = y0,nx,ny;
+
+    for(i=1;i<=n;i++) {
+        t  = (double) i/n;
+        nx = (1-t)*(1-t)*x0+2*(1-t)*t*cx+t*t*x1;
+        ny = (1-t)*(1-t)*y0+2*(1-t)*t*cy+t*t*y1;
+        addsegment(px,py,nx,ny);
+        px = nx;
+        py = ny;
+    }
+}
+
+/*
+ * @brief   Add outline of glyph gi transformed by matrix m (font units to pixels)
+ */
+static void addoutline(int gi, const double m[6]) {
+long p,len,fp;
+int nc,i,j,npts,ninstr,flag,rep,c0,c1,k;
+int *endpts;
+unsigned char *flags;
+double *xs,*ys,v;
+double ax,ay,bx,by,sx,sy;
+int comp,gidx,a1,a2;
+double cm[6],tm[6],a,b,c,d;
+
+    p = glyphoffset(gi,&len);
+    if( len <= 0 )
+        return;
+    nc = S16(p);
+    if( nc < 0 ) {
+        // Composite glyph
+        p += 10;
+        do {
+            comp = U16(p);
+            gidx = U16(p+2);
+            p += 4;
+            if( comp&1 ) {
+                a1 = S16(p); a2 = S16(p+2); p += 4;
+            } else {
+                a1 = (signed char) U8(p); a2 = (signed char) U8(p+1); p += 2;
+            }
+            a = d = 1.0; b = c = 0.0;
+            if( comp&8 ) {
+                a = d = S16(p)/16384.0; p += 2;
+            } else if( comp&0x40 ) {
+                a = S16(p)/16384.0; d = S16(p+2)/16384.0; p += 4;
+            } else if( comp&0x80 ) {
+                a = S16(p)/16384.0; b = S16(p+2)/16384.0;
+                c = S16(p+4)/16384.0; d = S16(p+6)/16384.0; p += 8;
+            }
+            // component matrix (font units), then parent transform
+            cm[0] = a; cm[1] = c; cm[2] = (comp&2)?a1:0;
+            cm[3] = b; cm[4] = d; cm[5] = (comp&2)?a2:0;
+            tm[0] = m[0]*cm[0]+m[1]*cm[3];
+            tm[1] = m[0]*cm[1]+m[1]*cm[4];
+            tm[2] = m[0]*cm[2]+m[1]*cm[5]+m[2];
+            tm[3] = m[3]*cm[0]+m[4]*cm[3];
+            tm[4] = m[3]*cm[1]+m[4]*cm[4];
+            tm[5] = m[3]*cm[2]+m[4]*cm[5]+m[5];
+            addoutline(gidx,tm);
+        } while( comp&0x20 );
+        return;
+    }
+
+    endpts = malloc(nc*sizeof(int));
+    for(i=0;i<nc;i++)
+        endpts[i] = U16(p+10+2*i);
+    npts   = nc ? endpts[nc-1]+1 : 0;
+    ninstr = U16(p+10+2*nc);
+    fp     = p+10+2*nc+2+ninstr;
+    flags  = malloc(npts+1);
+    xs     = malloc((npts+1)*sizeof(double));
+    ys     = malloc((npts+1)*sizeof(double));
+    for(i=0;i<npts;) {
+        flag = U8(fp++);
+        flags[i++] = flag;
+        if( flag&8 ) {
+            rep = U8(fp++);
+            while( rep-- > 0 && i < npts )
+                flags[i++] = flag;
+        }
+    }
+    v = 0;
+    for(i=0;i<npts;i++) {
+        if( flags[i]&2 ) {
+            v += (flags[i]&16) ? U8(fp) : -U8(fp);
+            fp++;
+        } else if( !(flags[i]&16) ) {
+            v += S16(fp);
+            fp += 2;
+        }
+        xs[i] = v;
+    }
+    v = 0;
+    for(i=0;i<npts;i++) {
+        if( flags[i]&4 ) {
+            v += (flags[i]&32) ? U8(fp) : -U8(fp);
+            fp++;
+        } else if( !(flags[i]&32) ) {
+            v += S16(fp);
+            fp += 2;
+        }
+        ys[i] = v;
+    }
+    // transform to pixels
+    for(i=0;i<npts;i++) {
+        ax = xs[i];
+        ay = ys[i];
+        xs[i] = m[0]*ax+m[1]*ay+m[2];
+        ys[i] = m[3]*ax+m[4]*ay+m[5];
+    }
+
+    c0 = 0;
+    for(i=0;i<nc;i++) {
+        c1 = endpts[i];
+        if( c1 < c0 ) {
+            c0 = c1+1;
+            continue;
+        }
+        // find a starting on-curve point (or the midpoint of two off-curve points)
+        k = -1;
+        for(j=c0;j<=c1;j++) {
+            if( flags[j]&1 ) {
+                k = j;
+                break;
+            }
+        }
+        if( k >= 0 ) {
+            sx = xs[k];
+            sy = ys[k];
+        } else {
+            // all points off-curve: start between last and first points
+            sx = (xs[c0]+xs[c1])/2;
+            sy = (ys[c0]+ys[c1])/2;
+            k  = c1;
+        }
+        ax = sx;
+        ay = sy;
+        for(j=1;j<=c1-c0+1;j++) {
+            int q = c0+(k-c0+j)%(c1-c0+1);
+            if( flags[q]&1 ) {
+                addsegment(ax,ay,xs[q],ys[q]);
+                ax = xs[q];
+                ay = ys[q];
+            } else {
+                int r = c0+(k-c0+j+1)%(c1-c0+1);
+                if( flags[r]&1 ) {
+                    bx = xs[r];
+                    by = ys[r];
+                } else {
+                    bx = (xs[q]+xs[r])/2;
+                    by = (ys[q]+ys[r])/2;
+                }
+                addquad(ax,ay,xs[q],ys[q],bx,by);
+                ax = bx;
+                ay = by;
+                if( flags[r]&1 )
+                    j++;
+            }
+        }
+        if( ax != sx || ay != sy )
+            addsegment(ax,ay,sx,sy);
+        c0 = c1+1;
+    }
+    free(endpts);
+    free(flags);
+    free(xs);
+    free(ys);
+}
+
+static int cmpdouble(const void *a, const void *b) {
+double d = ((const double *) a)[0]-((const double *) b)[0];
+
+    return (d > 0)-(d < 0);
+}
+
+/*
+ * @brief   Rasterize segments into glyph g (nonzero rule)
+ */
+static void rasterize(Glyph *g, double ox, double oy) {
+int x,y,s,i,n,wind;
+double sy,t,xa,xb,*cross,*cov;
+int maxcross = 2*nsegs+2;
+
+    cross = malloc(2*maxcross*sizeof(double));
+    cov   = calloc(g->w+2,sizeof(double));
+    for(y=0;y<g->h;y++) {
+        memset(cov,0,(g->w+2)*sizeof(double));
+        for(s=0;s<SUBSAMPLES;s++) {
+            sy = oy+y+(s+0.5)/SUBSAMPLES;
+            n = 0;
+            for(i=0;i<nsegs;i++) {
+                Segment *e = &segs[i];
+                if( (e->y0 <= sy && e->y1 > sy) || (e->y1 <= sy && e->y0 > sy) ) {
+                    t = (sy-e->y0)/(e->y1-e->y0);
+                    cross[2*n]   = e->x0+t*(e->x1-e->x0)-ox;
+                    cross[2*n+1] = (e->y1 > e->y0) ? 1 : -1;
+                    n++;
+                }
+            }
+            qsort(cross,n,2*sizeof(double),cmpdouble);
+            wind = 0;
+            for(i=0;i<n-1;i++) {
+                wind += (int) cross[2*i+1];
+                if( wind == 0 )
+                    continue;
+                xa = cross[2*i];
+                xb = cross[2*i+2];
+                if( xa < 0 ) xa = 0;
+                if( xb > g->w ) xb = g->w;
+                if( xb <= xa )
+                    continue;
+                // horizontal coverage with fractional ends
+                for(x=(int) floor(xa);x<g->w && x<xb;x++) {
+                    double l = (x > xa) ? x : xa;
+                    double r = (x+1 < xb) ? x+1 : xb;
+                    if( r > l )
+                        cov[x] += (r-l)/SUBSAMPLES;
+                }
+            }
+        }
+        for(x=0;x<g->w;x++) {
+            int v = (int) (cov[x]*255+0.5);
+            g->alpha[y*g->w+x] = v > 255 ? 255 : v;
+        }
+    }
+    free(cross);
+    free(cov);
+}
+
+static int readttf(FILE *in, int first, int last, int size) {
+int c,gi,i;
+double scale,m[6],xmin,xmax,ymin,ymax,asc,desc,gap;
+Glyph *g;
+
+    fseek(in,0,SEEK_END);
+    ttfsize = ftell(in);
+    fseek(in,0,SEEK_SET);
+    ttf = malloc(ttfsize);
+    if( fread(ttf,1,ttfsize,in) != (size_t) ttfsize )
+        return -1;
+
+    head = findtable("head");
+    loca = findtable("loca");
+    glyf = findtable("glyf");
+    hmtx = findtable("hmtx");
+    hhea = findtable("hhea");
+    cmap = findtable("cmap");
+    maxp = findtable("maxp");
+    if( head < 0 || loca < 0 || glyf < 0 || hmtx < 0 || hhea < 0 || cmap < 0 || maxp < 0 ) {
+        fprintf(stderr,"Not a TrueType font with quadratic outlines\n");
+        return -1;
+    }
+    unitsperem = U16(head+18);
+    locformat  = S16(head+50);
+    nhmetrics  = U16(hhea+34);
+    nglyphs    = U16(maxp+4);
+
+    scale = (double) size/unitsperem;
+    asc   = S16(hhea+4)*scale;
+    desc  = -S16(hhea+6)*scale;
+    gap   = S16(hhea+8)*scale;
+    ascent = (int) ceil(asc);
+    height = (int) ceil(asc+desc+gap);
+
+    for(c=first;c<=last;c++) {
+        gi = glyphindex(c);
+        if( gi >= nglyphs )
+            continue;
+        g = &glyphs[c];
+        i = gi < nhmetrics ? gi : nhmetrics-1;
+        g->present = 1;
+        g->advance = (int) floor(U16(hmtx+4*i)*scale+0.5);
+
+        nsegs = 0;
+        m[0] = scale; m[1] = 0;      m[2] = 0;
+        m[3] = 0;     m[4] = -scale; m[5] = 0;
+        addoutline(gi,m);
+        if( nsegs == 0 ) {
+            g->alpha = calloc(1,1);
+            continue;
+        }
+        xmin = xmax = segs[0].x0;
+        ymin = ymax = segs[0].y0;
+        for(i=0;i<nsegs;i++) {
+            if( segs[i].x0 < xmin ) xmin = segs[i].x0;
+            if( segs[i].x0 > xmax ) xmax = segs[i].x0;
+            if( segs[i].y0 < ymin ) ymin = segs[i].y0;
+            if( segs[i].y0 > ymax ) ymax = segs[i].y0;
+        }
+        g->xoff  = (int) floor(xmin);
+        g->yoff  = -(int) floor(ymin);
+        g->w     = (int) ceil(xmax)-g->xoff;
+        g->h     = (int) ceil(ymax)+g->yoff;
+        g->alpha = calloc(g->w*g->h+1,1);
+        rasterize(g,g->xoff,-g->yoff);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+int bpp = 4, size = 16, first = 32, last = 126;
+const char *name = "font";
+const char *fname = 0;
+FILE *in;
+int i,rc;
+
+    for(i=1;i<argc;i++) {
+        if( strcmp(argv[i],"-b") == 0 && i+1 < argc ) bpp   = atoi(argv[++i]);
+        else if( strcmp(argv[i],"-s") == 0 && i+1 < argc ) size  = atoi(argv[++i]);
+        else if( strcmp(argv[i],"-f") == 0 && i+1 < argc ) first = atoi(argv[++i]);
+        else if( strcmp(argv[i],"-l") == 0 && i+1 < argc ) last  = atoi(argv[++i]);
+        else if( strcmp(argv[i],"-n") == 0 && i+1 < argc ) name  = argv[++i];
+        else fname = argv[i];
+    }
+    if( !fname || (bpp != 1 && bpp != 4 && bpp != 8) || first < 0 || last >= MAXCHARS || first > last ) {
+        fprintf(stderr,"Usage: %s [-b 1|4|8] [-s size] [-f first] [-l last] [-n name] font.ttf|font.bdf\n",argv[0]);
+        return 1;
+    }
+    in = fopen(fname,"rb");
+    if( !in ) {
+        perror(fname);
+        return 1;
+    }
+    i = strlen(fname);
+    if( i > 4 && strcmp(fname+i-4,".bdf") == 0 )
+        rc = readbdf(in,first,last);
+    else
+        rc = readttf(in,first,last,size);
+    fclose(in);
+    if( rc < 0 ) {
+        fprintf(stderr,"Error reading %s\n",fname);
+        return 1;
+    }
+    writefont(stdout,name,strrchr(fname,'/')?strrchr(fname,'/')+1:fname,first,last,bpp);
+    return 0;
+}
@@ -0,0 +1,348 @@
+/**
+ * @file    mkimage.c
+ *
+ * @note    Host tool. Compresses a PPM/PGM/PAM image into QOI or RLE (see image.c)
+ *
+ * @note    Usage
+ *              mkimage [-t qoi|rle|raw] [-f format] [-n name] [-b] image.ppm > file.c
+ *
+ *              -t  type of compression. Default qoi. raw copies the file unchanged
+ *                  (e.g. a JPEG file for jpeg.c)
+ *              -f  pixel format for RLE: argb8888, rgb888, rgb565, argb1555, argb4444,
+ *                  l8, al44, al88. Default rgb565
+ *              -n  name of array. Default image
+ *              -b  binary output instead of a C file
+ *
+ * @note    Input can be binary PPM (P6), PGM (P5) or PAM (P7) with 1 to 4 channels
+ *          and maxval 255. The sizes and the compression ratio are printed to stderr.
+ *          The ratio uses as reference the uncompressed size in the same format
+ *          (RGB888 or ARGB8888 for QOI).
+ *
+ * @note    Build
+ *              gcc -O2 -o mkimage mkimage.c
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief   Pixel formats (same values as LCD_FORMAT_*)
+ */
+static const struct { const char *name; int size; } formats[] = {
+    { "argb8888", 4 }, { "rgb888", 3 }, { "rgb565", 2 }, { "argb1555", 2 },
+    { "argb4444", 2 }, { "l8",     1 }, { "al44",   1 }, { "al88",     2 }
+};
+
+/**
+ * @brief   Output buffer
+ */
+static uint8_t *out    = 0;
+static int      outlen = 0;
+static int      outcap = 0;
+
+static void put(int b) {
+
+    if( outlen == outcap ) {
+        outcap = outcap ? 2*outcap : 65536;
+        out    = realloc(out,outcap);
+    }
+    out[outlen++] = b;
+}
+
+/////////////////////////////////// Input /////////////////////////////////////////////////////////
+
+/*
+ * @brief   Read a header field of a PNM file (skipping blanks and comments)
+ */
+static int readfield(FILE *f, char *buf, int size) {
+int c,n = 0;
+
+    do {
+        c = fgetc(f);
+        if( c == '#' )
+            while( (c != '\n') && (c != EOF) )
+                c = fgetc(f);
+    } while( (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') );
+    while( (c != EOF) && (c != ' ') && (c != '\t') && (c != '\n') && (c != '\r') ) {
+        if( n < size-1 )
+            buf[n++] = c;
+        c = fgetc(f);
+    }
+    buf[n] = '\0';
+    return n;
+}
+
+/*
+ * @brief   Read image as ARGB8888
+ */
+static uint32_t *readimage(const char *fname, int *pw, int *ph, int *palpha) {
+FILE *f;
+char magic[8],field[64];
+int w = 0, h = 0, maxval = 0, depth = 0;
+int i,c;
+uint8_t v[4];
+uint32_t *img;
+
+    f = fopen(fname,"rb");
+    if( !f )
+        return 0;
+    readfield(f,magic,sizeof(magic));
+    if( strcmp(magic,"P6") == 0 || strcmp(magic,"P5") == 0 ) {
+        depth = magic[1] == '6' ? 3 : 1;
+        readfield(f,field,sizeof(field)); w      = atoi(field);
+        readfield(f,field,sizeof(field)); h      = atoi(field);
+        readfield(f,field,sizeof(field)); maxval = atoi(field);
+    } else if( strcmp(magic,"P7") == 0 ) {
+        while( readfield(f,field,sizeof(field)) && strcmp(field,"ENDHDR") ) {
+            if( strcmp(field,"WIDTH") == 0 )  { readfield(f,field,sizeof(field)); w = atoi(field); }
+            else if( strcmp(field,"HEIGHT") == 0 ) { readfield(f,field,sizeof(field)); h = atoi(field); }
+            else if( strcmp(field,"DEPTH") == 0 )  { readfield(f,field,sizeof(field)); depth = atoi(field); }
+            else if( strcmp(field,"MAXVAL") == 0 ) { readfield(f,field,sizeof(field)); maxval = atoi(field); }
+            else if( strcmp(field,"TUPLTYPE") == 0 ) readfield(f,field,sizeof(field));
+        }
+    }
+    if( (w <= 0) || (h <= 0) || (w > 65535) || (h > 65535) || (maxval != 255)
+        || (depth < 1) || (depth > 4) ) {
+        fclose(f);
+        return 0;
+    }
+
+    img = malloc(sizeof(uint32_t)*w*h);
+    for(i=0;i<w*h;i++) {
+        for(c=0;c<depth;c++)
+            v[c] = fgetc(f);
+        switch(depth) {
+        case 1: img[i] = 0xFF000000|(v[0]<<16)|(v[0]<<8)|v[0];                     break;
+        case 2: img[i] = ((uint32_t) v[1]<<24)|(v[0]<<16)|(v[0]<<8)|v[0];          break;
+        case 3: img[i] = 0xFF000000|(v[0]<<16)|(v[1]<<8)|v[2];                     break;
+        case 4: img[i] = ((uint32_t) v[3]<<24)|(v[0]<<16)|(v[1]<<8)|v[2];          break;
+        }
+    }
+    fclose(f);
+    *pw     = w;
+    *ph     = h;
+    *palpha = (depth == 2) || (depth == 4);
+    return img;
+}
+
+/*
+ * @brief   Read a file unchanged into the output buffer
+ */
+static int readraw(const char *fname) {
+FILE *f;
+int c;
+
+    f = fopen(fname,"rb");
+    if( !f )
+        return 0;
+    while( (c = fgetc(f)) != EOF )
+        put(c);
+    fclose(f);
+    return 1;
+}
+
+/////////////////////////////////// QOI ///////////////////////////////////////////////////////////
+
+#define QOI_HASH(C)             ((((C)>>16&0xFF)*3+((C)>>8&0xFF)*5+((C)&0xFF)*7+((C)>>24)*11)&63)
+
+static void encodeqoi(const uint32_t *img, int w, int h, int alpha) {
+uint32_t index[64] = { 0 };
+uint32_t px, prev = 0xFF000000;
+int i,run = 0,k;
+int dr,dg,db,vgr,vgb;
+
+    put('q'); put('o'); put('i'); put('f');
+    put(w>>24); put(w>>16); put(w>>8); put(w);
+    put(h>>24); put(h>>16); put(h>>8); put(h);
+    put(alpha ? 4 : 3);
+    put(0);
+
+    for(i=0;i<w*h;i++) {
+        px = img[i];
+        if( px == prev ) {
+            run++;
+            if( (run == 62) || (i == w*h-1) ) {
+                put(0xC0|(run-1));
+                run = 0;
+            }
+            continue;
+        }
+        if( run > 0 ) {
+            put(0xC0|(run-1));
+            run = 0;
+        }
+        k = QOI_HASH(px);
+        if( index[k] == px ) {
+            put(k);
+        } else {
+            index[k] = px;
+            if( (px>>24) == (prev>>24) ) {
+                dr  = (int8_t) (((px>>16)&0xFF)-((prev>>16)&0xFF));
+                dg  = (int8_t) (((px>>8)&0xFF)-((prev>>8)&0xFF));
+                db  = (int8_t) ((px&0xFF)-(prev&0xFF));
+                vgr = dr-dg;
+                vgb = db-dg;
+                if( (dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1) ) {
+                    put(0x40|((dr+2)<<4)|((dg+2)<<2)|(db+2));
+                } else if( (vgr >= -8) && (vgr <= 7) && (dg >= -32) && (dg <= 31)
+                           && (vgb >= -8) && (vgb <= 7) ) {
+                    put(0x80|(dg+32));
+                    put(((vgr+8)<<4)|(vgb+8));
+                } else {
+                    put(0xFE); put(px>>16); put(px>>8); put(px);
+                }
+            } else {
+                put(0xFF); put(px>>16); put(px>>8); put(px); put(px>>24);
+            }
+        }
+        prev = px;
+    }
+    for(i=0;i<7;i++)
+        put(0);
+    put(1);
+}
+
+/////////////////////////////////// RLE ///////////////////////////////////////////////////////////
+
+/*
+ * @brief   Convert ARGB8888 into a format (as Pixel_Pack in pixel.c)
+ */
+static uint32_t pack(int format, uint32_t c) {
+unsigned a = c>>24, r = (c>>16)&0xFF, g = (c>>8)&0xFF, b = c&0xFF;
+unsigned l = (r*77+g*150+b*29+128)>>8;
+
+    switch(format) {
+    case 0: return c;
+    case 1: return c&0xFFFFFF;
+    case 2: return ((r>>3)<<11)|((g>>2)<<5)|(b>>3);
+    case 3: return ((a>>7)<<15)|((r>>3)<<10)|((g>>3)<<5)|(b>>3);
+    case 4: return ((a>>4)<<12)|((r>>4)<<8)|((g>>4)<<4)|(b>>4);
+    case 5: return l;
+    case 6: return ((a>>4)<<4)|(l>>4);
+    case 7: return (a<<8)|l;
+    }
+    return 0;
+}
+
+static void putpixel(uint32_t v, int ps) {
+int i;
+
+    for(i=0;i<ps;i++)
+        put((v>>(8*i))&0xFF);
+}
+
+static void encoderle(const uint32_t *img, int w, int h, int format) {
+int ps = formats[format].size;
+int n = w*h;
+int i,j,k;
+uint32_t *p;
+
+    put('R'); put('L'); put('E'); put('1');
+    put(w); put(w>>8);
+    put(h); put(h>>8);
+    put(format); put(0); put(0); put(0);
+
+    p = malloc(sizeof(uint32_t)*n);
+    for(i=0;i<n;i++)
+        p[i] = pack(format,img[i]);
+
+    i = 0;
+    while( i < n ) {
+        // run
+        k = 1;
+        while( (i+k < n) && (k < 128) && (p[i+k] == p[i]) )
+            k++;
+        if( k >= 2 ) {
+            put(0x80|(k-1));
+            putpixel(p[i],ps);
+            i += k;
+            continue;
+        }
+        // literal until a run of 3 equal pixels
+        k = 1;
+        while( (i+k < n) && (k < 128) ) {
+            if( (i+k+2 < n) && (p[i+k] == p[i+k+1]) && (p[i+k] == p[i+k+2]) )
+                break;
+            k++;
+        }
+        put(k-1);
+        for(j=0;j<k;j++)
+            putpixel(p[i+j],ps);
+        i += k;
+    }
+    free(p);
+}
+
+/////////////////////////////////// Output ////////////////////////////////////////////////////////
+
+static void writecfile(FILE *f, const char *name, const char *source) {
+int i;
+
+    fprintf(f,"/**\n * @file    %s.c\n *\n * @note    Generated by mkimage from %s. Do not edit\n */\n\n",name,source);
+    fprintf(f,"#include <stdint.h>\n\n");
+    fprintf(f,"const int %s_size = %d;\n\n",name,outlen);
+    fprintf(f,"const uint8_t %s[] = {\n",name);
+    for(i=0;i<outlen;i++)
+        fprintf(f,"%s0x%02X,%s",(i%16)==0?"    ":"",out[i],((i%16)==15||i==outlen-1)?"\n":"");
+    fprintf(f,"};\n");
+}
+
+int main(int argc, char *argv[]) {
+const char *fname = 0, *name = "image", *type = "qoi", *fmt = "rgb565";
+int binary = 0;
+int i,w,h,alpha,format,raw;
+uint32_t *img;
+
+    for(i=1;i<argc;i++) {
+        if( strcmp(argv[i],"-t") == 0 && i+1 < argc ) type = argv[++i];
+        else if( strcmp(argv[i],"-f") == 0 && i+1 < argc ) fmt  = argv[++i];
+        else if( strcmp(argv[i],"-n") == 0 && i+1 < argc ) name = argv[++i];
+        else if( strcmp(argv[i],"-b") == 0 ) binary = 1;
+        else fname = argv[i];
+    }
+    for(format=0;format<8;format++)
+        if( strcmp(fmt,formats[format].name) == 0 )
+            break;
+    if( !fname || (format == 8) || (strcmp(type,"qoi") && strcmp(type,"rle") && strcmp(type,"raw")) ) {
+        fprintf(stderr,"Usage: %s [-t qoi|rle|raw] [-f format] [-n name] [-b] image.ppm|pgm|pam\n",argv[0]);
+        return 1;
+    }
+    if( strcmp(type,"raw") == 0 ) {
+        if( !readraw(fname) ) {
+            fprintf(stderr,"Cannot read %s\n",fname);
+            return 1;
+        }
+        fprintf(stderr,"%s: %d bytes\n",fname,outlen);
+        if( binary )
+            fwrite(out,1,outlen,stdout);
+        else
+            writecfile(stdout,name,fname);
+        return 0;
+    }
+    img = readimage(fname,&w,&h,&alpha);
+    if( !img ) {
+        fprintf(stderr,"Cannot read %s (binary PPM, PGM or PAM with maxval 255)\n",fname);
+        return 1;
+    }
+
+    if( strcmp(type,"qoi") == 0 ) {
+        encodeqoi(img,w,h,alpha);
+        raw = w*h*(alpha?4:3);
+    } else {
+        encoderle(img,w,h,format);
+        raw = w*h*formats[format].size;
+    }
+    fprintf(stderr,"%s: %dx%d %s %d bytes, uncompressed %d bytes, ratio %.2f\n",
+            fname,w,h,type,outlen,raw,(double) raw/outlen);
+
+    if( binary )
+        fwrite(out,1,outlen,stdout);
+    else
+        writecfile(stdout,name,fname);
+    free(img);
+    return 0;
+}
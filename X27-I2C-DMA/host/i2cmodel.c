@@ -0,0 +1,506 @@
+/**
+ * @file    i2cmodel.c
+ *
+ * @note    Model of the I2C units of the STM32F746 in master mode and of the bus
+ *
+ * @note    I2CModel_Step advances the unit by one bus event (address, byte, stop) using
+ *          the register values written by the driver:
+ *          * START (and STOP) in CR2 are seen and cleared.
+ *          * TXDR is set to TXEMPTY when TXIS is set. A different value is the byte
+ *            written by the driver.
+ *          * RXNE is considered read (RXDR) one step after it is set.
+ *          * When TCR is set, NBYTES is cleared, so the new value written by the
+ *            driver can be seen.
+ *          * ICR clears the flags. ISR is rewritten after each step.
+ *          * With TXDMAEN or RXDMAEN, an enabled DMA1 stream whose PAR is TXDR or RXDR
+ *            moves the byte in the same step (M0AR, NDTR).
+ *          * 10-bit addresses (ADD10) send the header and the second address byte.
+ *            HEAD10R after a write to the same slave sends only the read header.
+ *
+ * @note    I2CModel_Run calls the interrupt handlers of the driver after each step, when
+ *          an enabled flag is set.
+ *
+ * @note    Writes to PE are not seen. The model goes idle by itself after an error.
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f746xx.h"
+#include "gpio.h"
+#include "i2cmodel.h"
+
+/**
+ * @brief   Registers
+ */
+///@{
+I2C_TypeDef     I2CModel_Registers[4];
+RCC_TypeDef     I2CModel_RCC;
+DMA_TypeDef     I2CModel_DMA1;
+DMA_Stream_TypeDef I2CModel_DMA1Streams[8];
+DWT_Type        I2CModel_DWT;
+GPIO_TypeDef    I2CModel_GPIO[2];
+///@}
+
+/**
+ * @brief   Trace and counters
+ */
+///@{
+char            I2CModel_Trace[16384];
+unsigned        I2CModel_Interrupts;
+unsigned        I2CModel_Segments;
+unsigned        I2CModel_DMABytes;
+unsigned        I2CModel_CacheCleans;
+unsigned        I2CModel_CacheInvalidates;
+///@}
+
+/**
+ * @brief   Value of TXDR while waiting for a byte
+ */
+#define TXEMPTY         0x100
+
+/**
+ * @brief   States of a unit
+ */
+///@{
+#define IDLE            0
+#define WRITING         1
+#define READING         2
+#define WAITTC          3           // Transfer complete, waiting for START or STOP
+#define WAITTCR         4           // Transfer complete reload, waiting for NBYTES
+///@}
+
+#define MAXDEVICES      8
+
+typedef struct {
+    int                 state;
+    uint32_t            flags;
+    I2CModel_Device    *dev;
+    unsigned            nbytes;
+    unsigned            count;
+    int                 rd;
+    int                 first;          // Next byte written sets the register pointer
+    int                 written;        // Bytes written since the START
+} Unit;
+
+static Unit             units[4];
+static I2CModel_Device *devices[MAXDEVICES];
+static int              ndevices;
+static int              arbitrationlosses;
+static int              buserrorat;      // Bytes until a bus error, or -1
+static int              lastaddress = -1; // 10-bit address of the last write (HEAD10R)
+
+/**
+ * @brief   Transfer of each DMA stream
+ *
+ * @note    A new transfer is detected when M0AR changes or NDTR grows
+ */
+///@{
+static uint32_t         dmabase[8];
+static uint32_t         dmatotal[8];
+static uint32_t         dmalast[8];
+///@}
+
+/**
+ * @brief   Cache maintenance
+ */
+///@{
+void SCB_CleanDCache_by_Addr(uint32_t *addr, int32_t size) {
+    (void) addr; (void) size;
+    I2CModel_CacheCleans++;
+}
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t size) {
+    (void) addr; (void) size;
+    I2CModel_CacheInvalidates++;
+}
+///@}
+
+/**
+ * @brief   GPIO (nothing to do)
+ */
+void GPIO_ConfigureSinglePin( const GPIO_PinConfiguration *conf ) {
+    (void) conf;
+}
+
+/**
+ * @brief   Interrupt handlers of the driver
+ */
+///@{
+void I2C1_EV_IRQHandler(void);
+void I2C1_ER_IRQHandler(void);
+void I2C2_EV_IRQHandler(void);
+void I2C2_ER_IRQHandler(void);
+void I2C3_EV_IRQHandler(void);
+void I2C3_ER_IRQHandler(void);
+void I2C4_EV_IRQHandler(void);
+void I2C4_ER_IRQHandler(void);
+
+static void (*const evhandlers[4])(void) = {
+    I2C1_EV_IRQHandler, I2C2_EV_IRQHandler, I2C3_EV_IRQHandler, I2C4_EV_IRQHandler
+};
+static void (*const erhandlers[4])(void) = {
+    I2C1_ER_IRQHandler, I2C2_ER_IRQHandler, I2C3_ER_IRQHandler, I2C4_ER_IRQHandler
+};
+///@}
+
+static void trace(const char *fmt, unsigned v) {
+size_t n = strlen(I2CModel_Trace);
+
+    if( n+8 >= sizeof(I2CModel_Trace) )
+        return;
+    if( n > 0 )
+        I2CModel_Trace[n++] = ' ';
+    snprintf(I2CModel_Trace+n,sizeof(I2CModel_Trace)-n,fmt,v);
+}
+
+/**
+ * @brief   I2CModel_Reset
+ *
+ * @note    Clears registers, devices, trace and counters
+ */
+void
+I2CModel_Reset(void) {
+
+    memset(I2CModel_Registers,0,sizeof(I2CModel_Registers));
+    memset(I2CModel_DMA1Streams,0,sizeof(I2CModel_DMA1Streams));
+    memset(dmabase,0,sizeof(dmabase));
+    memset(dmalast,0,sizeof(dmalast));
+    I2CModel_DMABytes         = 0;
+    I2CModel_CacheCleans      = 0;
+    I2CModel_CacheInvalidates = 0;
+    memset(units,0,sizeof(units));
+    ndevices            = 0;
+    arbitrationlosses   = 0;
+    buserrorat          = -1;
+    lastaddress         = -1;
+    I2CModel_Trace[0]   = 0;
+    I2CModel_Interrupts = 0;
+    I2CModel_Segments   = 0;
+}
+
+/**
+ * @brief   I2CModel_AddDevice
+ */
+void
+I2CModel_AddDevice(I2CModel_Device *d) {
+
+    if( ndevices < MAXDEVICES )
+        devices[ndevices++] = d;
+}
+
+/**
+ * @brief   I2CModel_LoseArbitration
+ *
+ * @note    The next n STARTs lose the arbitration
+ */
+void
+I2CModel_LoseArbitration(int n) {
+
+    arbitrationlosses = n;
+}
+
+/**
+ * @brief   I2CModel_BusErrorAt
+ *
+ * @note    A bus error happens after n more bytes (-1: never)
+ */
+void
+I2CModel_BusErrorAt(int n) {
+
+    buserrorat = n;
+}
+
+static I2CModel_Device *finddevice(uint32_t sadd, int tenbit) {
+int i;
+
+    for(i=0;i<ndevices;i++) {
+        if( tenbit && devices[i]->tenbit && devices[i]->address == (sadd&0x3FF) )
+            return devices[i];
+        if( !tenbit && !devices[i]->tenbit && devices[i]->address == ((sadd>>1)&0x7F) )
+            return devices[i];
+    }
+    return 0;
+}
+
+static void stop(Unit *u) {
+
+    trace("P",0);
+    u->flags |= I2C_ISR_STOPF;
+    u->state  = IDLE;
+}
+
+static void startphase(I2C_TypeDef *i2c, Unit *u) {
+
+    u->count = 0;
+    if( u->state == WRITING && u->nbytes > 0 ) {
+        u->flags |= I2C_ISR_TXIS;
+        i2c->TXDR = TXEMPTY;
+    }
+}
+
+/**
+ * @brief   End of NBYTES bytes
+ */
+static void endofcount(I2C_TypeDef *i2c, Unit *u) {
+uint32_t cr2 = i2c->CR2;
+
+    if( cr2&I2C_CR2_RELOAD ) {
+        u->flags |= I2C_ISR_TCR;
+        u->state  = WAITTCR;
+        i2c->CR2  = cr2&~I2C_CR2_NBYTES_Msk;
+        I2CModel_Segments++;
+    } else if( cr2&I2C_CR2_AUTOEND ) {
+        stop(u);
+    } else {
+        u->flags |= I2C_ISR_TC;
+        u->state  = WAITTC;
+    }
+}
+
+/**
+ * @brief   Address phase after a START
+ */
+static void start(I2C_TypeDef *i2c, Unit *u) {
+uint32_t cr2 = i2c->CR2;
+uint32_t sadd = cr2&I2C_CR2_SADD_Msk;
+int tenbit = (cr2&I2C_CR2_ADD10) != 0;
+int rd = (cr2&I2C_CR2_RD_WRN) != 0;
+unsigned header;
+
+    i2c->CR2 = cr2&~I2C_CR2_START;
+    trace(u->state == WAITTC ? "Sr" : "S",0);
+    if( arbitrationlosses > 0 ) {
+        arbitrationlosses--;
+        trace("L",0);
+        u->flags |= I2C_ISR_ARLO;
+        u->state  = IDLE;
+        return;
+    }
+
+    u->dev = finddevice(sadd,tenbit);
+    if( tenbit ) {
+        header = 0xF0|((sadd>>7)&0x06);
+        if( rd && (cr2&I2C_CR2_HEAD10R) && lastaddress == (int) sadd ) {
+            trace("A%02X",header|1);
+        } else {
+            trace("A%02X",header);
+            if( u->dev )
+                trace("A%02X",sadd&0xFF);
+            if( rd && u->dev ) {
+                trace("Sr",0);
+                trace("A%02X",header|1);
+            }
+        }
+        lastaddress = rd ? lastaddress : (int) sadd;
+    } else {
+        trace("A%02X",(sadd&0xFE)|rd);
+    }
+
+    if( !u->dev ) {
+        trace("N",0);
+        u->flags |= I2C_ISR_NACKF;
+        stop(u);
+        return;
+    }
+    if( u->state != WAITTC )
+        u->written = 0;
+    u->first  = !rd;
+    u->rd     = rd;
+    u->nbytes = (cr2&I2C_CR2_NBYTES_Msk)>>I2C_CR2_NBYTES_Pos;
+    u->state  = rd ? READING : WRITING;
+    startphase(i2c,u);
+    if( u->nbytes == 0 )
+        endofcount(i2c,u);
+}
+
+/**
+ * @brief   Count a byte for the bus error injection
+ *
+ * @return  1 if the bus error happened
+ */
+static int buserror(Unit *u) {
+
+    if( buserrorat < 0 )
+        return 0;
+    if( buserrorat-- > 0 )
+        return 0;
+    trace("E",0);
+    u->flags |= I2C_ISR_BERR;
+    u->state  = IDLE;
+    return 1;
+}
+
+/**
+ * @brief   Enabled stream whose peripheral address is reg
+ *
+ * @return  pointer to the next byte of the transfer or 0
+ */
+static uint8_t *dmastream(volatile uint32_t *reg, DMA_Stream_TypeDef **sp) {
+DMA_Stream_TypeDef *s;
+int k;
+
+    for(k=0;k<8;k++) {
+        s = &I2CModel_DMA1Streams[k];
+        if( !(s->CR&DMA_SxCR_EN) || s->PAR != (uint32_t) (uintptr_t) reg || s->NDTR == 0 )
+            continue;
+        if( s->M0AR != dmabase[k] || s->NDTR > dmalast[k] ) {
+            dmabase[k]  = s->M0AR;
+            dmatotal[k] = s->NDTR;
+        }
+        dmalast[k] = s->NDTR-1;
+        *sp = s;
+        return (uint8_t *) (uintptr_t) s->M0AR+(dmatotal[k]-s->NDTR);
+    }
+    return 0;
+}
+
+/**
+ * @brief   DMA requests (TXIS and RXNE with TXDMAEN and RXDMAEN)
+ */
+static void dma(I2C_TypeDef *i2c, Unit *u) {
+DMA_Stream_TypeDef *s;
+uint8_t *p;
+
+    if( (u->flags&I2C_ISR_TXIS) && i2c->TXDR == TXEMPTY && (i2c->CR1&I2C_CR1_TXDMAEN) ) {
+        p = dmastream(&i2c->TXDR,&s);
+        if( p ) {
+            i2c->TXDR = *p;
+            s->NDTR--;
+            I2CModel_DMABytes++;
+        }
+    }
+    if( (u->flags&I2C_ISR_RXNE) && (i2c->CR1&I2C_CR1_RXDMAEN) ) {
+        p = dmastream(&i2c->RXDR,&s);
+        if( p ) {
+            *p = i2c->RXDR;
+            s->NDTR--;
+            u->flags &= ~I2C_ISR_RXNE;
+            I2CModel_DMABytes++;
+        }
+    }
+}
+
+/**
+ * @brief   I2CModel_Step
+ */
+void
+I2CModel_Step(I2C_TypeDef *i2c) {
+Unit *u = &units[i2c-I2CModel_Registers];
+uint32_t cr2;
+unsigned b;
+
+    u->flags &= ~(i2c->ICR&(I2C_ISR_NACKF|I2C_ISR_STOPF|I2C_ISR_BERR|I2C_ISR_ARLO|I2C_ISR_OVR));
+    i2c->ICR = 0;
+    cr2 = i2c->CR2;
+
+    switch( u->state ) {
+    case IDLE:
+        if( cr2&I2C_CR2_START )
+            start(i2c,u);
+        break;
+    case WAITTC:
+        if( cr2&I2C_CR2_START ) {
+            u->flags &= ~I2C_ISR_TC;
+            start(i2c,u);
+        } else if( cr2&I2C_CR2_STOP ) {
+            u->flags &= ~I2C_ISR_TC;
+            i2c->CR2 = cr2&~I2C_CR2_STOP;
+            stop(u);
+        }
+        break;
+    case WAITTCR:
+        if( cr2&I2C_CR2_NBYTES_Msk ) {
+            u->flags &= ~I2C_ISR_TCR;
+            u->nbytes = (cr2&I2C_CR2_NBYTES_Msk)>>I2C_CR2_NBYTES_Pos;
+            u->state  = u->rd ? READING : WRITING;
+            startphase(i2c,u);
+        }
+        break;
+    case WRITING:
+        if( !(u->flags&I2C_ISR_TXIS) || i2c->TXDR == TXEMPTY )
+            break;
+        b = i2c->TXDR&0xFF;
+        u->flags &= ~I2C_ISR_TXIS;
+        trace("W%02X",b);
+        if( buserror(u) )
+            break;
+        if( u->written++ == u->dev->nackat ) {
+            trace("N",0);
+            u->flags |= I2C_ISR_NACKF;
+            stop(u);
+            break;
+        }
+        if( u->first )
+            u->dev->pointer = b;
+        else
+            u->dev->regs[u->dev->pointer++] = b;
+        u->first = 0;
+        if( ++u->count == u->nbytes ) {
+            endofcount(i2c,u);
+        } else {
+            u->flags |= I2C_ISR_TXIS;
+            i2c->TXDR = TXEMPTY;
+        }
+        break;
+    case READING:
+        if( u->flags&I2C_ISR_RXNE ) {
+            u->flags &= ~I2C_ISR_RXNE;
+            if( u->count < u->nbytes )
+                break;
+        }
+        if( u->count < u->nbytes ) {
+            if( buserror(u) )
+                break;
+            b = u->dev->regs[u->dev->pointer++];
+            trace("R%02X",b);
+            i2c->RXDR = b;
+            u->flags |= I2C_ISR_RXNE;
+            u->count++;
+            break;
+        }
+        endofcount(i2c,u);
+        break;
+    }
+
+    dma(i2c,u);
+    I2CModel_DWT.CYCCNT += 10;
+    i2c->ISR = u->flags|(u->state != IDLE ? I2C_ISR_BUSY : 0)
+                       |(u->flags&I2C_ISR_TXIS ? 0 : I2C_ISR_TXE);
+}
+
+/**
+ * @brief   I2CModel_Run
+ *
+ * @note    Steps the model and calls the interrupt handlers until *status is not
+ *          pending, for at most maxsteps steps
+ *
+ * @return  0 if OK, -1 if maxsteps was reached
+ */
+int
+I2CModel_Run(I2C_TypeDef *i2c, volatile int *status, int pending, unsigned maxsteps) {
+int k = i2c-I2CModel_Registers;
+uint32_t cr1, isr, ev, er;
+unsigned n;
+
+    for(n=0;n<maxsteps && *status == pending;n++) {
+        I2CModel_Step(i2c);
+        cr1 = i2c->CR1;
+        isr = i2c->ISR;
+        ev  = (isr&I2C_ISR_TXIS && cr1&I2C_CR1_TXIE)
+            ||(isr&I2C_ISR_RXNE && cr1&I2C_CR1_RXIE)
+            ||(isr&(I2C_ISR_TC|I2C_ISR_TCR) && cr1&I2C_CR1_TCIE)
+            ||(isr&I2C_ISR_STOPF && cr1&I2C_CR1_STOPIE)
+            ||(isr&I2C_ISR_NACKF && cr1&I2C_CR1_NACKIE);
+        er  = (isr&(I2C_ISR_BERR|I2C_ISR_ARLO|I2C_ISR_OVR)) && cr1&I2C_CR1_ERRIE;
+        if( er ) {
+            I2CModel_Interrupts++;
+            erhandlers[k]();
+        }
+        if( ev ) {
+            I2CModel_Interrupts++;
+            evhandlers[k]();
+        }
+    }
+    return *status == pending ? -1 : 0;
+}
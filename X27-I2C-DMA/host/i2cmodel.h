@@ -0,0 +1,58 @@
+#ifndef I2CMODEL_H
+#define I2CMODEL_H
+/**
+ * @file    i2cmodel.h
+ *
+ * @note    Model of an I2C unit of the STM32F746 in master mode and of the bus, to run
+ *          i2c-master.c on a host
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "stm32f746xx.h"
+
+/**
+ * @brief   Slave on the bus
+ *
+ * @note    It has 256 registers and a register pointer. The first byte written sets
+ *          the pointer, the next ones are written to the registers. Reads return the
+ *          registers. The pointer is incremented after each access.
+ */
+typedef struct {
+    uint16_t    address;            ///< 7 or 10 bits
+    int         tenbit;             ///< Nonzero when address has 10 bits
+    uint8_t     regs[256];
+    uint8_t     pointer;
+    int         nackat;             ///< Written byte (0 = first) not acknowledged, or -1
+} I2CModel_Device;
+
+void I2CModel_Reset(void);
+void I2CModel_AddDevice(I2CModel_Device *d);
+void I2CModel_Step(I2C_TypeDef *i2c);
+int  I2CModel_Run(I2C_TypeDef *i2c, volatile int *status, int pending, unsigned maxsteps);
+void I2CModel_LoseArbitration(int n);
+void I2CModel_BusErrorAt(int n);
+
+/**
+ * @brief   Bus trace
+ *
+ * @note    One token per bus event, separated by spaces: S (start), Sr (repeated
+ *          start), A70 (address byte 0x70, with the R/W bit), W12 (byte written), R34
+ *          (byte read), N (not acknowledged), P (stop), L (arbitration lost), E (bus
+ *          error).
+ */
+extern char I2CModel_Trace[];
+
+/**
+ * @brief   Counters
+ */
+///@{
+extern unsigned I2CModel_Interrupts;    ///< Calls of the event and error handlers
+extern unsigned I2CModel_Segments;      ///< NBYTES reloads (TCR)
+extern unsigned I2CModel_DMABytes;      ///< Bytes moved by the DMA streams
+extern unsigned I2CModel_CacheCleans;
+extern unsigned I2CModel_CacheInvalidates;
+///@}
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file    queuetest.c
+ *
+ * @note    Tests the transaction queue of i2c-master.c with the bus model: order,
+ *          callbacks, error recovery and the choice between DMA and interrupts
+ *
+ * @note    Build (in the project directory) and run:
+ *
+ *              gcc -Wall -no-pie -Ihost -I. -o queuetest host/queuetest.c host/i2cmodel.c \
+ *                  i2c-master.c
+ *              ./queuetest
+ *
+ * @note    -no-pie keeps the static buffers at addresses that fit in the 32-bit DMA
+ *          address registers.
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f746xx.h"
+#include "i2c-master.h"
+#include "i2cmodel.h"
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+#define CHECKTRACE(s) do { if( strcmp(I2CModel_Trace,s) != 0 ) { \
+                        printf("%s:%d: trace\n  got      %s\n  expected %s\n",__FILE__,__LINE__,I2CModel_Trace,s); \
+                        failures++; } I2CModel_Trace[0] = 0; } while(0)
+
+#define MAXSTEPS 100000
+
+static I2CModel_Device touch = { .address = 0x38, .nackat = -1 };
+static I2CModel_Device codec = { .address = 0x1A, .nackat = -1 };
+
+/* Static, so their addresses fit in the 32-bit DMA registers (link with -no-pie) */
+static uint8_t wbig[40];
+static uint8_t rbig[64] __attribute__((aligned(32)));
+
+static I2C_Transaction *order[8];
+static int norder;
+
+static void done(I2C_Transaction *t) {
+
+    if( norder < 8 )
+        order[norder++] = t;
+}
+
+static void settransaction(I2C_Transaction *t, uint16_t addr, uint8_t *w, int nw, uint8_t *r, int nr) {
+
+    memset(t,0,sizeof(*t));
+    t->address   = addr;
+    t->writedata = w;
+    t->nwrite    = nw;
+    t->readdata  = r;
+    t->nread     = nr;
+    t->callback  = done;
+}
+
+static int run(I2C_Transaction *t) {
+
+    CHECK(I2CMaster_Submit(I2C3,t) == 0);
+    CHECK(I2CModel_Run(I2C3,&t->status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    return t->status;
+}
+
+static void reset(void) {
+int i;
+
+    I2CModel_Reset();
+    I2CModel_AddDevice(&touch);
+    I2CModel_AddDevice(&codec);
+    for(i=0;i<256;i++)
+        touch.regs[i] = i^0x5A;
+    touch.nackat = -1;
+    norder = 0;
+    I2CMaster_Init(I2C3,I2C_CONF_MODE_FAST|I2C_CONF_FILTER_NONE,I2C_TIMING_FAST_NONE);
+}
+
+int main(void) {
+I2C_Transaction t, q[3];
+uint8_t w[4] = { 0x10, 0xA1, 0xA2, 0xA3 };
+uint8_t r[8];
+int i;
+
+    /* Write */
+    reset();
+    settransaction(&t,0x38,w,4,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S A70 W10 WA1 WA2 WA3 P");
+    CHECK(touch.regs[0x10] == 0xA1 && touch.regs[0x12] == 0xA3);
+    CHECK(norder == 1 && order[0] == &t);
+
+    /* Write then read with a repeated start */
+    reset();
+    settransaction(&t,0x38,w,1,r,3);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S A70 W10 Sr A71 R4A R4B R48 P");
+    CHECK(r[0] == (0x10^0x5A) && r[2] == (0x12^0x5A));
+
+    /* Read */
+    reset();
+    touch.pointer = 0x20;
+    settransaction(&t,0x38,0,0,r,2);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S A71 R7A R7B P");
+
+    /* Address only */
+    reset();
+    settransaction(&t,0x1A,0,0,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S A34 P");
+
+    /* No slave */
+    reset();
+    settransaction(&t,0x50,w,2,r,2);
+    CHECK(run(&t) == I2C_STATUS_NACK);
+    CHECKTRACE("S AA0 N P");
+
+    /* Data not acknowledged */
+    reset();
+    touch.nackat = 1;
+    settransaction(&t,0x38,w,4,0,0);
+    CHECK(run(&t) == I2C_STATUS_NACK);
+    CHECKTRACE("S A70 W10 WA1 N P");
+
+    /* Queue: the three run in order, started by the interrupts */
+    reset();
+    settransaction(&q[0],0x38,w,2,0,0);
+    settransaction(&q[1],0x50,w,1,0,0);
+    settransaction(&q[2],0x38,w,1,r,1);
+    CHECK(I2CMaster_Submit(I2C3,&q[0]) == 0);
+    CHECK(I2CMaster_Submit(I2C3,&q[1]) == 0);
+    CHECK(I2CMaster_Submit(I2C3,&q[2]) == 0);
+    CHECK(I2CModel_Run(I2C3,&q[2].status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    CHECK(q[0].status == I2C_STATUS_OK && q[1].status == I2C_STATUS_NACK && q[2].status == I2C_STATUS_OK);
+    CHECK(norder == 3 && order[0] == &q[0] && order[1] == &q[1] && order[2] == &q[2]);
+    CHECKTRACE("S A70 W10 WA1 P S AA0 N P S A70 W10 Sr A71 RA1 P");
+
+    /* Arbitration lost twice: restarted */
+    reset();
+    I2CModel_LoseArbitration(2);
+    settransaction(&t,0x38,w,2,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S L S L S A70 W10 WA1 P");
+
+    /* Arbitration lost too many times */
+    reset();
+    I2CModel_LoseArbitration(I2C_MAXRETRIES+1);
+    settransaction(&t,0x38,w,2,0,0);
+    CHECK(run(&t) == I2C_STATUS_ARBLOST);
+
+    /* Bus error: the transaction fails and the next one runs */
+    reset();
+    I2CModel_BusErrorAt(1);
+    settransaction(&q[0],0x38,w,3,0,0);
+    settransaction(&q[1],0x38,w,2,0,0);
+    CHECK(I2CMaster_Submit(I2C3,&q[0]) == 0);
+    CHECK(I2CMaster_Submit(I2C3,&q[1]) == 0);
+    CHECK(I2CModel_Run(I2C3,&q[1].status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    CHECK(q[0].status == I2C_STATUS_BUSERROR && q[1].status == I2C_STATUS_OK);
+    CHECKTRACE("S A70 W10 WA1 E S A70 W10 WA1 P");
+
+    /* Abort ends everything */
+    reset();
+    settransaction(&q[0],0x38,w,3,0,0);
+    settransaction(&q[1],0x38,w,2,0,0);
+    CHECK(I2CMaster_Submit(I2C3,&q[0]) == 0);
+    CHECK(I2CMaster_Submit(I2C3,&q[1]) == 0);
+    I2CMaster_Abort(I2C3);
+    CHECK(q[0].status == I2C_STATUS_ABORTED && q[1].status == I2C_STATUS_ABORTED && norder == 2);
+
+    /* DMA write */
+    reset();
+    for(i=0;i<40;i++)
+        wbig[i] = i+0x40;
+    settransaction(&t,0x38,wbig,40,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(I2CModel_DMABytes == 40 && I2CModel_CacheCleans == 1);
+    CHECK(I2CModel_Interrupts < 4);
+    CHECK(touch.regs[0x40] == 0x41 && touch.regs[0x40+38] == 0x40+39);
+    CHECK((I2C3->CR1&(I2C_CR1_TXDMAEN|I2C_CR1_RXDMAEN)) == 0);
+    I2CModel_Trace[0] = 0;
+
+    /* Short write by interrupts, long read by DMA */
+    reset();
+    settransaction(&t,0x38,w,1,rbig,64);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(I2CModel_DMABytes == 64 && I2CModel_CacheInvalidates == 2);
+    CHECK(rbig[0] == (0x10^0x5A) && rbig[63] == ((0x10+63)^0x5A));
+    I2CModel_Trace[0] = 0;
+
+    /* Read buffer not aligned: interrupts */
+    reset();
+    settransaction(&t,0x38,w,1,rbig+1,31);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(I2CModel_DMABytes == 0 && rbig[1] == (0x10^0x5A));
+    I2CModel_Trace[0] = 0;
+
+    /* NACK in the middle of a DMA write */
+    reset();
+    touch.nackat = 5;
+    settransaction(&q[0],0x38,wbig,40,0,0);
+    settransaction(&q[1],0x38,w,2,0,0);
+    CHECK(I2CMaster_Submit(I2C3,&q[0]) == 0);
+    CHECK(I2CMaster_Submit(I2C3,&q[1]) == 0);
+    CHECK(I2CModel_Run(I2C3,&q[1].status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    CHECK(q[0].status == I2C_STATUS_NACK && q[1].status == I2C_STATUS_OK);
+    touch.nackat = -1;
+    I2CModel_Trace[0] = 0;
+
+    /* Interrupt mode: no DMA */
+    reset();
+    CHECK(I2CMaster_SetMode(I2C3,I2C_MODE_INTERRUPT) == 0);
+    settransaction(&t,0x38,wbig,40,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(I2CModel_DMABytes == 0 && I2CModel_Interrupts >= 40);
+    I2CModel_Trace[0] = 0;
+
+    /* Polling mode: no interrupt sources. Mode cannot change with a transaction queued */
+    reset();
+    CHECK(I2CMaster_SetMode(I2C3,I2C_MODE_POLLING) == 0);
+    CHECK((I2C3->CR1&(I2C_CR1_TXIE|I2C_CR1_RXIE|I2C_CR1_STOPIE|I2C_CR1_ERRIE)) == 0);
+    CHECK(I2CMaster_SetMode(I2C3,I2C_MODE_DMA) == 0);
+    settransaction(&t,0x38,w,2,0,0);
+    CHECK(I2CMaster_Submit(I2C3,&t) == 0);
+    CHECK(I2CMaster_SetMode(I2C3,I2C_MODE_POLLING) == I2C_STATUS_INVALID);
+    CHECK(I2CModel_Run(I2C3,&t.status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    CHECK(I2CMaster_SetMode(I2C3,7) == I2C_STATUS_INVALID);
+    I2CModel_Trace[0] = 0;
+
+    /* Rejected */
+    reset();
+    settransaction(&t,0x38,0,1,0,0);
+    CHECK(I2CMaster_Submit(I2C3,&t) == I2C_STATUS_INVALID);
+    CHECK(I2CMaster_WriteAndRead(I2C3,0x38,w,70000,0,0) == I2C_STATUS_INVALID);
+    CHECK(I2CMaster_WriteAndRead(I2C3,0x38,w,1,w,65536) == I2C_STATUS_INVALID);
+    CHECKTRACE("");
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file    segtest.c
+ *
+ * @note    Tests the transfers longer than 255 bytes (NBYTES reloaded with RELOAD) and
+ *          the 10-bit addressing of i2c-master.c with the bus model
+ *
+ * @note    Build (in the project directory) and run:
+ *
+ *              gcc -Wall -no-pie -Ihost -I. -o segtest host/segtest.c host/i2cmodel.c \
+ *                  i2c-master.c
+ *              ./segtest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f746xx.h"
+#include "i2c-master.h"
+#include "i2cmodel.h"
+
+static int failures = 0;
+
+#define CHECK(c) do { if( !(c) ) { printf("%s:%d: %s failed\n",__FILE__,__LINE__,#c); failures++; } } while(0)
+#define CHECKTRACE(s) do { if( strcmp(I2CModel_Trace,s) != 0 ) { \
+                        printf("%s:%d: trace\n  got      %s\n  expected %s\n",__FILE__,__LINE__,I2CModel_Trace,s); \
+                        failures++; } I2CModel_Trace[0] = 0; } while(0)
+
+#define MAXSTEPS 100000
+
+static I2CModel_Device eeprom = { .address = 0x50,  .nackat = -1 };
+static I2CModel_Device tenbit = { .address = 0x2A5, .tenbit = 1, .nackat = -1 };
+static I2CModel_Device alias  = { .address = 0x52,  .nackat = -1 };    // 0x2A5>>1 on 7 bits
+
+/* Static, so their addresses fit in the 32-bit DMA registers (link with -no-pie) */
+static uint8_t wbuf[1024];
+static uint8_t rbuf[1024] __attribute__((aligned(32)));
+
+static void settransaction(I2C_Transaction *t, uint16_t addr, uint8_t *w, int nw, uint8_t *r, int nr) {
+
+    memset(t,0,sizeof(*t));
+    t->address   = addr;
+    t->writedata = w;
+    t->nwrite    = nw;
+    t->readdata  = r;
+    t->nread     = nr;
+}
+
+static int run(I2C_Transaction *t) {
+
+    CHECK(I2CMaster_Submit(I2C3,t) == 0);
+    CHECK(I2CModel_Run(I2C3,&t->status,I2C_STATUS_PENDING,MAXSTEPS) == 0);
+    return t->status;
+}
+
+static void reset(int mode) {
+int i;
+
+    I2CModel_Reset();
+    I2CModel_AddDevice(&eeprom);
+    I2CModel_AddDevice(&tenbit);
+    I2CModel_AddDevice(&alias);
+    for(i=0;i<256;i++) {
+        eeprom.regs[i] = i^0xA5;
+        tenbit.regs[i] = i^0x3C;
+    }
+    eeprom.pointer = tenbit.pointer = 0;
+    I2CMaster_Init(I2C3,I2C_CONF_MODE_FAST|I2C_CONF_FILTER_NONE,I2C_TIMING_FAST_NONE);
+    I2CMaster_SetMode(I2C3,mode);
+}
+
+/**
+ * @brief   Occurrences of a token in the trace
+ */
+static int count(const char *tok) {
+static char buf[16384];
+char *p;
+int n = 0;
+
+    strcpy(buf,I2CModel_Trace);
+    for(p=strtok(buf," ");p;p=strtok(0," "))
+        n += strcmp(p,tok) == 0;
+    return n;
+}
+
+/**
+ * @brief   Number of bytes written and read in the trace
+ */
+static int bytes(char c) {
+static char buf[16384];
+char *p;
+int n = 0;
+
+    strcpy(buf,I2CModel_Trace);
+    for(p=strtok(buf," ");p;p=strtok(0," "))
+        n += p[0] == c && strlen(p) == 3;
+    return n;
+}
+
+/**
+ * @brief   A long write is one bus transaction, with a reload every 255 bytes
+ */
+static void testlongwrite(int mode, int n) {
+I2C_Transaction t;
+int i;
+
+    reset(mode);
+    for(i=0;i<n;i++)
+        wbuf[i] = i*7;
+    settransaction(&t,0x50,wbuf,n,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(count("S") == 1 && count("Sr") == 0 && count("P") == 1);
+    CHECK(bytes('W') == n);
+    CHECK(I2CModel_Segments == (unsigned) (n-1)/255);
+    // The first byte is the pointer, the others fill the registers, wrapping around
+    CHECK(eeprom.regs[(uint8_t) (wbuf[0]+n-2)] == wbuf[n-1]);
+    I2CModel_Trace[0] = 0;
+}
+
+/**
+ * @brief   A long read after a write of the register address
+ */
+static void testlongread(int mode, int n) {
+I2C_Transaction t;
+uint8_t reg = 0x10;
+int i, ok;
+
+    reset(mode);
+    memset(rbuf,0,sizeof(rbuf));
+    settransaction(&t,0x50,&reg,1,rbuf,n);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(count("S") == 1 && count("Sr") == 1 && count("P") == 1);
+    CHECK(bytes('R') == n);
+    CHECK(I2CModel_Segments == (unsigned) (n-1)/255);
+    for(ok=1,i=0;i<n;i++)
+        ok &= rbuf[i] == (uint8_t) ((0x10+i)^0xA5);
+    CHECK(ok);
+    I2CModel_Trace[0] = 0;
+}
+
+int main(void) {
+I2C_Transaction t;
+uint8_t w[3] = { 0x20, 0x11, 0x22 };
+uint8_t r[4];
+
+    /* Segmentation by interrupts, around the limits */
+    testlongwrite(I2C_MODE_INTERRUPT,255);
+    testlongwrite(I2C_MODE_INTERRUPT,256);
+    testlongwrite(I2C_MODE_INTERRUPT,510);
+    testlongwrite(I2C_MODE_INTERRUPT,511);
+    testlongwrite(I2C_MODE_INTERRUPT,1000);
+    testlongread(I2C_MODE_INTERRUPT,300);
+    testlongread(I2C_MODE_INTERRUPT,766);
+
+    /* By DMA: one stream transfer, NBYTES reloaded by the TCR interrupts */
+    testlongwrite(I2C_MODE_DMA,1000);
+    CHECK(I2CModel_DMABytes == 1000);
+    testlongread(I2C_MODE_DMA,512);
+    CHECK(I2CModel_DMABytes == 512);
+    testlongread(I2C_MODE_DMA,1024);
+    CHECK(I2CModel_Interrupts < 16);
+
+    /* Long read not acknowledged */
+    reset(I2C_MODE_DMA);
+    settransaction(&t,0x51,0,0,rbuf,600);
+    CHECK(run(&t) == I2C_STATUS_NACK);
+    CHECKTRACE("S AA3 N P");
+
+    /* Long write not acknowledged after a reload */
+    reset(I2C_MODE_INTERRUPT);
+    eeprom.nackat = 300;
+    settransaction(&t,0x50,wbuf,400,0,0);
+    CHECK(run(&t) == I2C_STATUS_NACK);
+    CHECK(bytes('W') == 301 && count("N") == 1);
+    eeprom.nackat = -1;
+    I2CModel_Trace[0] = 0;
+
+    /* 10-bit write: header (11110 A9 A8 0) and the low address byte */
+    reset(I2C_MODE_INTERRUPT);
+    settransaction(&t,I2C_ADDRESS_10BIT|0x2A5,w,3,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S AF4 AA5 W20 W11 W22 P");
+    CHECK(tenbit.regs[0x20] == 0x11 && tenbit.regs[0x21] == 0x22);
+    CHECK(alias.regs[0x20] == 0);
+
+    /* 10-bit write then read: only the read header after the repeated start (HEAD10R) */
+    reset(I2C_MODE_INTERRUPT);
+    settransaction(&t,I2C_ADDRESS_10BIT|0x2A5,w,1,r,2);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S AF4 AA5 W20 Sr AF5 R1C R1D P");
+    CHECK(r[0] == (0x20^0x3C) && r[1] == (0x21^0x3C));
+
+    /* 10-bit read alone: the full sequence */
+    reset(I2C_MODE_INTERRUPT);
+    tenbit.pointer = 0x40;
+    settransaction(&t,I2C_ADDRESS_10BIT|0x2A5,0,0,r,1);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S AF4 AA5 Sr AF5 R7C P");
+
+    /* 10-bit slave missing */
+    reset(I2C_MODE_INTERRUPT);
+    settransaction(&t,I2C_ADDRESS_10BIT|0x1A5,w,1,0,0);
+    CHECK(run(&t) == I2C_STATUS_NACK);
+    CHECKTRACE("S AF2 N P");
+
+    /* 10-bit detect */
+    reset(I2C_MODE_INTERRUPT);
+    settransaction(&t,I2C_ADDRESS_10BIT|0x2A5,0,0,0,0);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECKTRACE("S AF4 AA5 P");
+
+    /* 10-bit long read by DMA */
+    reset(I2C_MODE_DMA);
+    settransaction(&t,I2C_ADDRESS_10BIT|0x2A5,w,1,rbuf,320);
+    CHECK(run(&t) == I2C_STATUS_OK);
+    CHECK(count("AF5") == 1 && bytes('R') == 320 && I2CModel_Segments == 1);
+    CHECK(rbuf[319] == (uint8_t) ((0x20+319)^0x3C));
+    I2CModel_Trace[0] = 0;
+
+    if( failures == 0 )
+        printf("OK\n");
+    return failures != 0;
+}
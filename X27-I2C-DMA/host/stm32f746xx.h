@@ -0,0 +1,232 @@
+#ifndef STM32F746XX_H
+#define STM32F746XX_H
+/**
+ * @file    stm32f746xx.h
+ *
+ * @note    Replacement of the CMSIS device header to compile i2c-master.c on a host
+ *
+ * @note    Only the I2C and what it uses are defined. The I2C and DMA1 registers are
+ *          variables of the bus model (i2cmodel.c). RCC and GPIO registers are dummies
+ *          and the core functions (interrupt masking, NVIC) do nothing. The DWT cycle
+ *          counter advances 10 cycles per step of the model.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+
+#define __IO    volatile
+
+typedef enum {
+    I2C1_EV_IRQn        = 31,
+    I2C1_ER_IRQn        = 32,
+    I2C2_EV_IRQn        = 33,
+    I2C2_ER_IRQn        = 34,
+    I2C3_EV_IRQn        = 72,
+    I2C3_ER_IRQn        = 73,
+    I2C4_EV_IRQn        = 95,
+    I2C4_ER_IRQn        = 96
+} IRQn_Type;
+
+/**
+ * @brief   Registers (same layout as the device)
+ */
+typedef struct {
+    __IO uint32_t   CR1;                ///< 0x00 Control 1
+    __IO uint32_t   CR2;                ///< 0x04 Control 2
+    __IO uint32_t   OAR1;               ///< 0x08 Own address 1
+    __IO uint32_t   OAR2;               ///< 0x0C Own address 2
+    __IO uint32_t   TIMINGR;            ///< 0x10 Timing
+    __IO uint32_t   TIMEOUTR;           ///< 0x14 Timeout
+    __IO uint32_t   ISR;                ///< 0x18 Interrupt and status
+    __IO uint32_t   ICR;                ///< 0x1C Interrupt clear
+    __IO uint32_t   PECR;               ///< 0x20 PEC
+    __IO uint32_t   RXDR;               ///< 0x24 Receive data
+    __IO uint32_t   TXDR;               ///< 0x28 Transmit data
+} I2C_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CR;
+    __IO uint32_t   BDCR;
+    __IO uint32_t   AHB1ENR;
+    __IO uint32_t   APB1ENR;
+    __IO uint32_t   APB1RSTR;
+    __IO uint32_t   DCKCFGR2;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t   MODER;
+    __IO uint32_t   OTYPER;
+    __IO uint32_t   OSPEEDR;
+    __IO uint32_t   PUPDR;
+    __IO uint32_t   IDR;
+    __IO uint32_t   ODR;
+    __IO uint32_t   BSRR;
+} GPIO_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CR;                 ///< 0x00 Configuration
+    __IO uint32_t   NDTR;               ///< 0x04 Number of data
+    __IO uint32_t   PAR;                ///< 0x08 Peripheral address
+    __IO uint32_t   M0AR;               ///< 0x0C Memory 0 address
+    __IO uint32_t   M1AR;               ///< 0x10 Memory 1 address
+    __IO uint32_t   FCR;                ///< 0x14 FIFO control
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    __IO uint32_t   LISR;               ///< 0x00 Low interrupt status
+    __IO uint32_t   HISR;               ///< 0x04 High interrupt status
+    __IO uint32_t   LIFCR;              ///< 0x08 Low interrupt flag clear
+    __IO uint32_t   HIFCR;              ///< 0x0C High interrupt flag clear
+} DMA_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CTRL;
+    __IO uint32_t   CYCCNT;
+} DWT_Type;
+
+extern I2C_TypeDef  I2CModel_Registers[4];
+extern DMA_TypeDef  I2CModel_DMA1;
+extern DMA_Stream_TypeDef I2CModel_DMA1Streams[8];
+extern DWT_Type     I2CModel_DWT;
+extern RCC_TypeDef  I2CModel_RCC;
+extern GPIO_TypeDef I2CModel_GPIO[2];
+
+#define I2C1                    (&I2CModel_Registers[0])
+#define I2C2                    (&I2CModel_Registers[1])
+#define I2C3                    (&I2CModel_Registers[2])
+#define I2C4                    (&I2CModel_Registers[3])
+#define RCC                     (&I2CModel_RCC)
+#define DMA1                    (&I2CModel_DMA1)
+#define DMA1_Stream0            (&I2CModel_DMA1Streams[0])
+#define DMA1_Stream1            (&I2CModel_DMA1Streams[1])
+#define DMA1_Stream2            (&I2CModel_DMA1Streams[2])
+#define DMA1_Stream3            (&I2CModel_DMA1Streams[3])
+#define DMA1_Stream4            (&I2CModel_DMA1Streams[4])
+#define DMA1_Stream5            (&I2CModel_DMA1Streams[5])
+#define DMA1_Stream6            (&I2CModel_DMA1Streams[6])
+#define DMA1_Stream7            (&I2CModel_DMA1Streams[7])
+#define DWT                     (&I2CModel_DWT)
+#define GPIOB                   (&I2CModel_GPIO[0])
+#define GPIOH                   (&I2CModel_GPIO[1])
+
+/**
+ * @brief   RCC fields
+ *
+ * @note    The ones of CR and BDCR are used by the inline functions of
+ *          system_stm32f746.h
+ */
+///@{
+#define RCC_CR_HSION                (1UL<<0)
+#define RCC_CR_HSIRDY               (1UL<<1)
+#define RCC_CR_HSEON                (1UL<<16)
+#define RCC_CR_HSERDY               (1UL<<17)
+#define RCC_CR_HSEBYP               (1UL<<18)
+#define RCC_CR_PLLON                (1UL<<24)
+#define RCC_CR_PLLRDY               (1UL<<25)
+#define RCC_CR_PLLI2SON             (1UL<<26)
+#define RCC_CR_PLLI2SRDY            (1UL<<27)
+#define RCC_CR_PLLSAION             (1UL<<28)
+#define RCC_CR_PLLSAIRDY            (1UL<<29)
+#define RCC_BDCR_LSEON              (1UL<<0)
+#define RCC_BDCR_LSERDY             (1UL<<1)
+#define RCC_BDCR_LSEBYP             (1UL<<2)
+#define RCC_AHB1ENR_DMA1EN          (1UL<<21)
+#define RCC_APB1ENR_I2C1EN_Msk      (1UL<<21)
+#define RCC_APB1ENR_I2C2EN_Msk      (1UL<<22)
+#define RCC_APB1ENR_I2C3EN_Msk      (1UL<<23)
+#define RCC_APB1ENR_I2C4EN_Msk      (1UL<<24)
+#define RCC_APB1RSTR_I2C1RST        (1UL<<21)
+#define RCC_APB1RSTR_I2C2RST        (1UL<<22)
+#define RCC_APB1RSTR_I2C3RST        (1UL<<23)
+#define RCC_APB1RSTR_I2C4RST        (1UL<<24)
+#define RCC_DCKCFGR2_I2C1SEL_Pos    (16)
+#define RCC_DCKCFGR2_I2C2SEL_Pos    (18)
+#define RCC_DCKCFGR2_I2C3SEL_Pos    (20)
+#define RCC_DCKCFGR2_I2C4SEL_Pos    (22)
+///@}
+
+/**
+ * @brief   I2C fields
+ */
+///@{
+#define I2C_CR1_PE                  (1UL<<0)
+#define I2C_CR1_TXIE                (1UL<<1)
+#define I2C_CR1_RXIE                (1UL<<2)
+#define I2C_CR1_ADDRIE              (1UL<<3)
+#define I2C_CR1_NACKIE              (1UL<<4)
+#define I2C_CR1_STOPIE              (1UL<<5)
+#define I2C_CR1_TCIE                (1UL<<6)
+#define I2C_CR1_ERRIE               (1UL<<7)
+#define I2C_CR1_DNF_Pos             (8)
+#define I2C_CR1_DNF_Msk             (0xFUL<<I2C_CR1_DNF_Pos)
+#define I2C_CR1_DNF                 I2C_CR1_DNF_Msk
+#define I2C_CR1_ANFOFF              (1UL<<12)
+#define I2C_CR1_TXDMAEN             (1UL<<14)
+#define I2C_CR1_RXDMAEN             (1UL<<15)
+
+#define I2C_CR2_SADD_Pos            (0)
+#define I2C_CR2_SADD_Msk            (0x3FFUL<<I2C_CR2_SADD_Pos)
+#define I2C_CR2_RD_WRN              (1UL<<10)
+#define I2C_CR2_ADD10               (1UL<<11)
+#define I2C_CR2_HEAD10R             (1UL<<12)
+#define I2C_CR2_START               (1UL<<13)
+#define I2C_CR2_START_Msk           I2C_CR2_START
+#define I2C_CR2_STOP                (1UL<<14)
+#define I2C_CR2_NACK                (1UL<<15)
+#define I2C_CR2_NBYTES_Pos          (16)
+#define I2C_CR2_NBYTES_Msk          (0xFFUL<<I2C_CR2_NBYTES_Pos)
+#define I2C_CR2_RELOAD              (1UL<<24)
+#define I2C_CR2_AUTOEND             (1UL<<25)
+
+#define I2C_ISR_TXE                 (1UL<<0)
+#define I2C_ISR_TXIS                (1UL<<1)
+#define I2C_ISR_RXNE                (1UL<<2)
+#define I2C_ISR_NACKF               (1UL<<4)
+#define I2C_ISR_STOPF               (1UL<<5)
+#define I2C_ISR_TC                  (1UL<<6)
+#define I2C_ISR_TCR                 (1UL<<7)
+#define I2C_ISR_BERR                (1UL<<8)
+#define I2C_ISR_ARLO                (1UL<<9)
+#define I2C_ISR_OVR                 (1UL<<10)
+#define I2C_ISR_BUSY                (1UL<<15)
+
+#define I2C_ICR_NACKCF              (1UL<<4)
+#define I2C_ICR_STOPCF              (1UL<<5)
+#define I2C_ICR_BERRCF              (1UL<<8)
+#define I2C_ICR_ARLOCF              (1UL<<9)
+#define I2C_ICR_OVRCF               (1UL<<10)
+///@}
+
+/**
+ * @brief   DMA stream fields
+ */
+///@{
+#define DMA_SxCR_EN                 (1UL<<0)
+#define DMA_SxCR_DIR_0              (1UL<<6)
+#define DMA_SxCR_MINC               (1UL<<10)
+#define DMA_SxCR_PL_1               (1UL<<17)
+#define DMA_SxCR_CHSEL_Pos          (25)
+///@}
+
+/**
+ * @brief   Cache maintenance (counted by the model)
+ */
+///@{
+void SCB_CleanDCache_by_Addr(uint32_t *addr, int32_t size);
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t size);
+///@}
+
+/**
+ * @brief   Core functions
+ */
+///@{
+static inline uint32_t __get_PRIMASK(void)              { return 0; }
+static inline void     __set_PRIMASK(uint32_t p)        { (void) p; }
+static inline void     __disable_irq(void)              { }
+static inline void     NVIC_SetPriority(IRQn_Type n, uint32_t p) { (void) n; (void) p; }
+static inline void     NVIC_ClearPendingIRQ(IRQn_Type n) { (void) n; }
+static inline void     NVIC_EnableIRQ(IRQn_Type n)      { (void) n; }
+///@}
+
+#endif
@@ -10,8 +10,14 @@
  *          * Interrupt
  *          * Direct Memory Access (DMA)
  *
- * @note    For now, one can use Polling or Interrupt, by defining
- *          USE_POLLING or USE_INTERRUPT at the beginning
+ * @note    The mode is chosen for each unit by I2CMaster_SetMode. In DMA mode, long
+ *          transfers use DMA1 streams and short ones use interrupts.
+ *
+ * @note    Transfers are transactions in a queue of each I2C unit (I2CMaster_Submit).
+ *          They are done by a state machine, called by the interrupts or, when
+ *          polling, by I2CMaster_Wait. I2CMaster_Write, I2CMaster_Read and
+ *          I2CMaster_WriteAndRead submit a transaction and wait for it.
+ *
  * @author  Hans
  */
 
@@ -21,15 +27,6 @@
 #include "gpio.h"
 
 
-/**
- * @brief Implementation
- *
- * @note  Uncomment only one
- */
-//#define USE_POLLING
-#define USE_INTERRUPT
-
-
 /**
  *  @brief  Data structure to store information about I2C Configuration
  */
@@ -189,247 +186,683 @@ static I2C_Configuration_t i2c_configuration[] = {
 };
 
 
-#ifdef USE_INTERRUPT
 /**
- * @brief  Interrupt routines and data structures for I2C
+ *  @brief  ConfigurePins
  *
+ *  @note   For now, uses GPIO library
  */
-///@{
+static int I2CMaster_ConfigurePins( I2C_TypeDef *i2c ) {
+I2C_Configuration_t *p;
+
+    // Lookup configuration information on table
+    p = i2c_configuration;
+    while( p->i2c && (i2c!=p->i2c) ) p++;
 
-#define I2C_OPERATION_WRITE             0
-#define I2C_OPERATION_READ              1
-#define I2C_OPERATION_WRITE_READ        2
+    // Not found!!
+    if( ! p->i2c )
+        return -1;
 
-typedef struct {
-    unsigned char *pointer;
-    int           operation;
-    int           count;
-    int           status;
-} I2C_Info;
+    // Pins not configurable
+    if( (p->sclpin.gpio == 0) || (p->sdapin.gpio == 0) )
+        return -2;
+    // Configure pins when possible
+    GPIO_ConfigureSinglePin(&(p->sclpin));
+    GPIO_ConfigureSinglePin(&(p->sdapin));
+    return 0;
+}
 
-static I2C_Info     i2c1_info;  // Info for I2C1
-static I2C_Info     i2c2_info;  // Info for I2C2
-static I2C_Info     i2c3_info;  // Info for I2C3
-static I2C_Info     i2c4_info;  // Info for I2C4
 
 /**
- * @brief Process I2C Error Interrupts
+ *  @brief  I2CMaster_PeripheralClockEnable
  *
- * @param i2c
- * @param i2cinfo
+ *  @note   Using HSI as I2CCLK clock source (=16 MHz)
  */
-void I2C_ProcessErrorInterrupt(I2C_TypeDef *i2c, I2C_Info *i2cinfo) {
+static void
+I2CMaster_PeripheralClockEnable( I2C_TypeDef *i2c ) {
 
-    // TODO
+    // Enable Peripheral Clock
+    if ( i2c == I2C1 ) {
+        RCC->APB1ENR |= RCC_APB1ENR_I2C1EN_Msk;
+    } else if ( i2c == I2C2 ) {
+        RCC->APB1ENR |= RCC_APB1ENR_I2C2EN_Msk;
+    } else if ( i2c == I2C3 ) {
+        RCC->APB1ENR |= RCC_APB1ENR_I2C3EN_Msk;
+    } else if ( i2c == I2C4 ) {
+        RCC->APB1ENR |= RCC_APB1ENR_I2C4EN_Msk;
+    }
 
 }
 
 /**
- * @brief Process I2C Event Interrupt
+ *  @brief  I2CMaster_PeripheralClockEnable
  *
- * @param i2c
- * @param i2cinfo
+ *  @note   Using HSI as I2CCLK clock source (=16 MHz)
  */
-void I2C_ProcessEventInterrupt(I2C_TypeDef *i2c, I2C_Info *i2cinfo) {
+#define I2CLKSRC (2)
 
-    // TODO
+
+static void
+I2CMaster_I2CClockEnable( I2C_TypeDef *i2c ) {
+
+    // Enable I2C clocks
+    if ( i2c == I2C1 ) {
+        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C1SEL_Pos))
+                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C1SEL_Pos);
+    } else if ( i2c == I2C2 ) {
+        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C2SEL_Pos))
+                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C2SEL_Pos);
+    } else if ( i2c == I2C3 ) {
+        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C3SEL_Pos))
+                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C3SEL_Pos);
+    } else if ( i2c == I2C4 ) {
+        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C4SEL_Pos))
+                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C4SEL_Pos);
+    }
 
 }
 
 /**
- * @brief I2C1 Event interrupt
+ *  @brief  I2CMaster_Disable
+ *
+ *  @note   Disable I2C and at the same time, reset it
+ *          See RM 30.4.4
+ *
+ *  @note   When cleared, PE must be kept low for at
+ *          least 3 APB clock cycles. (RM Section 30.7.1)
+ *
+ *  @note   This is ensured by writing the following software sequence:
+ *           - Write PE=0
+ *           - Check PE=0
+ *           - Write PE=0
+ *          (RM Section 30.4.5)
  */
-void I2C1_EV_IRQHandler(void) {
+static void I2CMaster_Disable( I2C_TypeDef *i2c ) {
 
-    I2C_ProcessEventInterrupt(I2C1,&i2c1_info);
+    // Turn off device (Three times, see Note in RM Section 30.7.1 */
+    i2c->CR1 &= ~I2C_CR1_PE;
+    i2c->CR1 &= ~I2C_CR1_PE;
+    i2c->CR1 &= ~I2C_CR1_PE;
 }
 
+
 /**
- * @brief I2C1 Error interrupt
+ *  @brief  I2CMaster_Enable
+ *
+ *  @note   Turn on device. Three times, just in case. See above
  */
-void I2C1_ER_IRQHandler(void) {
+static void I2CMaster_Enable( I2C_TypeDef *i2c ) {
 
-    I2C_ProcessErrorInterrupt(I2C1,&i2c1_info);
+    i2c->CR1 |= I2C_CR1_PE;
+    i2c->CR1 |= I2C_CR1_PE;
+    i2c->CR1 |= I2C_CR1_PE;
 }
 
 /**
- * @brief I2C2 Event interrupt
+ * @brief  Transactions
+ *
+ * @note   Each I2C unit has a queue of transactions (a linked list through the next
+ *         field). The first one is in progress. It is done by a state machine driven
+ *         by the I2C flags: by the interrupts or, in I2C_MODE_POLLING, by
+ *         I2CMaster_Wait calling the same routines.
+ *
+ * @note   A transaction has a write phase, a read phase or both. The write phase of a
+ *         write-then-read ends with TC (AUTOEND=0) and the read starts with a repeated
+ *         start. The last phase uses AUTOEND, so the hardware sends the STOP and the
+ *         transaction ends with STOPF.
+ *
+ * @note   In I2C_MODE_DMA, a phase of I2C_DMATHRESHOLD bytes or more is moved by a DMA
+ *         stream (TXDMAEN or RXDMAEN) and TXIE/RXIE are off, so there is no interrupt
+ *         per byte. Shorter phases, where programming the stream costs more than the
+ *         interrupts it saves, are done by the interrupts.
+ *
+ * @note   Recovery
+ *         * NACK: the hardware sends a STOP. The transaction ends with I2C_STATUS_NACK.
+ *         * Arbitration lost: another master won the bus. The transaction is started
+ *           again (START waits for a free bus) up to I2C_MAXRETRIES times.
+ *         * Bus error (misplaced START/STOP): the unit is reset (PE=0) and the
+ *           transaction ends with I2C_STATUS_BUSERROR.
+ *         * No progress (a slave holding SCL low or a DMA transfer error): I2CMaster_Wait
+ *           times out and calls I2CMaster_Abort, that resets the unit and ends all
+ *           transactions.
  */
-void I2C2_EV_IRQHandler(void) {
+///@{
 
-    I2C_ProcessEventInterrupt(I2C2,&i2c2_info);
-}
+#define I2C_STATE_IDLE                  0
+#define I2C_STATE_WRITING               1
+#define I2C_STATE_READING               2
 
 /**
- * @brief I2C2 Error interrupt
+ * @brief DMA stream used by an I2C unit
+ *
+ * @note  The flags of streams 0-3 are in LISR/LIFCR and those of 4-7 in HISR/HIFCR,
+ *        at bit positions 0, 6, 16 and 22
  */
-void I2C2_ER_IRQHandler(void) {
+typedef struct {
+    DMA_Stream_TypeDef *stream;
+    uint32_t            channel;        // CHSEL
+    volatile uint32_t  *isr;            // LISR or HISR of DMA1
+    volatile uint32_t  *ifcr;           // LIFCR or HIFCR of DMA1
+    unsigned            pos;            // Position of the flags of the stream
+} I2C_DMAStream;
 
-    I2C_ProcessErrorInterrupt(I2C2,&i2c2_info);
-}
+/**
+ * @brief Flags of a stream (shifted by pos)
+ */
+///@{
+#define I2C_DMA_FEIF                    (1U<<0)
+#define I2C_DMA_DMEIF                   (1U<<2)
+#define I2C_DMA_TEIF                    (1U<<3)
+#define I2C_DMA_HTIF                    (1U<<4)
+#define I2C_DMA_TCIF                    (1U<<5)
+#define I2C_DMA_ALLFLAGS                (I2C_DMA_FEIF|I2C_DMA_DMEIF|I2C_DMA_TEIF\
+                                        |I2C_DMA_HTIF|I2C_DMA_TCIF)
+///@}
 
 /**
- * @brief I2C3 Event interrupt
+ * @brief DMA1 requests of the I2C units (RM0385 Table 26)
+ *
+ * @note  Chosen so the four units can use DMA at the same time
+ *
+ * | Unit  |  RX              |  TX              |
+ * |-------|------------------|------------------|
+ * | I2C1  | Stream 0, Ch 1   | Stream 6, Ch 1   |
+ * | I2C2  | Stream 3, Ch 7   | Stream 7, Ch 7   |
+ * | I2C3  | Stream 1, Ch 1   | Stream 4, Ch 3   |
+ * | I2C4  | Stream 2, Ch 2   | Stream 5, Ch 2   |
  */
-void I2C3_EV_IRQHandler(void) {
+///@{
+static const I2C_DMAStream i2c1_rxdma = { DMA1_Stream0, 1, &DMA1->LISR, &DMA1->LIFCR,  0 };
+static const I2C_DMAStream i2c1_txdma = { DMA1_Stream6, 1, &DMA1->HISR, &DMA1->HIFCR, 16 };
+static const I2C_DMAStream i2c2_rxdma = { DMA1_Stream3, 7, &DMA1->LISR, &DMA1->LIFCR, 22 };
+static const I2C_DMAStream i2c2_txdma = { DMA1_Stream7, 7, &DMA1->HISR, &DMA1->HIFCR, 22 };
+static const I2C_DMAStream i2c3_rxdma = { DMA1_Stream1, 1, &DMA1->LISR, &DMA1->LIFCR,  6 };
+static const I2C_DMAStream i2c3_txdma = { DMA1_Stream4, 3, &DMA1->HISR, &DMA1->HIFCR,  0 };
+static const I2C_DMAStream i2c4_rxdma = { DMA1_Stream2, 2, &DMA1->LISR, &DMA1->LIFCR, 16 };
+static const I2C_DMAStream i2c4_txdma = { DMA1_Stream5, 2, &DMA1->HISR, &DMA1->HIFCR,  6 };
+///@}
 
-    I2C_ProcessEventInterrupt(I2C3,&i2c3_info);
+/**
+ * @brief DTCM RAM
+ *
+ * @note  It is not cached, so buffers there need no cache maintenance
+ */
+///@{
+#define I2C_DTCM_START                  (0x20000000U)
+#define I2C_DTCM_END                    (0x20010000U)
+///@}
+
+/**
+ * @brief D-Cache line size
+ */
+#define I2C_CACHELINE                   (32)
+
+/**
+ * @brief Maximal value of NBYTES
+ */
+#define I2C_MAXNBYTES                   (255)
+
+/**
+ * @brief State of an I2C unit
+ *
+ * @note  The fields changed by the interrupts and read by I2CMaster_Wait or
+ *        I2CMaster_Abort are volatile
+ */
+typedef struct {
+    I2C_Transaction * volatile head;    // Transaction in progress (first of the queue)
+    I2C_Transaction * volatile tail;    // Last transaction of the queue
+    volatile int        state;          // I2C_STATE_*
+    unsigned            count;          // Bytes done in the current phase
+    unsigned            left;           // Bytes of the phase not yet in NBYTES
+    uint32_t            autoend;        // AUTOEND of the last segment of the phase
+    volatile unsigned   events;         // Progress, for the timeout of I2CMaster_Wait
+    int                 error;          // Error detected in the current transaction
+    int                 retries;        // Restarts after arbitration losses
+    int                 ready;          // Set by I2CMaster_Init
+    int                 mode;           // I2C_MODE_*
+    const I2C_DMAStream *dma;           // Stream used by the current phase or 0
+    const I2C_DMAStream *rxdma;
+    const I2C_DMAStream *txdma;
+    uint32_t            cycles;         // CPU cycles used (I2CMaster_GetCycles)
+} I2C_Info;
+
+static I2C_Info     i2c1_info = { .rxdma = &i2c1_rxdma, .txdma = &i2c1_txdma };
+static I2C_Info     i2c2_info = { .rxdma = &i2c2_rxdma, .txdma = &i2c2_txdma };
+static I2C_Info     i2c3_info = { .rxdma = &i2c3_rxdma, .txdma = &i2c3_txdma };
+static I2C_Info     i2c4_info = { .rxdma = &i2c4_rxdma, .txdma = &i2c4_txdma };
+
+/**
+ * @brief Find the info of an I2C unit
+ */
+static I2C_Info *GetInfo( I2C_TypeDef *i2c ) {
+
+    if( i2c == I2C1 )
+        return &i2c1_info;
+    if( i2c == I2C2 )
+        return &i2c2_info;
+    if( i2c == I2C3 )
+        return &i2c3_info;
+    if( i2c == I2C4 )
+        return &i2c4_info;
+    return 0;
 }
 
 /**
- * @brief I2C3 Error interrupt
+ * @brief Address fields of CR2 for a phase of transaction t
+ *
+ * @note  A 7-bit address goes into SADD[7:1]. A 10-bit one (I2C_ADDRESS_10BIT) fills
+ *        SADD and sets ADD10.
+ *
+ * @note  The read of a 10-bit write-then-read uses HEAD10R: after the repeated start
+ *        only the header (11110XX1) is sent, since the slave was addressed by the
+ *        write. A read alone sends the full sequence (header and address as a write,
+ *        repeated start and header as a read).
  */
-void I2C3_ER_IRQHandler(void) {
+static uint32_t I2C_CR2Address( I2C_Transaction *t, int rd ) {
+
+    if( !(t->address&I2C_ADDRESS_10BIT) )
+        return ((t->address<<1)&I2C_CR2_SADD_Msk)|(rd ? I2C_CR2_RD_WRN : 0);
+    return  (t->address&I2C_CR2_SADD_Msk)
+           |I2C_CR2_ADD10
+           |(rd ? I2C_CR2_RD_WRN : 0)
+           |(rd && t->nwrite ? I2C_CR2_HEAD10R : 0);
+}
+
+/**
+ * @brief Next segment of the phase (NBYTES, RELOAD and AUTOEND fields of CR2)
+ *
+ * @note  NBYTES has 8 bits. A longer phase is done in segments of 255 bytes with
+ *        RELOAD set, so it is a single bus transaction: at the end of each segment,
+ *        the unit stretches SCL and sets TCR until NBYTES is written again. The last
+ *        segment has RELOAD clear and the AUTOEND of the phase.
+ */
+static uint32_t I2C_NextSegment( I2C_Info *info ) {
+unsigned n = info->left > I2C_MAXNBYTES ? I2C_MAXNBYTES : info->left;
 
-    I2C_ProcessErrorInterrupt(I2C3,&i2c3_info);
+    info->left -= n;
+    return (n<<I2C_CR2_NBYTES_Pos)|(info->left ? I2C_CR2_RELOAD : info->autoend);
 }
 
 /**
- * @brief I2C4 Event interrupt
+ * @brief Check if a buffer is (partly) outside the DTCM
  */
-void I2C4_EV_IRQHandler(void) {
+static int I2C_IsCached( uint8_t *data, unsigned n ) {
+uintptr_t a = (uintptr_t) data;
 
-    I2C_ProcessEventInterrupt(I2C4,&i2c4_info);
+    return a < I2C_DTCM_START || a+n > I2C_DTCM_END;
 }
 
 /**
- * @brief I2C1 Error interrupt
+ * @brief Check if a buffer can be used by the DMA
+ *
+ * @note  The DMA does not see the D-Cache. Before a write, the buffer is cleaned
+ *        (written to memory). A read buffer is invalidated before and after the
+ *        transfer, which discards other data in the same cache lines, so it must be
+ *        in the DTCM or take whole cache lines.
  */
-void I2C4_ER_IRQHandler(void) {
+static int I2C_DMABufferOK( uint8_t *data, unsigned n, int rd ) {
 
-    I2C_ProcessErrorInterrupt(I2C4,&i2c4_info);
+    if( !rd || !I2C_IsCached(data,n) )
+        return 1;
+    return (((uintptr_t) data|n)&(I2C_CACHELINE-1)) == 0;
 }
-///@}
 
-#endif // USE_INTERRUPT
+/**
+ * @brief Program the DMA stream for a phase of n bytes
+ */
+static void I2C_DMAStart( I2C_TypeDef *i2c, const I2C_DMAStream *d,
+                          uint8_t *data, unsigned n, int rd ) {
+DMA_Stream_TypeDef *s = d->stream;
+int cached = I2C_IsCached(data,n);
+
+    s->CR &= ~DMA_SxCR_EN;
+    while( s->CR&DMA_SxCR_EN ) {}
+    *d->ifcr = I2C_DMA_ALLFLAGS<<d->pos;
+
+    if( rd ) {
+        if( cached )
+            SCB_InvalidateDCache_by_Addr((void *) data,n);
+        s->PAR = (uint32_t) (uintptr_t) &i2c->RXDR;
+    } else {
+        if( cached )
+            SCB_CleanDCache_by_Addr((uint32_t *) data,n);
+        s->PAR = (uint32_t) (uintptr_t) &i2c->TXDR;
+    }
+    s->M0AR = (uint32_t) (uintptr_t) data;
+    s->NDTR = n;
+    s->FCR  = 0;                                    // Direct mode
+    s->CR   = (d->channel<<DMA_SxCR_CHSEL_Pos)
+             |DMA_SxCR_PL_1                         // High priority
+             |DMA_SxCR_MINC
+             |(rd ? 0 : DMA_SxCR_DIR_0);            // Peripheral to memory or memory to peripheral
+    s->CR  |= DMA_SxCR_EN;
+}
 
 /**
- *  @brief  ConfigurePins
+ * @brief Stop the DMA stream of the current phase (if any)
  *
- *  @note   For now, uses GPIO library
+ * @note  A read buffer is invalidated again, because the cache could have loaded
+ *        the lines while the DMA was writing them.
+ *
+ * @return nonzero if the stream had a transfer error or did not move all bytes of
+ *         a phase that ended normally
  */
-static int I2CMaster_ConfigurePins( I2C_TypeDef *i2c ) {
-I2C_Configuration_t *p;
+static int I2C_DMAStop( I2C_TypeDef *i2c, I2C_Info *info, int complete ) {
+const I2C_DMAStream *d = info->dma;
+I2C_Transaction *t = info->head;
+DMA_Stream_TypeDef *s;
+int error;
+
+    if( !d )
+        return 0;
+    s = d->stream;
+    s->CR &= ~DMA_SxCR_EN;
+    while( s->CR&DMA_SxCR_EN ) {}
+    error = ((*d->isr>>d->pos)&I2C_DMA_TEIF) != 0 || (complete && s->NDTR != 0);
+    *d->ifcr = I2C_DMA_ALLFLAGS<<d->pos;
+    i2c->CR1 &= ~(I2C_CR1_TXDMAEN|I2C_CR1_RXDMAEN);
+
+    if( d == info->rxdma && I2C_IsCached(t->readdata,t->nread) )
+        SCB_InvalidateDCache_by_Addr((void *) t->readdata,t->nread);
+    info->dma = 0;
+    return error;
+}
 
-    // Lookup configuration information on table
-    p = i2c_configuration;
-    while( p->i2c && (i2c!=p->i2c) ) p++;
+/**
+ * @brief Start a phase of n bytes (a write or a read) with a START
+ *
+ * @note  Chooses between DMA and interrupts (or polling) and writes CR2. autoend is
+ *        I2C_CR2_AUTOEND for the last phase of the transaction.
+ */
+static void I2C_StartPhase( I2C_TypeDef *i2c, I2C_Info *info,
+                            uint8_t *data, unsigned n, int rd, uint32_t autoend ) {
+
+    info->count   = 0;
+    info->left    = n;
+    info->autoend = autoend;
+    info->state = rd ? I2C_STATE_READING : I2C_STATE_WRITING;
+    if( info->mode == I2C_MODE_DMA && n >= I2C_DMATHRESHOLD
+     && I2C_DMABufferOK(data,n,rd) ) {
+        info->dma = rd ? info->rxdma : info->txdma;
+        I2C_DMAStart(i2c,info->dma,data,n,rd);
+        i2c->CR1 = (i2c->CR1&~(I2C_CR1_TXIE|I2C_CR1_RXIE))
+                  |(rd ? I2C_CR1_RXDMAEN : I2C_CR1_TXDMAEN);
+    } else if( info->mode != I2C_MODE_POLLING ) {
+        i2c->CR1 |= I2C_CR1_TXIE|I2C_CR1_RXIE;
+    }
+    if( !rd )
+        i2c->ISR = I2C_ISR_TXE;                     // Flush TXDR
+    i2c->CR2 = I2C_CR2Address(info->head,rd)|I2C_NextSegment(info)|I2C_CR2_START;
+}
 
-    // Not found!!
-    if( ! p->i2c )
-        return -1;
+/**
+ * @brief Start the first transaction of the queue (again after an arbitration loss)
+ */
+static void I2C_StartTransaction( I2C_TypeDef *i2c, I2C_Info *info ) {
+I2C_Transaction *t = info->head;
+
+    I2C_DMAStop(i2c,info,0);
+    info->error = I2C_STATUS_OK;
+    if( t->nwrite > 0 || t->nread == 0 ) {
+        I2C_StartPhase(i2c,info,t->writedata,t->nwrite,0,t->nread ? 0 : I2C_CR2_AUTOEND);
+    } else {
+        I2C_StartPhase(i2c,info,t->readdata,t->nread,1,I2C_CR2_AUTOEND);
+    }
+}
 
-    // Pins not configurable
-    if( (p->sclpin.gpio == 0) || (p->sdapin.gpio == 0) )
-        return -2;
-    // Configure pins when possible
-    GPIO_ConfigureSinglePin(&(p->sclpin));
-    GPIO_ConfigureSinglePin(&(p->sdapin));
+/**
+ * @brief End the first transaction of the queue and start the next one
+ *
+ * @note  The callback is called after the next transaction is started. It can submit
+ *        more transactions.
+ */
+static void I2C_EndTransaction( I2C_TypeDef *i2c, I2C_Info *info, int status ) {
+I2C_Transaction *t = info->head;
+
+    if( I2C_DMAStop(i2c,info,status == I2C_STATUS_OK) && status == I2C_STATUS_OK )
+        status = I2C_STATUS_DMAERROR;
+    info->head  = t->next;
+    if( !info->head )
+        info->tail = 0;
+    info->state = I2C_STATE_IDLE;
+    if( info->head ) {
+        info->retries = 0;
+        I2C_StartTransaction(i2c,info);
+    }
+    t->status = status;
+    if( t->callback )
+        t->callback(t);
 }
 
+/**
+ * @brief Reset the state machine of the unit (PE=0, PE=1)
+ *
+ * @note  The configuration registers are kept. The flags are cleared and the SCL and
+ *        SDA lines are released.
+ */
+static void I2C_ResetUnit( I2C_TypeDef *i2c ) {
+
+    I2CMaster_Disable(i2c);
+    I2CMaster_Enable(i2c);
+}
 
 /**
- *  @brief  I2CMaster_PeripheralClockEnable
+ * @brief Process I2C Error Interrupts
  *
- *  @note   Using HSI as I2CCLK clock source (=16 MHz)
+ * @param i2c
+ * @param i2cinfo
  */
-static void
-I2CMaster_PeripheralClockEnable( I2C_TypeDef *i2c ) {
+void I2C_ProcessErrorInterrupt(I2C_TypeDef *i2c, I2C_Info *i2cinfo) {
+uint32_t isr = i2c->ISR;
+
+    // Clear the flags read (OVR only happens in slave mode)
+    i2c->ICR =  (isr&I2C_ISR_ARLO ? I2C_ICR_ARLOCF : 0)
+               |(isr&I2C_ISR_BERR ? I2C_ICR_BERRCF : 0)
+               |(isr&I2C_ISR_OVR  ? I2C_ICR_OVRCF  : 0);
+
+    if( isr&I2C_ISR_ARLO ) {
+        if( i2cinfo->head ) {
+            if( i2cinfo->retries < I2C_MAXRETRIES ) {
+                i2cinfo->retries++;
+                I2C_StartTransaction(i2c,i2cinfo);
+            } else {
+                I2C_EndTransaction(i2c,i2cinfo,I2C_STATUS_ARBLOST);
+            }
+        }
+    }
+    if( isr&I2C_ISR_BERR ) {
+        I2C_ResetUnit(i2c);
+        if( i2cinfo->head )
+            I2C_EndTransaction(i2c,i2cinfo,I2C_STATUS_BUSERROR);
+    }
+}
 
-    // Enable Peripheral Clock
-    if ( i2c == I2C1 ) {
-        RCC->APB1ENR |= RCC_APB1ENR_I2C1EN_Msk;
-    } else if ( i2c == I2C2 ) {
-        RCC->APB1ENR |= RCC_APB1ENR_I2C2EN_Msk;
-    } else if ( i2c == I2C3 ) {
-        RCC->APB1ENR |= RCC_APB1ENR_I2C3EN_Msk;
-    } else if ( i2c == I2C4 ) {
-        RCC->APB1ENR |= RCC_APB1ENR_I2C4EN_Msk;
+/**
+ * @brief Process I2C Event Interrupt
+ *
+ * @note  TXIS: next byte to write. RXNE: byte read. TCR: end of a segment of a long
+ *        phase. TC: end of the write phase of a write-then-read. NACKF: the slave did
+ *        not acknowledge (a STOP follows). STOPF: end of the transaction.
+ *
+ * @note  TXIS and RXNE are left to the DMA when it is used in the phase.
+ *
+ * @param i2c
+ * @param i2cinfo
+ */
+void I2C_ProcessEventInterrupt(I2C_TypeDef *i2c, I2C_Info *i2cinfo) {
+I2C_Transaction *t = i2cinfo->head;
+uint32_t isr = i2c->ISR;
+uint8_t data;
+
+    // Clear the flags read
+    i2c->ICR =  (isr&I2C_ISR_NACKF ? I2C_ICR_NACKCF : 0)
+               |(isr&I2C_ISR_STOPF ? I2C_ICR_STOPCF : 0);
+
+    if( !t || i2cinfo->state == I2C_STATE_IDLE ) {
+        // Nothing in progress
+        return;
     }
+    if( isr&(I2C_ISR_TXIS|I2C_ISR_RXNE|I2C_ISR_TC|I2C_ISR_TCR|I2C_ISR_NACKF|I2C_ISR_STOPF) )
+        i2cinfo->events++;
 
+    if( isr&I2C_ISR_NACKF ) {
+        i2cinfo->error = I2C_STATUS_NACK;
+    }
+    if( !i2cinfo->dma ) {
+        if( (isr&I2C_ISR_TXIS) && i2cinfo->state == I2C_STATE_WRITING
+         && i2cinfo->count < t->nwrite ) {
+            i2c->TXDR = t->writedata[i2cinfo->count++];
+        }
+        if( isr&I2C_ISR_RXNE ) {
+            data = i2c->RXDR;
+            if( i2cinfo->count < t->nread )
+                t->readdata[i2cinfo->count++] = data;
+        }
+    }
+    if( isr&I2C_ISR_TCR ) {
+        // End of a segment. Writing NBYTES releases SCL
+        i2c->CR2 = (i2c->CR2&~(I2C_CR2_NBYTES_Msk|I2C_CR2_RELOAD|I2C_CR2_AUTOEND))
+                  |I2C_NextSegment(i2cinfo);
+    }
+    if( isr&I2C_ISR_TC ) {
+        // Write phase done. Read with a repeated start
+        if( I2C_DMAStop(i2c,i2cinfo,1) )
+            i2cinfo->error = I2C_STATUS_DMAERROR;
+        I2C_StartPhase(i2c,i2cinfo,t->readdata,t->nread,1,I2C_CR2_AUTOEND);
+    }
+    if( isr&I2C_ISR_STOPF ) {
+        I2C_EndTransaction(i2c,i2cinfo,i2cinfo->error);
+    }
 }
 
 /**
- *  @brief  I2CMaster_PeripheralClockEnable
+ * @brief Interrupt handlers of a unit
  *
- *  @note   Using HSI as I2CCLK clock source (=16 MHz)
+ * @note  The cycles spent in them are added to the cycles of the unit. The exception
+ *        entry and exit (about 24 cycles) are not counted.
  */
-#define I2CLKSRC (2)
+///@{
+static void I2C_EventIRQ( I2C_TypeDef *i2c, I2C_Info *info ) {
+uint32_t t0 = DWT->CYCCNT;
 
+    I2C_ProcessEventInterrupt(i2c,info);
+    info->cycles += DWT->CYCCNT-t0;
+}
 
-static void
-I2CMaster_I2CClockEnable( I2C_TypeDef *i2c ) {
+static void I2C_ErrorIRQ( I2C_TypeDef *i2c, I2C_Info *info ) {
+uint32_t t0 = DWT->CYCCNT;
 
-    // Enable I2C clocks
-    if ( i2c == I2C1 ) {
-        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C1SEL_Pos))
-                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C1SEL_Pos);
-    } else if ( i2c == I2C2 ) {
-        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C2SEL_Pos))
-                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C2SEL_Pos);
-    } else if ( i2c == I2C3 ) {
-        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C3SEL_Pos))
-                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C3SEL_Pos);
-    } else if ( i2c == I2C4 ) {
-        RCC->DCKCFGR2 =  (RCC->DCKCFGR2&~(3<<RCC_DCKCFGR2_I2C4SEL_Pos))
-                        |(I2CLKSRC<<RCC_DCKCFGR2_I2C4SEL_Pos);
-    }
+    I2C_ProcessErrorInterrupt(i2c,info);
+    info->cycles += DWT->CYCCNT-t0;
+}
+///@}
 
+/**
+ * @brief I2C1 Event interrupt
+ */
+void I2C1_EV_IRQHandler(void) {
+
+    I2C_EventIRQ(I2C1,&i2c1_info);
 }
 
 /**
- *  @brief  I2CMaster_Reset
- *
- *  @note   Reset I2C using the SWRST pin on the APB1RSTR
- *
- *  @note   There is another way to reset it by using the PE=0, PE=1
- *          sequence as describe in RM 30.4.4: "A software reset can be
- *          performed by clearing the PE bit in the I2C_CR1 register"
+ * @brief I2C1 Error interrupt
+ */
+void I2C1_ER_IRQHandler(void) {
+
+    I2C_ErrorIRQ(I2C1,&i2c1_info);
+}
+
+/**
+ * @brief I2C2 Event interrupt
+ */
+void I2C2_EV_IRQHandler(void) {
+
+    I2C_EventIRQ(I2C2,&i2c2_info);
+}
+
+/**
+ * @brief I2C2 Error interrupt
+ */
+void I2C2_ER_IRQHandler(void) {
+
+    I2C_ErrorIRQ(I2C2,&i2c2_info);
+}
+
+/**
+ * @brief I2C3 Event interrupt
+ */
+void I2C3_EV_IRQHandler(void) {
+
+    I2C_EventIRQ(I2C3,&i2c3_info);
+}
+
+/**
+ * @brief I2C3 Error interrupt
+ */
+void I2C3_ER_IRQHandler(void) {
+
+    I2C_ErrorIRQ(I2C3,&i2c3_info);
+}
+
+/**
+ * @brief I2C4 Event interrupt
+ */
+void I2C4_EV_IRQHandler(void) {
+
+    I2C_EventIRQ(I2C4,&i2c4_info);
+}
+
+/**
+ * @brief I2C4 Error interrupt
+ */
+void I2C4_ER_IRQHandler(void) {
+
+    I2C_ErrorIRQ(I2C4,&i2c4_info);
+}
+
+/**
+ * @brief Enable the event and error interrupts of an I2C unit in the NVIC
  *
+ * @note  The sources are enabled in CR1 by I2C_SetInterrupts
  */
-static void I2CMaster_Reset( I2C_TypeDef *i2c ) {
-uint32_t mask;
+static void I2CMaster_EnableInterrupts( I2C_TypeDef *i2c ) {
+IRQn_Type ev, er;
 
     if ( i2c == I2C1 ) {
-        mask =  RCC_APB1RSTR_I2C1RST;
+        ev = I2C1_EV_IRQn;  er = I2C1_ER_IRQn;
     } else if ( i2c == I2C2 ) {
-        mask =  RCC_APB1RSTR_I2C2RST;
+        ev = I2C2_EV_IRQn;  er = I2C2_ER_IRQn;
     } else if ( i2c == I2C3 ) {
-        mask =  RCC_APB1RSTR_I2C3RST;
+        ev = I2C3_EV_IRQn;  er = I2C3_ER_IRQn;
     } else if ( i2c == I2C4 ) {
-        mask =  RCC_APB1RSTR_I2C4RST;
+        ev = I2C4_EV_IRQn;  er = I2C4_ER_IRQn;
+    } else {
+        return;
     }
-    // Set reset pin
-    RCC->APB1RSTR |=  mask;
-    // Clear reset pin
-    RCC->APB1RSTR &= ~mask;
 
+    NVIC_SetPriority(ev,I2C_INTLEVEL);
+    NVIC_ClearPendingIRQ(ev);
+    NVIC_EnableIRQ(ev);
+    NVIC_SetPriority(er,I2C_INTLEVEL);
+    NVIC_ClearPendingIRQ(er);
+    NVIC_EnableIRQ(er);
 }
 
-
-
 /**
- *  @brief  I2CMaster_Disable
- *
- *  @note   Disable I2C and at the same time, reset it
- *          See RM 30.4.4
+ * @brief Set the interrupt sources in CR1 for a mode
  *
- *  @note   When cleared, PE must be kept low for at
- *          least 3 APB clock cycles. (RM Section 30.7.1)
- *
- *  @note   This is ensured by writing the following software sequence:
- *           - Write PE=0
- *           - Check PE=0
- *           - Write PE=0
- *          (RM Section 30.4.5)
+ * @note  TXIE and RXIE are set by I2C_StartPhase when the phase does not use DMA
  */
-static void I2CMaster_Disable( I2C_TypeDef *i2c ) {
-
-    // Turn off device (Three times, see Note in RM Section 30.7.1 */
-    i2c->CR1 &= ~I2C_CR1_PE;
-    i2c->CR1 &= ~I2C_CR1_PE;
-    i2c->CR1 &= ~I2C_CR1_PE;
+static void I2C_SetInterrupts( I2C_TypeDef *i2c, int mode ) {
+const uint32_t all = I2C_CR1_TXIE|I2C_CR1_RXIE|I2C_CR1_TCIE|I2C_CR1_STOPIE
+                    |I2C_CR1_NACKIE|I2C_CR1_ERRIE;
+
+    if( mode == I2C_MODE_POLLING )
+        i2c->CR1 &= ~all;
+    else
+        i2c->CR1 = (i2c->CR1&~all)|I2C_CR1_TCIE|I2C_CR1_STOPIE|I2C_CR1_NACKIE|I2C_CR1_ERRIE;
 }
+///@}
 
 /**
  *  @brief  I2CMaster_Init
@@ -437,10 +870,12 @@ static void I2CMaster_Disable( I2C_TypeDef *i2c ) {
  *  @note   Initializes I2C and configure it
  *
  *  @note   It only accepts one of the filters: None, Analog or Digital.
+ *
+ *  @note   The unit starts in I2C_DEFAULTMODE (see I2CMaster_SetMode)
  */
 int
 I2CMaster_Init( I2C_TypeDef *i2c, uint32_t conf, uint32_t timing) {
-int index;
+I2C_Info *info;
 
     // In the example in CubeF7, there is a 200 ms delay here
 
@@ -458,12 +893,10 @@ int index;
         // Using no filter
         i2c->CR1 |= I2C_CR1_ANFOFF;                 // Turn off analog filter
         i2c->CR1 = (i2c->CR1&~(I2C_CR1_DNF_Msk));   // Turn off digital filter
-        index = 0;
     } else if( (conf&I2C_CONF_FILTER_ANALOG)!=0 )  {
         // Using analog filter
         i2c->CR1 &= ~I2C_CR1_ANFOFF;                // Turn on analog filter
         i2c->CR1 = (i2c->CR1&~(I2C_CR1_DNF_Msk));   // Turn off digital filter
-        index = 1;
     } else if( (conf&I2C_CONF_FILTER_DIGITAL_MASK)!=0 ) {
         i2c->CR1 |= I2C_CR1_ANFOFF;                 // Turn off analog filter
         // Using digital filter
@@ -480,53 +913,230 @@ int index;
     I2CMaster_I2CClockEnable(i2c);
 
     // Turn on device. Three times, just in case. See above */
-    i2c->CR1 |= I2C_CR1_PE;
-    i2c->CR1 |= I2C_CR1_PE;
-    i2c->CR1 |= I2C_CR1_PE;
+    I2CMaster_Enable(i2c);
+
+    // Clock for the DMA streams
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA1EN;
+
+    // Empty queue
+    info = GetInfo(i2c);
+    if( info ) {
+        info->head  = info->tail = 0;
+        info->state = I2C_STATE_IDLE;
+        info->dma   = 0;
+        info->mode  = I2C_DEFAULTMODE;
+        info->ready = 1;
+    }
+
+    I2CMaster_EnableInterrupts(i2c);
+    I2C_SetInterrupts(i2c,I2C_DEFAULTMODE);
+
+    return 0;
+}
+
+/**
+ * @brief I2CMaster_SetMode
+ *
+ * @note  Selects how the transactions are done: I2C_MODE_POLLING (by I2CMaster_Wait),
+ *        I2C_MODE_INTERRUPT (one interrupt per byte) or I2C_MODE_DMA (long phases by
+ *        DMA, short ones by interrupts). The queue must be empty.
+ *
+ * @return 0 if OK, I2C_STATUS_INVALID if not possible
+ */
+int
+I2CMaster_SetMode( I2C_TypeDef *i2c, int mode ) {
+I2C_Info *info = GetInfo(i2c);
+
+    if( !info || !info->ready || info->head )
+        return I2C_STATUS_INVALID;
+    if( mode != I2C_MODE_POLLING && mode != I2C_MODE_INTERRUPT && mode != I2C_MODE_DMA )
+        return I2C_STATUS_INVALID;
+    info->mode = mode;
+    I2C_SetInterrupts(i2c,mode);
+    return 0;
+}
+
+/**
+ * @brief I2CMaster_GetCycles
+ *
+ * @note  Returns the CPU cycles used by the unit: in I2CMaster_Submit, in the
+ *        interrupts and, in I2C_MODE_POLLING, in I2CMaster_Wait. It is never cleared
+ *        (use unsigned subtraction). The DWT cycle counter must be enabled.
+ */
+uint32_t
+I2CMaster_GetCycles( I2C_TypeDef *i2c ) {
+I2C_Info *info = GetInfo(i2c);
+
+    return info ? info->cycles : 0;
+}
 
+/**
+ * @brief I2CMaster_Submit
+ *
+ * @note  Puts transaction t at the end of the queue of the unit. It is started at once
+ *        when the queue is empty. The caller keeps t (and the data) until the status
+ *        is no longer I2C_STATUS_PENDING. The callback, if any, is called from the
+ *        interrupt (from I2CMaster_Wait in I2C_MODE_POLLING).
+ *
+ * @note  t must have address, nwrite, writedata, nread, readdata, callback and context.
+ *        The other fields are set here. A transaction without data (nwrite and nread
+ *        equal to 0) only sends the address (see I2CMaster_Detect).
+ *
+ * @return 0 if OK, I2C_STATUS_INVALID if t cannot be done
+ */
+int
+I2CMaster_Submit( I2C_TypeDef *i2c, I2C_Transaction *t ) {
+I2C_Info *info = GetInfo(i2c);
+uint32_t primask;
+uint32_t t0 = DWT->CYCCNT;
+
+    if( !info || !info->ready )
+        return I2C_STATUS_INVALID;
+    if( (t->nwrite && !t->writedata) || (t->nread && !t->readdata) )
+        return I2C_STATUS_INVALID;
+
+    t->i2c    = i2c;
+    t->next   = 0;
+    t->status = I2C_STATUS_PENDING;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if( info->tail ) {
+        info->tail->next = t;
+        info->tail = t;
+    } else {
+        info->head = info->tail = t;
+        info->retries = 0;
+        I2C_StartTransaction(i2c,info);
+    }
+    info->cycles += DWT->CYCCNT-t0;
+    __set_PRIMASK(primask);
     return 0;
 }
 
+/**
+ * @brief I2CMaster_Abort
+ *
+ * @note  Resets the unit and ends all transactions in the queue with
+ *        I2C_STATUS_ABORTED (calling their callbacks)
+ */
+void
+I2CMaster_Abort( I2C_TypeDef *i2c ) {
+I2C_Info *info = GetInfo(i2c);
+I2C_Transaction *list, *t;
+uint32_t primask;
+
+    if( !info )
+        return;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    I2C_DMAStop(i2c,info,0);
+    list = info->head;
+    info->head  = info->tail = 0;
+    info->state = I2C_STATE_IDLE;
+    I2C_ResetUnit(i2c);
+    __set_PRIMASK(primask);
+
+    while( list ) {
+        t = list;
+        list = t->next;
+        t->status = I2C_STATUS_ABORTED;
+        if( t->callback )
+            t->callback(t);
+    }
+}
+
+/**
+ * @brief I2CMaster_Wait
+ *
+ * @note  Waits until transaction t ends. In I2C_MODE_POLLING, it runs the state
+ *        machine (and all its time is counted as used by the unit).
+ *        After I2C_TIMEOUT iterations without progress of the unit (an event of the
+ *        state machine), the unit is aborted. So long transfers do not time out.
+ *
+ * @return status of t (0 if OK, negative in case of error)
+ */
+int
+I2CMaster_Wait( I2C_Transaction *t ) {
+uint32_t n = 0;
+I2C_Info *info = GetInfo(t->i2c);
+int polling = info && info->mode == I2C_MODE_POLLING;
+uint32_t t0 = DWT->CYCCNT;
+unsigned events = info ? info->events : 0;
+
+    while( t->status == I2C_STATUS_PENDING ) {
+        if( polling ) {
+            I2C_ProcessEventInterrupt(t->i2c,info);
+            I2C_ProcessErrorInterrupt(t->i2c,info);
+        }
+        if( info && info->events != events ) {
+            events = info->events;
+            n = 0;
+        }
+        if( ++n >= I2C_TIMEOUT ) {
+            I2CMaster_Abort(t->i2c);
+            t->status = I2C_STATUS_TIMEOUT;
+        }
+    }
+    if( polling )
+        info->cycles += DWT->CYCCNT-t0;
+    return t->status;
+}
+
+/**
+ * @brief Blocking transaction
+ */
+static int I2CMaster_Transfer( I2C_TypeDef *i2c, uint16_t addr,
+                               uint8_t *writedata, int nwrite,
+                               uint8_t *readdata, int nread ) {
+I2C_Transaction t;
+int rc;
+
+    t.address   = addr;
+    t.writedata = writedata;
+    t.nwrite    = nwrite;
+    t.readdata  = readdata;
+    t.nread     = nread;
+    t.callback  = 0;
+    t.context   = 0;
+    rc = I2CMaster_Submit(i2c,&t);
+    if( rc < 0 )
+        return rc;
+    return I2CMaster_Wait(&t);
+}
+
+/**
+ * @brief I2CMaster_Detect
+ *
+ * @note  Sends only the address of the slave
+ *
+ * @return 0 if the slave acknowledged, I2C_STATUS_NACK if not, other negative values
+ *         in case of error
+ */
+int
+I2CMaster_Detect( I2C_TypeDef *i2c, uint16_t addr ) {
+
+    return I2CMaster_Transfer(i2c,addr,0,0,0,0);
+}
+
 /**
  * @brief I2CMaster_Write
  *
  * @note  Send the *n* bytes in the *data array* to slave *addr*
  *
- * @param i2c
- * @param address
- * @param data
- * @param n
- * @return int
+ * @note  It waits for the end of the transfer (and for the transactions queued before)
+ *
+ * @param i2c:      I2C peripheral to be used
+ * @param address:  I2C address of slave (7 bits, or 10 bits with I2C_ADDRESS_10BIT)
+ * @param data:     pointer to data to be transmitted
+ * @param n:        Number of bytes to be transmitted
+ * @return int:     0 if OK, else negative number (I2C_STATUS_*)
  */
 int
 I2CMaster_Write( I2C_TypeDef *i2c, uint16_t addr, uint8_t *data, uint16_t nbytes) {
-uint8_t *p = data;
-
-    i2c->CR2 =   (i2c->CR2 & ~(
-                     I2C_CR2_SADD_Msk
-                    |I2C_CR2_NBYTES_Msk
-                    |I2C_CR2_ADD10
-                    |I2C_CR2_RD_WRN
-                    |I2C_CR2_HEAD10R
-                    |I2C_CR2_RELOAD
-                    )
-                 )
-                |((addr<<I2C_CR2_SADD_Pos)&I2C_CR2_START_Msk)
-                |((nbytes<<I2C_CR2_NBYTES_Pos)&I2C_CR2_NBYTES_Msk)
-                |I2C_CR2_AUTOEND;
-#ifdef USE_POLLING
-    i2c->TXDR = *p++;
-    i2c->CR2 |= I2C_CR2_START;
-    while(1) {
-        while( (i2c->ISR&I2C_ISR_TXIS) == 0 ) {}
-        nbytes--;
-        if( nbytes == 0 )
-            break;
-        i2c->TXDR = *p++;
-    }
-    i2c->CR2 |= I2C_CR2_STOP;  // should be set before last byte ?
-#endif
-    return 0;
+
+    return I2CMaster_Transfer(i2c,addr,data,nbytes,0,0);
 }
 
 /**
@@ -534,36 +1144,36 @@ uint8_t *p = data;
  *
  * @note  Read *n* bytes into the *data array* from slave *addr*
  *
- * @param i2c
- * @param address
- * @param data
- * @param n
- * @return int
+ * @note  It waits for the end of the transfer (and for the transactions queued before)
+ *
+ * @param i2c:      I2C peripheral to be used
+ * @param address:  I2C address of slave (7 bits, or 10 bits with I2C_ADDRESS_10BIT)
+ * @param data:     pointer to area to store the data received
+ * @param n:        Number of bytes to be received
+ * @return int:     0 if OK, else negative number (I2C_STATUS_*)
  */
 int
 I2CMaster_Read( I2C_TypeDef *i2c, uint16_t addr, uint8_t *data, uint16_t nbytes) {
-uint8_t *p = data;
-
-    i2c->CR2 =   (i2c->CR2 & ~(
-                     I2C_CR2_SADD_Msk
-                    |I2C_CR2_NBYTES_Msk
-                    |I2C_CR2_ADD10
-                    |I2C_CR2_HEAD10R
-                    |I2C_CR2_RELOAD
-                    )
-                 )
-                |((addr<<I2C_CR2_SADD_Pos)&I2C_CR2_START_Msk)
-                |((nbytes<<I2C_CR2_NBYTES_Pos)&I2C_CR2_NBYTES_Msk)
-                |I2C_CR2_AUTOEND
-                |I2C_CR2_RD_WRN;
-#ifdef USE_POLLING
-    i2c->CR2 |= I2C_CR2_START;
-    while(nbytes--) {
-        while( (i2c->ISR&I2C_ISR_RXNE) == 0 ) {}
-        *p++ = i2c->RXDR;
-        nbytes--;
-    }
-#endif
 
-    return 0;
+    return I2CMaster_Transfer(i2c,addr,0,0,data,nbytes);
+}
+
+/**
+ * @brief I2CMaster_WriteAndRead
+ *
+ * @note  Send *nwrite* bytes and then, after a repeated start, read *nread* bytes
+ *        from slave *addr*. Used to read registers.
+ *
+ * @note  nwrite and nread are at most 65535 (the fields of I2C_Transaction)
+ *
+ * @return int:     0 if OK, else negative number (I2C_STATUS_*)
+ */
+int
+I2CMaster_WriteAndRead( I2C_TypeDef *i2c, uint16_t addr,
+                        uint8_t *writedata, int nwrite,
+                        uint8_t *readdata,  int nread ) {
+
+    if( nwrite < 0 || nread < 0 || nwrite > 65535 || nread > 65535 )
+        return I2C_STATUS_INVALID;
+    return I2CMaster_Transfer(i2c,addr,writedata,nwrite,readdata,nread);
 }
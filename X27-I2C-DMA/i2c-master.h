@@ -14,6 +14,9 @@
  * @author  Hans
  */
 
+#include <stdint.h>
+#include "stm32f746xx.h"
+
 #define I2C_CONF_MODE_NORMAL         (0)
 #define I2C_CONF_MODE_FAST           (1)
 #define I2C_CONF_MODE_FASTPLUS       (2)
@@ -54,6 +57,90 @@
 #define I2C_TIMING_FASTPLUS_DNF_1       0x00200004
 #define I2C_TIMING_FASTPLUS_DNF_2       0x00200003
 
+/**
+ * @brief   Parameters of the interrupt driven implementation
+ *
+ * @note    I2C_TIMEOUT is the number of iterations of I2CMaster_Wait without progress
+ *          before it gives up (about 50 ms at 200 MHz, enough for a segment of 255
+ *          bytes by DMA at 100 KHz)
+ */
+///@{
+#ifndef I2C_INTLEVEL
+#define I2C_INTLEVEL                    (6)
+#endif
+#ifndef I2C_MAXRETRIES
+#define I2C_MAXRETRIES                  (3)
+#endif
+#ifndef I2C_TIMEOUT
+#define I2C_TIMEOUT                     (2000000)
+#endif
+///@}
+
+/**
+ * @brief   Modes (I2CMaster_SetMode)
+ *
+ * @note    In I2C_MODE_DMA, phases (the write or the read of a transaction) with at
+ *          least I2C_DMATHRESHOLD bytes use DMA, the shorter ones use interrupts.
+ *          Read buffers in cached memory (outside the DTCM) must be aligned to 32
+ *          bytes and have a multiple of 32 bytes, otherwise interrupts are used.
+ */
+///@{
+#define I2C_MODE_POLLING                (0)
+#define I2C_MODE_INTERRUPT              (1)
+#define I2C_MODE_DMA                    (2)
+#ifndef I2C_DEFAULTMODE
+#define I2C_DEFAULTMODE                 I2C_MODE_DMA
+#endif
+#ifndef I2C_DMATHRESHOLD
+#define I2C_DMATHRESHOLD                (8)
+#endif
+///@}
+
+/**
+ * @brief   Flag of a 10-bit address
+ *
+ * @note    address = I2C_ADDRESS_10BIT|0x2A5 for the slave 0x2A5 with 10-bit addressing
+ */
+#define I2C_ADDRESS_10BIT               (0x8000)
+
+/**
+ * @brief   Status of a transaction
+ */
+///@{
+#define I2C_STATUS_PENDING              (1)     ///< Queued or in progress
+#define I2C_STATUS_OK                   (0)
+#define I2C_STATUS_NACK                 (-1)    ///< Address or data not acknowledged
+#define I2C_STATUS_BUSERROR             (-2)    ///< Misplaced START or STOP
+#define I2C_STATUS_ARBLOST              (-3)    ///< Arbitration lost I2C_MAXRETRIES+1 times
+#define I2C_STATUS_ABORTED              (-4)    ///< Ended by I2CMaster_Abort
+#define I2C_STATUS_TIMEOUT              (-5)    ///< No end in I2CMaster_Wait
+#define I2C_STATUS_INVALID              (-6)    ///< Rejected by I2CMaster_Submit
+#define I2C_STATUS_DMAERROR             (-7)    ///< DMA transfer error
+///@}
+
+/**
+ * @brief   Transaction
+ *
+ * @note    A write of nwrite bytes, a read of nread bytes or a write followed by a read
+ *          with a repeated start (to read registers). Up to 65535 bytes each, in a
+ *          single bus transaction (NBYTES is reloaded every 255 bytes).
+ *
+ * @note    The callback is called from the interrupt when the transaction ends, with
+ *          the result in status.
+ */
+typedef struct I2C_Transaction {
+    uint16_t                    address;        ///< 7-bit address or I2C_ADDRESS_10BIT|10-bit address
+    uint16_t                    nwrite;         ///< Bytes to write
+    uint16_t                    nread;          ///< Bytes to read (after the write)
+    uint8_t                    *writedata;
+    uint8_t                    *readdata;
+    void                      (*callback)(struct I2C_Transaction *t);
+    void                       *context;        ///< For the callback
+    volatile int                status;         ///< I2C_STATUS_*
+    I2C_TypeDef                *i2c;            ///< Set by I2CMaster_Submit
+    struct I2C_Transaction     *next;           ///< Queue
+} I2C_Transaction;
+
 int I2CMaster_Init(         I2C_TypeDef *i2c,
                             uint32_t conf,
                             uint32_t timing
@@ -77,4 +164,23 @@ int I2CMaster_WriteAndRead( I2C_TypeDef *i2c,
                             uint8_t *readdata,  int nread
                             );
 
+int I2CMaster_Detect(       I2C_TypeDef *i2c,
+                            uint16_t address
+                            );
+
+int  I2CMaster_Submit(      I2C_TypeDef *i2c, I2C_Transaction *t );
+int  I2CMaster_Wait(        I2C_Transaction *t );
+void I2CMaster_Abort(       I2C_TypeDef *i2c );
+int  I2CMaster_SetMode(     I2C_TypeDef *i2c, int mode );
+uint32_t I2CMaster_GetCycles( I2C_TypeDef *i2c );
+
+/**
+ * @brief   I2CMaster_IsDone
+ *
+ * @note    Nonzero when transaction t has ended (it is not needed anymore)
+ */
+static inline int I2CMaster_IsDone( I2C_Transaction *t ) {
+    return t->status != I2C_STATUS_PENDING;
+}
+
 #endif // I2C_MASTER_H
@@ -4,6 +4,16 @@
  * @version  V1.0
  * @date     06/10/2020
  *
+ * @note     It initializes the I2C3 and reads the two peripherals connected:
+ *           Touch controller
+ *           Audio controller
+ *
+ * @note     The CPU cycles used per byte are measured reading a block of
+ *           touch registers in polling, interrupt and DMA modes
+ *
+ * @note     While the LED blinks, the touch registers are read by queued
+ *           transactions, so the bus transfers overlap the delay loop
+ *
  * @note     The blinking frequency depends on core frequency
  * @note     Direct access to registers
  * @note     No library used
@@ -11,9 +21,12 @@
  *
  ******************************************************************************/
 
+#include <stdio.h>
 #include "stm32f746xx.h"
 #include "system_stm32f746.h"
 #include "led.h"
+#include "bench.h"
+#include "i2c-master.h"
 
 
 #define OPERATING_FREQUENCY (200000000)
@@ -39,7 +52,106 @@ void ms_delay(volatile int ms) {
    }
 }
 
+/**
+ * I2C slaves addresses (7-bit)
+ *
+ * From schematics:
+ * Touch address: 01110000 (0x70), which is a 8-bit value but I2C address is 0x038 (7-bit value)
+ * Audio address: 00110100 (0x34), which is a 8-bit value but I2C address is 0x1A (7-bit value)
+ */
+#define TOUCH_ADDR              0x38
+#define AUDIO_ADDR              0x1A
+
+/**
+ * Registers
+ *
+ * FT5336: chip id at 0xA8 (0x51). The touch data (status and 5 points) are the 31
+ * bytes from 0x00.
+ * WM8994: 16-bit register addresses and values. Register 0x0000 has the id (0x8994).
+ */
+#define TOUCH_REG_CHIPID        0xA8
+#define TOUCH_REG_DATA          0x00
+#define TOUCH_DATASIZE          31
+
+/**
+ * @brief   Block of registers read to measure the modes
+ *
+ * @note    Aligned to a cache line and with a multiple of 32 bytes, so it can be
+ *          used by the DMA
+ */
+///@{
+#define BLOCKSIZE               128
+#define BLOCKREADS              20
+static uint8_t          block[BLOCKSIZE] __attribute__((aligned(32)));
+///@}
+
+/**
+ * @brief   Measure the CPU cycles used per byte in a mode
+ *
+ * @note    Each read has 1 byte written (register address) and BLOCKSIZE bytes read.
+ *          The cycles are those counted by the driver (I2CMaster_GetCycles). In
+ *          polling mode, they are the whole transfer.
+ */
+static void measure(const char *name, int mode) {
+uint8_t reg = TOUCH_REG_DATA;
+uint32_t c0, t0, cycles, elapsed;
+unsigned bytes = BLOCKREADS*(1+BLOCKSIZE);
+int i, rc = 0;
+
+    I2CMaster_SetMode(I2C3,mode);
+    c0 = I2CMaster_GetCycles(I2C3);
+    t0 = Bench_GetCycles();
+    for(i=0;i<BLOCKREADS && rc == 0;i++)
+        rc = I2CMaster_WriteAndRead(I2C3,TOUCH_ADDR,&reg,1,block,BLOCKSIZE);
+    elapsed = Bench_GetCycles()-t0;
+    cycles  = I2CMaster_GetCycles(I2C3)-c0;
+    if( rc < 0 ) {
+        printf("%-10s Error (%d)\n",name,rc);
+        return;
+    }
+    printf("%-10s %6u cycles/byte %6u us/read\n",name,
+            (unsigned) (cycles/bytes),
+            (unsigned) Bench_CyclesToMicroseconds(elapsed/BLOCKREADS));
+}
+
+/**
+ * @brief   Reads of the touch data done by the queue
+ */
+///@{
+static uint8_t          touchreg = TOUCH_REG_DATA;
+static uint8_t          touchdata[TOUCH_DATASIZE];
+static I2C_Transaction  touchread;
+static volatile int     touchreads = 0;
+static volatile int     toucherrors = 0;
+///@}
+
+/**
+ * @brief   Called from the I2C interrupt when a touch read ends
+ */
+static void touchdone(I2C_Transaction *t) {
+
+    if( t->status == I2C_STATUS_OK )
+        touchreads++;
+    else
+        toucherrors++;
+}
 
+/**
+ * @brief   Queue a read of the touch data (if the last one ended)
+ */
+static void starttouchread(void) {
+
+    if( touchread.i2c && !I2CMaster_IsDone(&touchread) )
+        return;
+    touchread.address   = TOUCH_ADDR;
+    touchread.writedata = &touchreg;
+    touchread.nwrite    = 1;
+    touchread.readdata  = touchdata;
+    touchread.nread     = TOUCH_DATASIZE;
+    touchread.callback  = touchdone;
+    touchread.context   = 0;
+    I2CMaster_Submit(I2C3,&touchread);
+}
 
 /**
  * @brief   main
@@ -50,27 +162,62 @@ void ms_delay(volatile int ms) {
  */
 
 int main(void) {
+int rc;
+int n = 0;
+uint8_t reg[2];
+uint8_t id[2];
 
-
+    printf("Starting.....\n");
     SystemSetCoreClockFrequency(OPERATING_FREQUENCY);
 
     LED_Init();
 
+    Bench_Init();
+
     SystemConfigPLLSAI(&PLLSAIConfiguration_48MHz);
 
+    /*
+     * Test if the slaves are detected
+     */
+    printf("Initializing I2C3....");
+    rc = I2CMaster_Init(I2C3,I2C_CONF_MODE_FAST|I2C_CONF_FILTER_NONE,I2C_TIMING_FAST_NONE);
+    if( rc < 0 ) {
+        printf("Error (%d)\n",rc);
+    } else {
+        printf("OK\n");
+    }
+
+    reg[0] = TOUCH_REG_CHIPID;
+    rc = I2CMaster_WriteAndRead(I2C3,TOUCH_ADDR,reg,1,id,1);
+    if( rc < 0 ) {
+        printf("Touch Controller: Error (%d)\n",rc);
+    } else {
+        printf("Touch Controller: chip id %02X\n",id[0]);
+    }
+
+    reg[0] = reg[1] = 0;
+    rc = I2CMaster_WriteAndRead(I2C3,AUDIO_ADDR,reg,2,id,2);
+    if( rc < 0 ) {
+        printf("Audio Controller: Error (%d)\n",rc);
+    } else {
+        printf("Audio Controller: id %02X%02X\n",id[0],id[1]);
+    }
+
+    /*
+     * CPU usage of the modes
+     */
+    measure("Polling",I2C_MODE_POLLING);
+    measure("Interrupt",I2C_MODE_INTERRUPT);
+    measure("DMA",I2C_MODE_DMA);
+
     /*
      * Blink LED
      */
     for (;;) {
-#if 1
-       ms_delay(500);
-       LED_Toggle();
-#else
-        ms_delay(500);
-        LED_Set();
-        ms_delay(500);
-        LED_Clear();
+        starttouchread();
         ms_delay(500);
-#endif
+        LED_Toggle();
+        if( ++n%10 == 0 )
+            printf("Touch reads %d (errors %d)\n",touchreads,toucherrors);
     }
 }
@@ -302,6 +302,197 @@ static const GPIO_PinConfiguration interruptpin = {
     .initial =  0,
 } ;
 
+/**
+ * @brief   Reads started by the interrupt pin
+ *
+ * @note    When enabled by FTXXXX_EnableInterruptRead, each falling edge of INT starts
+ *          a read of TD_STATUS and of the registers of all points in one transfer
+ *
+ *              SAAAAAAAW*02h*  SAAAAAAAR*DDDDDDDD*...*DDDDDDDD*P
+ *
+ *          driven by the I2C3 interrupts. No cycle is spent waiting for the bus. When
+ *          the transfer ends, the callback gets the decoded info.
+ *
+ * @note    An edge during a transfer is not lost. It is marked as pending and a new
+ *          read starts as soon as the current one ends (with the timestamp of the
+ *          last edge).
+ *
+ * @note    The I2C3 interrupts have the same priority as the EXTI one, so they do not
+ *          preempt each other and the state needs no locking.
+ *
+ * @note    Once enabled, the transfers own I2C3. The blocking functions below must
+ *          not be used anymore.
+ *
+ * @note    When the FTXXXX_DONT_IMPLEMENT_I2C_IRQ compilation flag is defined, the I2C3
+ *          IRQ Handlers are not implemented here and must call FTXXXX_ProcessI2CInterrupt
+ *          and FTXXXX_ProcessI2CError.
+ */
+///@{
+#define LCD_I2C_EV_IRQ      (72)
+#define LCD_I2C_ER_IRQ      (73)
+
+#define XFER_IDLE           (0)
+#define XFER_WRITE          (1)     // Sending the register address (and data)
+#define XFER_READ           (2)     // Receiving data
+
+#define XFER_READSIZE       (1+6*FTXXXX_MAXPOINTS)  // TD_STATUS and the points
+#define XFER_TIMEOUT        (1000000)               // Loops waiting for the mode write
+
+static FTXXXX_Callback  callback = 0;
+static volatile int     xferstate = XFER_IDLE;
+static volatile int     xfererror;
+static uint8_t          xfertx[2];
+static int              xferntx,xferitx;
+static uint8_t          xferrx[XFER_READSIZE];
+static int              xfernrx,xferirx;
+static uint32_t         xfertime;
+static int              pending = 0;
+static uint32_t         pendingtime;
+
+static const uint32_t   I2C_CR2_SADDR = (I2C_ADDRESS<<1)<<I2C_CR2_SADD_Pos;   // 7-bit in SADD[7:1]
+static const uint32_t   I2C_ICR_ALL   = I2C_ICR_NACKCF|I2C_ICR_STOPCF|I2C_ICR_BERRCF
+                                       |I2C_ICR_ARLOCF|I2C_ICR_OVRCF;
+
+/**
+ * @brief   Starts a transfer
+ *
+ * @note    Writes ntx bytes (register address and data). When nrx > 0, a repeated
+ *          start follows (on TC) and nrx bytes are read.
+ */
+static void StartTransfer(int ntx, int nrx, uint32_t timestamp) {
+I2C_TypeDef *i2c = I2C_INTERFACE;
+
+    xferntx   = ntx;
+    xferitx   = 0;
+    xfernrx   = nrx;
+    xferirx   = 0;
+    xfererror = 0;
+    xfertime  = timestamp;
+    xferstate = XFER_WRITE;
+
+    i2c->ICR = I2C_ICR_ALL;
+    i2c->CR2 = I2C_CR2_SADDR
+              |(ntx<<I2C_CR2_NBYTES_Pos)
+              |(nrx==0?I2C_CR2_AUTOEND:0)
+              |I2C_CR2_START;
+}
+
+/**
+ * @brief   Starts a read of the touch info
+ */
+static void StartRead(uint32_t timestamp) {
+
+    xfertx[0] = FTXXXX_REG_TD_STATUS;
+    StartTransfer(1,XFER_READSIZE,timestamp);
+}
+
+/**
+ * @brief   Ends a transfer, calls the callback and starts a pending read
+ */
+static void EndTransfer(void) {
+FTXXXX_Info info;
+uint8_t *b;
+int i;
+
+    xferstate = XFER_IDLE;
+    if( xfernrx > 0 && callback ) {
+        if( xfererror || xferirx < xfernrx ) {
+            info.npoints = -1;
+        } else {
+            info.npoints = xferrx[0]&0xF;
+            if( info.npoints > FTXXXX_MAXPOINTS )
+                info.npoints = FTXXXX_MAXPOINTS;
+            info.gesture = 0;
+            for(i=0;i<info.npoints;i++) {
+                b = &xferrx[1+6*i];
+                info.points[i].x     = (b[0]&0xF)<<8|b[1];
+                info.points[i].y     = (b[2]&0xF)<<8|b[3];
+                info.points[i].w     = b[4];
+                info.points[i].event = b[0]>>6;
+                info.points[i].id    = b[2]>>4;
+            }
+        }
+        callback(&info,xfertime);
+    }
+    if( pending && callback ) {
+        pending = 0;
+        StartRead(pendingtime);
+    }
+}
+
+/**
+ * @brief   I2C3 event interrupt
+ */
+void FTXXXX_ProcessI2CInterrupt(void) {
+I2C_TypeDef *i2c = I2C_INTERFACE;
+uint32_t isr = i2c->ISR;
+
+    if( isr&I2C_ISR_NACKF ) {
+        // The STOP is sent automatically, so the transfer ends at STOPF
+        i2c->ICR = I2C_ICR_NACKCF;
+        xfererror = 1;
+    }
+    if( (isr&I2C_ISR_TXIS) && xferitx < xferntx ) {
+        i2c->TXDR = xfertx[xferitx++];
+    }
+    if( isr&I2C_ISR_TC ) {
+        // Address sent. Repeated start in read mode. Clears TC
+        xferstate = XFER_READ;
+        i2c->CR2 = I2C_CR2_SADDR
+                  |(xfernrx<<I2C_CR2_NBYTES_Pos)
+                  |I2C_CR2_RD_WRN
+                  |I2C_CR2_AUTOEND
+                  |I2C_CR2_START;
+    }
+    if( isr&I2C_ISR_RXNE ) {
+        uint8_t d = i2c->RXDR;
+        if( xferirx < xfernrx )
+            xferrx[xferirx++] = d;
+    }
+    if( isr&I2C_ISR_STOPF ) {
+        i2c->ICR = I2C_ICR_STOPCF;
+        if( xferstate != XFER_IDLE )
+            EndTransfer();
+    }
+}
+
+/**
+ * @brief   I2C3 error interrupt
+ *
+ * @note    After a bus error or an arbitration loss, the peripheral is reset by
+ *          toggling PE (it releases the lines) and the transfer fails.
+ */
+void FTXXXX_ProcessI2CError(void) {
+I2C_TypeDef *i2c = I2C_INTERFACE;
+
+    i2c->ICR = I2C_ICR_ALL;
+    i2c->CR1 &= ~I2C_CR1_PE;
+    while( (i2c->CR1&I2C_CR1_PE) != 0 ) {}
+    i2c->CR1 |= I2C_CR1_PE;
+    if( xferstate != XFER_IDLE ) {
+        xfererror = 1;
+        EndTransfer();
+    }
+}
+
+#ifndef FTXXXX_DONT_IMPLEMENT_I2C_IRQ
+
+void I2C3_EV_IRQHandler(void) {
+
+    FTXXXX_ProcessI2CInterrupt();
+
+}
+
+void I2C3_ER_IRQHandler(void) {
+
+    FTXXXX_ProcessI2CError();
+
+}
+
+#endif
+///@}
+
+
 /**
  * @brief Interrupt routine for the Touch Controller
  *
@@ -322,6 +513,14 @@ void FTXXXX_ProcessInterrupt(void) {
     if( (EXTI->PR&INTPINMASK)!=0 ) {
         state = 1;
         EXTI->PR = INTPINMASK;
+        if( callback ) {
+            if( xferstate == XFER_IDLE ) {
+                StartRead(DWT->CYCCNT);
+            } else {
+                pending = 1;
+                pendingtime = DWT->CYCCNT;
+            }
+        }
     }
 }
 
@@ -383,7 +582,7 @@ int16_t t = state;
  * @returns 0 if no touch, >0 if a touch is detected
  */
 int
-FTXXX_ReadInterruptPinStatus(void) {
+FTXXXX_ReadInterruptPinStatus(void) {
 uint32_t s;
 
     s = interruptpin.gpio->IDR&INTPINMASK;
@@ -420,6 +619,50 @@ int rc;
 }
 
 
+/**
+ * @brief  FTXXXX_EnableInterruptRead
+ *
+ * @note   Switches the controller to trigger mode (INT pulses for each new report,
+ *         instead of staying low while touched) and enables the I2C3 interrupts. From
+ *         then on, every report is read without blocking and passed to the callback.
+ *
+ * @note   Must be called after FTXXXX_Init.
+ *
+ * @return 0 if OK, -1 if the mode could not be written
+ */
+int
+FTXXXX_EnableInterruptRead(FTXXXX_Callback cb) {
+I2C_TypeDef *i2c = I2C_INTERFACE;
+int timeout;
+
+    // Cycle counter for the timestamps. In the Cortex-M7, the DWT must be unlocked
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR   = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    i2c->CR1 |= I2C_CR1_TXIE|I2C_CR1_RXIE|I2C_CR1_TCIE|I2C_CR1_STOPIE
+               |I2C_CR1_NACKIE|I2C_CR1_ERRIE;
+    NVIC_SetPriority(LCD_I2C_EV_IRQ,LCD_INT_PRIO);
+    NVIC_SetPriority(LCD_I2C_ER_IRQ,LCD_INT_PRIO);
+    NVIC_EnableIRQ(LCD_I2C_EV_IRQ);
+    NVIC_EnableIRQ(LCD_I2C_ER_IRQ);
+
+    // Trigger mode. Edges are ignored while callback is 0
+    xfertx[0] = FTXXXX_REG_MODE;
+    xfertx[1] = FTXXXX_MODE_VAL_TRIGGER;
+    StartTransfer(2,0,0);
+    timeout = XFER_TIMEOUT;
+    while( xferstate != XFER_IDLE && --timeout > 0 ) {}
+    if( xferstate != XFER_IDLE )
+        FTXXXX_ProcessI2CError();
+    if( xfererror )
+        return -1;
+
+    callback = cb;
+    return 0;
+}
+
+
 
 /**
  * @brief  Write data to Touch register
@@ -539,6 +782,8 @@ uint8_t buffer[6];
         touchinfo->points[i].x = (buffer[0]&0xF)<<8|buffer[1];
         touchinfo->points[i].y = (buffer[2]&0xF)<<8|buffer[3];
         touchinfo->points[i].w = buffer[4];
+        touchinfo->points[i].event = buffer[0]>>6;
+        touchinfo->points[i].id = buffer[2]>>4;
     }
 
     return touchinfo->npoints;
@@ -37,9 +37,20 @@ typedef struct {
         uint16_t    x;      // X-pos
         uint16_t    y;      // Y-pos
         uint16_t    w;      // Weight
+        uint8_t     event;  // Event flag (0=Put down, 1=Put up, 2=Contact, 3=None)
+        uint8_t     id;     // Touch ID
     } points[FTXXXX_MAXPOINTS];
 } FTXXXX_Info;
 
+/**
+ * @brief   Callback for the reads started by the interrupt pin
+ *
+ * @note    It is called from the I2C interrupt with the touch info and the value of
+ *          DWT->CYCCNT when the controller asserted INT. When the transfer failed,
+ *          npoints is negative.
+ */
+typedef void (*FTXXXX_Callback)(const FTXXXX_Info *info, uint32_t timestamp);
+
 
 
 int FTXXXX_Init(void);
@@ -51,6 +62,9 @@ int FTXXXX_WriteSequentialRegisters( uint8_t startreg, uint8_t *pdata, int num);
 int FTXXXX_ReadSequentialRegisters( uint8_t startreg, uint8_t *pdata, int num);
 int FTXXXX_ReadTouchInfo( FTXXXX_Info *touchinfo );
 void FTXXXX_ProcessInterrupt(void);
+int  FTXXXX_EnableInterruptRead(FTXXXX_Callback callback);
+void FTXXXX_ProcessI2CInterrupt(void);
+void FTXXXX_ProcessI2CError(void);
 
 /*
  * Registers of the FT5336 controller. From the FT5x16 documentation
@@ -15,6 +15,7 @@
 #include "system_stm32f746.h"
 #include "led.h"
 #include "lcd.h"
+#include "touch.h"
 
 
 
@@ -64,11 +65,21 @@ int main(void) {
 
     LCD_Init();
 
+    Touch_Init();
+
+    Touch_EnableEvents();
+
     /*
-     * Blink LED
+     * Blink LED. With touch events, toggle it when a finger is put down
      */
     for (;;) {
 #if 1
+       Touch_Event e;
+       while( Touch_GetEvent(&e) ) {
+           if( e.event == TOUCH_EVENT_DOWN )
+               LED_Toggle();
+       }
+#elif 0
        ms_delay(500);
        LED_Toggle();
 #else
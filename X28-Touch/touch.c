@@ -16,6 +16,8 @@
  *
  */
 
+#include <stdint.h>
+#include <string.h>
 #include "stm32f746xx.h"
 #include "system_stm32f746.h"
 #include "touch.h"
@@ -81,3 +83,199 @@ int n = 0;
     }
     return n;
 }
+
+
+/**
+ * @brief   Event queue
+ *
+ * @note    Lock-free queue with a single producer (the I2C interrupt, thru the FTXXXX
+ *          callback) and a single consumer (the main loop or LVGL). head is written
+ *          only by the producer and tail only by the consumer. Both count forever and
+ *          are reduced modulo TOUCH_QUEUESIZE to index the array.
+ *
+ * @note    When the queue is full, new events are dropped (and counted).
+ */
+///@{
+static Touch_Event          queue[TOUCH_QUEUESIZE];
+static volatile uint32_t    head = 0;
+static volatile uint32_t    tail = 0;
+static Touch_Stats          stats;
+///@}
+
+/**
+ * @brief   Touch IDs that are down (and their last position), to generate the UP
+ *          events that the controller does not report
+ */
+///@{
+static uint16_t             downmask = 0;
+static uint16_t             lastx[16],lasty[16];
+///@}
+
+/**
+ * @brief   Put an event into the queue (producer)
+ */
+static void PutEvent(uint32_t timestamp, int id, int event, int x, int y, int w) {
+uint32_t h = head;
+Touch_Event *e;
+
+    if( h-tail >= TOUCH_QUEUESIZE ) {
+        stats.overruns++;
+        return;
+    }
+    e = &queue[h&(TOUCH_QUEUESIZE-1)];
+    e->timestamp = timestamp;
+    e->id        = id;
+    e->event     = event;
+    e->x         = x;
+    e->y         = y;
+    e->weight    = w;
+    __DMB();                    // Event written before it is published
+    head = h+1;
+    stats.events++;
+}
+
+/**
+ * @brief   Called by the FTXXXX module (I2C interrupt) for each report
+ *
+ * @note    A touch ID that was down and is missing in the report is put up. This
+ *          happens when the last finger leaves and the controller reports 0 points.
+ *
+ * @note    A point with event flag 3 (no event) is not a contact. It is skipped, so
+ *          its ID is put up too when it was down.
+ */
+static void ProcessReport(const FTXXXX_Info *info, uint32_t timestamp) {
+uint16_t present = 0;
+int i,id,ev;
+
+    if( info->npoints < 0 ) {
+        stats.errors++;
+        return;
+    }
+    stats.reads++;
+
+    for(i=0;i<info->npoints;i++) {
+        id = info->points[i].id&0xF;
+        ev = info->points[i].event;
+        if( ev > TOUCH_EVENT_CONTACT )
+            continue;
+        if( ev == TOUCH_EVENT_UP ) {
+            downmask &= ~(1U<<id);
+        } else {
+            if( (downmask&(1U<<id)) == 0 )
+                ev = TOUCH_EVENT_DOWN;
+            downmask |= 1U<<id;
+            present  |= 1U<<id;
+            lastx[id] = info->points[i].x;
+            lasty[id] = info->points[i].y;
+        }
+        PutEvent(timestamp,id,ev,info->points[i].x,info->points[i].y,info->points[i].w);
+    }
+
+    for(id=0;id<16;id++) {
+        if( (downmask&~present)&(1U<<id) ) {
+            downmask &= ~(1U<<id);
+            PutEvent(timestamp,id,TOUCH_EVENT_UP,lastx[id],lasty[id],0);
+        }
+    }
+}
+
+/**
+ * @brief  Touch_EnableEvents
+ *
+ * @note   From now on, the controller is read only when it asserts INT, without
+ *         blocking, and the points go into the event queue. Touch_ReadInfo must not
+ *         be used anymore.
+ *
+ * @return 0 if OK, negative in case of error
+ */
+int
+Touch_EnableEvents(void) {
+
+    return FTXXXX_EnableInterruptRead(ProcessReport);
+}
+
+/**
+ * @brief  Touch_GetEvent
+ *
+ * @note   Gets the oldest event in the queue (consumer)
+ *
+ * @return 1 if an event was returned, 0 if the queue is empty
+ */
+int
+Touch_GetEvent(Touch_Event *ev) {
+uint32_t t = tail;
+
+    if( t == head )
+        return 0;
+    __DMB();                    // Read the event only after seeing head
+    *ev = queue[t&(TOUCH_QUEUESIZE-1)];
+    __DMB();                    // Event read before the slot is released
+    tail = t+1;
+    return 1;
+}
+
+/**
+ * @brief  Touch_EventsPending
+ *
+ * @return number of events in the queue
+ */
+int
+Touch_EventsPending(void) {
+
+    return head-tail;
+}
+
+/**
+ * @brief  Touch_GetStats
+ *
+ * @note   Copies the statistics collected since the last call and clears them
+ */
+void
+Touch_GetStats(Touch_Stats *s) {
+uint32_t primask;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *s = stats;
+    memset(&stats,0,sizeof(stats));
+    __set_PRIMASK(primask);
+}
+
+#ifdef TOUCH_USE_LVGL
+/**
+ * @brief  Touch_LVGLRead
+ *
+ * @note   read_cb of a LVGL (v8.3) pointer input device. It follows the first
+ *         touch ID put down until it is put up; other fingers are ignored.
+ *
+ * @note   One event is consumed per call. When more are queued, continue_reading
+ *         makes LVGL call again in the same read cycle, so fast taps (a DOWN and an
+ *         UP in the same period) are not merged.
+ */
+void
+Touch_LVGLRead(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+static lv_point_t       point = { 0, 0 };
+static lv_indev_state_t state = LV_INDEV_STATE_RELEASED;
+static int              primary = -1;
+Touch_Event e;
+
+    while( Touch_GetEvent(&e) ) {
+        if( primary < 0 && e.event != TOUCH_EVENT_UP )
+            primary = e.id;
+        if( e.id != primary )
+            continue;
+        point.x = e.x;
+        point.y = e.y;
+        if( e.event == TOUCH_EVENT_UP ) {
+            state   = LV_INDEV_STATE_RELEASED;
+            primary = -1;
+        } else {
+            state   = LV_INDEV_STATE_PRESSED;
+        }
+        data->continue_reading = Touch_EventsPending() > 0;
+        break;
+    }
+    data->point = point;
+    data->state = state;
+}
+#endif
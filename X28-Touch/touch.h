@@ -24,8 +24,57 @@ typedef struct {
     uint16_t misc;
 } Touch_Info;
 
+/**
+ * @brief   Size of the event queue (power of 2)
+ */
+#ifndef TOUCH_QUEUESIZE
+#define TOUCH_QUEUESIZE         32
+#endif
+
+/**
+ * @brief   Event types
+ */
+///@{
+#define TOUCH_EVENT_DOWN        0
+#define TOUCH_EVENT_UP          1
+#define TOUCH_EVENT_CONTACT     2
+///@}
+
+/**
+ * @brief   Touch event
+ *
+ * @note    timestamp is the value of DWT->CYCCNT when the controller asserted INT
+ */
+typedef struct {
+    uint32_t timestamp;
+    uint16_t x;
+    uint16_t y;
+    uint8_t  id;
+    uint8_t  event;
+    uint8_t  weight;
+} Touch_Event;
+
+/**
+ * @brief   Statistics
+ */
+typedef struct {
+    uint32_t reads;             ///< Reports read from the controller
+    uint32_t errors;            ///< Reads that failed
+    uint32_t events;            ///< Events queued
+    uint32_t overruns;          ///< Events lost because the queue was full
+} Touch_Stats;
+
 int Touch_Init(void);
 int Touch_ReadInfo(Touch_Info *touch, int nmax );
 int Touch_Detected(void);
+int Touch_EnableEvents(void);
+int Touch_GetEvent(Touch_Event *ev);
+int Touch_EventsPending(void);
+void Touch_GetStats(Touch_Stats *s);
+
+#ifdef TOUCH_USE_LVGL
+#include "lvgl.h"
+void Touch_LVGLRead(lv_indev_drv_t *drv, lv_indev_data_t *data);
+#endif
 
 #endif // TOUCH_H
@@ -0,0 +1,48 @@
+/**
+ * @file    bench.c
+ *
+ * @note    Time measurement using the DWT cycle counter
+ *
+ * @note    The DWT unit must be enabled in the CoreDebug DEMCR register and, in the
+ *          Cortex-M7, unlocked by writing a key into the LAR register.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "stm32f746xx.h"
+#include "system_stm32f746.h"
+#include "bench.h"
+
+/**
+ * @brief   Key to unlock DWT registers
+ */
+#define DWT_LAR_KEY         (0xC5ACCE55)
+
+/**
+ * @brief   Bench_Init
+ *
+ * @note    Enables and resets the cycle counter
+ */
+void
+Bench_Init(void) {
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR    = DWT_LAR_KEY;
+    DWT->CYCCNT = 0;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief   Bench_CyclesToMicroseconds
+ *
+ * @note    Uses the SystemCoreClock variable
+ */
+uint32_t
+Bench_CyclesToMicroseconds(uint32_t cycles) {
+uint32_t mhz = SystemCoreClock/1000000;
+
+    if( mhz == 0 )
+        return 0;
+    return cycles/mhz;
+}
@@ -0,0 +1,26 @@
+#ifndef BENCH_H
+#define BENCH_H
+/**
+ * @file    bench.h
+ *
+ * @note    Time measurement using the DWT cycle counter
+ *
+ * @author  Hans
+ */
+
+#include "stm32f746xx.h"
+
+void     Bench_Init(void);
+uint32_t Bench_CyclesToMicroseconds(uint32_t cycles);
+
+/**
+ * @brief   Bench_GetCycles
+ *
+ * @note    Returns the cycle counter. It wraps around after 2^32 cycles (21 s at 200 MHz).
+ *          Use unsigned subtraction to compute intervals.
+ */
+static inline uint32_t Bench_GetCycles(void) {
+    return DWT->CYCCNT;
+}
+
+#endif
@@ -126,7 +126,6 @@ Buddy_Init(char *address, long size, long minsize) {
  */
 void *
 Buddy_Alloc(unsigned size) {
-int level;
 int s;
 int k;
 int l;
@@ -199,42 +198,44 @@ static inline int iseven(int n) { return (n&1)^1; }
 
 /**
  *  @brief  buddy_free
+ *
+ *  @note   The block is the node with the used bit set on the path from the leaf of
+ *          addr up, while addr is the start of the node (left children). Only this
+ *          node is marked used by Buddy_Alloc. Then, while the node and its buddy are
+ *          both free and not split, the parent is not split anymore.
  */
 void Buddy_Free(void *addr) {
 uint32_t disp = (char *) addr - (char *)pool->baseaddress;       // 4 GB limit
 int b,d,k,p;
 
+    if( disp%pool->minimalsize )
+        return;
     d = disp/pool->minimalsize;
+    if( d >= pool->mapsize )
+        return;
 
+    // Find block to be freed
     k = pool->mapsize+d-1;
-    // Free if it is not
+    while( !bv_test(pool->used,k) ) {
+        if( k == 0 || iseven(k) )
+            return;                             // not the start of an allocated block
+        k = (k-1)/2;
+    }
     bv_clear(pool->used,k);
     bv_clear(pool->split,k);
-    // Find block to be freed
-    while( k > 0 ) {
-            k /= 2;
-        if( bv_test(pool->used,k) ) {
-            bv_clear(pool->used,k);
-            bv_clear(pool->split,k);
-            break;
-        }
-    }
+
     // Adjust parents
     while( k > 0 ) {
         // find buddy
-
         if( isodd(k) )
             b = k+1;
         else
             b = k-1;
-        if(  (bv_test(pool->used,k)==0)
-           &&(bv_test(pool->used,b)==0)
-           &&(bv_test(pool->split,k)==0)
-           &&(bv_test(pool->split,b))    ) {
-            p = k/2;
-            bv_clear(pool->split,p);
-        }
-        k /= 2;
+        if(  bv_test(pool->used,b) || bv_test(pool->split,b) )
+            break;
+        p = (k-1)/2;
+        bv_clear(pool->split,p);
+        k = p;
     }
 }
 
@@ -264,7 +265,6 @@ int i;
  */
 static void
 buildmap(char *m) {
-int level;
 int s;
 int k;
 int l;
@@ -16,77 +16,332 @@
  * @brief   Pixel Format Conversion accepts inputs in ARGB8888, RGB888, RGB565, ARGB1555, ARGB4444,
  *          L8, AL44, AL88, L4, A8 and A4 format and converts to outputs in ARGB8888, RGB888,
  *          RGB565, ARGB1555 and ARGB4444 format
+ *
+ * @note    Operations are jobs in a queue. A job is a copy of the registers values. The
+ *          first one is started when submitted and the next ones by the transfer complete
+ *          interrupt, that also calls the job callback. Each job has a fence, a sequence
+ *          number, and DMA2D_Wait waits until the job with this fence (and all the former
+ *          ones) ends.
+ *
+ * @note    A job with a CLUT (L8, AL44, AL88 or L4 source) is run in two steps: the CLUT
+ *          is loaded into the foreground CLUT memory and, when the CLUT transfer complete
+ *          interrupt comes, the transfer is started.
+ *
+ * @note    The DMA2D does not see the data cache. The SDRAM (0xC0000000) is not cached by
+ *          default, but buffers in the internal SRAM must be cleaned (SCB_CleanDCache_by_Addr)
+ *          before a job reads them.
  */
 
 
 #include "stm32f746xx.h"
-#include "system_stm32f746.h"
 
+#include "bench.h"
 #include "dma2d.h"
 
 /**
  * @brief   structure to hold parameters as used by DMA2D unit
-  *
- * @note
+ *
+ * @note    Widths and offsets are in pixels, as in the NLR, FGOR, BGOR and OOR registers
  */
 
 typedef struct {
-    unsigned        area;               ///< Address of first byte of 1st line
-    unsigned        w;                  ///< Width
-    unsigned        h;                  ///< Height
-    unsigned        offset;             ///< Offset in bytes to start of next line
+    unsigned        area;               ///< Address of first pixel
+    unsigned        w;                  ///< Width (pixels per line)
+    unsigned        h;                  ///< Height (number of lines)
+    unsigned        offset;             ///< Pixels to skip to start of next line
     unsigned        pixelformat;        ///< Pixel format
 } Params;
 
+/**
+ * @brief   Job: register values for one operation
+ */
+typedef struct {
+    uint32_t        cr;                 ///< Mode
+    uint32_t        fgmar;              ///< Foreground
+    uint32_t        fgor;
+    uint32_t        fgpfccr;
+    uint32_t        fgcolr;
+    uint32_t        fgcmar;             ///< CLUT to load or 0
+    uint32_t        bgmar;              ///< Background
+    uint32_t        bgor;
+    uint32_t        bgpfccr;
+    uint32_t        bgcolr;
+    uint32_t        omar;               ///< Output
+    uint32_t        oor;
+    uint32_t        opfccr;
+    uint32_t        ocolr;
+    uint32_t        nlr;
+    DMA2D_Callback  cb;                 ///< Called when the job ends
+    void            *ctx;
+} Job;
+
+/**
+ * @brief   Modes (CR register)
+ */
+///@{
+#define MODE_M2M                (0)
+#define MODE_M2M_PFC            (DMA2D_CR_MODE_0)
+#define MODE_M2M_BLEND          (DMA2D_CR_MODE_1)
+#define MODE_R2M                (DMA2D_CR_MODE_0|DMA2D_CR_MODE_1)
+///@}
+
+/**
+ * @brief   Alpha mode (AM field of FGPFCCR): alpha of pixel multiplied by ALPHA/255
+ */
+#define ALPHA_MULTIPLY          (2UL<<DMA2D_FGPFCCR_AM_Pos)
+
+/**
+ * @brief   Interrupts used and flags cleared
+ */
+///@{
+#define INTERRUPTS              (DMA2D_CR_TCIE|DMA2D_CR_TEIE|DMA2D_CR_CEIE|\
+                                 DMA2D_CR_CTCIE|DMA2D_CR_CAEIE)
+#define ALLFLAGS                (DMA2D_IFCR_CTEIF|DMA2D_IFCR_CTCIF|DMA2D_IFCR_CTWIF|\
+                                 DMA2D_IFCR_CAECIF|DMA2D_IFCR_CCTCIF|DMA2D_IFCR_CCEIF)
+///@}
+
+#if (DMA2D_QUEUESIZE&(DMA2D_QUEUESIZE-1)) != 0
+#error "DMA2D_QUEUESIZE must be a power of 2"
+#endif
+
+/**
+ * @brief   Job queue
+ *
+ * @note    The job with fence f is in jobs[f%DMA2D_QUEUESIZE]. Jobs with fences between
+ *          completed+1 and submitted are waiting or running. Comparisons use differences
+ *          so the counters can wrap around.
+ */
+///@{
+static Job jobs[DMA2D_QUEUESIZE];
+static volatile unsigned submitted = 0;     ///< Fence of last job queued
+static volatile unsigned completed = 0;     ///< Fence of last job ended
+static volatile int running = 0;            ///< A job is in the DMA2D
+static volatile int loading = 0;            ///< Its CLUT is being loaded
+///@}
 
 /**
- * @brief Size in bits and in bytes of a pixel
+ * @brief   Busy time
+ *
+ * @note    Sum of the durations of the jobs ended (cycles). It counts forever, so
+ *          intervals are differences.
  */
 ///@{
-static unsigned char pixelsizebits[] = {
+static volatile uint32_t busycycles = 0;
+static uint32_t jobstart;                   ///< Start of the running job
+///@}
+
+
+/**
+ * @brief Size in bits of a pixel
+ */
+static const unsigned char pixelsizebits[] = {
 /*      0       1        2          3          4      5      6      7    8    9   10 */
 /* ARGB8888  RGB888   RGB565   ARGB1555   ARGB4444   L8   AL44   AL88   L4   A8   A4 */
 /*    I/O     1/O......I/O        I/O        I/O      I      I      I    I    I    I */
        32,     24,      16,        16,        16,     8,     8,    16,   4,   8,   4
 };
-static unsigned char pixelsize[] = {
-/*      0       1        2          3          4      5      6      7    8    9   10 */
-/* ARGB8888  RGB888   RGB565   ARGB1555   ARGB4444   L8   AL44   AL88   L4   A8   A4 */
-/*    I/O     1/O......I/O        I/O        I/O      I      I      I    I    I    I */
-        4,      3,       2,         2,         2,     1,     1,     2,   1,   1,   1
-};
-///@}
 
 
 /**
- * @brief   <Function to ....>
+ * @brief   calcParamsFromRegion
  *
- * @note    <bla bla bla>
+ * @note    Gets the address of the first pixel and the line offset of a region
+ *
+ * @return  0 if OK, -1 if it can not be done by the DMA2D (empty, too big, 4-bit pixel
+ *          not starting at a byte or line size not a multiple of the pixel size)
  */
 static int
 calcParamsFromRegion(const DMA2DRegion *r, Params *p) {
-unsigned ps = pixelsize[r->pixelformat];
+unsigned bits;
 
-    p->pixelformat = r->pixelformat;
-    p->area = (unsigned) (r->address) + r->x*ps;
-    p->w    = r->w*ps;
-    p->h    = r->h;
-    p->offset= r->linesize - p->w;
+    if( r->pixelformat > DMA2D_A4 )
+        return -1;
+    bits = pixelsizebits[r->pixelformat];
+    if( ((r->x*bits)%8) != 0 || ((r->linesize*8)%bits) != 0 )
+        return -1;
 
+    p->pixelformat = r->pixelformat;
+    p->area   = (unsigned) (r->address) + r->y*r->linesize + r->x*bits/8;
+    p->w      = r->w;
+    p->h      = r->h;
+    if( r->linesize*8/bits < r->w )
+        return -1;
+    p->offset = r->linesize*8/bits - r->w;
+
+    if( p->w == 0 || p->h == 0 || p->w > 0x3FFF || p->h > 0xFFFF || p->offset > 0x3FFF )
+        return -1;
     return 0;
 }
 
+/**
+ * @brief   Set size and output registers of a job
+ *
+ * @note    The size is the smallest of the output and p
+ */
+static void
+setOutput(Job *j, const Params *o, const Params *p) {
+unsigned w,h;
+
+    w = o->w < p->w ? o->w : p->w;
+    h = o->h < p->h ? o->h : p->h;
+    j->omar   = o->area;
+    j->oor    = o->offset+(o->w-w);
+    j->opfccr = o->pixelformat;
+    j->nlr    = (w<<DMA2D_NLR_PL_Pos)|(h<<DMA2D_NLR_NL_Pos);
+}
+
+
+/**
+ * @brief   Load registers from job and start it (or its CLUT loading)
+ */
+static void
+startJob(const Job *j) {
+
+    jobstart = Bench_GetCycles();
+    DMA2D->FGMAR   = j->fgmar;
+    DMA2D->FGOR    = j->fgor;
+    DMA2D->FGPFCCR = j->fgpfccr;
+    DMA2D->FGCOLR  = j->fgcolr;
+    DMA2D->BGMAR   = j->bgmar;
+    DMA2D->BGOR    = j->bgor;
+    DMA2D->BGPFCCR = j->bgpfccr;
+    DMA2D->BGCOLR  = j->bgcolr;
+    DMA2D->OMAR    = j->omar;
+    DMA2D->OOR     = j->oor;
+    DMA2D->OPFCCR  = j->opfccr;
+    DMA2D->OCOLR   = j->ocolr;
+    DMA2D->NLR     = j->nlr;
+    if( j->fgcmar ) {
+        loading = 1;
+        DMA2D->FGCMAR   = j->fgcmar;
+        DMA2D->CR       = j->cr|INTERRUPTS;
+        DMA2D->FGPFCCR |= DMA2D_FGPFCCR_START;
+    } else {
+        DMA2D->CR      = j->cr|INTERRUPTS|DMA2D_CR_START;
+    }
+}
+
+/**
+ * @brief   Start the oldest job waiting
+ */
+static void
+startNext(void) {
+
+    running = 1;
+    startJob(&jobs[(completed+1)%DMA2D_QUEUESIZE]);
+}
+
+
+/**
+ * @brief   Put a job in the queue
+ *
+ * @note    If the queue is full, waits for a free position, except when called from
+ *          an interrupt. The position is reserved with the interrupts masked.
+ *
+ * @return  fence or 0 when not queued
+ */
+static unsigned
+submit(const Job *j) {
+unsigned fence;
+uint32_t primask;
+
+    /* The check is repeated with the interrupts masked: an interrupt can submit */
+    for(;;) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if( submitted-completed < DMA2D_QUEUESIZE )
+            break;
+        __set_PRIMASK(primask);
+        if( __get_IPSR() != 0 )
+            return 0;
+        __NOP();
+    }
+
+    fence = submitted+1;
+    jobs[fence%DMA2D_QUEUESIZE] = *j;
+    submitted = fence;
+    if( !running )
+        startNext();
+    __set_PRIMASK(primask);
+
+    return fence;
+}
+
+
+/**
+ * @brief   DMA2D_IRQHandler
+ *
+ * @note    Ends the running job, starts the next one and then calls the callback
+ *          of the job ended
+ *
+ * @note    The hand-off is done with the interrupts masked. Otherwise an interrupt
+ *          calling DMA2D_Submit* after running is cleared would start the next job,
+ *          and it would be started again here.
+ */
+void DMA2D_IRQHandler(void) {
+uint32_t isr,primask;
+DMA2D_Callback cb;
+void *ctx;
+int status;
+Job *j;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    isr = DMA2D->ISR;
+    DMA2D->IFCR = isr&ALLFLAGS;
+
+    if( !running ) {
+        __set_PRIMASK(primask);
+        return;
+    }
+    if( isr&(DMA2D_ISR_TEIF|DMA2D_ISR_CEIF|DMA2D_ISR_CAEIF) ) {
+        status = DMA2D_ERROR;
+    } else if( isr&DMA2D_ISR_TCIF ) {
+        status = DMA2D_DONE;
+    } else if( (isr&DMA2D_ISR_CTCIF) && loading ) {
+        /* CLUT loaded. Now the transfer */
+        loading = 0;
+        DMA2D->CR |= DMA2D_CR_START;
+        __set_PRIMASK(primask);
+        return;
+    } else {
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    busycycles += Bench_GetCycles()-jobstart;
+    j   = &jobs[(completed+1)%DMA2D_QUEUESIZE];
+    cb  = j->cb;
+    ctx = j->ctx;
+    running = 0;
+    loading = 0;
+    completed++;
+    if( submitted != completed )
+        startNext();
+    __set_PRIMASK(primask);
+
+    if( cb )
+        cb(ctx,status);
+}
+
 
 /**
  * @brief   DMA2D_Init
  *
- * @note    Initializes de DMA2D (ChromeArt Accelerator) unit
+ * @note    Initializes de DMA2D (ChromeArt Accelerator) unit and enables its interrupt
  */
 int DMA2D_Init(void) {
 
     /* Enable clock for DMA2D unit */
     RCC->AHB1ENR |= RCC_AHB1ENR_DMA2DEN;
 
+    /* Enable interrupt */
+    DMA2D->IFCR = ALLFLAGS;
+    NVIC_SetPriority(DMA2D_IRQn,DMA2D_INTLEVEL);
+    NVIC_ClearPendingIRQ(DMA2D_IRQn);
+    NVIC_EnableIRQ(DMA2D_IRQn);
+
     return 0;
 }
 
@@ -94,24 +349,58 @@ int DMA2D_Init(void) {
 /**
  * @brief   DMA2D_IsReady
  *
- * @note    Test if ongoing operation is done and unit is ready to accept new ones
+ * @note    Test if all jobs are done and unit is ready to accept new ones
  */
 int DMA2D_IsReady(void) {
 
-    return !(DMA2D->CR & DMA2D_CR_START);
+    return !running && !(DMA2D->CR & DMA2D_CR_START);
 }
 
 
 /**
  * @brief   DMA2D_Abort
  *
- * @note    Abort on going operation
+ * @note    Abort on going operation and remove all jobs from the queue. Their
+ *          callbacks are called with status DMA2D_ABORTED. Jobs submitted by
+ *          these callbacks are run normally.
  */
 int DMA2D_Abort(void) {
+uint32_t primask;
+unsigned last;
+DMA2D_Callback cb;
+void *ctx;
+Job *j;
 
-    DMA2D->CR |= DMA2D_CR_SUSP;
+    primask = __get_PRIMASK();
+    __disable_irq();
 
     DMA2D->CR |= DMA2D_CR_ABORT;
+    while( (DMA2D->CR&DMA2D_CR_START) || (DMA2D->FGPFCCR&DMA2D_FGPFCCR_START) ) {
+        __NOP();
+    }
+    loading = 0;
+    DMA2D->CR &= ~(DMA2D_CR_ABORT|DMA2D_CR_SUSP);
+    DMA2D->IFCR = ALLFLAGS;
+    NVIC_ClearPendingIRQ(DMA2D_IRQn);
+    if( running )
+        busycycles += Bench_GetCycles()-jobstart;
+
+    /* running stays set, so the callbacks do not start new jobs */
+    running = 1;
+    last = submitted;
+    while( completed != last ) {
+        j   = &jobs[(completed+1)%DMA2D_QUEUESIZE];
+        cb  = j->cb;
+        ctx = j->ctx;
+        completed++;
+        if( cb )
+            cb(ctx,DMA2D_ABORTED);
+    }
+    running = 0;
+    if( submitted != completed )
+        startNext();
+
+    __set_PRIMASK(primask);
 
     return 1;
 }
@@ -133,7 +422,7 @@ int DMA2D_Suspend(void) {
 /**
  * @brief   DMA2D_Resume
  *
- * @note    Abort on going operation
+ * @note    Resume the suspended operation
  */
 int DMA2D_Resume(void) {
 
@@ -144,41 +433,285 @@ int DMA2D_Resume(void) {
 
 
 /**
- * @brief   DMA2D_FillRegion
+ * @brief   DMA2D_SubmitFill
  *
- * @note    Fill specified region with color c
+ * @note    Queue a fill of region r with color c (register to memory). c must be
+ *          in the format of the region, that must be an output format
+ *
+ * @return  fence or 0 if the region is not valid
  */
-int DMA2D_FillRegion( const DMA2DRegion *r, unsigned c ) {
+unsigned
+DMA2D_SubmitFill(const DMA2DRegion *r, unsigned c, DMA2D_Callback cb, void *ctx) {
 Params p;
+Job j = { 0 };
+
+    if( calcParamsFromRegion(r,&p) < 0 || p.pixelformat > DMA2D_ARGB4444 )
+        return 0;
+
+    j.cr    = MODE_R2M;
+    j.ocolr = c;
+    setOutput(&j,&p,&p);
+    j.cb    = cb;
+    j.ctx   = ctx;
+
+    return submit(&j);
+}
+
 
-    /* Wait until previus operation is done and unit is ready to accept a new one */
-    while( !DMA2D_IsReady() ) {}
+/**
+ * @brief   DMA2D_SubmitCopy
+ *
+ * @note    Queue a copy of region src into region dst (memory to memory). Both must
+ *          have the same pixel format with at least 8 bits. The size is the smallest
+ *          of both regions.
+ *
+ * @return  fence or 0 if the regions are not valid
+ */
+unsigned
+DMA2D_SubmitCopy(const DMA2DRegion *dst, const DMA2DRegion *src, DMA2D_Callback cb, void *ctx) {
+Params o,f;
+Job j = { 0 };
+
+    if( calcParamsFromRegion(dst,&o) < 0 || calcParamsFromRegion(src,&f) < 0 )
+        return 0;
+    if( o.pixelformat != f.pixelformat || pixelsizebits[f.pixelformat] < 8 )
+        return 0;
+
+    j.cr      = MODE_M2M;
+    j.fgmar   = f.area;
+    j.fgpfccr = f.pixelformat;
+    setOutput(&j,&o,&f);
+    j.fgor    = f.offset+(f.w-(j.nlr>>DMA2D_NLR_PL_Pos));
+    j.cb      = cb;
+    j.ctx     = ctx;
+
+    return submit(&j);
+}
+
+
+/**
+ * @brief   DMA2D_SubmitConvert
+ *
+ * @note    Queue a copy of region src into region dst with pixel format conversion
+ *          (memory to memory with PFC). dst must be in an output format. For L8, AL44,
+ *          AL88 and L4 sources, clut has n (1 to 256) ARGB8888 colors, loaded before
+ *          the transfer. It must not change until the job ends. The size is the
+ *          smallest of both regions.
+ *
+ * @return  fence or 0 if the regions or the CLUT are not valid
+ */
+unsigned
+DMA2D_SubmitConvert(const DMA2DRegion *dst, const DMA2DRegion *src,
+                    const uint32_t *clut, unsigned n, DMA2D_Callback cb, void *ctx) {
+Params o,f;
+Job j = { 0 };
+
+    if( calcParamsFromRegion(dst,&o) < 0 || calcParamsFromRegion(src,&f) < 0 )
+        return 0;
+    if( o.pixelformat > DMA2D_ARGB4444 || f.pixelformat > DMA2D_L4 )
+        return 0;
+
+    if( f.pixelformat >= DMA2D_L8 ) {
+        if( clut == 0 || n == 0 || n > 256 )
+            return 0;
+        j.fgcmar  = (uint32_t) (uintptr_t) clut;
+        j.fgpfccr = (n-1)<<DMA2D_FGPFCCR_CS_Pos;
+    }
+    j.cr       = MODE_M2M_PFC;
+    j.fgmar    = f.area;
+    j.fgpfccr |= f.pixelformat;
+    setOutput(&j,&o,&f);
+    j.fgor     = f.offset+(f.w-(j.nlr>>DMA2D_NLR_PL_Pos));
+    j.cb       = cb;
+    j.ctx      = ctx;
+
+    return submit(&j);
+}
+
+
+/**
+ * @brief   DMA2D_SubmitBlend
+ *
+ * @note    Queue a blending of foreground fg over background bg into dst (memory to
+ *          memory with blending). dst and bg must be in formats with color (ARGB8888 to
+ *          ARGB4444). dst can be the same as bg. The size is the smallest of the three
+ *          regions.
+ *
+ * @note    fg can also be A8 or A4 (e.g. anti-aliased glyphs): its pixels are alpha
+ *          values and color (RGB888) is used for all of them.
+ *
+ * @note    The alpha of each fg pixel is multiplied by alpha/255. For fg formats without
+ *          alpha, alpha is a constant transparency. With alpha 255, only the alpha of the
+ *          pixels is used.
+ *
+ * @return  fence or 0 if the regions are not valid
+ */
+unsigned
+DMA2D_SubmitBlend(const DMA2DRegion *dst, const DMA2DRegion *fg, const DMA2DRegion *bg,
+                  unsigned color, unsigned alpha, DMA2D_Callback cb, void *ctx) {
+Params o,f,b;
+Job j = { 0 };
+unsigned w;
+
+    if( calcParamsFromRegion(dst,&o) < 0 || calcParamsFromRegion(fg,&f) < 0
+     || calcParamsFromRegion(bg,&b) < 0 )
+        return 0;
+    if( o.pixelformat > DMA2D_ARGB4444 || b.pixelformat > DMA2D_ARGB4444 )
+        return 0;
+    if( f.pixelformat > DMA2D_ARGB4444 && f.pixelformat != DMA2D_A8
+     && f.pixelformat != DMA2D_A4 )
+        return 0;
+    if( alpha > 255 )
+        return 0;
+
+    if( b.w < f.w )
+        f.w = b.w;
+    if( b.h < f.h )
+        f.h = b.h;
+    j.cr      = MODE_M2M_BLEND;
+    setOutput(&j,&o,&f);
+    w = j.nlr>>DMA2D_NLR_PL_Pos;
+    j.fgmar   = f.area;
+    j.fgor    = f.offset+(fg->w-w);
+    j.fgpfccr = f.pixelformat;
+    if( alpha < 255 )
+        j.fgpfccr |= ALPHA_MULTIPLY|(alpha<<DMA2D_FGPFCCR_ALPHA_Pos);
+    j.fgcolr  = color&0xFFFFFF;
+    j.bgmar   = b.area;
+    j.bgor    = b.offset+(b.w-w);
+    j.bgpfccr = b.pixelformat;
+    j.cb      = cb;
+    j.ctx     = ctx;
+
+    return submit(&j);
+}
+
+
+/**
+ * @brief   DMA2D_GetFence
+ *
+ * @note    Returns the fence of the last job submitted. Waiting for it waits for all
+ *          jobs submitted until now.
+ */
+unsigned DMA2D_GetFence(void) {
+
+    return submitted;
+}
+
+
+/**
+ * @brief   DMA2D_GetBusyCycles
+ *
+ * @note    Returns the sum of the durations of the jobs ended until now (cycles of the
+ *          DWT counter, that must be enabled with Bench_Init). It wraps around, so use
+ *          the difference of two calls.
+ */
+uint32_t DMA2D_GetBusyCycles(void) {
 
-    /* Set register to memory mode*/
-    DMA2D->CR = DMA2D_CR_MODE_0;
+    return busycycles;
+}
 
-    /* Set color source */
-    DMA2D->OCOLR = c;
 
-    /* Calculate parameters for configuring DMA2D */
-    calcParamsFromRegion(r,&p);
+/**
+ * @brief   DMA2D_IsDone
+ *
+ * @note    Returns 1 if the job with this fence has ended
+ */
+int DMA2D_IsDone(unsigned fence) {
 
-    /* Set color format */
-    DMA2D->OPFCCR = p.pixelformat;
+    return (int) (completed-fence) >= 0;
+}
 
-    /* Destination address */
-    DMA2D->OMAR = p.area;
 
-    /* Set pixel per line and number of lines */
-    DMA2D->NLR = (p.w<<DMA2D_NLR_PL_Pos)|(p.h<<DMA2D_NLR_NL_Pos);
+/**
+ * @brief   DMA2D_Wait
+ *
+ * @note    Waits until the job with this fence has ended. Must not be called from an
+ *          interrupt with priority higher than or equal to the DMA2D one.
+ *
+ * @return  0 if OK, -1 if no job with this fence was submitted
+ */
+int DMA2D_Wait(unsigned fence) {
 
-    /* Offset to next start of line */
-    DMA2D->OOR = p.offset;
+    if( (int) (fence-submitted) > 0 )
+        return -1;
+    while( !DMA2D_IsDone(fence) ) {
+        __NOP();
+    }
+    return 0;
+}
 
-    /* Start operation */
-    DMA2D->CR |= DMA2D_CR_START;
 
+/**
+ * @brief   DMA2D_WaitIdle
+ *
+ * @note    Waits until the queue is empty, including the jobs submitted by callbacks
+ *          meanwhile
+ */
+int DMA2D_WaitIdle(void) {
 
+    while( submitted != completed ) {
+        __NOP();
+    }
     return 0;
 }
 
+
+/**
+ * @brief   DMA2D_FillRegion
+ *
+ * @note    Fill specified region with color c. It is queued and does not wait for the
+ *          end (use DMA2D_WaitIdle).
+ *
+ * @return  0 if OK, -1 if the region is not valid
+ */
+int DMA2D_FillRegion( const DMA2DRegion *r, unsigned c ) {
+
+    return DMA2D_SubmitFill(r,c,0,0) ? 0 : -1;
+}
+
+
+/**
+ * @brief   DMA2D_CopyRegion
+ *
+ * @note    Copy region src into region dst (same pixel format). It is queued and does
+ *          not wait for the end.
+ *
+ * @return  0 if OK, -1 if the regions are not valid
+ */
+int DMA2D_CopyRegion(const DMA2DRegion *dst, const DMA2DRegion *src) {
+
+    return DMA2D_SubmitCopy(dst,src,0,0) ? 0 : -1;
+}
+
+
+/**
+ * @brief   DMA2D_ConvertRegion
+ *
+ * @note    Copy region src into region dst converting the pixel format. clut (n colors)
+ *          is used for L8, AL44, AL88 and L4 sources. It is queued and does not wait
+ *          for the end.
+ *
+ * @return  0 if OK, -1 if the regions or the CLUT are not valid
+ */
+int DMA2D_ConvertRegion(const DMA2DRegion *dst, const DMA2DRegion *src,
+                        const uint32_t *clut, unsigned n) {
+
+    return DMA2D_SubmitConvert(dst,src,clut,n,0,0) ? 0 : -1;
+}
+
+
+/**
+ * @brief   DMA2D_BlendRegion
+ *
+ * @note    Blend fg over bg into dst. color is used by A8 and A4 foregrounds and alpha
+ *          (0-255) multiplies the alpha of fg (see DMA2D_SubmitBlend). It is queued and
+ *          does not wait for the end.
+ *
+ * @return  0 if OK, -1 if the regions are not valid
+ */
+int DMA2D_BlendRegion(const DMA2DRegion *dst, const DMA2DRegion *fg, const DMA2DRegion *bg,
+                      unsigned color, unsigned alpha) {
+
+    return DMA2D_SubmitBlend(dst,fg,bg,color,alpha,0,0) ? 0 : -1;
+}
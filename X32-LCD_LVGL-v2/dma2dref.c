@@ -0,0 +1,263 @@
+/**
+ * @file    dma2dref.c
+ *
+ * @note    CPU equivalents of the DMA2D operations over DMA2DRegion descriptors
+ *
+ * @note    They follow the DMA2D pixel format conversion and blending (RM0385, 9.3):
+ *          - components with less than 8 bits are expanded replicating their high bits
+ *            (0x1F -> 0xFF)
+ *          - output conversion keeps the high bits
+ *          - alpha multiplied by a constant is a*ALPHA/255
+ *          - blending uses
+ *                  am   = afg*abg/255
+ *                  aout = afg+abg-am
+ *                  cout = (cfg*afg+cbg*abg-cbg*am)/aout
+ *          - divisions truncate
+ *          - in L4 and A4 formats, the first pixel is in the low nibble
+ *
+ * @note    They do one pixel at a time and are slow. They give the expected output of the
+ *          DMA2D operations, for tests and benchmarks.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "dma2d.h"
+#include "dma2dref.h"
+
+/**
+ * @brief   Size in bits of a pixel
+ */
+static const unsigned char pixelsizebits[] = {
+/* ARGB8888  RGB888   RGB565   ARGB1555   ARGB4444   L8   AL44   AL88   L4   A8   A4 */
+       32,     24,      16,        16,        16,     8,     8,    16,   4,   8,   4
+};
+
+/**
+ * @brief   Expand a n-bit value to 8 bits
+ */
+static inline unsigned expand(unsigned v, int n) {
+
+    v <<= 8-n;
+    return v|(v>>n);
+}
+
+/**
+ * @brief   Address of pixel (i,j) of region
+ */
+static inline uint8_t *pixeladdress(const DMA2DRegion *r, unsigned i, unsigned j) {
+
+    return (uint8_t *) r->address+(r->y+j)*r->linesize
+                      +(r->x+i)*pixelsizebits[r->pixelformat]/8;
+}
+
+/**
+ * @brief   DMA2DRef_GetPixel
+ *
+ * @note    Returns pixel (i,j) of region r in ARGB8888. clut is used by L8, AL44, AL88
+ *          and L4 and color (RGB888) by A8 and A4
+ */
+uint32_t
+DMA2DRef_GetPixel(const DMA2DRegion *r, unsigned i, unsigned j,
+                  const uint32_t *clut, unsigned color) {
+uint8_t *p = pixeladdress(r,i,j);
+unsigned v,a;
+
+    switch( r->pixelformat ) {
+    case DMA2D_ARGB8888:
+        return p[0]|(p[1]<<8)|(p[2]<<16)|((uint32_t) p[3]<<24);
+    case DMA2D_RGB888:
+        return 0xFF000000|p[0]|(p[1]<<8)|(p[2]<<16);
+    case DMA2D_RGB565:
+        v = p[0]|(p[1]<<8);
+        return 0xFF000000|(expand(v>>11,5)<<16)|(expand((v>>5)&0x3F,6)<<8)|expand(v&0x1F,5);
+    case DMA2D_ARGB1555:
+        v = p[0]|(p[1]<<8);
+        a = (v&0x8000) ? 0xFF : 0;
+        return ((uint32_t) a<<24)|(expand((v>>10)&0x1F,5)<<16)|(expand((v>>5)&0x1F,5)<<8)
+              |expand(v&0x1F,5);
+    case DMA2D_ARGB4444:
+        v = p[0]|(p[1]<<8);
+        return ((uint32_t) expand(v>>12,4)<<24)|(expand((v>>8)&0xF,4)<<16)
+              |(expand((v>>4)&0xF,4)<<8)|expand(v&0xF,4);
+    case DMA2D_L8:
+        return clut[p[0]];
+    case DMA2D_AL44:
+        return ((uint32_t) expand(p[0]>>4,4)<<24)|(clut[p[0]&0xF]&0xFFFFFF);
+    case DMA2D_AL88:
+        return ((uint32_t) p[1]<<24)|(clut[p[0]]&0xFFFFFF);
+    case DMA2D_L4:
+        return clut[((r->x+i)&1) ? p[0]>>4 : p[0]&0xF];
+    case DMA2D_A8:
+        return ((uint32_t) p[0]<<24)|(color&0xFFFFFF);
+    case DMA2D_A4:
+        v = ((r->x+i)&1) ? p[0]>>4 : p[0]&0xF;
+        return ((uint32_t) expand(v,4)<<24)|(color&0xFFFFFF);
+    }
+    return 0;
+}
+
+/**
+ * @brief   DMA2DRef_PutPixel
+ *
+ * @note    Writes ARGB8888 color c into pixel (i,j) of region r (output formats only)
+ */
+void
+DMA2DRef_PutPixel(const DMA2DRegion *r, unsigned i, unsigned j, uint32_t c) {
+uint8_t *p = pixeladdress(r,i,j);
+unsigned a = c>>24, rr = (c>>16)&0xFF, g = (c>>8)&0xFF, b = c&0xFF;
+unsigned v;
+
+    switch( r->pixelformat ) {
+    case DMA2D_ARGB8888:
+        p[3] = a;
+        /* FALLTHRU */
+    case DMA2D_RGB888:
+        p[0] = b;
+        p[1] = g;
+        p[2] = rr;
+        return;
+    case DMA2D_RGB565:
+        v = ((rr>>3)<<11)|((g>>2)<<5)|(b>>3);
+        break;
+    case DMA2D_ARGB1555:
+        v = ((a>>7)<<15)|((rr>>3)<<10)|((g>>3)<<5)|(b>>3);
+        break;
+    case DMA2D_ARGB4444:
+        v = ((a>>4)<<12)|((rr>>4)<<8)|((g>>4)<<4)|(b>>4);
+        break;
+    default:
+        return;
+    }
+    p[0] = v;
+    p[1] = v>>8;
+}
+
+/**
+ * @brief   DMA2DRef_Blend
+ *
+ * @note    Blends ARGB8888 colors fg over bg
+ */
+uint32_t
+DMA2DRef_Blend(uint32_t fg, uint32_t bg) {
+unsigned af = fg>>24, ab = bg>>24;
+unsigned am, ao;
+uint32_t c;
+int k;
+
+    am = af*ab/255;
+    ao = af+ab-am;
+    if( ao == 0 )
+        return 0;
+    c = (uint32_t) ao<<24;
+    for(k=0;k<24;k+=8)
+        c |= (((fg>>k)&0xFF)*af+((bg>>k)&0xFF)*(ab-am))/ao<<k;
+    return c;
+}
+
+/**
+ * @brief   Size of operation (smallest of the regions)
+ */
+static void
+opsize(const DMA2DRegion *a, const DMA2DRegion *b, unsigned *w, unsigned *h) {
+
+    *w = a->w < b->w ? a->w : b->w;
+    *h = a->h < b->h ? a->h : b->h;
+}
+
+/**
+ * @brief   DMA2DRef_FillRegion
+ *
+ * @note    As DMA2D_FillRegion. c is in the format of the region
+ */
+int
+DMA2DRef_FillRegion(const DMA2DRegion *r, unsigned c) {
+unsigned ps,i,j,k;
+uint8_t *p;
+
+    if( r->pixelformat > DMA2D_ARGB4444 )
+        return -1;
+    ps = pixelsizebits[r->pixelformat]/8;
+    for(j=0;j<r->h;j++) {
+        p = pixeladdress(r,0,j);
+        for(i=0;i<r->w;i++) {
+            for(k=0;k<ps;k++)
+                *p++ = c>>(8*k);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   DMA2DRef_CopyRegion
+ *
+ * @note    As DMA2D_CopyRegion
+ */
+int
+DMA2DRef_CopyRegion(const DMA2DRegion *dst, const DMA2DRegion *src) {
+unsigned w,h,j;
+
+    if( dst->pixelformat != src->pixelformat || pixelsizebits[src->pixelformat] < 8 )
+        return -1;
+    opsize(dst,src,&w,&h);
+    for(j=0;j<h;j++)
+        memmove(pixeladdress(dst,0,j),pixeladdress(src,0,j),w*pixelsizebits[src->pixelformat]/8);
+    return 0;
+}
+
+/**
+ * @brief   DMA2DRef_ConvertRegion
+ *
+ * @note    As DMA2D_ConvertRegion
+ */
+int
+DMA2DRef_ConvertRegion(const DMA2DRegion *dst, const DMA2DRegion *src,
+                       const uint32_t *clut, unsigned n) {
+unsigned w,h,i,j;
+
+    if( dst->pixelformat > DMA2D_ARGB4444 || src->pixelformat > DMA2D_L4 )
+        return -1;
+    if( src->pixelformat >= DMA2D_L8 && (clut == 0 || n == 0 || n > 256) )
+        return -1;
+    opsize(dst,src,&w,&h);
+    for(j=0;j<h;j++) {
+        for(i=0;i<w;i++)
+            DMA2DRef_PutPixel(dst,i,j,DMA2DRef_GetPixel(src,i,j,clut,0));
+    }
+    return 0;
+}
+
+/**
+ * @brief   DMA2DRef_BlendRegion
+ *
+ * @note    As DMA2D_BlendRegion
+ */
+int
+DMA2DRef_BlendRegion(const DMA2DRegion *dst, const DMA2DRegion *fg, const DMA2DRegion *bg,
+                     unsigned color, unsigned alpha) {
+unsigned w,h,i,j;
+uint32_t f;
+
+    if( dst->pixelformat > DMA2D_ARGB4444 || bg->pixelformat > DMA2D_ARGB4444 )
+        return -1;
+    if( fg->pixelformat > DMA2D_ARGB4444 && fg->pixelformat != DMA2D_A8
+     && fg->pixelformat != DMA2D_A4 )
+        return -1;
+    if( alpha > 255 )
+        return -1;
+    opsize(dst,fg,&w,&h);
+    if( bg->w < w )
+        w = bg->w;
+    if( bg->h < h )
+        h = bg->h;
+    for(j=0;j<h;j++) {
+        for(i=0;i<w;i++) {
+            f = DMA2DRef_GetPixel(fg,i,j,0,color);
+            if( alpha < 255 )
+                f = (f&0xFFFFFF)|((uint32_t) ((f>>24)*alpha/255)<<24);
+            DMA2DRef_PutPixel(dst,i,j,DMA2DRef_Blend(f,DMA2DRef_GetPixel(bg,i,j,0,0)));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,26 @@
+#ifndef DMA2DREF_H
+#define DMA2DREF_H
+/**
+ * @file    dma2dref.h
+ *
+ * @note    CPU equivalents of the DMA2D operations, used as reference
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "dma2d.h"
+
+uint32_t DMA2DRef_GetPixel(const DMA2DRegion *r, unsigned i, unsigned j,
+                           const uint32_t *clut, unsigned color);
+void     DMA2DRef_PutPixel(const DMA2DRegion *r, unsigned i, unsigned j, uint32_t c);
+uint32_t DMA2DRef_Blend(uint32_t fg, uint32_t bg);
+
+int DMA2DRef_FillRegion(const DMA2DRegion *r, unsigned c);
+int DMA2DRef_CopyRegion(const DMA2DRegion *dst, const DMA2DRegion *src);
+int DMA2DRef_ConvertRegion(const DMA2DRegion *dst, const DMA2DRegion *src,
+                           const uint32_t *clut, unsigned n);
+int DMA2DRef_BlendRegion(const DMA2DRegion *dst, const DMA2DRegion *fg, const DMA2DRegion *bg,
+                         unsigned color, unsigned alpha);
+
+#endif
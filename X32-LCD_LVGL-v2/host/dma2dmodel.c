@@ -0,0 +1,471 @@
+/**
+ * @file    dma2dmodel.c
+ *
+ * @note    Model of the DMA2D to run dma2d.c on a host
+ *
+ * @note    All modes are done over the host memory with the register semantics of the
+ *          device (RM0385, section 9): register to memory, memory to memory, memory to
+ *          memory with pixel format conversion (PFC) and with blending. Foreground and
+ *          background have their own PFC, with CLUT (loaded by START in FGPFCCR or
+ *          BGPFCCR, ARGB8888 or RGB888 colors), fixed color for A8/A4 and alpha modes.
+ *
+ * @note    Pixel rules:
+ *          - components with less than 8 bits are expanded replicating their high bits
+ *          - the output conversion keeps the high bits
+ *          - alpha modes: 0 keeps, 1 replaces by ALPHA, 2 multiplies: a*ALPHA/255
+ *          - blending: am = afg*abg/255, aout = afg+abg-am,
+ *                      cout = (cfg*afg+cbg*abg-cbg*am)/aout, truncating divisions
+ *          - in 4-bit formats, the first pixel is in the low nibble
+ *
+ * @note    A transfer that the device rejects (no pixels or lines, output or input
+ *          format not valid for the mode) sets the configuration error flag and does
+ *          not write the memory.
+ *
+ * @note    The time of each transfer is estimated from the words read and written and
+ *          the number of lines (see DMA2DModel_Timing). It is added to DMA2DModel_Cycles.
+ *
+ * @author  Hans
+ */
+
+#include <string.h>
+#include "stm32f746xx.h"
+#include "dma2dmodel.h"
+
+/**
+ * @brief   Registers
+ */
+///@{
+DMA2D_TypeDef DMA2DModel_Registers;
+RCC_TypeDef   DMA2DModel_RCC;
+DWT_Type      DMA2DModel_DWT;
+///@}
+
+/**
+ * @brief   Log of transfers
+ */
+///@{
+DMA2DModel_Transfer DMA2DModel_Log[DMA2DMODEL_LOGSIZE];
+int DMA2DModel_LogCount = 0;
+///@}
+
+/**
+ * @brief   Timing
+ */
+///@{
+DMA2DModel_Timing DMA2DModel_TimingParameters = { 2, 2, 4, 1 };
+uint64_t DMA2DModel_Cycles = 0;
+///@}
+
+/**
+ * @brief   Core state
+ */
+///@{
+static uint32_t primask = 0;            ///< Interrupts masked
+static uint32_t ipsr    = 0;            ///< Exception running
+static int      enabled = 0;            ///< DMA2D interrupt enabled in NVIC
+///@}
+
+/**
+ * @brief   Bytes per pixel
+ */
+static const unsigned pixelsize[] = { 4, 3, 2, 2, 2, 1, 1, 2, 1, 1, 1 };
+
+/**
+ * @brief   Apply writes to IFCR
+ */
+static void
+clearflags(void) {
+
+    DMA2D->ISR  &= ~DMA2D->IFCR;
+    DMA2D->IFCR  = 0;
+}
+
+/**
+ * @brief   Call the interrupt handler while there are flags enabled
+ *
+ * @note    Enables in CR bits 8-13 are in the same order as flags in ISR bits 0-5
+ */
+static void
+deliver(void) {
+
+    clearflags();
+    while( enabled && !primask && !ipsr && (DMA2D->ISR&(DMA2D->CR>>8)&0x3F) ) {
+        ipsr = 16+DMA2D_IRQn;
+        DMA2D_IRQHandler();
+        ipsr = 0;
+        clearflags();
+    }
+}
+
+/**
+ * @brief   Record registers
+ */
+static void
+record(void) {
+DMA2DModel_Transfer *t;
+
+    if( DMA2DModel_LogCount >= DMA2DMODEL_LOGSIZE )
+        return;
+    t = &DMA2DModel_Log[DMA2DModel_LogCount++];
+    t->cr      = DMA2D->CR;
+    t->fgmar   = DMA2D->FGMAR;
+    t->fgor    = DMA2D->FGOR;
+    t->fgpfccr = DMA2D->FGPFCCR;
+    t->fgcolr  = DMA2D->FGCOLR;
+    t->bgmar   = DMA2D->BGMAR;
+    t->bgor    = DMA2D->BGOR;
+    t->bgpfccr = DMA2D->BGPFCCR;
+    t->bgcolr  = DMA2D->BGCOLR;
+    t->omar    = DMA2D->OMAR;
+    t->oor     = DMA2D->OOR;
+    t->opfccr  = DMA2D->OPFCCR;
+    t->ocolr   = DMA2D->OCOLR;
+    t->nlr     = DMA2D->NLR;
+}
+
+/**
+ * @brief   Load a CLUT
+ *
+ * @note    pfccr gives the size (CS) and the color format (CCM): ARGB8888 or RGB888
+ */
+static void
+loadclut(volatile uint32_t *clutmem, uint32_t cmar, uint32_t pfccr) {
+const uint8_t *p = (const uint8_t *) (uintptr_t) cmar;
+unsigned n = ((pfccr&DMA2D_FGPFCCR_CS)>>DMA2D_FGPFCCR_CS_Pos)+1;
+unsigned i;
+
+    for(i=0;i<n;i++) {
+        if( pfccr&DMA2D_FGPFCCR_CCM ) {
+            clutmem[i] = 0xFF000000|p[0]|(p[1]<<8)|(p[2]<<16);
+            p += 3;
+        } else {
+            clutmem[i] = p[0]|(p[1]<<8)|(p[2]<<16)|((uint32_t) p[3]<<24);
+            p += 4;
+        }
+    }
+}
+
+/**
+ * @brief   Expand a n-bit value to 8 bits
+ */
+static unsigned
+expand(unsigned v, int n) {
+
+    v <<= 8-n;
+    return v|(v>>n);
+}
+
+/**
+ * @brief   Input port (foreground or background)
+ */
+typedef struct {
+    uint32_t            mar;            ///< Address of first pixel
+    uint32_t            or;             ///< Line offset in pixels
+    uint32_t            pfccr;          ///< PFC control
+    uint32_t            colr;           ///< Color for A8/A4
+    volatile uint32_t   *clut;          ///< CLUT memory
+} Port;
+
+/**
+ * @brief   Read pixel i of line j of a port, after conversion and alpha mode
+ */
+static uint32_t
+readpixel(const Port *p, unsigned pl, unsigned i, unsigned j) {
+unsigned cm = p->pfccr&DMA2D_FGPFCCR_CM;
+unsigned bits = 8*pixelsize[cm];
+unsigned long pos = (unsigned long) j*(pl+p->or)+i;
+const uint8_t *q;
+unsigned v,a;
+uint32_t c;
+
+    if( cm == 8 || cm == 10 )
+        bits = 4;
+    q = (const uint8_t *) (uintptr_t) p->mar+pos*bits/8;
+    switch( cm ) {
+    case 0:                             // ARGB8888
+        c = q[0]|(q[1]<<8)|(q[2]<<16)|((uint32_t) q[3]<<24);
+        break;
+    case 1:                             // RGB888
+        c = 0xFF000000|q[0]|(q[1]<<8)|(q[2]<<16);
+        break;
+    case 2:                             // RGB565
+        v = q[0]|(q[1]<<8);
+        c = 0xFF000000|(expand(v>>11,5)<<16)|(expand((v>>5)&0x3F,6)<<8)|expand(v&0x1F,5);
+        break;
+    case 3:                             // ARGB1555
+        v = q[0]|(q[1]<<8);
+        c = ((v&0x8000) ? 0xFF000000 : 0)|(expand((v>>10)&0x1F,5)<<16)
+           |(expand((v>>5)&0x1F,5)<<8)|expand(v&0x1F,5);
+        break;
+    case 4:                             // ARGB4444
+        v = q[0]|(q[1]<<8);
+        c = ((uint32_t) expand(v>>12,4)<<24)|(expand((v>>8)&0xF,4)<<16)
+           |(expand((v>>4)&0xF,4)<<8)|expand(v&0xF,4);
+        break;
+    case 5:                             // L8
+        c = p->clut[q[0]];
+        break;
+    case 6:                             // AL44
+        c = ((uint32_t) expand(q[0]>>4,4)<<24)|(p->clut[q[0]&0xF]&0xFFFFFF);
+        break;
+    case 7:                             // AL88
+        c = ((uint32_t) q[1]<<24)|(p->clut[q[0]]&0xFFFFFF);
+        break;
+    case 8:                             // L4
+        c = p->clut[(pos&1) ? q[0]>>4 : q[0]&0xF];
+        break;
+    case 9:                             // A8
+        c = ((uint32_t) q[0]<<24)|(p->colr&0xFFFFFF);
+        break;
+    default:                            // A4
+        v = (pos&1) ? q[0]>>4 : q[0]&0xF;
+        c = ((uint32_t) expand(v,4)<<24)|(p->colr&0xFFFFFF);
+        break;
+    }
+
+    a = p->pfccr>>DMA2D_FGPFCCR_ALPHA_Pos;
+    switch( (p->pfccr&DMA2D_FGPFCCR_AM)>>DMA2D_FGPFCCR_AM_Pos ) {
+    case 1:
+        c = (c&0xFFFFFF)|((uint32_t) a<<24);
+        break;
+    case 2:
+        c = (c&0xFFFFFF)|((uint32_t) ((c>>24)*a/255)<<24);
+        break;
+    }
+    return c;
+}
+
+/**
+ * @brief   Blend ARGB8888 colors
+ */
+static uint32_t
+blend(uint32_t fg, uint32_t bg) {
+unsigned af = fg>>24, ab = bg>>24;
+unsigned am, ao, k;
+uint32_t c;
+
+    am = af*ab/255;
+    ao = af+ab-am;
+    if( ao == 0 )
+        return 0;
+    c = (uint32_t) ao<<24;
+    for(k=0;k<24;k+=8)
+        c |= (((fg>>k)&0xFF)*af+((bg>>k)&0xFF)*(ab-am))/ao<<k;
+    return c;
+}
+
+/**
+ * @brief   Write ARGB8888 color c in output format cm
+ */
+static void
+writepixel(uint8_t *q, unsigned cm, uint32_t c) {
+unsigned a = c>>24, r = (c>>16)&0xFF, g = (c>>8)&0xFF, b = c&0xFF;
+unsigned v;
+
+    switch( cm ) {
+    case 0:
+        q[3] = a;
+        /* FALLTHRU */
+    case 1:
+        q[0] = b;
+        q[1] = g;
+        q[2] = r;
+        return;
+    case 2:
+        v = ((r>>3)<<11)|((g>>2)<<5)|(b>>3);
+        break;
+    case 3:
+        v = ((a>>7)<<15)|((r>>3)<<10)|((g>>3)<<5)|(b>>3);
+        break;
+    default:
+        v = ((a>>4)<<12)|((r>>4)<<8)|((g>>4)<<4)|(b>>4);
+        break;
+    }
+    q[0] = v;
+    q[1] = v>>8;
+}
+
+/**
+ * @brief   Estimate the cycles of a transfer
+ */
+static void
+addtime(unsigned mode, unsigned pl, unsigned nl) {
+const DMA2DModel_Timing *t = &DMA2DModel_TimingParameters;
+unsigned fgbits, bgbits, obits;
+uint64_t words;
+
+    fgbits = 8*pixelsize[DMA2D->FGPFCCR&DMA2D_FGPFCCR_CM];
+    if( (DMA2D->FGPFCCR&DMA2D_FGPFCCR_CM) == 8 || (DMA2D->FGPFCCR&DMA2D_FGPFCCR_CM) == 10 )
+        fgbits = 4;
+    bgbits = 8*pixelsize[DMA2D->BGPFCCR&DMA2D_BGPFCCR_CM];
+    obits  = mode == 0 ? fgbits : 8*pixelsize[DMA2D->OPFCCR&DMA2D_OPFCCR_CM];
+
+    words = (uint64_t) nl*((pl*obits+31)/32)*t->writecycles;
+    if( mode != 3 )
+        words += (uint64_t) nl*((pl*fgbits+31)/32)*t->readcycles;
+    if( mode == 2 )
+        words += (uint64_t) nl*((pl*bgbits+31)/32)*t->readcycles;
+    DMA2DModel_Cycles += words+(uint64_t) nl*t->linecycles
+                        +(mode >= 1 && mode <= 2 ? (uint64_t) nl*pl*t->pixelcycles : 0);
+    DMA2DModel_DWT.CYCCNT = (uint32_t) DMA2DModel_Cycles;
+}
+
+/**
+ * @brief   Run the transfer in the registers
+ *
+ * @return  0 if OK, -1 if configuration error
+ */
+static int
+transfer(void) {
+unsigned pl = (DMA2D->NLR&DMA2D_NLR_PL)>>DMA2D_NLR_PL_Pos;
+unsigned nl = (DMA2D->NLR&DMA2D_NLR_NL)>>DMA2D_NLR_NL_Pos;
+unsigned mode = (DMA2D->CR&DMA2D_CR_MODE)>>DMA2D_CR_MODE_Pos;
+unsigned ocm = DMA2D->OPFCCR&DMA2D_OPFCCR_CM;
+unsigned fcm = DMA2D->FGPFCCR&DMA2D_FGPFCCR_CM;
+unsigned bcm = DMA2D->BGPFCCR&DMA2D_BGPFCCR_CM;
+Port fg = { DMA2D->FGMAR, DMA2D->FGOR, DMA2D->FGPFCCR, DMA2D->FGCOLR, DMA2D->FGCLUT };
+Port bg = { DMA2D->BGMAR, DMA2D->BGOR, DMA2D->BGPFCCR, DMA2D->BGCOLR, DMA2D->BGCLUT };
+unsigned ops,ips;
+uint8_t *out,*in;
+uint8_t color[4];
+uint32_t c;
+unsigned i,j;
+
+    if( pl == 0 || nl == 0 )
+        return -1;
+    if( mode != 0 && ocm > 4 )
+        return -1;
+    if( mode != 3 && fcm > 10 )
+        return -1;
+    if( mode == 0 && (fcm == 8 || fcm == 10) )
+        return -1;
+    if( mode == 2 && bcm > 10 )
+        return -1;
+
+    out = (uint8_t *) (uintptr_t) DMA2D->OMAR;
+    ops = pixelsize[ocm];
+    switch( mode ) {
+    case 3:                             // Register to memory
+        for(i=0;i<4;i++)
+            color[i] = DMA2D->OCOLR>>(8*i);
+        for(j=0;j<nl;j++) {
+            for(i=0;i<pl;i++) {
+                memcpy(out,color,ops);
+                out += ops;
+            }
+            out += DMA2D->OOR*ops;
+        }
+        break;
+    case 0:                             // Memory to memory
+        ips = pixelsize[fcm];
+        in  = (uint8_t *) (uintptr_t) DMA2D->FGMAR;
+        for(j=0;j<nl;j++) {
+            memmove(out,in,pl*ips);
+            out += (pl+DMA2D->OOR)*ips;
+            in  += (pl+DMA2D->FGOR)*ips;
+        }
+        break;
+    case 1:                             // Memory to memory with PFC
+    case 2:                             // Memory to memory with blending
+        for(j=0;j<nl;j++) {
+            for(i=0;i<pl;i++) {
+                c = readpixel(&fg,pl,i,j);
+                if( mode == 2 )
+                    c = blend(c,readpixel(&bg,pl,i,j));
+                writepixel(out,ocm,c);
+                out += ops;
+            }
+            out += DMA2D->OOR*ops;
+        }
+        break;
+    }
+    addtime(mode,pl,nl);
+    return 0;
+}
+
+/**
+ * @brief   DMA2DModel_Reset
+ *
+ * @note    Clears registers, log and core state
+ */
+void
+DMA2DModel_Reset(void) {
+
+    memset((void *) &DMA2DModel_Registers,0,sizeof(DMA2DModel_Registers));
+    DMA2DModel_RCC.AHB1ENR = 0;
+    DMA2DModel_LogCount = 0;
+    DMA2DModel_Cycles   = 0;
+    DMA2DModel_DWT.CYCCNT = 0;
+    primask = 0;
+    ipsr    = 0;
+    enabled = 0;
+}
+
+/**
+ * @brief   DMA2DModel_Step
+ *
+ * @note    Runs the CLUT loading or the transfer started (if not suspended), or aborts
+ *          it, and then delivers the interrupt
+ *
+ * @return  1 if a transfer was run, 0 otherwise (also after a CLUT loading)
+ */
+int
+DMA2DModel_Step(void) {
+int rc = 0;
+
+    clearflags();
+    if( DMA2D->CR&DMA2D_CR_ABORT ) {
+        DMA2D->CR &= ~(DMA2D_CR_START|DMA2D_CR_ABORT);
+        DMA2D->FGPFCCR &= ~DMA2D_FGPFCCR_START;
+        DMA2D->BGPFCCR &= ~DMA2D_BGPFCCR_START;
+    } else if( DMA2D->FGPFCCR&DMA2D_FGPFCCR_START ) {
+        if( RCC->AHB1ENR&RCC_AHB1ENR_DMA2DEN ) {
+            loadclut(DMA2D->FGCLUT,DMA2D->FGCMAR,DMA2D->FGPFCCR);
+            DMA2D->FGPFCCR &= ~DMA2D_FGPFCCR_START;
+            DMA2D->ISR |= DMA2D_ISR_CTCIF;
+        }
+    } else if( DMA2D->BGPFCCR&DMA2D_BGPFCCR_START ) {
+        if( RCC->AHB1ENR&RCC_AHB1ENR_DMA2DEN ) {
+            loadclut(DMA2D->BGCLUT,DMA2D->BGCMAR,DMA2D->BGPFCCR);
+            DMA2D->BGPFCCR &= ~DMA2D_BGPFCCR_START;
+            DMA2D->ISR |= DMA2D_ISR_CTCIF;
+        }
+    } else if( (DMA2D->CR&(DMA2D_CR_START|DMA2D_CR_SUSP)) == DMA2D_CR_START ) {
+        if( RCC->AHB1ENR&RCC_AHB1ENR_DMA2DEN ) {
+            record();
+            if( transfer() < 0 )
+                DMA2D->ISR |= DMA2D_ISR_CEIF;
+            else
+                DMA2D->ISR |= DMA2D_ISR_TCIF;
+            DMA2D->CR &= ~DMA2D_CR_START;
+            rc = 1;
+        }
+    }
+    deliver();
+    return rc;
+}
+
+/**
+ * @brief   Core functions
+ */
+///@{
+uint32_t __get_IPSR(void)           { return ipsr; }
+uint32_t __get_PRIMASK(void)        { return primask; }
+void __set_PRIMASK(uint32_t m)      { primask = m&1; deliver(); }
+void __disable_irq(void)            { primask = 1; }
+void __enable_irq(void)             { primask = 0; deliver(); }
+void __NOP(void)                    { DMA2DModel_Step(); }
+
+void NVIC_EnableIRQ(IRQn_Type irqn) {
+    if( irqn == DMA2D_IRQn ) {
+        enabled = 1;
+        deliver();
+    }
+}
+void NVIC_DisableIRQ(IRQn_Type irqn) {
+    if( irqn == DMA2D_IRQn )
+        enabled = 0;
+}
+void NVIC_ClearPendingIRQ(IRQn_Type irqn)           { (void) irqn; }
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t p)   { (void) irqn; (void) p; }
+///@}
@@ -0,0 +1,63 @@
+#ifndef DMA2DMODEL_H
+#define DMA2DMODEL_H
+/**
+ * @file    dma2dmodel.h
+ *
+ * @note    Model of the DMA2D to run dma2d.c on a host
+ *
+ * @note    Registers are plain variables, so the model acts only when called: each call
+ *          of DMA2DModel_Step (or __NOP) runs the transfer started, sets the flags and
+ *          calls DMA2D_IRQHandler when the interrupt is enabled and not masked. The
+ *          register values of every transfer run are recorded in a log.
+ *
+ * @note    Addresses in the registers are 32 bits, so the memory used must be in the
+ *          first 4 GB of the host address space (e.g. mmap with MAP_32BIT).
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "stm32f746xx.h"
+
+#ifndef DMA2DMODEL_LOGSIZE
+#define DMA2DMODEL_LOGSIZE      256
+#endif
+
+/**
+ * @brief   Registers of a transfer when it was run
+ */
+typedef struct {
+    uint32_t    cr;
+    uint32_t    fgmar,fgor,fgpfccr,fgcolr;
+    uint32_t    bgmar,bgor,bgpfccr,bgcolr;
+    uint32_t    omar,oor,opfccr,ocolr;
+    uint32_t    nlr;
+} DMA2DModel_Transfer;
+
+/**
+ * @brief   Parameters of the time estimate
+ *
+ * @note    Cycles of a transfer = words read * readcycles + words written * writecycles
+ *          + lines * linecycles + pixels * pixelcycles (PFC and blending only). Words
+ *          are counted per line. The defaults are a guess for SDRAM; they should be
+ *          adjusted with measurements on the board.
+ */
+typedef struct {
+    unsigned    readcycles;             ///< AHB cycles per word read
+    unsigned    writecycles;            ///< AHB cycles per word written
+    unsigned    linecycles;             ///< Overhead per line
+    unsigned    pixelcycles;            ///< Pipeline cycles per pixel (PFC, blending)
+} DMA2DModel_Timing;
+
+extern DMA2DModel_Timing DMA2DModel_TimingParameters;
+extern uint64_t DMA2DModel_Cycles;
+
+extern DMA2DModel_Transfer DMA2DModel_Log[DMA2DMODEL_LOGSIZE];
+extern int DMA2DModel_LogCount;
+
+void DMA2DModel_Reset(void);
+int  DMA2DModel_Step(void);
+
+void DMA2D_IRQHandler(void);
+
+#endif
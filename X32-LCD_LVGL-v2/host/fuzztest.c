@@ -0,0 +1,200 @@
+/**
+ * @file    fuzztest.c
+ *
+ * @note    Host check of dma2d.c against the CPU reference (dma2dref.c) using the DMA2D
+ *          model
+ *
+ * @note    Does random fills, copies, conversions and blendings, with random formats,
+ *          regions, colors, CLUTs and alpha, using the DMA2D functions and the reference
+ *          ones, and compares the whole memory written. At the end, prints the cycles
+ *          per pixel estimated by the model for each operation.
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -Wall -Ihost -I. -o fuzztest host/fuzztest.c host/dma2dmodel.c \
+ *                  dma2d.c dma2dref.c
+ *              ./fuzztest [iterations [seed]]
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "stm32f746xx.h"
+#include "dma2dmodel.h"
+#include "dma2d.h"
+#include "dma2dref.h"
+
+#define BUFSIZE     (64*64*4)
+
+/**
+ * @brief   Buffers (in the first 4 GB, for 32-bit addresses)
+ */
+///@{
+static uint8_t  *fgbuf, *bgbuf, *outbuf, *refbuf;
+static uint32_t *clut;
+///@}
+
+static const unsigned bits[] = { 32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4 };
+
+static const char *opnames[] = { "fill", "copy", "convert", "blend" };
+
+/**
+ * @brief   Statistics for time estimates
+ */
+///@{
+static uint64_t opcycles[4];
+static uint64_t oppixels[4];
+///@}
+
+/**
+ * @brief   Random region in buffer with format f
+ */
+static DMA2DRegion randomregion(uint8_t *buf, unsigned f) {
+DMA2DRegion r;
+unsigned b = bits[f];
+unsigned n;
+
+    r.pixelformat = f;
+    r.w = 1+rand()%64;
+    n   = r.w+rand()%(64-r.w+1);            // pixels per line
+    if( b == 4 )
+        n = (n+1)&~1U;
+    r.linesize = n*b/8;
+    r.x = rand()%(n-r.w+1);
+    if( b == 4 )
+        r.x &= ~1U;
+    r.h = 1+rand()%16;
+    r.y = rand()%(BUFSIZE/r.linesize-r.h+1);
+    r.address = (unsigned long) buf;
+    return r;
+}
+
+/**
+ * @brief   Same region in another buffer
+ */
+static DMA2DRegion moveregion(const DMA2DRegion *r, uint8_t *buf) {
+DMA2DRegion m = *r;
+
+    m.address = (unsigned long) buf;
+    return m;
+}
+
+static void randomfill(uint8_t *p, int n) {
+
+    while( n-- > 0 )
+        *p++ = rand();
+}
+
+int main(int argc, char *argv[]) {
+int iterations = argc > 1 ? atoi(argv[1]) : 5000;
+unsigned seed  = argc > 2 ? (unsigned) atoi(argv[2]) : 1;
+DMA2DRegion dst,ref,src,bg,refbg;
+unsigned op,of,sf,bf,color,alpha,n;
+uint64_t c0;
+int it,rc,fence,same;
+uint8_t *mem;
+
+    mem = mmap(0,4*BUFSIZE+1024,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_32BIT,-1,0);
+    if( mem == MAP_FAILED ) {
+        perror("mmap");
+        return 1;
+    }
+    fgbuf  = mem;
+    bgbuf  = mem+BUFSIZE;
+    outbuf = mem+2*BUFSIZE;
+    refbuf = mem+3*BUFSIZE;
+    clut   = (uint32_t *) (mem+4*BUFSIZE);
+
+    srand(seed);
+    DMA2DModel_Reset();
+    DMA2D_Init();
+
+    for(it=0;it<iterations;it++) {
+        randomfill(fgbuf,BUFSIZE);
+        randomfill(bgbuf,BUFSIZE);
+        randomfill(outbuf,BUFSIZE);
+        memcpy(refbuf,outbuf,BUFSIZE);
+        randomfill((uint8_t *) clut,1024);
+
+        op    = rand()%4;
+        of    = rand()%5;
+        color = (unsigned) rand()^((unsigned) rand()<<16);
+        alpha = rand()%3 == 0 ? 255 : rand()%256;
+        dst   = randomregion(outbuf,of);
+        ref   = moveregion(&dst,refbuf);
+        sf    = of;
+        bf    = 0;
+        n     = 256;
+        same  = 0;
+        c0    = DMA2DModel_Cycles;
+        switch( op ) {
+        case 0:
+            color &= bits[of] == 32 ? 0xFFFFFFFF : (1U<<bits[of])-1;
+            fence = DMA2D_SubmitFill(&dst,color,0,0);
+            rc    = DMA2DRef_FillRegion(&ref,color);
+            break;
+        case 1:
+            sf    = rand()%10;
+            if( sf == DMA2D_L4 )
+                sf = DMA2D_A8;
+            of    = sf;
+            dst   = randomregion(outbuf,of);
+            ref   = moveregion(&dst,refbuf);
+            src   = randomregion(fgbuf,sf);
+            fence = DMA2D_SubmitCopy(&dst,&src,0,0);
+            rc    = DMA2DRef_CopyRegion(&ref,&src);
+            break;
+        case 2:
+            sf    = rand()%9;
+            n     = sf == DMA2D_L4 || sf == DMA2D_AL44 ? 16 : 256;
+            src   = randomregion(fgbuf,sf);
+            fence = DMA2D_SubmitConvert(&dst,&src,clut,n,0,0);
+            rc    = DMA2DRef_ConvertRegion(&ref,&src,clut,n);
+            break;
+        default:
+            sf    = rand()%7;
+            if( sf == 5 )
+                sf = DMA2D_A8;
+            else if( sf == 6 )
+                sf = DMA2D_A4;
+            bf    = rand()%5;
+            src   = randomregion(fgbuf,sf);
+            same  = rand()%4 == 0;
+            if( same ) {
+                bg    = dst;
+                refbg = ref;
+            } else {
+                bg    = randomregion(bgbuf,bf);
+                refbg = bg;
+            }
+            fence = DMA2D_SubmitBlend(&dst,&src,&bg,color,alpha,0,0);
+            rc    = DMA2DRef_BlendRegion(&ref,&src,&refbg,color,alpha);
+            break;
+        }
+
+        if( fence == 0 || rc < 0 ) {
+            printf("%d: %s not done (fence %u, reference %d)\n",it,opnames[op],fence,rc);
+            return 1;
+        }
+        DMA2D_WaitIdle();
+        if( memcmp(outbuf,refbuf,BUFSIZE) != 0 ) {
+            printf("%d: %s differs: output %u, source %u, background %u%s, alpha %u\n",
+                    it,opnames[op],of,sf,bf,same?" (same as output)":"",alpha);
+            printf("    dst x=%u y=%u w=%u h=%u ls=%u\n",dst.x,dst.y,dst.w,dst.h,dst.linesize);
+            return 1;
+        }
+        opcycles[op] += DMA2DModel_Cycles-c0;
+        oppixels[op] += (DMA2DModel_Log[DMA2DModel_LogCount-1].nlr>>16)
+                        *(DMA2DModel_Log[DMA2DModel_LogCount-1].nlr&0xFFFF);
+        DMA2DModel_LogCount = 0;
+    }
+
+    printf("%d operations OK\n",iterations);
+    printf("Estimated cycles per pixel:");
+    for(op=0;op<4;op++)
+        printf(" %s %.2f",opnames[op],oppixels[op] ? (double) opcycles[op]/oppixels[op] : 0.0);
+    putchar('\n');
+    return 0;
+}
@@ -0,0 +1,342 @@
+/**
+ * @file    memtest.c
+ *
+ * @note    Host check of the buddy allocator (buddy.c) and of the LVGL memory pools
+ *          (lvmem.c)
+ *
+ * @note    First, random allocations and frees with Buddy_Alloc and Buddy_Free. Every
+ *          block is filled with a pattern, that is verified when it is freed, so a block
+ *          handed out twice is found. At the end, everything is freed and the whole pool
+ *          must be allocated again as one block.
+ *
+ * @note    Then, random LVMem_Alloc, LVMem_Free and LVMem_Realloc with the same content
+ *          verification. The statistics of each pool (used, reserved, blocks, fallbacks
+ *          and failures) are compared with the ones computed here after each operation.
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -Wall -fsanitize=address,undefined -I. -o memtest host/memtest.c \
+ *                  buddy.c lvmem.c
+ *              ./memtest [iterations [seed]]
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "buddy.h"
+#include "lvmem.h"
+
+/**
+ * @brief   Pool of the buddy allocator (in place of the SDRAM)
+ */
+///@{
+#define POOLSIZE        (8*1024*1024)
+#define MAXBLOCKS       512
+///@}
+
+/**
+ * @brief   Blocks in use
+ */
+typedef struct {
+    uint8_t    *p;
+    unsigned    size;
+    unsigned    blocksize;          ///< lvmem: bytes reserved (kept by realloc in place)
+    uint8_t     pattern;
+} Block;
+
+static Block blocks[MAXBLOCKS];
+static int   nblocks = 0;
+
+static char *poolarea;
+
+/**
+ * @brief   Statistics expected for each pool
+ */
+static LVMem_Stats expected[2];
+
+static void fill(const Block *b) {
+unsigned i;
+
+    for(i=0;i<b->size;i++)
+        b->p[i] = b->pattern+i;
+}
+
+static int verify(const Block *b, unsigned size) {
+unsigned i;
+
+    for(i=0;i<size;i++) {
+        if( b->p[i] != (uint8_t) (b->pattern+i) )
+            return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Power of 2 not less than size and minsize
+ */
+static unsigned roundup(unsigned size, unsigned minsize) {
+unsigned bs = minsize;
+
+    while( bs < size )
+        bs <<= 1;
+    return bs;
+}
+
+/**
+ * @brief   Random size, mostly small (as LVGL), some large
+ */
+static unsigned randomsize(void) {
+int r = rand()%100;
+
+    if( r < 80 )
+        return 1+rand()%256;
+    if( r < 95 )
+        return 1+rand()%LVMEM_LARGE;
+    return 1+rand()%(256*1024);
+}
+
+/**
+ * @brief   Random alloc/free with the buddy allocator
+ */
+static int buddytest(int iterations) {
+int it,i;
+Block *b;
+void *p;
+
+    Buddy_Init(poolarea,POOLSIZE,LVMEM_SDRAMMINBLOCK);
+    nblocks = 0;
+    for(it=0;it<iterations;it++) {
+        if( nblocks < MAXBLOCKS && (nblocks == 0 || rand()%2) ) {
+            b = &blocks[nblocks];
+            b->size    = randomsize();
+            b->pattern = rand();
+            b->p       = Buddy_Alloc(b->size);
+            if( !b->p )
+                continue;
+            if( (char *) b->p < poolarea || (char *) b->p+b->size > poolarea+POOLSIZE ) {
+                printf("buddy %d: block outside the pool\n",it);
+                return 1;
+            }
+            fill(b);
+            nblocks++;
+        } else {
+            i = rand()%nblocks;
+            b = &blocks[i];
+            if( verify(b,b->size) ) {
+                printf("buddy %d: block of %u bytes overwritten\n",it,b->size);
+                return 1;
+            }
+            Buddy_Free(b->p);
+            *b = blocks[--nblocks];
+        }
+    }
+    for(i=0;i<nblocks;i++) {
+        if( verify(&blocks[i],blocks[i].size) ) {
+            printf("buddy: block of %u bytes overwritten\n",blocks[i].size);
+            return 1;
+        }
+        Buddy_Free(blocks[i].p);
+    }
+    nblocks = 0;
+
+    p = Buddy_Alloc(POOLSIZE);
+    if( p != poolarea ) {
+        printf("buddy: the whole pool cannot be allocated after freeing everything\n");
+        return 1;
+    }
+    Buddy_Free(p);
+    printf("buddy: %d operations OK\n",iterations);
+    return 0;
+}
+
+/**
+ * @brief   Pool of a block given by LVMem_Alloc
+ */
+static int poolof(const void *p) {
+
+    if( (const char *) p >= poolarea && (const char *) p < poolarea+POOLSIZE )
+        return LVMEM_SDRAM;
+    return LVMEM_SRAM;
+}
+
+/**
+ * @brief   Bytes reserved by a block of size bytes in the pool
+ */
+static unsigned reserved(int pool, unsigned size) {
+
+    if( pool == LVMEM_SRAM )
+        return roundup(size+8,16);
+    return roundup(size+8,LVMEM_SDRAMMINBLOCK);
+}
+
+static void countalloc(Block *b) {
+LVMem_Stats *s = &expected[poolof(b->p)];
+
+    b->blocksize = reserved(poolof(b->p),b->size);
+    s->used     += b->size;
+    s->reserved += b->blocksize;
+    s->blocks++;
+    s->allocs++;
+    if( b->size <= LVMEM_LARGE && poolof(b->p) == LVMEM_SDRAM )
+        expected[LVMEM_SRAM].fallbacks++;
+}
+
+static void countfree(const Block *b) {
+LVMem_Stats *s = &expected[poolof(b->p)];
+
+    s->used     -= b->size;
+    s->reserved -= b->blocksize;
+    s->blocks--;
+}
+
+/**
+ * @brief   Compare the statistics of both pools with the expected ones
+ */
+static int checkstats(int it, const char *op) {
+LVMem_Stats s;
+int pool;
+
+    for(pool=LVMEM_SRAM;pool<=LVMEM_SDRAM;pool++) {
+        LVMem_GetStats(pool,&s);
+        if( s.used != expected[pool].used || s.reserved != expected[pool].reserved
+         || s.blocks != expected[pool].blocks || s.allocs != expected[pool].allocs
+         || s.fallbacks != expected[pool].fallbacks
+         || s.failures != expected[pool].failures ) {
+            printf("lvmem %d: %s: pool %d used %u/%u reserved %u/%u blocks %u/%u allocs %u/%u "
+                   "fallbacks %u/%u failures %u/%u\n",it,op,pool,
+                   (unsigned) s.used,(unsigned) expected[pool].used,
+                   (unsigned) s.reserved,(unsigned) expected[pool].reserved,
+                   (unsigned) s.blocks,(unsigned) expected[pool].blocks,
+                   (unsigned) s.allocs,(unsigned) expected[pool].allocs,
+                   (unsigned) s.fallbacks,(unsigned) expected[pool].fallbacks,
+                   (unsigned) s.failures,(unsigned) expected[pool].failures);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Random alloc, free and realloc with lvmem
+ *
+ * @note    The number of blocks grows until the SRAM pool is exhausted, so the
+ *          fallback to SDRAM is used too.
+ */
+static int lvmemtest(int iterations) {
+int it,i,op,pool,inplace;
+unsigned size,oldsize;
+Block *b;
+uint8_t *p;
+
+    Buddy_Init(poolarea,POOLSIZE,LVMEM_SDRAMMINBLOCK);
+    nblocks = 0;
+    for(it=0;it<iterations;it++) {
+        op = rand()%10;
+        if( nblocks == 0 || (op < 4 && nblocks < MAXBLOCKS) ) {
+            b = &blocks[nblocks];
+            b->size    = randomsize();
+            b->pattern = rand();
+            b->p       = LVMem_Alloc(b->size);
+            if( !b->p ) {
+                expected[b->size <= LVMEM_LARGE ? LVMEM_SRAM : LVMEM_SDRAM].failures++;
+                if( checkstats(it,"alloc failed") )
+                    return 1;
+                continue;
+            }
+            if( (uintptr_t) b->p%8 ) {
+                printf("lvmem %d: block not aligned\n",it);
+                return 1;
+            }
+            fill(b);
+            countalloc(b);
+            nblocks++;
+            if( checkstats(it,"alloc") )
+                return 1;
+        } else if( op < 7 ) {
+            i = rand()%nblocks;
+            b = &blocks[i];
+            if( verify(b,b->size) ) {
+                printf("lvmem %d: block of %u bytes overwritten\n",it,b->size);
+                return 1;
+            }
+            LVMem_Free(b->p);
+            countfree(b);
+            *b = blocks[--nblocks];
+            if( checkstats(it,"free") )
+                return 1;
+        } else {
+            i = rand()%nblocks;
+            b = &blocks[i];
+            oldsize = b->size;
+            size = op == 7 ? 1+rand()%oldsize : randomsize();
+            pool = size <= LVMEM_LARGE ? LVMEM_SRAM : LVMEM_SDRAM;
+            inplace = poolof(b->p) == pool && size+8 <= b->blocksize;
+            p = LVMem_Realloc(b->p,size);
+            if( !p ) {
+                expected[pool].failures++;
+                if( checkstats(it,"realloc failed") )
+                    return 1;
+                continue;
+            }
+            if( inplace && p != b->p ) {
+                printf("lvmem %d: block of %u bytes moved by realloc to %u bytes\n",
+                        it,oldsize,size);
+                return 1;
+            }
+            countfree(b);
+            b->p    = p;
+            b->size = size;
+            if( verify(b,size < oldsize ? size : oldsize) ) {
+                printf("lvmem %d: data lost by realloc from %u to %u bytes\n",it,oldsize,size);
+                return 1;
+            }
+            fill(b);
+            if( inplace ) {
+                // same block: only the bytes used change
+                expected[pool].used     += size;
+                expected[pool].reserved += b->blocksize;
+                expected[pool].blocks++;
+            } else {
+                countalloc(b);
+            }
+            if( checkstats(it,inplace ? "realloc in place" : "realloc") )
+                return 1;
+        }
+    }
+    for(i=0;i<nblocks;i++) {
+        if( verify(&blocks[i],blocks[i].size) ) {
+            printf("lvmem: block of %u bytes overwritten\n",blocks[i].size);
+            return 1;
+        }
+        LVMem_Free(blocks[i].p);
+        countfree(&blocks[i]);
+    }
+    nblocks = 0;
+    if( checkstats(iterations,"free all") )
+        return 1;
+    printf("lvmem: %d operations OK (%u fallbacks to SDRAM)\n",iterations,
+            (unsigned) expected[LVMEM_SRAM].fallbacks);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+int iterations = 200000;
+unsigned seed = 1;
+
+    if( argc > 1 )
+        iterations = atoi(argv[1]);
+    if( argc > 2 )
+        seed = atoi(argv[2]);
+    srand(seed);
+
+    poolarea = aligned_alloc(POOLSIZE,POOLSIZE);
+    if( !poolarea ) {
+        printf("No memory for the pool\n");
+        return 1;
+    }
+    if( buddytest(iterations) || lvmemtest(iterations) )
+        return 1;
+    free(poolarea);
+    return 0;
+}
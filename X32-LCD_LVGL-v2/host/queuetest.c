@@ -0,0 +1,264 @@
+/**
+ * @file    queuetest.c
+ *
+ * @note    Host check of the DMA2D job queue (dma2d.c) using the register model
+ *
+ * @note    Checks that jobs run one at a time in the order submitted, that callbacks
+ *          are called in the same order, fences, chaining from callbacks, a full queue,
+ *          masked interrupts, abort and CLUT loading before a conversion.
+ *
+ * @note    Build and run (in the directory above)
+ *              gcc -Wall -Ihost -I. -o queuetest host/queuetest.c host/dma2dmodel.c dma2d.c
+ *              ./queuetest
+ *
+ * @author  Hans
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "stm32f746xx.h"
+#include "dma2dmodel.h"
+#include "dma2d.h"
+
+#define W       64
+#define H       32
+#define LS      (W*2)
+
+static int errors = 0;
+
+#define CHECK(C) do { if( !(C) ) { printf("%s:%d: %s\n",__FILE__,__LINE__,#C); errors++; } } while(0)
+
+/**
+ * @brief   Callback log
+ */
+///@{
+static int calls[64];
+static int statuses[64];
+static int ncalls = 0;
+///@}
+
+static uint8_t *mem;
+static uint32_t *clut;                  ///< In mem, to have a 32-bit address
+
+static void callback(void *ctx, int status) {
+
+    if( ncalls < 64 ) {
+        calls[ncalls]    = (int) (intptr_t) ctx;
+        statuses[ncalls] = status;
+        ncalls++;
+    }
+}
+
+/**
+ * @brief   Region of buffer n (RGB565, W x H)
+ */
+static DMA2DRegion region(int n) {
+DMA2DRegion r = { (unsigned long) (mem+n*LS*H), 0, 0, W, H, DMA2D_RGB565, LS };
+
+    return r;
+}
+
+/**
+ * @brief   Callback that submits two more jobs (ids 100 and 101)
+ */
+static unsigned chained[2];
+static void chain(void *ctx, int status) {
+DMA2DRegion r = region(0);
+
+    callback(ctx,status);
+    chained[0] = DMA2D_SubmitFill(&r,0x100,callback,(void *) 100);
+    chained[1] = DMA2D_SubmitFill(&r,0x101,callback,(void *) 101);
+}
+
+static void reset(void) {
+
+    DMA2DModel_LogCount = 0;
+    ncalls = 0;
+}
+
+int main(void) {
+DMA2DRegion r0,r1,r2,r3,bad;
+unsigned f[DMA2D_QUEUESIZE+4];
+uint16_t *p;
+int i;
+
+    mem = mmap(0,4*LS*H+64,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_32BIT,-1,0);
+    if( mem == MAP_FAILED ) {
+        perror("mmap");
+        return 1;
+    }
+    clut = (uint32_t *) (mem+4*LS*H);
+    DMA2DModel_Reset();
+    DMA2D_Init();
+    r0 = region(0);
+    r1 = region(1);
+    r2 = region(2);
+    r3 = region(3);
+
+    /* First job starts at once, the others wait */
+    reset();
+    f[0] = DMA2D_SubmitFill(&r0,0x1234,callback,(void *) 1);
+    f[1] = DMA2D_SubmitCopy(&r1,&r0,callback,(void *) 2);
+    f[2] = DMA2D_SubmitBlend(&r2,&r1,&r3,0,255,callback,(void *) 3);
+    CHECK(f[0] != 0 && f[1] == f[0]+1 && f[2] == f[1]+1);
+    CHECK(DMA2D->CR&DMA2D_CR_START);
+    CHECK(DMA2D->OMAR == (uint32_t) r0.address);
+    CHECK(!DMA2D_IsDone(f[0]) && !DMA2D_IsReady());
+    CHECK(DMA2D_GetFence() == f[2]);
+
+    /* Each step ends one job and starts the next */
+    CHECK(DMA2DModel_Step() == 1);
+    CHECK(DMA2D_IsDone(f[0]) && !DMA2D_IsDone(f[1]));
+    CHECK(ncalls == 1 && DMA2D->OMAR == (uint32_t) r1.address);
+    CHECK(DMA2D_Wait(f[2]) == 0);
+    CHECK(DMA2D_IsReady());
+    CHECK(DMA2DModel_LogCount == 3);
+    CHECK(DMA2DModel_Log[0].omar == (uint32_t) r0.address
+        && (DMA2DModel_Log[0].cr&DMA2D_CR_MODE) == DMA2D_CR_MODE);
+    CHECK(DMA2DModel_Log[1].omar == (uint32_t) r1.address
+        && (DMA2DModel_Log[1].cr&DMA2D_CR_MODE) == 0);
+    CHECK(DMA2DModel_Log[2].omar == (uint32_t) r2.address
+        && (DMA2DModel_Log[2].cr&DMA2D_CR_MODE) == DMA2D_CR_MODE_1);
+    CHECK(DMA2DModel_Log[0].nlr == ((W<<16)|H) && DMA2DModel_Log[0].oor == 0);
+    CHECK(ncalls == 3);
+    CHECK(DMA2D_GetBusyCycles() == (uint32_t) DMA2DModel_Cycles && DMA2DModel_Cycles > 0);
+    for(i=0;i<3;i++)
+        CHECK(calls[i] == i+1 && statuses[i] == DMA2D_DONE);
+    p = (uint16_t *) (uintptr_t) r1.address;
+    for(i=0;i<W*H;i++)
+        CHECK(p[i] == 0x1234);
+
+    /* Subregion: position and offset */
+    reset();
+    bad = r0;
+    bad.x = 3;
+    bad.y = 5;
+    bad.w = 10;
+    bad.h = 2;
+    DMA2D_FillRegion(&bad,0xABCD);
+    DMA2D_WaitIdle();
+    CHECK(DMA2DModel_Log[0].omar == (uint32_t) r0.address+5*LS+3*2);
+    CHECK(DMA2DModel_Log[0].oor == W-10 && DMA2DModel_Log[0].nlr == ((10<<16)|2));
+    p = (uint16_t *) (uintptr_t) r0.address;
+    CHECK(p[5*W+2] == 0x1234 && p[5*W+3] == 0xABCD && p[6*W+12] == 0xABCD);
+    CHECK(p[6*W+13] == 0x1234 && p[7*W+3] == 0x1234);
+
+    /* Invalid regions are not queued */
+    bad = r0;
+    bad.w = 0;
+    CHECK(DMA2D_SubmitFill(&bad,0,0,0) == 0);
+    bad = r0;
+    bad.pixelformat = DMA2D_L8;
+    CHECK(DMA2D_SubmitFill(&bad,0,0,0) == 0);
+    CHECK(DMA2D_SubmitCopy(&r0,&bad,0,0) == 0);
+    CHECK(DMA2D_Wait(DMA2D_GetFence()+1) == -1);
+
+    /* Jobs submitted by a callback go after the ones already queued */
+    reset();
+    f[0] = DMA2D_SubmitFill(&r0,1,chain,(void *) 1);
+    f[1] = DMA2D_SubmitFill(&r0,2,callback,(void *) 2);
+    DMA2D_WaitIdle();
+    CHECK(chained[0] == f[1]+1 && chained[1] == f[1]+2);
+    CHECK(DMA2DModel_LogCount == 4 && ncalls == 4);
+    CHECK(calls[0] == 1 && calls[1] == 2 && calls[2] == 100 && calls[3] == 101);
+    for(i=0;i<4;i++)
+        CHECK(DMA2DModel_Log[i].ocolr == (unsigned) (i<2 ? i+1 : 0x100+i-2));
+
+    /* Full queue: a callback can not wait, the main program does */
+    reset();
+    f[0] = DMA2D_SubmitFill(&r0,0,chain,(void *) 1);
+    for(i=1;i<DMA2D_QUEUESIZE;i++)
+        f[i] = DMA2D_SubmitFill(&r0,i,callback,(void *) (intptr_t) (i+1));
+    CHECK(DMA2DModel_LogCount == 0);
+    f[i] = DMA2D_SubmitFill(&r0,i,callback,(void *) (intptr_t) (i+1));
+    CHECK(DMA2DModel_LogCount == 2);
+    CHECK(chained[0] == f[i-1]+1 && chained[1] == 0 && f[i] == chained[0]+1);
+    DMA2D_WaitIdle();
+    CHECK(DMA2DModel_LogCount == DMA2D_QUEUESIZE+2);
+    for(i=0;i<DMA2D_QUEUESIZE;i++)
+        CHECK(calls[i] == i+1);
+    CHECK(calls[i] == 100 && calls[i+1] == i+1);
+
+    /* Masked interrupts delay the callbacks */
+    reset();
+    __disable_irq();
+    f[0] = DMA2D_SubmitFill(&r0,0,callback,(void *) 1);
+    f[1] = DMA2D_SubmitFill(&r0,0,callback,(void *) 2);
+    DMA2DModel_Step();
+    DMA2DModel_Step();
+    CHECK(DMA2DModel_LogCount == 1 && ncalls == 0 && !DMA2D_IsDone(f[0]));
+    __enable_irq();
+    CHECK(ncalls == 1 && DMA2D_IsDone(f[0]));
+    DMA2D_WaitIdle();
+    CHECK(ncalls == 2 && DMA2DModel_LogCount == 2);
+
+    /* Abort ends all jobs queued */
+    reset();
+    f[0] = DMA2D_SubmitFill(&r0,0,callback,(void *) 1);
+    f[1] = DMA2D_SubmitFill(&r0,0,callback,(void *) 2);
+    f[2] = DMA2D_SubmitFill(&r0,0,chain,(void *) 3);
+    DMA2D_Abort();
+    CHECK(DMA2DModel_LogCount == 0);
+    CHECK(DMA2D_IsDone(f[2]) && ncalls == 3);
+    for(i=0;i<3;i++)
+        CHECK(calls[i] == i+1 && statuses[i] == DMA2D_ABORTED);
+    CHECK(chained[0] == f[2]+1 && chained[1] == f[2]+2);
+    CHECK(!(DMA2D->CR&(DMA2D_CR_ABORT|DMA2D_CR_SUSP)) && (DMA2D->CR&DMA2D_CR_START));
+    DMA2D_WaitIdle();
+    CHECK(DMA2DModel_LogCount == 2 && ncalls == 5 && calls[3] == 100 && calls[4] == 101);
+
+    /* A conversion from L8 loads the CLUT first */
+    reset();
+    for(i=0;i<16;i++)
+        clut[i] = 0xFF000000|(i*0x111111);
+    bad = r0;
+    bad.pixelformat = DMA2D_L8;
+    bad.linesize    = W;
+    f[0] = DMA2D_SubmitFill(&r1,0,callback,(void *) 1);
+    f[1] = DMA2D_SubmitConvert(&r2,&bad,clut,16,callback,(void *) 2);
+    f[2] = DMA2D_SubmitConvert(&r2,&bad,0,16,callback,(void *) 3);
+    CHECK(f[1] != 0 && f[2] == 0);
+    CHECK(DMA2D_SubmitConvert(&bad,&r1,0,0,0,0) == 0);
+    DMA2DModel_Step();
+    CHECK(DMA2DModel_LogCount == 1 && (DMA2D->FGPFCCR&DMA2D_FGPFCCR_START));
+    CHECK(DMA2DModel_Step() == 0 && DMA2D->FGCLUT[15] == clut[15] && ncalls == 1);
+    CHECK(DMA2D->CR&DMA2D_CR_START);
+    DMA2D_WaitIdle();
+    CHECK(DMA2DModel_LogCount == 2 && ncalls == 2 && statuses[1] == DMA2D_DONE);
+    CHECK((DMA2DModel_Log[1].cr&DMA2D_CR_MODE) == DMA2D_CR_MODE_0);
+    CHECK(DMA2DModel_Log[1].fgpfccr == ((15<<8)|DMA2D_L8));
+    CHECK(DMA2DModel_Log[1].fgor == 0 && DMA2DModel_Log[1].oor == 0);
+
+    /* Blend of a A8 foreground with color and constant alpha */
+    reset();
+    bad = r0;
+    bad.pixelformat = DMA2D_A8;
+    bad.linesize    = W;
+    bad.w           = W/2;
+    CHECK(DMA2D_SubmitBlend(&r2,&bad,&r3,0x123456,256,0,0) == 0);
+    CHECK(DMA2D_SubmitBlend(&r2,&r3,&bad,0,255,0,0) == 0);
+    DMA2D_BlendRegion(&r2,&bad,&r3,0xAB123456,128);
+    DMA2D_WaitIdle();
+    CHECK(DMA2DModel_LogCount == 1);
+    CHECK(DMA2DModel_Log[0].fgpfccr == (0x80020000|DMA2D_A8));
+    CHECK(DMA2DModel_Log[0].fgcolr == 0x123456);
+    CHECK(DMA2DModel_Log[0].nlr == (((W/2)<<16)|H));
+    CHECK(DMA2DModel_Log[0].fgor == W/2 && DMA2DModel_Log[0].bgor == W/2
+        && DMA2DModel_Log[0].oor == W/2);
+
+    /* Configuration error is reported to the callback */
+    reset();
+    f[0] = DMA2D_SubmitFill(&r0,0,callback,(void *) 1);
+    DMA2D->NLR = 0;
+    DMA2D_Wait(f[0]);
+    CHECK(ncalls == 1 && statuses[0] == DMA2D_ERROR);
+
+    if( errors ) {
+        printf("%d errors\n",errors);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
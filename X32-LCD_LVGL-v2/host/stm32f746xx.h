@@ -0,0 +1,147 @@
+#ifndef STM32F746XX_H
+#define STM32F746XX_H
+/**
+ * @file    stm32f746xx.h
+ *
+ * @note    Replacement of the CMSIS device header to compile dma2d.c on a host
+ *
+ * @note    Only the DMA2D and what it uses are defined. The registers are variables of
+ *          the DMA2D model (dma2dmodel.c), that also emulates the core functions used
+ *          (interrupt masking, NVIC). __NOP lets the model run, so the waiting loops of
+ *          the driver make progress.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+
+#define __IO    volatile
+
+typedef enum {
+    DMA2D_IRQn          = 90
+} IRQn_Type;
+
+/**
+ * @brief   Registers (same layout as the device)
+ */
+typedef struct {
+    __IO uint32_t   CR;                 ///< 0x00 Control
+    __IO uint32_t   ISR;                ///< 0x04 Interrupt status
+    __IO uint32_t   IFCR;               ///< 0x08 Interrupt flag clear
+    __IO uint32_t   FGMAR;              ///< 0x0C Foreground memory address
+    __IO uint32_t   FGOR;               ///< 0x10 Foreground offset
+    __IO uint32_t   BGMAR;              ///< 0x14 Background memory address
+    __IO uint32_t   BGOR;               ///< 0x18 Background offset
+    __IO uint32_t   FGPFCCR;            ///< 0x1C Foreground PFC control
+    __IO uint32_t   FGCOLR;             ///< 0x20 Foreground color
+    __IO uint32_t   BGPFCCR;            ///< 0x24 Background PFC control
+    __IO uint32_t   BGCOLR;             ///< 0x28 Background color
+    __IO uint32_t   FGCMAR;             ///< 0x2C Foreground CLUT memory address
+    __IO uint32_t   BGCMAR;             ///< 0x30 Background CLUT memory address
+    __IO uint32_t   OPFCCR;             ///< 0x34 Output PFC control
+    __IO uint32_t   OCOLR;              ///< 0x38 Output color
+    __IO uint32_t   OMAR;               ///< 0x3C Output memory address
+    __IO uint32_t   OOR;                ///< 0x40 Output offset
+    __IO uint32_t   NLR;                ///< 0x44 Number of lines
+    __IO uint32_t   LWR;                ///< 0x48 Line watermark
+    __IO uint32_t   AMTCR;              ///< 0x4C AHB master timer configuration
+    uint32_t        RESERVED[236];
+    __IO uint32_t   FGCLUT[256];        ///< 0x400 Foreground CLUT
+    __IO uint32_t   BGCLUT[256];        ///< 0x800 Background CLUT
+} DMA2D_TypeDef;
+
+typedef struct {
+    __IO uint32_t   AHB1ENR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t   CYCCNT;             ///< DMA2DModel_Cycles (truncated)
+} DWT_Type;
+
+extern DMA2D_TypeDef DMA2DModel_Registers;
+extern RCC_TypeDef   DMA2DModel_RCC;
+extern DWT_Type      DMA2DModel_DWT;
+
+#define DMA2D                   (&DMA2DModel_Registers)
+#define RCC                     (&DMA2DModel_RCC)
+#define DWT                     (&DMA2DModel_DWT)
+
+#define RCC_AHB1ENR_DMA2DEN     (1UL<<23)
+
+/**
+ * @brief   Register fields
+ */
+///@{
+#define DMA2D_CR_START          (1UL<<0)
+#define DMA2D_CR_SUSP           (1UL<<1)
+#define DMA2D_CR_ABORT          (1UL<<2)
+#define DMA2D_CR_TEIE           (1UL<<8)
+#define DMA2D_CR_TCIE           (1UL<<9)
+#define DMA2D_CR_TWIE           (1UL<<10)
+#define DMA2D_CR_CAEIE          (1UL<<11)
+#define DMA2D_CR_CTCIE          (1UL<<12)
+#define DMA2D_CR_CEIE           (1UL<<13)
+#define DMA2D_CR_MODE_Pos       (16)
+#define DMA2D_CR_MODE           (3UL<<16)
+#define DMA2D_CR_MODE_0         (1UL<<16)
+#define DMA2D_CR_MODE_1         (2UL<<16)
+
+#define DMA2D_ISR_TEIF          (1UL<<0)
+#define DMA2D_ISR_TCIF          (1UL<<1)
+#define DMA2D_ISR_TWIF          (1UL<<2)
+#define DMA2D_ISR_CAEIF         (1UL<<3)
+#define DMA2D_ISR_CTCIF         (1UL<<4)
+#define DMA2D_ISR_CEIF          (1UL<<5)
+
+#define DMA2D_IFCR_CTEIF        (1UL<<0)
+#define DMA2D_IFCR_CTCIF        (1UL<<1)
+#define DMA2D_IFCR_CTWIF        (1UL<<2)
+#define DMA2D_IFCR_CAECIF       (1UL<<3)
+#define DMA2D_IFCR_CCTCIF       (1UL<<4)
+#define DMA2D_IFCR_CCEIF        (1UL<<5)
+
+#define DMA2D_FGPFCCR_CM        (0xFUL<<0)
+#define DMA2D_FGPFCCR_CCM       (1UL<<4)
+#define DMA2D_FGPFCCR_START     (1UL<<5)
+#define DMA2D_FGPFCCR_CS_Pos    (8)
+#define DMA2D_FGPFCCR_CS        (0xFFUL<<8)
+#define DMA2D_FGPFCCR_AM_Pos    (16)
+#define DMA2D_FGPFCCR_AM        (3UL<<16)
+#define DMA2D_FGPFCCR_ALPHA_Pos (24)
+#define DMA2D_FGPFCCR_ALPHA     (0xFFUL<<24)
+
+#define DMA2D_BGPFCCR_CM        (0xFUL<<0)
+#define DMA2D_BGPFCCR_CCM       (1UL<<4)
+#define DMA2D_BGPFCCR_START     (1UL<<5)
+#define DMA2D_BGPFCCR_CS_Pos    (8)
+#define DMA2D_BGPFCCR_CS        (0xFFUL<<8)
+#define DMA2D_BGPFCCR_AM_Pos    (16)
+#define DMA2D_BGPFCCR_AM        (3UL<<16)
+#define DMA2D_BGPFCCR_ALPHA_Pos (24)
+#define DMA2D_BGPFCCR_ALPHA     (0xFFUL<<24)
+
+#define DMA2D_OPFCCR_CM         (7UL<<0)
+
+#define DMA2D_NLR_NL_Pos        (0)
+#define DMA2D_NLR_NL            (0xFFFFUL<<0)
+#define DMA2D_NLR_PL_Pos        (16)
+#define DMA2D_NLR_PL            (0x3FFFUL<<16)
+///@}
+
+/**
+ * @brief   Core functions (emulated by the model)
+ */
+///@{
+uint32_t __get_IPSR(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+void     __disable_irq(void);
+void     __enable_irq(void);
+void     __NOP(void);
+void     NVIC_EnableIRQ(IRQn_Type irqn);
+void     NVIC_DisableIRQ(IRQn_Type irqn);
+void     NVIC_ClearPendingIRQ(IRQn_Type irqn);
+void     NVIC_SetPriority(IRQn_Type irqn, uint32_t priority);
+///@}
+
+#endif
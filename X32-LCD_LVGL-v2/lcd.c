@@ -785,6 +785,12 @@ void LCD_Init(void) {
     /* Enable interrupts */
     //LTDC->IER  |= (LTDC_IER_RRIE|LTDC_IER_TERRIE|LTDC_IER_FUIE|LTDC_IER_LIE);
 
+    /* Count FIFO underruns (see LCD_GetUnderruns) */
+    LTDC->ICR  = LTDC_ICR_CFUIF|LTDC_ICR_CTERRIF;
+    LTDC->IER |= LTDC_IER_FUIE|LTDC_IER_TERRIE;
+    NVIC_SetPriority(LTDC_ER_IRQn,LCD_ERRINTLEVEL);
+    NVIC_ClearPendingIRQ(LTDC_ER_IRQn);
+    NVIC_EnableIRQ(LTDC_ER_IRQn);
 
     LCD_PutDisplayOperation();
     LCD_TurnBacklightOn();
@@ -792,6 +798,47 @@ void LCD_Init(void) {
 }
 
 
+/**
+ * @brief   LTDC errors
+ *
+ * @note    A FIFO underrun happens when the LTDC cannot read the frame buffer fast
+ *          enough, usually because the DMA2D or the CPU keep the SDRAM busy. The
+ *          line is shown with the background color.
+ */
+///@{
+static volatile uint32_t underruns = 0;
+static volatile uint32_t transfererrors = 0;
+///@}
+
+/**
+ * @brief   LTDC error interrupt handler
+ */
+void LCD_TFT_ER_IRQHandler(void) {
+uint32_t isr = LTDC->ISR;
+
+    if( isr&LTDC_ISR_FUIF )
+        underruns++;
+    if( isr&LTDC_ISR_TERRIF )
+        transfererrors++;
+    LTDC->ICR = LTDC_ICR_CFUIF|LTDC_ICR_CTERRIF;
+}
+
+
+/**
+ * @brief   LCD_GetUnderruns
+ *
+ * @note    Number of FIFO underruns (and transfer errors, in *terr when not null) since
+ *          LCD_Init. The counters are never cleared.
+ */
+uint32_t
+LCD_GetUnderruns(uint32_t *terr) {
+
+    if( terr )
+        *terr = transfererrors;
+    return underruns;
+}
+
+
 /*
  * @brief   LCD Set Background Color
  */
@@ -18,9 +18,21 @@
  * @note    The 8 low order bits are 0 (Why?)
  */
 #define RGB(R,G,B)      ((uint32_t)((0L)|((R)<<16|((G)<<8)|((B)<<0))))
-#define RGB565(R,G,B)   ((uint16_t)((0L)|(((R)&0x1F)<<11)|(((G)&0x3F)<<5)|((((B)&0x1F)<<0)))
-#define RGB555(R,G,B)   ((uint16_t)((0L)|(((R)&0x1F)<<10)|(((G)&x01F)<<5)|((((B)&0x1F)<<0))))
-#define RGBA(R,G,B)     ((uint32_t)(((A)<<24)|((R)<<16|((G)<<8)|((B)<<0))))
+#define RGBA(R,G,B,A)   ((uint32_t)(((A)<<24)|((R)<<16|((G)<<8)|((B)<<0))))
+
+/**
+ * @brief   Create a color in the 16-bit formats
+ *
+ * @note    R, G and B are 8-bit values (0-255). Low order bits are discarded
+ */
+///@{
+#define RGB565(R,G,B)  ( (((uint16_t)((R)&0xF8))<<8)    \
+                        |(((uint16_t)((G)&0xFC))<<3)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+#define RGB555(R,G,B)  ( (((uint16_t)((R)&0xF8))<<7)    \
+                        |(((uint16_t)((G)&0xF8))<<2)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+///@}
 
 /*
  * @brief   LCD Set Pixel Format
@@ -42,6 +54,13 @@
 #define LCD_DH          272
 ///@}
 
+/**
+ * @brief   Priority of the LTDC error interrupt (counts FIFO underruns)
+ */
+#ifndef LCD_ERRINTLEVEL
+#define LCD_ERRINTLEVEL 7
+#endif
+
 typedef struct {
     uint8_t     B;
     uint8_t     G;
@@ -50,6 +69,7 @@ typedef struct {
 
 
 void  LCD_Init(void);
+uint32_t LCD_GetUnderruns(uint32_t *terr);
 
 void  LCD_TurnBacklightOn(void);
 void  LCD_TurnBacklightOff(void);
@@ -0,0 +1,102 @@
+/**
+ * @file lv_conf.h
+ * Configuration file for LVGL v8.3
+ *
+ * Only the settings that differ from the defaults in lv_conf_internal.h are here.
+ * It is found because LV_CONF_INCLUDE_SIMPLE is defined in the Makefile.
+ */
+
+/* clang-format off */
+#if 1 /*Set it to "1" to enable content*/
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+/*====================
+   COLOR SETTINGS
+ *====================*/
+
+/*Render in RGB565. The DMA2D converts it when flushing to a layer in another format*/
+#define LV_COLOR_DEPTH 16
+
+/*Do not swap the bytes: the DMA2D and the LTDC use little endian RGB565*/
+#define LV_COLOR_16_SWAP 0
+
+/*=========================
+   MEMORY SETTINGS
+ *=========================*/
+
+/*Use the SRAM and SDRAM pools of lvmem.c (SDRAM must be initialized before lv_init)*/
+#define LV_MEM_CUSTOM 1
+#if LV_MEM_CUSTOM
+    #define LV_MEM_CUSTOM_INCLUDE "lvmem.h"
+    #define LV_MEM_CUSTOM_ALLOC   LVMem_Alloc
+    #define LV_MEM_CUSTOM_FREE    LVMem_Free
+    #define LV_MEM_CUSTOM_REALLOC LVMem_Realloc
+#endif
+
+/*====================
+   HAL SETTINGS
+ *====================*/
+
+/*Default display refresh period. The benchmark measures the maximal frame rate anyway*/
+#define LV_DISP_DEF_REFR_PERIOD 10      /*[ms]*/
+
+/*The tick is incremented by lv_tick_inc() in the SysTick interrupt (see lvport.c)*/
+#define LV_TICK_CUSTOM 0
+
+/*=======================
+ * FEATURE CONFIGURATION
+ *=======================*/
+
+/*Log the benchmark results using printf (UART)*/
+#define LV_USE_LOG 1
+#if LV_USE_LOG
+    #define LV_LOG_LEVEL LV_LOG_LEVEL_USER
+    #define LV_LOG_PRINTF 1
+#endif
+
+/*Show CPU usage and FPS count (replaced by the overlay of lvprof.c)*/
+#define LV_USE_PERF_MONITOR 0
+#if LV_USE_PERF_MONITOR
+    #define LV_USE_PERF_MONITOR_POS LV_ALIGN_BOTTOM_RIGHT
+#endif
+
+/*Keep up to 8 decoded images (in SDRAM, see lvimage.c) open*/
+#define LV_IMG_CACHE_DEF_SIZE 8
+
+/*Halt on failed asserts*/
+#define LV_ASSERT_HANDLER while(1);
+
+/*==================
+ *   FONT USAGE
+ *===================*/
+
+/*Fonts used by the benchmark*/
+#define LV_FONT_MONTSERRAT_12 1
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_16 1
+#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_24 1
+#define LV_FONT_MONTSERRAT_28 1
+
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+/*===================
+ * DEMO USAGE
+ ====================*/
+
+/*Benchmark your system*/
+#define LV_USE_DEMO_BENCHMARK 1
+#if LV_USE_DEMO_BENCHMARK
+    /*Use RGB565A8 images with 16 bit color depth instead of ARGB8565*/
+    #define LV_DEMO_BENCHMARK_RGB565A8 0
+#endif
+
+/*--END OF LV_CONF_H--*/
+
+#endif /*LV_CONF_H*/
+
+#endif /*End of "Content enable"*/
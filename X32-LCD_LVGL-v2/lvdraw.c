@@ -0,0 +1,284 @@
+/**
+ * @file    lvdraw.c
+ *
+ * @note    LVGL (v8.3) draw context using the DMA2D
+ *
+ * @note    It is the software draw context with the blend function replaced. The
+ *          DMA2D does, on RGB565 buffers and with normal blending:
+ *
+ *          Operation                     | DMA2D job
+ *          ------------------------------|------------------------------------------
+ *          Opaque fill                   | Fill (register to memory)
+ *          Fill with mask (glyphs, AA)   | Blend of the mask as A8 with the color
+ *          Opaque image blit             | Copy
+ *          Image blit with opacity       | Blend with constant alpha
+ *
+ *          Everything else (small areas, translucent fills without mask, images with
+ *          mask, other blend modes, layers with alpha) is drawn by the CPU.
+ *
+ * @note    Fills are not waited for: the next ones are queued behind them. Jobs
+ *          reading a source or a mask are waited for, because LVGL reuses these
+ *          buffers as soon as blend returns. Before the CPU draws (or LVGL flushes),
+ *          all pending jobs are waited for.
+ *
+ * @note    The buffers can be in the cached SRAM. Before a job, the lines of the
+ *          destination are cleaned and invalidated and the ones of the sources are
+ *          cleaned. After waiting, the lines written by the DMA2D are invalidated.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f746xx.h"
+#include "lvgl.h"
+#include "dma2d.h"
+#include "lvdraw.h"
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "lvdraw needs LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 0"
+#endif
+
+/**
+ * @brief   Functions of the software context
+ */
+///@{
+static void (*swblend)(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+static void (*swimgdecoded)(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc,
+                            const lv_area_t *coords, const uint8_t *map_p,
+                            lv_img_cf_t color_format);
+static void (*swbuffercopy)(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                            const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                            const lv_area_t *src_area);
+static void (*swwait)(lv_draw_ctx_t *draw_ctx);
+///@}
+
+/**
+ * @brief   State
+ */
+///@{
+static int          enabled = 1;            ///< Use the DMA2D
+static unsigned     pending = 0;            ///< Fence of the last job not waited for
+static uint32_t     writtenstart;           ///< Memory written by the pending jobs
+static uint32_t     writtenend;
+static LVDraw_Stats stats;
+///@}
+
+/**
+ * @brief   Get the memory range (aligned to cache lines) used by a region
+ *
+ * @note    bytes is the pixel size
+ */
+static void getrange(const DMA2DRegion *r, unsigned bytes, uint32_t *start, uint32_t *end) {
+uint32_t first = r->address+r->y*r->linesize+r->x*bytes;
+
+    *start = first&~31U;
+    *end   = (first+(r->h-1)*r->linesize+r->w*bytes+31U)&~31U;
+}
+
+/**
+ * @brief   Prepare the cache for a job
+ *
+ * @note    dst is RGB565. src can be RGB565 (bytes=2), A8 (bytes=1) or null
+ */
+static void prepare(const DMA2DRegion *dst, const DMA2DRegion *src, unsigned bytes) {
+uint32_t start,end;
+
+    if( src ) {
+        getrange(src,bytes,&start,&end);
+        SCB_CleanDCache_by_Addr((uint32_t *) start,(int32_t) (end-start));
+    }
+    getrange(dst,2,&start,&end);
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *) start,(int32_t) (end-start));
+    if( pending == 0 ) {
+        writtenstart = start;
+        writtenend   = end;
+    } else {
+        if( start < writtenstart )
+            writtenstart = start;
+        if( end > writtenend )
+            writtenend = end;
+    }
+}
+
+/**
+ * @brief   Wait for the pending jobs
+ *
+ * @note    The lines written are invalidated, because the CPU can have read them
+ *          (speculatively, or data near them) while the DMA2D was writing
+ */
+static void sync(void) {
+
+    if( pending == 0 )
+        return;
+    DMA2D_Wait(pending);
+    SCB_InvalidateDCache_by_Addr((uint32_t *) writtenstart,(int32_t) (writtenend-writtenstart));
+    pending = 0;
+}
+
+/**
+ * @brief   Blend done by the CPU
+ */
+static void software(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+
+    sync();
+    stats.software++;
+    swblend(draw_ctx,dsc);
+}
+
+/**
+ * @brief   Blend function of the context
+ *
+ * @note    The destination buffer has draw_ctx->buf_area size. The source has the
+ *          size of blend_area and the mask the size of mask_area. Only their
+ *          intersection with the clipping area is drawn.
+ */
+static void blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+const lv_opa_t *mask;
+const lv_area_t *buf_area = draw_ctx->buf_area;
+lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+lv_area_t a;
+unsigned w,h,fence;
+
+    mask = (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) ? 0 : dsc->mask_buf;
+
+    if( !enabled || disp->driver->screen_transp || disp->driver->set_px_cb
+     || dsc->blend_mode != LV_BLEND_MODE_NORMAL
+     || (mask && dsc->src_buf) || (!mask && !dsc->src_buf && dsc->opa < LV_OPA_MAX)
+     || !_lv_area_intersect(&a,dsc->blend_area,draw_ctx->clip_area)
+     || lv_area_get_size(&a) < LVDRAW_MINPIXELS ) {
+        software(draw_ctx,dsc);
+        return;
+    }
+
+    w = lv_area_get_width(&a);
+    h = lv_area_get_height(&a);
+    DECLARE_REGION(dst,draw_ctx->buf,a.x1-buf_area->x1,a.y1-buf_area->y1,w,h,DMA2D_RGB565,
+                   lv_area_get_width(buf_area)*sizeof(lv_color_t));
+
+    if( mask ) {
+        DECLARE_REGION(m,mask,a.x1-dsc->mask_area->x1,a.y1-dsc->mask_area->y1,w,h,DMA2D_A8,
+                       lv_area_get_width(dsc->mask_area));
+        prepare(&dst,&m,1);
+        fence = DMA2D_SubmitBlend(&dst,&m,&dst,lv_color_to32(dsc->color)&0xFFFFFF,
+                                  dsc->opa >= LV_OPA_MAX ? 255 : dsc->opa,0,0);
+        stats.masked++;
+    } else if( dsc->src_buf ) {
+        DECLARE_REGION(src,dsc->src_buf,a.x1-dsc->blend_area->x1,a.y1-dsc->blend_area->y1,
+                       w,h,DMA2D_RGB565,lv_area_get_width(dsc->blend_area)*sizeof(lv_color_t));
+        prepare(&dst,&src,2);
+        if( dsc->opa >= LV_OPA_MAX ) {
+            fence = DMA2D_SubmitCopy(&dst,&src,0,0);
+            stats.copies++;
+        } else {
+            fence = DMA2D_SubmitBlend(&dst,&src,&dst,0,dsc->opa,0,0);
+            stats.blends++;
+        }
+    } else {
+        prepare(&dst,0,0);
+        fence = DMA2D_SubmitFill(&dst,dsc->color.full,0,0);
+        stats.fills++;
+    }
+
+    if( fence == 0 ) {
+        /* Rejected (should not happen) */
+        software(draw_ctx,dsc);
+        return;
+    }
+    pending = fence;
+    stats.pixels += w*h;
+
+    /* LVGL reuses source and mask buffers when blend returns */
+    if( mask || dsc->src_buf )
+        sync();
+}
+
+/**
+ * @brief   Image drawing (software) after waiting for the DMA2D
+ *
+ * @note    The image can be a layer drawn by the DMA2D
+ */
+static void imgdecoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc,
+                       const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t color_format) {
+
+    sync();
+    swimgdecoded(draw_ctx,draw_dsc,coords,map_p,color_format);
+}
+
+/**
+ * @brief   Buffer copy (software) after waiting for the DMA2D
+ */
+static void buffercopy(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                       const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                       const lv_area_t *src_area) {
+
+    sync();
+    swbuffercopy(draw_ctx,dest_buf,dest_stride,dest_area,src_buf,src_stride,src_area);
+}
+
+/**
+ * @brief   Called by LVGL before flushing and before reading the buffer
+ */
+static void waitforfinish(lv_draw_ctx_t *draw_ctx) {
+
+    sync();
+    if( swwait )
+        swwait(draw_ctx);
+}
+
+/**
+ * @brief   LVDraw_InitContext
+ *
+ * @note    Set as draw_ctx_init of the display driver, with draw_ctx_size set to
+ *          sizeof(LVDraw_Context)
+ */
+void
+LVDraw_InitContext(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+LVDraw_Context *ctx = (LVDraw_Context *) draw_ctx;
+
+    lv_draw_sw_init_ctx(drv,draw_ctx);
+
+    swblend      = ctx->blend;
+    swimgdecoded = ctx->base_draw.draw_img_decoded;
+    swbuffercopy = ctx->base_draw.buffer_copy;
+    swwait       = ctx->base_draw.wait_for_finish;
+
+    ctx->blend                      = blend;
+    ctx->base_draw.draw_img_decoded = imgdecoded;
+    ctx->base_draw.buffer_copy      = buffercopy;
+    ctx->base_draw.wait_for_finish  = waitforfinish;
+}
+
+/**
+ * @brief   LVDraw_DeinitContext
+ */
+void
+LVDraw_DeinitContext(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+
+    sync();
+    lv_draw_sw_deinit_ctx(drv,draw_ctx);
+}
+
+/**
+ * @brief   LVDraw_Enable
+ *
+ * @note    With on = 0, everything is drawn by the CPU (to compare)
+ */
+void
+LVDraw_Enable(int on) {
+
+    sync();
+    enabled = on;
+}
+
+/**
+ * @brief   LVDraw_GetStats
+ *
+ * @note    Copies the statistics collected since the last call and clears them
+ */
+void
+LVDraw_GetStats(LVDraw_Stats *s) {
+
+    *s = stats;
+    memset(&stats,0,sizeof(stats));
+}
@@ -0,0 +1,46 @@
+#ifndef LVDRAW_H
+#define LVDRAW_H
+/**
+ * @file    lvdraw.h
+ *
+ * @note    LVGL (v8.3) draw context that uses the DMA2D for fills, image blits and
+ *          masked fills (anti-aliased glyphs) and the software renderer for the rest
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/**
+ * @brief   Areas smaller than this (in pixels) are drawn by the CPU
+ *
+ * @note    For them, programming and waiting for the DMA2D takes longer than drawing
+ */
+#ifndef LVDRAW_MINPIXELS
+#define LVDRAW_MINPIXELS        240
+#endif
+
+/**
+ * @brief   Draw context (it is the software one with some functions replaced)
+ */
+typedef lv_draw_sw_ctx_t LVDraw_Context;
+
+/**
+ * @brief   Statistics
+ */
+typedef struct {
+    uint32_t    fills;              ///< Opaque fills done by the DMA2D
+    uint32_t    masked;             ///< Masked fills (glyphs) done by the DMA2D
+    uint32_t    copies;             ///< Opaque blits done by the DMA2D
+    uint32_t    blends;             ///< Blits with opacity done by the DMA2D
+    uint32_t    software;           ///< Blends done by the CPU
+    uint32_t    pixels;             ///< Pixels done by the DMA2D
+} LVDraw_Stats;
+
+void LVDraw_InitContext(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+void LVDraw_DeinitContext(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+void LVDraw_Enable(int on);
+void LVDraw_GetStats(LVDraw_Stats *s);
+
+#endif
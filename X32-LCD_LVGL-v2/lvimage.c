@@ -0,0 +1,197 @@
+/**
+ * @file    lvimage.c
+ *
+ * @note    LVGL (v8.3) decoder for RLE compressed images
+ *
+ * @note    The format is the RLE of the 24-LCD project with RGB565 pixels. Little endian
+ *          header:
+ *
+ *          Offset | Size | Contents
+ *          -------|------|----------------------------------
+ *             0   |  4   | "RLE1"
+ *             4   |  2   | Width
+ *             6   |  2   | Height
+ *             8   |  1   | Format (2 = RGB565)
+ *             9   |  3   | 0
+ *
+ *          followed by packets. The control byte c has in bit 7 the type and in bits
+ *          6-0 the count n-1. When bit 7 is 1, the next pixel is repeated n times,
+ *          otherwise n pixels follow. Packets can cross rows.
+ *
+ * @note    The image is decoded at once into a buffer from lv_mem_alloc (that, being
+ *          large, is in SDRAM). The LVGL image cache keeps it open, so it is decoded
+ *          again only after it leaves the cache.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "lvgl.h"
+#include "bench.h"
+#include "lvimage.h"
+
+/**
+ * @brief   Header
+ */
+///@{
+#define HEADERSIZE              12
+#define FORMAT_RGB565           2
+///@}
+
+/**
+ * @brief   Statistics
+ */
+static LVImage_Stats stats;
+
+/**
+ * @brief   Get the RLE data of a source, or 0 if it is not a RLE image
+ */
+static const uint8_t *getdata(const void *src, unsigned *size) {
+const lv_img_dsc_t *img = (const lv_img_dsc_t *) src;
+
+    if( lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE )
+        return 0;
+    if( img->header.cf != LV_IMG_CF_RAW || img->data_size < HEADERSIZE )
+        return 0;
+    if( memcmp(img->data,"RLE1",4) != 0 || img->data[8] != FORMAT_RGB565 )
+        return 0;
+    *size = img->data_size;
+    return img->data;
+}
+
+/**
+ * @brief   Decode RLE data into n pixels
+ *
+ * @return  0 if OK, -1 if the data ended too soon
+ */
+static int decode(const uint8_t *p, const uint8_t *end, uint16_t *pixels, unsigned n) {
+unsigned cnt,i;
+uint16_t c;
+
+    while( n > 0 ) {
+        if( p >= end )
+            return -1;
+        cnt = (*p&0x7F)+1;
+        if( cnt > n )
+            cnt = n;
+        if( *p++&0x80 ) {
+            if( p+2 > end )
+                return -1;
+            c = p[0]|(p[1]<<8);
+            p += 2;
+            for(i=0;i<cnt;i++)
+                *pixels++ = c;
+        } else {
+            if( p+2*cnt > end )
+                return -1;
+            memcpy(pixels,p,2*cnt);
+            pixels += cnt;
+            p      += 2*cnt;
+        }
+        n -= cnt;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Decoder info function
+ */
+static lv_res_t decoderinfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+const uint8_t *d;
+unsigned size;
+
+    d = getdata(src,&size);
+    if( !d )
+        return LV_RES_INV;
+    header->cf          = LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w           = d[4]|(d[5]<<8);
+    header->h           = d[6]|(d[7]<<8);
+    return LV_RES_OK;
+}
+
+/**
+ * @brief   Decoder open function
+ */
+static lv_res_t decoderopen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+const uint8_t *d;
+unsigned size,n;
+uint16_t *pixels;
+uint32_t t0;
+
+    d = getdata(dsc->src,&size);
+    if( !d )
+        return LV_RES_INV;
+
+    t0 = Bench_GetCycles();
+    n = (d[4]|(d[5]<<8))*(d[6]|(d[7]<<8));
+    pixels = lv_mem_alloc(n*sizeof(lv_color_t));
+    if( !pixels )
+        return LV_RES_INV;
+    if( decode(d+HEADERSIZE,d+size,pixels,n) < 0 ) {
+        lv_mem_free(pixels);
+        return LV_RES_INV;
+    }
+    dsc->img_data = (const uint8_t *) pixels;
+    stats.decodes++;
+    stats.decodetime += Bench_CyclesToMicroseconds(Bench_GetCycles()-t0);
+    return LV_RES_OK;
+}
+
+/**
+ * @brief   Decoder close function
+ */
+static void decoderclose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+
+    lv_mem_free((void *) dsc->img_data);
+    dsc->img_data = 0;
+}
+
+/**
+ * @brief   LVImage_Init
+ *
+ * @note    Registers the decoder. Must be called after lv_init.
+ *
+ * @return  0 if OK, -1 if there is no memory
+ */
+int
+LVImage_Init(void) {
+lv_img_decoder_t *dec;
+
+    dec = lv_img_decoder_create();
+    if( !dec )
+        return -1;
+    lv_img_decoder_set_info_cb(dec,decoderinfo);
+    lv_img_decoder_set_open_cb(dec,decoderopen);
+    lv_img_decoder_set_close_cb(dec,decoderclose);
+    return 0;
+}
+
+/**
+ * @brief   LVImage_InitDescriptor
+ *
+ * @note    Initializes an image descriptor for RLE data, to be used with lv_img_set_src
+ */
+void
+LVImage_InitDescriptor(lv_img_dsc_t *dsc, const uint8_t *data, unsigned size) {
+
+    memset(dsc,0,sizeof(*dsc));
+    dsc->header.cf = LV_IMG_CF_RAW;
+    dsc->header.w  = data[4]|(data[5]<<8);
+    dsc->header.h  = data[6]|(data[7]<<8);
+    dsc->data_size = size;
+    dsc->data      = data;
+}
+
+/**
+ * @brief   LVImage_GetStats
+ *
+ * @note    Copies the statistics collected since the last call and clears them
+ */
+void
+LVImage_GetStats(LVImage_Stats *s) {
+
+    *s = stats;
+    memset(&stats,0,sizeof(stats));
+}
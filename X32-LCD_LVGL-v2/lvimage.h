@@ -0,0 +1,26 @@
+#ifndef LVIMAGE_H
+#define LVIMAGE_H
+/**
+ * @file    lvimage.h
+ *
+ * @note    LVGL (v8.3) decoder for RLE compressed images
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/**
+ * @brief   Statistics
+ */
+typedef struct {
+    uint32_t    decodes;            ///< Images decoded
+    uint32_t    decodetime;         ///< Sum of the decoding times (us)
+} LVImage_Stats;
+
+int  LVImage_Init(void);
+void LVImage_InitDescriptor(lv_img_dsc_t *dsc, const uint8_t *data, unsigned size);
+void LVImage_GetStats(LVImage_Stats *s);
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file    lvmem.c
+ *
+ * @note    Memory for LVGL (v8.3) in SRAM and SDRAM pools
+ *
+ * @note    Every block starts with a header of 8 bytes (the size requested and the
+ *          pool/size class), so free and realloc know where it came from.
+ *
+ * @note    The SRAM pool is carved from the top (bump allocation) in blocks of 16, 32,
+ *          ..., 2048 bytes. Freed blocks go into a list for their size and are reused.
+ *          They are not merged, but LVGL allocates the same few sizes again and again.
+ *          Allocation and free take constant time.
+ *
+ * @note    The SDRAM pool is the buddy allocator, that must be initialized (Buddy_Init
+ *          with LVMEM_SDRAMMINBLOCK) before lv_init. Its blocks are powers of 2 and are
+ *          not cached, which is fine for buffers filled by the DMA2D and read once per
+ *          refresh.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "buddy.h"
+#include "lvmem.h"
+
+/**
+ * @brief   Block header
+ */
+typedef struct {
+    uint32_t    size;               ///< Size requested
+    uint16_t    pool;               ///< LVMEM_SRAM or LVMEM_SDRAM
+    uint16_t    sizeclass;          ///< Block size is 16<<sizeclass (SRAM) or
+                                    ///< LVMEM_SDRAMMINBLOCK<<sizeclass (SDRAM)
+} Header;
+
+/**
+ * @brief   Size classes of the SRAM pool
+ */
+///@{
+#define MINBLOCK                16
+#define NCLASSES                8               // 16 to 2048
+///@}
+
+/**
+ * @brief   SRAM pool
+ */
+///@{
+static uint64_t sramarea[LVMEM_SRAMSIZE/sizeof(uint64_t)];
+static unsigned sramtop = 0;                        ///< Bytes carved from sramarea
+static Header  *freelist[NCLASSES];                 ///< Free blocks (next in the data)
+///@}
+
+/**
+ * @brief   Statistics
+ */
+static LVMem_Stats stats[2];
+
+/**
+ * @brief   Size of the block of a header
+ */
+static uint32_t blocksize(const Header *h) {
+
+    if( h->pool == LVMEM_SRAM )
+        return MINBLOCK<<h->sizeclass;
+    return LVMEM_SDRAMMINBLOCK<<h->sizeclass;
+}
+
+/**
+ * @brief   Update the statistics after an allocation
+ */
+static void count(int pool, uint32_t size, uint32_t reserved) {
+LVMem_Stats *s = &stats[pool];
+
+    s->used     += size;
+    s->reserved += reserved;
+    s->blocks++;
+    s->allocs++;
+    if( s->used > s->peak )
+        s->peak = s->used;
+}
+
+/**
+ * @brief   Allocate from the SRAM pool
+ *
+ * @return  header of the block or 0
+ */
+static Header *sramalloc(size_t size) {
+unsigned c = 0, bs = MINBLOCK;
+Header *h;
+
+    while( bs < size+sizeof(Header) ) {
+        bs <<= 1;
+        c++;
+    }
+    if( c >= NCLASSES )
+        return 0;
+
+    h = freelist[c];
+    if( h ) {
+        freelist[c] = *(Header **) (h+1);
+    } else {
+        if( sramtop+bs > sizeof(sramarea) )
+            return 0;
+        h = (Header *) ((char *) sramarea+sramtop);
+        sramtop += bs;
+    }
+    h->size      = size;
+    h->pool      = LVMEM_SRAM;
+    h->sizeclass = c;
+    count(LVMEM_SRAM,size,bs);
+    return h;
+}
+
+/**
+ * @brief   Allocate from the SDRAM pool
+ *
+ * @return  header of the block or 0
+ */
+static Header *sdramalloc(size_t size) {
+unsigned c = 0;
+uint32_t bs = LVMEM_SDRAMMINBLOCK;
+Header *h;
+
+    h = Buddy_Alloc(size+sizeof(Header));
+    if( !h )
+        return 0;
+    while( bs < size+sizeof(Header) ) {
+        bs <<= 1;
+        c++;
+    }
+    h->size      = size;
+    h->pool      = LVMEM_SDRAM;
+    h->sizeclass = c;
+    count(LVMEM_SDRAM,size,bs);
+    return h;
+}
+
+/**
+ * @brief   LVMem_Alloc
+ *
+ * @note    A failure is counted in the pool of the request, only when it returns 0.
+ *          A small request done in SDRAM is counted as a fallback of the SRAM pool.
+ *
+ * @return  pointer aligned to 8 bytes or 0
+ */
+void *
+LVMem_Alloc(size_t size) {
+Header *h = 0;
+int pool;
+
+    if( size == 0 )
+        return 0;
+
+    pool = size <= LVMEM_LARGE ? LVMEM_SRAM : LVMEM_SDRAM;
+    if( pool == LVMEM_SRAM )
+        h = sramalloc(size);
+    if( !h ) {
+        h = sdramalloc(size);
+        if( h && pool == LVMEM_SRAM )
+            stats[LVMEM_SRAM].fallbacks++;
+    }
+    if( !h ) {
+        stats[pool].failures++;
+        return 0;
+    }
+    return h+1;
+}
+
+/**
+ * @brief   LVMem_Free
+ */
+void
+LVMem_Free(void *p) {
+Header *h;
+LVMem_Stats *s;
+
+    if( !p )
+        return;
+
+    h = (Header *) p-1;
+    s = &stats[h->pool];
+    s->used     -= h->size;
+    s->reserved -= blocksize(h);
+    s->blocks--;
+    if( h->pool == LVMEM_SRAM ) {
+        *(Header **) p = freelist[h->sizeclass];
+        freelist[h->sizeclass] = h;
+    } else {
+        Buddy_Free(h);
+    }
+}
+
+/**
+ * @brief   LVMem_Realloc
+ *
+ * @note    The block is kept when the new size fits in it and belongs to the same
+ *          pool. Then only the bytes used change. Otherwise a new block is allocated
+ *          and the data copied.
+ */
+void *
+LVMem_Realloc(void *p, size_t size) {
+Header *h;
+void *q;
+int pool;
+
+    if( !p )
+        return LVMem_Alloc(size);
+    if( size == 0 ) {
+        LVMem_Free(p);
+        return 0;
+    }
+
+    h = (Header *) p-1;
+    pool = size <= LVMEM_LARGE ? LVMEM_SRAM : LVMEM_SDRAM;
+    if( h->pool == pool && size+sizeof(Header) <= blocksize(h) ) {
+        stats[pool].used += size-h->size;
+        if( stats[pool].used > stats[pool].peak )
+            stats[pool].peak = stats[pool].used;
+        h->size = size;
+        return p;
+    }
+
+    q = LVMem_Alloc(size);
+    if( !q )
+        return 0;
+    memcpy(q,p,h->size < size ? h->size : size);
+    LVMem_Free(p);
+    return q;
+}
+
+/**
+ * @brief   LVMem_GetStats
+ */
+void
+LVMem_GetStats(int pool, LVMem_Stats *s) {
+
+    if( pool != LVMEM_SRAM && pool != LVMEM_SDRAM ) {
+        memset(s,0,sizeof(*s));
+        return;
+    }
+    *s = stats[pool];
+    s->free = pool == LVMEM_SRAM ? sizeof(sramarea)-sramtop : 0;
+}
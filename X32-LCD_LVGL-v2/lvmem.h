@@ -0,0 +1,72 @@
+#ifndef LVMEM_H
+#define LVMEM_H
+/**
+ * @file    lvmem.h
+ *
+ * @note    Memory for LVGL (v8.3) in two pools: small objects in internal SRAM and
+ *          large buffers (decoded images, layers) in SDRAM, using the buddy allocator
+ *
+ * @note    It is used through LV_MEM_CUSTOM_ALLOC, LV_MEM_CUSTOM_FREE and
+ *          LV_MEM_CUSTOM_REALLOC in lv_conf.h.
+ *
+ * @author  Hans
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief   Sizes
+ *
+ * @note    Requests up to LVMEM_LARGE bytes are served from a pool of LVMEM_SRAMSIZE
+ *          bytes in .bss, using free lists for power of 2 sizes (16 to LVMEM_LARGE plus
+ *          a header of 8 bytes). Larger requests, and small ones when the SRAM pool is
+ *          exhausted, use Buddy_Alloc (blocks of at least 4 KB in SDRAM).
+ */
+///@{
+#ifndef LVMEM_SRAMSIZE
+#define LVMEM_SRAMSIZE          (48*1024)
+#endif
+#ifndef LVMEM_LARGE
+#define LVMEM_LARGE             2040
+#endif
+///@}
+
+/**
+ * @brief   Minimal block size of the buddy allocator
+ *
+ * @note    Must be the minimal size given to Buddy_Init. It is used to count the bytes
+ *          reserved by SDRAM blocks, that are powers of 2 not less than this.
+ */
+#ifndef LVMEM_SDRAMMINBLOCK
+#define LVMEM_SDRAMMINBLOCK     4096
+#endif
+
+/**
+ * @brief   Pools
+ */
+///@{
+#define LVMEM_SRAM              (0)
+#define LVMEM_SDRAM             (1)
+///@}
+
+/**
+ * @brief   Statistics of a pool
+ */
+typedef struct {
+    uint32_t    used;               ///< Bytes requested by the blocks in use
+    uint32_t    reserved;           ///< Bytes of the blocks in use (with headers and rounding)
+    uint32_t    peak;               ///< Maximal value of used
+    uint32_t    blocks;             ///< Blocks in use
+    uint32_t    allocs;             ///< Allocations done
+    uint32_t    fallbacks;          ///< SRAM: Small requests done in SDRAM (SDRAM: 0)
+    uint32_t    failures;           ///< Requests for this pool that returned 0
+    uint32_t    free;               ///< SRAM: Bytes not yet assigned to a size (SDRAM: 0)
+} LVMem_Stats;
+
+void *LVMem_Alloc(size_t size);
+void  LVMem_Free(void *p);
+void *LVMem_Realloc(void *p, size_t size);
+void  LVMem_GetStats(int pool, LVMem_Stats *s);
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file    lvport.c
+ *
+ * @note    LVGL (v8.3) port: display driver and tick
+ *
+ * @note    LVGL renders the invalidated areas into two partial buffers. When one is
+ *          ready, flush submits a DMA2D job to copy it into the frame buffer of the
+ *          layer and returns, so LVGL can render into the other one meanwhile. The job
+ *          callback (in the DMA2D interrupt) calls lv_disp_flush_ready. When the layer
+ *          format is not RGB565, the DMA2D converts the pixels while copying them.
+ *
+ * @note    The render buffers can be in the cached part of the SRAM (SRAM1), so the
+ *          area is cleaned from the data cache before the DMA2D reads it. The frame
+ *          buffer is in SDRAM, that is not cached.
+ *
+ * @note    Drawing is done by the DMA2D draw context in lvdraw.c.
+ *
+ * @note    SysTick interrupts every 1 ms to advance the LVGL tick.
+ *
+ * @note    DMA2D_Init must be called before LVPort_Init.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f746xx.h"
+#include "system_stm32f746.h"
+#include "lvgl.h"
+#include "lcd.h"
+#include "dma2d.h"
+#include "dma2dref.h"
+#include "bench.h"
+#include "lvdraw.h"
+#include "lvport.h"
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "lvport needs LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 0"
+#endif
+
+/**
+ * @brief   Render buffers
+ *
+ * @note    Aligned to cache lines, so cleaning them does not touch other data
+ */
+static lv_color_t buffer1[LVPORT_HRES*LVPORT_BUFLINES] __attribute__((aligned(32)));
+static lv_color_t buffer2[LVPORT_HRES*LVPORT_BUFLINES] __attribute__((aligned(32)));
+
+/**
+ * @brief   LVGL display driver
+ */
+///@{
+static lv_disp_draw_buf_t   drawbuf;
+static lv_disp_drv_t        dispdrv;
+///@}
+
+/**
+ * @brief   Frame buffer of the layer
+ */
+///@{
+static void                *fbaddress;
+static int                  fbformat;
+static int                  fbpitch;
+///@}
+
+/**
+ * @brief   Statistics
+ */
+///@{
+static LVPort_Stats         stats;
+static uint32_t             statstick;
+static uint32_t             flushstart;
+static volatile uint32_t    flushcycles;                ///< Never cleared (LVPort_GetFlushCycles)
+///@}
+
+/**
+ * @brief   Clean an area from the data cache
+ *
+ * @note    SCB_CleanDCache_by_Addr works with whole cache lines (32 bytes). The start
+ *          is rounded down and the size rounded up, so the last line is not missed.
+ */
+static void cleandcache(const void *p, unsigned size) {
+uint32_t start = ((uint32_t) p)&~31U;
+uint32_t end   = ((uint32_t) p+size+31U)&~31U;
+
+    SCB_CleanDCache_by_Addr((uint32_t *) start,(int32_t) (end-start));
+}
+
+/**
+ * @brief   Called when the DMA2D finishes a flush
+ */
+static void flushdone(void *ctx, int status) {
+uint32_t cycles = Bench_GetCycles()-flushstart;
+
+    flushcycles     += cycles;
+    stats.flushtime += Bench_CyclesToMicroseconds(cycles);
+    lv_disp_flush_ready((lv_disp_drv_t *) ctx);
+}
+
+/**
+ * @brief   Flush callback
+ *
+ * @note    The area is w x h pixels, stored one line after the other in color_p
+ */
+static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+unsigned w = lv_area_get_width(area);
+unsigned h = lv_area_get_height(area);
+DECLARE_REGION(src,color_p,0,0,w,h,DMA2D_RGB565,w*sizeof(lv_color_t));
+DECLARE_REGION(dst,fbaddress,area->x1,area->y1,w,h,fbformat,fbpitch);
+unsigned fence;
+
+    cleandcache(color_p,w*h*sizeof(lv_color_t));
+
+    stats.flushes++;
+    flushstart = Bench_GetCycles();
+    if( fbformat == DMA2D_RGB565 )
+        fence = DMA2D_SubmitCopy(&dst,&src,flushdone,drv);
+    else
+        fence = DMA2D_SubmitConvert(&dst,&src,0,0,flushdone,drv);
+
+    if( fence == 0 ) {
+        /* Rejected (should not happen): do it with the CPU */
+        stats.cpuflushes++;
+        DMA2DRef_ConvertRegion(&dst,&src,0,0);
+        lv_disp_flush_ready(drv);
+    }
+}
+
+/**
+ * @brief   Called by LVGL after each screen refresh
+ *
+ * @note    time is in ms and px is the number of pixels rendered
+ */
+static void monitor(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+
+    stats.refreshes++;
+    stats.refreshtime += time;
+    stats.pixels      += px;
+}
+
+/**
+ * @brief   SysTick interrupt handler
+ *
+ * @note    Advances the LVGL tick
+ */
+void SysTick_Handler(void) {
+
+    lv_tick_inc(1);
+}
+
+/**
+ * @brief   LVPort_Init
+ *
+ * @note    Initializes LVGL and registers a display with the size of the layer
+ *          (that must already have a frame buffer). The layer format must be one of
+ *          ARGB8888, RGB888, RGB565, ARGB1555 or ARGB4444.
+ *
+ * @return  0 if OK, -1 if the layer cannot be used
+ */
+int
+LVPort_Init(int layer) {
+int w,h;
+
+    fbaddress = LCD_GetFrameBufferAddress(layer);
+    fbformat  = LCD_GetFormat(layer);
+    fbpitch   = LCD_GetPitch(layer);
+    w         = LCD_GetWidth(layer);
+    h         = LCD_GetHeight(layer);
+
+    if( (fbaddress == 0) || (fbformat > DMA2D_ARGB4444) || (w > LVPORT_HRES) )
+        return -1;
+
+    Bench_Init();
+    lv_init();
+
+    lv_disp_draw_buf_init(&drawbuf,buffer1,buffer2,LVPORT_HRES*LVPORT_BUFLINES);
+    lv_disp_drv_init(&dispdrv);
+    dispdrv.hor_res    = w;
+    dispdrv.ver_res    = h;
+    dispdrv.flush_cb   = flush;
+    dispdrv.monitor_cb = monitor;
+    dispdrv.draw_buf   = &drawbuf;
+    dispdrv.draw_ctx_init   = LVDraw_InitContext;
+    dispdrv.draw_ctx_deinit = LVDraw_DeinitContext;
+    dispdrv.draw_ctx_size   = sizeof(LVDraw_Context);
+    lv_disp_drv_register(&dispdrv);
+
+    SysTick_Config(SystemCoreClock/1000);
+    statstick = lv_tick_get();
+
+    return 0;
+}
+
+/**
+ * @brief   LVPort_GetStats
+ *
+ * @note    Copies the statistics collected since the last call and clears them.
+ *          Interrupts are disabled meanwhile, because flushdone updates them.
+ */
+void
+LVPort_GetStats(LVPort_Stats *s) {
+uint32_t primask;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *s = stats;
+    s->elapsed = lv_tick_elaps(statstick);
+    statstick = lv_tick_get();
+    memset(&stats,0,sizeof(stats));
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief   LVPort_GetFlushCycles
+ *
+ * @note    Sum of the flush times in cycles since LVPort_Init. It is not cleared, so
+ *          callers take the difference between two readings.
+ */
+uint32_t
+LVPort_GetFlushCycles(void) {
+
+    return flushcycles;
+}
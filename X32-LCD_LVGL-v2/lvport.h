@@ -0,0 +1,50 @@
+#ifndef LVPORT_H
+#define LVPORT_H
+/**
+ * @file    lvport.h
+ *
+ * @note    LVGL (v8.3) port: display driver flushing with the DMA2D and tick
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * @brief   Render buffers
+ *
+ * @note    LVGL renders into one of two buffers of LVPORT_BUFLINES lines of
+ *          LVPORT_HRES RGB565 pixels, while the other one is flushed by the DMA2D.
+ *          They are in .bss (internal SRAM). With the defaults, both take 60 KB.
+ */
+///@{
+#ifndef LVPORT_HRES
+#define LVPORT_HRES             LCD_DW
+#endif
+#ifndef LVPORT_BUFLINES
+#define LVPORT_BUFLINES         32
+#endif
+///@}
+
+/**
+ * @brief   Statistics
+ *
+ * @note    Refreshes and times are reported by LVGL after each screen refresh (render
+ *          and flush of all invalidated areas).
+ */
+typedef struct {
+    uint32_t    refreshes;          ///< Screen refreshes
+    uint32_t    refreshtime;        ///< Sum of the refresh times (ms)
+    uint32_t    pixels;             ///< Pixels rendered
+    uint32_t    flushes;            ///< Areas flushed
+    uint32_t    flushtime;          ///< Sum of the DMA2D flush times (us)
+    uint32_t    cpuflushes;         ///< Areas flushed by the CPU (DMA2D rejected them)
+    uint32_t    elapsed;            ///< Time since the last LVPort_GetStats (ms)
+} LVPort_Stats;
+
+int  LVPort_Init(int layer);
+void LVPort_GetStats(LVPort_Stats *s);
+uint32_t LVPort_GetFlushCycles(void);
+
+#endif
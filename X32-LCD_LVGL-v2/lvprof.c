@@ -0,0 +1,263 @@
+/**
+ * @file    lvprof.c
+ *
+ * @note    Frame time profiler for LVGL (v8.3)
+ *
+ * @note    The callback of the refresh timer of the display is replaced by refresh,
+ *          that measures the time taken by _lv_disp_refr_timer (the LVGL refresh). The
+ *          display driver gets a wait_cb, that measures how long LVGL waits for a
+ *          render buffer to be flushed, and its monitor_cb is chained to get the number
+ *          of pixels. Refreshes that render nothing are not frames and are not recorded.
+ *
+ * @note    The DMA2D busy time, the flush time and the LTDC underruns are counters that
+ *          are never cleared. Each frame gets the increments since the previous one.
+ *
+ * @note    The frames are kept in a ring of LVPROF_HISTORY entries. When it is full,
+ *          new frames are dropped (and counted) until the ring is read.
+ *
+ * @note    The overlay replaces LV_USE_PERF_MONITOR. It is a label on the system
+ *          layer, so it stays on top when screens are loaded. Updating it causes a
+ *          small refresh every LVPROF_OVERLAYPERIOD ms.
+ *
+ * @note    LVProf_Init must be called after LVPort_Init. lv_refr_now calls
+ *          _lv_disp_refr_timer directly and is not profiled.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "lvgl.h"
+#include "lcd.h"
+#include "dma2d.h"
+#include "bench.h"
+#include "lvport.h"
+#include "lvprof.h"
+
+/**
+ * @brief   Frame ring
+ */
+///@{
+static LVProf_Frame         history[LVPROF_HISTORY];
+static unsigned             head = 0;                   ///< Next to write
+static unsigned             count = 0;                  ///< Frames in the ring
+static uint32_t             dropped = 0;                ///< Not yet reported by LVProf_PrintCSV
+static int                  headerprinted = 0;
+///@}
+
+/**
+ * @brief   Current refresh
+ */
+///@{
+static uint32_t             waitcycles;                 ///< Spent in waitflush
+static uint32_t             pixels;                     ///< Reported by monitor
+///@}
+
+/**
+ * @brief   Counters at the end of the last frame
+ */
+///@{
+static uint32_t             frames = 0;
+static uint32_t             lastdma2d;
+static uint32_t             lastflush;
+static uint32_t             lastunderruns;
+///@}
+
+/**
+ * @brief   Overlay
+ */
+///@{
+static lv_obj_t            *label = 0;
+static uint32_t             overlaytick;
+static uint32_t             overlayframes;
+static uint32_t             overlaycycles;              ///< Sum of the refresh times
+///@}
+
+/**
+ * @brief   Previous monitor callback of the display driver (lvport.c)
+ */
+static void               (*prevmonitor)(lv_disp_drv_t *drv, uint32_t time, uint32_t px);
+
+/**
+ * @brief   Monitor callback
+ *
+ * @note    Called by LVGL at the end of a refresh that rendered px pixels
+ */
+static void monitor(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+
+    pixels += px;
+    if( prevmonitor )
+        prevmonitor(drv,time,px);
+}
+
+/**
+ * @brief   Wait callback
+ *
+ * @note    Called by LVGL while both render buffers are in use. It waits here until
+ *          the DMA2D finishes the flush, so the whole wait is measured at once.
+ */
+static void waitflush(lv_disp_drv_t *drv) {
+uint32_t t0 = Bench_GetCycles();
+
+    while( drv->draw_buf->flushing ) {}
+    waitcycles += Bench_GetCycles()-t0;
+}
+
+/**
+ * @brief   Store a frame in the ring
+ */
+static void record(uint32_t tick, uint32_t cycles) {
+LVProf_Frame *f;
+uint32_t dma2d, flush, underruns;
+
+    dma2d     = DMA2D_GetBusyCycles();
+    flush     = LVPort_GetFlushCycles();
+    underruns = LCD_GetUnderruns(0);
+
+    if( count < LVPROF_HISTORY ) {
+        f = &history[head];
+        f->frame     = frames;
+        f->tick      = tick;
+        f->refresh   = Bench_CyclesToMicroseconds(cycles);
+        f->flushwait = Bench_CyclesToMicroseconds(waitcycles);
+        f->render    = f->refresh-f->flushwait;
+        f->flush     = Bench_CyclesToMicroseconds(flush-lastflush);
+        f->dma2d     = Bench_CyclesToMicroseconds(dma2d-lastdma2d);
+        f->pixels    = pixels;
+        f->underruns = underruns-lastunderruns;
+        head = (head+1)%LVPROF_HISTORY;
+        count++;
+    } else {
+        dropped++;
+    }
+
+    frames++;
+    lastdma2d     = dma2d;
+    lastflush     = flush;
+    lastunderruns = underruns;
+}
+
+/**
+ * @brief   Refresh timer callback
+ *
+ * @note    Replaces _lv_disp_refr_timer, that is called from here
+ */
+static void refresh(lv_timer_t *t) {
+uint32_t tick, t0, cycles;
+
+    waitcycles = 0;
+    pixels     = 0;
+    tick       = lv_tick_get();
+    t0         = Bench_GetCycles();
+    _lv_disp_refr_timer(t);
+    cycles     = Bench_GetCycles()-t0;
+
+    if( pixels == 0 )
+        return;
+    overlayframes++;
+    overlaycycles += cycles;
+    record(tick,cycles);
+}
+
+/**
+ * @brief   Overlay timer callback
+ *
+ * @note    FPS and refresh time are averages since the last update. The CPU load is
+ *          the one measured by LVGL (100 - lv_timer_get_idle). Underruns are counted
+ *          since LCD_Init.
+ */
+static void updateoverlay(lv_timer_t *t) {
+uint32_t elapsed = lv_tick_elaps(overlaytick);
+
+    if( elapsed == 0 )
+        return;
+    lv_label_set_text_fmt(label,"%u FPS, %u%% CPU\n%u us refresh\n%u underruns",
+            (unsigned) (overlayframes*1000/elapsed),
+            (unsigned) (100-lv_timer_get_idle()),
+            (unsigned) (overlayframes ? Bench_CyclesToMicroseconds(overlaycycles/overlayframes) : 0),
+            (unsigned) LCD_GetUnderruns(0));
+    overlaytick   = lv_tick_get();
+    overlayframes = 0;
+    overlaycycles = 0;
+}
+
+/**
+ * @brief   LVProf_Init
+ *
+ * @note    Starts profiling the default display. When overlay is not zero, the
+ *          overlay is shown at the bottom right corner.
+ *
+ * @return  0 if OK, -1 if there is no display
+ */
+int
+LVProf_Init(int overlay) {
+lv_disp_t *disp = lv_disp_get_default();
+
+    if( !disp || !disp->refr_timer )
+        return -1;
+
+    lastdma2d     = DMA2D_GetBusyCycles();
+    lastflush     = LVPort_GetFlushCycles();
+    lastunderruns = LCD_GetUnderruns(0);
+
+    prevmonitor = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = monitor;
+    disp->driver->wait_cb    = waitflush;
+    lv_timer_set_cb(disp->refr_timer,refresh);
+
+    if( overlay && !label ) {
+        label = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_opa(label,LV_OPA_50,0);
+        lv_obj_set_style_bg_color(label,lv_color_black(),0);
+        lv_obj_set_style_text_color(label,lv_color_white(),0);
+        lv_obj_set_style_pad_all(label,4,0);
+        lv_obj_align(label,LV_ALIGN_BOTTOM_RIGHT,0,0);
+        lv_label_set_text(label,"");
+        overlaytick = lv_tick_get();
+        lv_timer_create(updateoverlay,LVPROF_OVERLAYPERIOD,0);
+    }
+    return 0;
+}
+
+/**
+ * @brief   LVProf_GetFrame
+ *
+ * @note    Removes the oldest frame from the ring
+ *
+ * @return  1 if a frame was copied into *f, 0 if there are none
+ */
+int
+LVProf_GetFrame(LVProf_Frame *f) {
+
+    if( count == 0 )
+        return 0;
+    *f = history[(head+LVPROF_HISTORY-count)%LVPROF_HISTORY];
+    count--;
+    return 1;
+}
+
+/**
+ * @brief   LVProf_PrintCSV
+ *
+ * @note    Prints the frames in the ring as CSV lines and empties it. The header is
+ *          printed the first time. Dropped frames are reported in a comment line.
+ */
+void
+LVProf_PrintCSV(void) {
+LVProf_Frame f;
+
+    if( !headerprinted ) {
+        printf("frame,tick_ms,refresh_us,render_us,flushwait_us,flush_us,dma2d_us,pixels,underruns\n");
+        headerprinted = 1;
+    }
+    while( LVProf_GetFrame(&f) ) {
+        printf("%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+                (unsigned) f.frame,(unsigned) f.tick,(unsigned) f.refresh,
+                (unsigned) f.render,(unsigned) f.flushwait,(unsigned) f.flush,
+                (unsigned) f.dma2d,(unsigned) f.pixels,(unsigned) f.underruns);
+    }
+    if( dropped ) {
+        printf("# %u frames dropped\n",(unsigned) dropped);
+        dropped = 0;
+    }
+}
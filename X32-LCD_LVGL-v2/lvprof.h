@@ -0,0 +1,50 @@
+#ifndef LVPROF_H
+#define LVPROF_H
+/**
+ * @file    lvprof.h
+ *
+ * @note    Frame time profiler for LVGL (v8.3): per frame timings measured with the
+ *          DWT cycle counter, an on-screen overlay and CSV output
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+
+/**
+ * @brief   Frames kept until they are read (LVProf_GetFrame or LVProf_PrintCSV)
+ */
+#ifndef LVPROF_HISTORY
+#define LVPROF_HISTORY          64
+#endif
+
+/**
+ * @brief   Period of the overlay update (ms)
+ */
+#ifndef LVPROF_OVERLAYPERIOD
+#define LVPROF_OVERLAYPERIOD    500
+#endif
+
+/**
+ * @brief   Timings of a frame (a refresh that rendered something)
+ *
+ * @note    Times are in us. The flush and DMA2D times are the increments since the
+ *          previous frame, so the last flush of a frame can be counted in the next one.
+ */
+typedef struct {
+    uint32_t    frame;              ///< Frame number
+    uint32_t    tick;               ///< LVGL tick at the start of the refresh (ms)
+    uint32_t    refresh;            ///< Refresh time (render + flushwait)
+    uint32_t    render;             ///< Rendering (CPU and DMA2D drawing)
+    uint32_t    flushwait;          ///< Waiting for a render buffer to be flushed
+    uint32_t    flush;              ///< DMA2D flush jobs (submission to completion)
+    uint32_t    dma2d;              ///< DMA2D busy (drawing and flushing)
+    uint32_t    pixels;             ///< Pixels rendered
+    uint32_t    underruns;          ///< LTDC FIFO underruns
+} LVProf_Frame;
+
+int  LVProf_Init(int overlay);
+int  LVProf_GetFrame(LVProf_Frame *f);
+void LVProf_PrintCSV(void);
+
+#endif
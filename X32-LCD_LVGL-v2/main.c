@@ -13,12 +13,23 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "stm32f746xx.h"
 #include "system_stm32f746.h"
 #include "led.h"
 #include "sdram.h"
 #include "buddy.h"
 #include "lcd.h"
+#include "dma2d.h"
+#include "dma2dref.h"
+#include "bench.h"
+#include "lvgl.h"
+#include "demos/lv_demos.h"
+#include "lvport.h"
+#include "lvdraw.h"
+#include "lvmem.h"
+#include "lvimage.h"
+#include "lvprof.h"
 
 
 
@@ -51,6 +62,7 @@ void ms_delay(volatile int ms) {
 int verbose = 1;
 
 #define DO_NOT_STOP
+#define LVGL_BENCHMARK
 
 /*
  * @brief   prints a message and waits for ENTER to continue
@@ -137,6 +149,462 @@ char *q;
 }
 
 
+/**
+ * @brief   DMA2D job queue demo
+ *
+ * @note    Fills layer 1 with bands using DMA2D jobs and counts how many loops the CPU
+ *          can do while they run
+ */
+static volatile int jobsdone = 0;
+
+static void jobdone(void *ctx, int status) {
+
+    if( status == DMA2D_DONE )
+        jobsdone++;
+}
+
+void dma2ddemo(void *fb, int format) {
+DECLARE_REGION(band,fb,0,0,LCD_GetWidth(1),LCD_GetHeight(1)/8,format,LCD_GetPitch(1));
+unsigned fence = 0;
+int count = 0;
+int i;
+
+    jobsdone = 0;
+    for(i=0;i<8;i++) {
+        band.y = i*band.h;
+        fence  = DMA2D_SubmitFill(&band,(i&1)?RGB(0,0,255):RGB(255,255,0),jobdone,0);
+    }
+    while( !DMA2D_IsDone(fence) )
+        count++;
+    printf("%d jobs done, %d loops while waiting\n",jobsdone,count);
+    LCD_ReloadLayerByVerticalBlanking(1);
+}
+
+
+/**
+ * @brief   DMA2D against CPU copy loops
+ *
+ * @note    Copies a RGB888 image and converts a L8 image (with a CLUT) into RGB888, both
+ *          in SDRAM. The DMA2D times include the wait for the end.
+ */
+#define BW    240
+#define BH    136
+
+void dma2dbench(void) {
+static uint32_t clut[256];
+uint8_t *src8 = Buddy_Alloc(BW*BH);
+uint8_t *src  = Buddy_Alloc(BW*BH*3);
+uint8_t *dst  = Buddy_Alloc(BW*BH*3);
+uint8_t *dst2 = Buddy_Alloc(BW*BH*3);
+DECLARE_REGION(rsrc8,src8,0,0,BW,BH,DMA2D_L8,BW);
+DECLARE_REGION(rsrc,src,0,0,BW,BH,DMA2D_RGB888,BW*3);
+DECLARE_REGION(rdst,dst,0,0,BW,BH,DMA2D_RGB888,BW*3);
+uint32_t t0,tcpu,tdma,c;
+uint8_t *q;
+int i,j;
+
+    if( !src8 || !src || !dst || !dst2 ) {
+        message("Not enough memory for benchmark");
+        return;
+    }
+    for(i=0;i<256;i++)
+        clut[i] = 0xFF000000|RGB(i,255-i,i/2);
+    for(i=0;i<BW*BH;i++)
+        src8[i] = i;
+    for(i=0;i<BW*BH*3;i++)
+        src[i] = i;
+
+    /* Copy */
+    t0 = Bench_GetCycles();
+    for(j=0;j<BH;j++)
+        memcpy(dst+j*BW*3,src+j*BW*3,BW*3);
+    tcpu = Bench_GetCycles()-t0;
+    t0 = Bench_GetCycles();
+    DMA2D_CopyRegion(&rdst,&rsrc);
+    DMA2D_WaitIdle();
+    tdma = Bench_GetCycles()-t0;
+    printf("Copy RGB888       CPU %6u us  DMA2D %6u us %s\n",
+            (unsigned) Bench_CyclesToMicroseconds(tcpu),
+            (unsigned) Bench_CyclesToMicroseconds(tdma),
+            memcmp(dst,src,BW*BH*3) ? "DIFFERENT" : "same");
+
+    /* Conversion from L8 */
+    t0 = Bench_GetCycles();
+    q  = dst2;
+    for(j=0;j<BH;j++) {
+        for(i=0;i<BW;i++) {
+            c    = clut[src8[j*BW+i]];
+            q[0] = c;
+            q[1] = c>>8;
+            q[2] = c>>16;
+            q   += 3;
+        }
+    }
+    tcpu = Bench_GetCycles()-t0;
+    t0 = Bench_GetCycles();
+    DMA2D_ConvertRegion(&rdst,&rsrc8,clut,256);
+    DMA2D_WaitIdle();
+    tdma = Bench_GetCycles()-t0;
+    printf("L8 to RGB888      CPU %6u us  DMA2D %6u us %s\n",
+            (unsigned) Bench_CyclesToMicroseconds(tcpu),
+            (unsigned) Bench_CyclesToMicroseconds(tdma),
+            memcmp(dst,dst2,BW*BH*3) ? "DIFFERENT" : "same");
+
+    Buddy_Free(dst2);
+    Buddy_Free(dst);
+    Buddy_Free(src);
+    Buddy_Free(src8);
+}
+
+
+/**
+ * @brief   Largest difference between two buffers
+ */
+static int maxdiff(const uint8_t *a, const uint8_t *b, int n) {
+int i,d,m = 0;
+
+    for(i=0;i<n;i++) {
+        d = a[i]-b[i];
+        if( d < 0 )
+            d = -d;
+        if( d > m )
+            m = d;
+    }
+    return m;
+}
+
+/**
+ * @brief   DMA2D blending against CPU loops
+ *
+ * @note    Blends a translucent ARGB8888 image and an A8 mask (anti-aliased text) with
+ *          a color over a RGB888 background. The CPU loops do the multiply per channel
+ *          per pixel. The DMA2D output is compared with the output of dma2dref.c.
+ */
+void dma2dblendbench(void) {
+uint8_t *fg   = Buddy_Alloc(BW*BH*4);
+uint8_t *mask = Buddy_Alloc(BW*BH);
+uint8_t *bg   = Buddy_Alloc(BW*BH*3);
+uint8_t *dst  = Buddy_Alloc(BW*BH*3);
+uint8_t *ref  = Buddy_Alloc(BW*BH*3);
+DECLARE_REGION(rfg,fg,0,0,BW,BH,DMA2D_ARGB8888,BW*4);
+DECLARE_REGION(rmask,mask,0,0,BW,BH,DMA2D_A8,BW);
+DECLARE_REGION(rbg,bg,0,0,BW,BH,DMA2D_RGB888,BW*3);
+DECLARE_REGION(rdst,dst,0,0,BW,BH,DMA2D_RGB888,BW*3);
+DECLARE_REGION(rref,ref,0,0,BW,BH,DMA2D_RGB888,BW*3);
+const unsigned color = RGB(255,200,0);
+uint32_t t0,tcpu,tdma;
+const uint8_t *s,*b;
+uint8_t *q;
+unsigned a,k;
+int i;
+
+    if( !fg || !mask || !bg || !dst || !ref ) {
+        message("Not enough memory for benchmark");
+        return;
+    }
+    for(i=0;i<BW*BH*4;i++)
+        fg[i] = i*7;
+    for(i=0;i<BW*BH;i++)
+        mask[i] = i;
+    for(i=0;i<BW*BH*3;i++)
+        bg[i] = i*3;
+
+    /* Translucent image */
+    t0 = Bench_GetCycles();
+    s  = fg;
+    b  = bg;
+    q  = dst;
+    for(i=0;i<BW*BH;i++) {
+        a = s[3];
+        for(k=0;k<3;k++)
+            q[k] = (s[k]*a+b[k]*(255-a))/255;
+        s += 4;
+        b += 3;
+        q += 3;
+    }
+    tcpu = Bench_GetCycles()-t0;
+    t0 = Bench_GetCycles();
+    DMA2D_BlendRegion(&rdst,&rfg,&rbg,0,255);
+    DMA2D_WaitIdle();
+    tdma = Bench_GetCycles()-t0;
+    DMA2DRef_BlendRegion(&rref,&rfg,&rbg,0,255);
+    printf("ARGB8888 blend    CPU %6u us  DMA2D %6u us  max diff %d\n",
+            (unsigned) Bench_CyclesToMicroseconds(tcpu),
+            (unsigned) Bench_CyclesToMicroseconds(tdma),
+            maxdiff(dst,ref,BW*BH*3));
+
+    /* Text mask */
+    t0 = Bench_GetCycles();
+    s  = mask;
+    b  = bg;
+    q  = dst;
+    for(i=0;i<BW*BH;i++) {
+        a = *s++;
+        for(k=0;k<3;k++)
+            q[k] = (((color>>(8*k))&0xFF)*a+b[k]*(255-a))/255;
+        b += 3;
+        q += 3;
+    }
+    tcpu = Bench_GetCycles()-t0;
+    t0 = Bench_GetCycles();
+    DMA2D_BlendRegion(&rdst,&rmask,&rbg,color,255);
+    DMA2D_WaitIdle();
+    tdma = Bench_GetCycles()-t0;
+    DMA2DRef_BlendRegion(&rref,&rmask,&rbg,color,255);
+    printf("A8 text blend     CPU %6u us  DMA2D %6u us  max diff %d\n",
+            (unsigned) Bench_CyclesToMicroseconds(tcpu),
+            (unsigned) Bench_CyclesToMicroseconds(tdma),
+            maxdiff(dst,ref,BW*BH*3));
+
+    Buddy_Free(ref);
+    Buddy_Free(dst);
+    Buddy_Free(bg);
+    Buddy_Free(mask);
+    Buddy_Free(fg);
+}
+
+/**
+ * @brief   Set when the LVGL benchmark ends
+ */
+static volatile int lvgldone;
+
+static void lvglfinished(void) {
+
+    lvgldone = 1;
+}
+
+/**
+ * @brief   Runs the LVGL benchmark demo once and prints a summary
+ *
+ * @note    The CPU load is the average of lv_timer_get_idle sampled every second. The
+ *          results of each scene are printed by the demo (LV_USE_LOG).
+ *
+ * @note    When csv is not zero, the frame timings of the profiler are printed as CSV
+ *          while it runs (this slows it down).
+ */
+static void lvglrun(const char *name, int csv) {
+LVPort_Stats s;
+LVDraw_Stats d;
+uint32_t last;
+unsigned idle = 0, samples = 0;
+
+    LVPort_GetStats(&s);
+    LVDraw_GetStats(&d);
+    lvgldone = 0;
+    lv_obj_clean(lv_scr_act());
+    lv_demo_benchmark();
+
+    last = lv_tick_get();
+    while( !lvgldone ) {
+        lv_timer_handler();
+        if( csv )
+            LVProf_PrintCSV();
+        if( lv_tick_elaps(last) >= 1000 ) {
+            last = lv_tick_get();
+            idle += lv_timer_get_idle();
+            samples++;
+        }
+    }
+
+    LVPort_GetStats(&s);
+    LVDraw_GetStats(&d);
+    if( s.refreshes == 0 || s.elapsed == 0 || samples == 0 )
+        return;
+    printf("LVGL %-5s %3u fps  CPU %3u%%  refresh %3u ms  DMA2D flush %5u us  (%u areas, %u by CPU)\n",
+            name,
+            (unsigned) (s.refreshes*1000/s.elapsed),
+            100-idle/samples,
+            (unsigned) (s.refreshtime/s.refreshes),
+            (unsigned) (s.flushtime/s.refreshes),
+            (unsigned) s.flushes,(unsigned) s.cpuflushes);
+    printf("           DMA2D draw: %u fills %u masked %u copies %u blends, %u Kpixels, %u by CPU\n",
+            (unsigned) d.fills,(unsigned) d.masked,(unsigned) d.copies,(unsigned) d.blends,
+            (unsigned) (d.pixels/1000),(unsigned) d.software);
+}
+
+/**
+ * @brief   Prints the memory used by LVGL in each pool
+ */
+static void printlvmem(const char *when) {
+static const char *names[] = { "SRAM", "SDRAM" };
+LVMem_Stats s;
+int i;
+
+    for(i=LVMEM_SRAM;i<=LVMEM_SDRAM;i++) {
+        LVMem_GetStats(i,&s);
+        printf("%-14s %-5s used %7u peak %7u reserved %7u blocks %4u allocs %6u "
+               "fallbacks %u failures %u\n",
+                when,names[i],(unsigned) s.used,(unsigned) s.peak,(unsigned) s.reserved,
+                (unsigned) s.blocks,(unsigned) s.allocs,(unsigned) s.fallbacks,
+                (unsigned) s.failures);
+    }
+}
+
+/**
+ * @brief   Test images for the screen switches
+ *
+ * @note    RLE (see lvimage.c) with runs of IMGRUN pixels
+ */
+///@{
+#define IMGW        160
+#define IMGH        100
+#define IMGRUN      16
+#define NIMAGES     4
+///@}
+
+static uint8_t *makeimage(unsigned seed, unsigned *size) {
+uint8_t *d = Buddy_Alloc(12+IMGH*(IMGW/IMGRUN)*3);
+uint8_t *p = d;
+unsigned i,j,c;
+
+    if( !d )
+        return 0;
+    memcpy(p,"RLE1",4);
+    p[4]  = IMGW&0xFF;
+    p[5]  = IMGW>>8;
+    p[6]  = IMGH&0xFF;
+    p[7]  = IMGH>>8;
+    p[8]  = LCD_FORMAT_RGB565;
+    p[9]  = p[10] = p[11] = 0;
+    p    += 12;
+    for(j=0;j<IMGH;j++) {
+        for(i=0;i<IMGW;i+=IMGRUN) {
+            c = (((seed*7+i/IMGRUN)&0x1F)<<11)|(((j*64/IMGH)&0x3F)<<5)|((seed*11+j/8)&0x1F);
+            *p++ = 0x80|(IMGRUN-1);
+            *p++ = c&0xFF;
+            *p++ = c>>8;
+        }
+    }
+    *size = p-d;
+    return d;
+}
+
+/**
+ * @brief   Creates a screen with images, a title and buttons
+ */
+static lv_obj_t *makescreen(const char *title, const lv_img_dsc_t *imgs) {
+lv_obj_t *scr = lv_obj_create(NULL);
+lv_obj_t *o, *l;
+int i;
+
+    o = lv_label_create(scr);
+    lv_label_set_text(o,title);
+    lv_obj_align(o,LV_ALIGN_TOP_MID,0,4);
+    for(i=0;i<NIMAGES;i++) {
+        o = lv_img_create(scr);
+        lv_img_set_src(o,&imgs[i]);
+        lv_obj_set_pos(o,10+(i%2)*(IMGW+10),30+(i/2)*(IMGH+10));
+    }
+    for(i=0;i<3;i++) {
+        o = lv_btn_create(scr);
+        lv_obj_set_pos(o,360,40+i*70);
+        l = lv_label_create(o);
+        lv_label_set_text_fmt(l,"Button %d",i+1);
+    }
+    return scr;
+}
+
+/**
+ * @brief   Loads a screen and returns the time (us) until it is on the frame buffer
+ */
+static unsigned switchto(lv_obj_t *scr) {
+uint32_t t0;
+
+    t0 = Bench_GetCycles();
+    lv_scr_load(scr);
+    lv_refr_now(NULL);
+    DMA2D_WaitIdle();
+    return Bench_CyclesToMicroseconds(Bench_GetCycles()-t0);
+}
+
+/**
+ * @brief   Measures the screen switch latency with cold and warm image caches
+ *
+ * @note    Cold: the image cache is emptied before the switch, so the images of the
+ *          new screen are decoded again. Warm: both screens were shown and their 8
+ *          images are in the cache (LV_IMG_CACHE_DEF_SIZE).
+ */
+static void lvglscreens(void) {
+static lv_img_dsc_t imgs[2][NIMAGES];
+uint8_t *data[2][NIMAGES];
+lv_obj_t *scr[2], *old;
+LVImage_Stats is;
+unsigned size, t;
+int i,k;
+
+    LVImage_Init();
+    for(k=0;k<2;k++) {
+        for(i=0;i<NIMAGES;i++) {
+            data[k][i] = makeimage(k*NIMAGES+i,&size);
+            if( !data[k][i] ) {
+                message("No memory for the test images");
+                return;
+            }
+            LVImage_InitDescriptor(&imgs[k][i],data[k][i],size);
+        }
+    }
+    old    = lv_scr_act();
+    scr[0] = makescreen("Screen A",imgs[0]);
+    scr[1] = makescreen("Screen B",imgs[1]);
+    printlvmem("Screens built");
+
+    /* A cold, B cold, A (to fill the cache again), B warm, A warm */
+    LVImage_GetStats(&is);
+    for(i=0;i<5;i++) {
+        k = i%2;
+        if( i < 2 )
+            lv_img_cache_invalidate_src(NULL);
+        t = switchto(scr[k]);
+        LVImage_GetStats(&is);
+        if( i == 2 )
+            continue;
+        printf("Switch to %c %s %6u us (%u images decoded in %u us)\n",
+                'A'+k,i < 2 ? "cold" : "warm",t,(unsigned) is.decodes,(unsigned) is.decodetime);
+    }
+    printlvmem("Screens shown");
+
+    lv_scr_load(old);
+    lv_obj_del(scr[0]);
+    lv_obj_del(scr[1]);
+    lv_img_cache_invalidate_src(NULL);
+    for(k=0;k<2;k++)
+        for(i=0;i<NIMAGES;i++)
+            Buddy_Free(data[k][i]);
+    printlvmem("Screens deleted");
+}
+
+/**
+ * @brief   Runs the LVGL tests on layer 1
+ *
+ * @note    First, the screen switch latency. Then the benchmark demo twice: drawing
+ *          with the DMA2D and with the CPU only. Both flush with the DMA2D. Finally,
+ *          with the DMA2D again, streaming the frame timings as CSV. It does not return.
+ *
+ * @note    The profiler overlay shows FPS, CPU load and LTDC underruns all the time.
+ */
+void lvglbenchmark(void) {
+
+    if( LVPort_Init(1) < 0 ) {
+        message("Cannot use layer 1 for LVGL");
+        return;
+    }
+    LVProf_Init(1);
+    lvglscreens();
+
+    lv_demo_benchmark_set_finished_cb(lvglfinished);
+    LVDraw_Enable(1);
+    lvglrun("DMA2D",0);
+    printlvmem("Benchmark");
+    LVDraw_Enable(0);
+    lvglrun("CPU",0);
+    LVDraw_Enable(1);
+    lvglrun("CSV",1);
+
+    for(;;)
+        lv_timer_handler();
+}
+
+
 /**
  * @brief   main
  *
@@ -181,7 +649,7 @@ int format = LCD_FORMAT_RGB888;
 
 
     message("Initializing buddy allocator");
-    Buddy_Init((char*) SDRAM_ADDRESS,SDRAM_SIZE,4096);
+    Buddy_Init((char*) SDRAM_ADDRESS,SDRAM_SIZE,LVMEM_SDRAMMINBLOCK);
 
     messagewithconfirm("Press ENTER to enable controller");
     LCD_EnableController();
@@ -240,6 +708,20 @@ int format = LCD_FORMAT_RGB888;
     LCD_DisableLayer(2);
     LCD_EnableLayer(1);
 
+    messagewithconfirm("Press ENTER to fill layer 1 with DMA2D jobs");
+    DMA2D_Init();
+    dma2ddemo(fbarea1,format);
+
+    messagewithconfirm("Press ENTER to compare DMA2D and CPU");
+    Bench_Init();
+    dma2dbench();
+    dma2dblendbench();
+
+#ifdef LVGL_BENCHMARK
+    messagewithconfirm("Press ENTER to run the LVGL benchmark");
+    lvglbenchmark();
+#endif
+
     /*
      * Show some screens
      */
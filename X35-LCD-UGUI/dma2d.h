@@ -0,0 +1,112 @@
+#ifndef DMA2D_H
+#define DMA2D_H
+/**
+ * @file    dma2d.h
+ *
+ * @date    11/04/2021
+ * @author  Hans
+ *
+ * @note    Operations are queued as jobs and run one after the other. The next job is
+ *          started by the transfer complete interrupt, so the CPU can do other work
+ *          meanwhile. Each job has a fence (sequence number) that can be waited for.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+    unsigned long   address;                ///< Address of 1st byte of 1st line
+    unsigned        x;                      ///< Horizontal position inside the englobing region
+    unsigned        y;                      ///< Vertical position inside the englobing region
+    unsigned        w;                      ///< Width of region
+    unsigned        h;                      ///< Height of region (Number of lines)
+    unsigned        pixelformat;            ///< Pixel format used in region
+    unsigned        linesize;               ///< Line size in bytes
+} DMA2DRegion;
+
+#define DECLARE_REGION(NAME,ADDR,X,Y,W,H,PF,LS)       \
+    DMA2DRegion NAME = { (unsigned long ) (ADDR),     \
+                         (unsigned)       (X),        \
+                         (unsigned)       (Y),        \
+                         (unsigned)       (W),        \
+                         (unsigned)       (H),        \
+                         (unsigned)       (PF),       \
+                         (unsigned)       (LS)        \
+                         }
+/**
+ * @brief   Pixel format recognized by the DMA2D
+ *
+ * @brief   Table 35 in section 9.3.4
+ *
+ * @brief   A is transparency (alpha value). 0xFF is opaque. 0 is transparent
+ *
+ * @brief   L is luminance (index to a LUT)
+ *
+ */
+#define DMA2D_ARGB8888                0
+#define DMA2D_RGB888                  1
+#define DMA2D_RGB565                  2
+#define DMA2D_ARGB1555                3
+#define DMA2D_ARGB4444                4
+#define DMA2D_L8                      5
+#define DMA2D_AL44                    6
+#define DMA2D_AL88                    7
+#define DMA2D_L4                      8
+#define DMA2D_A8                      9
+#define DMA2D_A4                     10
+
+/**
+ * @brief   Job queue size and interrupt priority
+ */
+///@{
+#ifndef DMA2D_QUEUESIZE
+#define DMA2D_QUEUESIZE              16
+#endif
+#ifndef DMA2D_INTLEVEL
+#define DMA2D_INTLEVEL                6
+#endif
+///@}
+
+/**
+ * @brief   Status passed to the job callback
+ */
+///@{
+#define DMA2D_DONE                    0
+#define DMA2D_ERROR                  -1
+#define DMA2D_ABORTED                -2
+///@}
+
+/**
+ * @brief   Function called when a job ends
+ *
+ * @note    It is called from the DMA2D interrupt (or from DMA2D_Abort). It can submit
+ *          new jobs, but they are not queued (fence 0) when the queue is full.
+ */
+typedef void (*DMA2D_Callback)(void *ctx, int status);
+
+int DMA2D_Init(void);
+int DMA2D_IsReady(void);
+int DMA2D_Abort(void);
+int DMA2D_Suspend(void);
+int DMA2D_Resume(void);
+int DMA2D_FillRegion(const DMA2DRegion *r, unsigned c);
+int DMA2D_CopyRegion(const DMA2DRegion *dst, const DMA2DRegion *src);
+int DMA2D_ConvertRegion(const DMA2DRegion *dst, const DMA2DRegion *src,
+                        const uint32_t *clut, unsigned n);
+int DMA2D_BlendRegion(const DMA2DRegion *dst, const DMA2DRegion *fg, const DMA2DRegion *bg,
+                      unsigned color, unsigned alpha);
+
+unsigned DMA2D_SubmitFill(const DMA2DRegion *r, unsigned c, DMA2D_Callback cb, void *ctx);
+unsigned DMA2D_SubmitCopy(const DMA2DRegion *dst, const DMA2DRegion *src,
+                          DMA2D_Callback cb, void *ctx);
+unsigned DMA2D_SubmitConvert(const DMA2DRegion *dst, const DMA2DRegion *src,
+                             const uint32_t *clut, unsigned n, DMA2D_Callback cb, void *ctx);
+unsigned DMA2D_SubmitBlend(const DMA2DRegion *dst, const DMA2DRegion *fg,
+                           const DMA2DRegion *bg, unsigned color, unsigned alpha,
+                           DMA2D_Callback cb, void *ctx);
+unsigned DMA2D_GetFence(void);
+int DMA2D_IsDone(unsigned fence);
+int DMA2D_Wait(unsigned fence);
+int DMA2D_WaitIdle(void);
+
+
+#endif
@@ -1489,16 +1489,67 @@ uint8_t c1,c2,c3,c4;
     }
 }
 
+/*
+ * @brief   LCD_FillBox
+ *
+ * @note    Fill the box with upper left corner at (x,y) and size sizew x sizeh with
+ *          color (in the layer format). It is clipped to the layer.
+ */
+void
+LCD_FillBox(int layer, int x, int y, int sizew, int sizeh, unsigned color) {
+int  ps,w,h,i;
+char *q;
+
+    ps     = LCD_GetPixelSize(layer);
+    w      = LCD_GetWidth(layer);
+    h      = LCD_GetHeight(layer);
+
+    if( x < 0 ) {
+        sizew += x;
+        x = 0;
+    }
+    if( y < 0 ) {
+        sizeh += y;
+        y = 0;
+    }
+    if( (x+sizew) > w )
+        sizew = w-x;
+    if( (y+sizeh) > h )
+        sizeh = h-y;
+
+    if( sizew <= 0 || sizeh <= 0 )
+        return;
+
+    for(i=0;i<sizeh;i++) {
+        q = LCD_GetLineAddress(layer,y+i);
+        q += ps*x;
+        switch(ps) {
+        case 1:
+            fill1(q,sizew*ps,color);
+            break;
+        case 2:
+            fill2(q,sizew*ps,color);
+            break;
+        case 3:
+            fill3(q,sizew*ps,color);
+            break;
+        case 4:
+            fill4(q,sizew*ps,color);
+            break;
+        }
+    }
+}
+
 /*
  * @brief Mark point
  */
 static void plot(char *p, int ps, unsigned color ) {
 
     switch(ps) {
-    case 4: *p++ = (color>>24)&0xFF;
-    case 3: *p++ = (color>>16)&0xFF;
-    case 2: *p++ = (color>>8)&0xFF;
-    case 1: *p++ = color&0xFF;
+    case 4: p[3] = (color>>24)&0xFF;
+    case 3: p[2] = (color>>16)&0xFF;
+    case 2: p[1] = (color>>8)&0xFF;
+    case 1: p[0] = color&0xFF;
     }
 }
 /*
@@ -20,13 +20,31 @@
 #define RGB(R,G,B)     ( (((uint32_t) (R))<<16)         \
                         |(((uint32_t) (G))<<8)          \
                         |(((uint32_t) (B))<<0) )
-#define RGB565(R,G,B)  ( (((uint16_t)((R)&0x1F))<<8)    \
-                        |(((uint16_t)((G)&0x3F))<<3)    \
-                        |(((uint16_t)((B)&0x1F))>>3) )
-#define RGB555(R,G,B)  ( (((uint16_t)((R)&0x1F))<<7)    \
-                        |(((uint16_t)((G)&0x1F))<<3)    \
-                        |(((uint16_t)((B)&0x1F))>>3) )
-#define RGBA(R,G,B)    ( (((uint32_t) (A))<<24)         \
+
+/**
+ * @brief   Create a color in the 16-bit formats
+ *
+ * @note    R, G and B are 8-bit values (0-255). Low order bits are discarded
+ */
+///@{
+#define RGB565(R,G,B)  ( (((uint16_t)((R)&0xF8))<<8)    \
+                        |(((uint16_t)((G)&0xFC))<<3)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+#define RGB555(R,G,B)  ( (((uint16_t)((R)&0xF8))<<7)    \
+                        |(((uint16_t)((G)&0xF8))<<2)    \
+                        |(((uint16_t)((B)&0xF8))>>3) )
+#define ARGB1555(A,R,G,B) ( (((uint16_t)((A)&0x80))<<8) \
+                        |RGB555(R,G,B) )
+#define ARGB4444(A,R,G,B) ( (((uint16_t)((A)&0xF0))<<8) \
+                        |(((uint16_t)((R)&0xF0))<<4)    \
+                        |(((uint16_t)((G)&0xF0))<<0)    \
+                        |(((uint16_t)((B)&0xF0))>>4) )
+///@}
+
+/**
+ * @brief   Create a ARGB8888 color
+ */
+#define RGBA(R,G,B,A)  ( (((uint32_t) (A))<<24)         \
                         |(((uint32_t) (R))<<16)         \
                         |(((uint32_t) (G))<<8)          \
                         |(((uint32_t) (B))<<0) )
@@ -106,6 +124,7 @@ int   LCD_GetMinimalFullFrameBufferSize(int format);
 void LCD_DrawHorizontalLine(int layer, int x, int y, int size, unsigned color);
 void LCD_DrawVerticalLine(int layer, int x, int y, int size, unsigned color);
 void LCD_DrawBox(int layer, int x, int y, int sw, int sh, unsigned color, unsigned bordercolor);
+void LCD_FillBox(int layer, int x, int y, int sw, int sh, unsigned color);
 void LCD_DrawLine(int layer, int x, int y, int sw, int sh, unsigned color);
 #endif
 
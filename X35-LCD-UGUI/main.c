@@ -19,6 +19,9 @@
 #include "sdram.h"
 #include "buddy.h"
 #include "lcd.h"
+#include "bench.h"
+#include "ugui.h"
+#include "uguiport.h"
 
 
 
@@ -137,6 +140,179 @@ char *q;
 }
 
 
+
+/**
+ * @brief   UGUI benchmark
+ *
+ * @note    Draws typical screens with UGUI, first with pset only and then with the
+ *          accelerators, and prints the time per screen and how it was drawn
+ */
+#define UGUI_BENCHMARK
+
+#ifdef UGUI_BENCHMARK
+
+#define UGUI_RUNS       5
+
+static UG_GUI       gui;
+static UG_WINDOW    window;
+static UG_OBJECT    objects[6];
+static UG_BUTTON    buttons[4];
+static UG_TEXTBOX   textbox;
+
+static void windowcallback(UG_MESSAGE *msg) {
+}
+
+/*
+ * @brief   Panels with bars and labels
+ */
+static void dashboard(void) {
+int i,j,x,y;
+char s[20];
+
+    UG_FillScreen(RGB(0,0,0));
+    UG_FontSelect(&FONT_8X12);
+    UG_SetBackcolor(RGB(32,32,64));
+    UG_SetForecolor(RGB(255,255,255));
+    for(i=0;i<3;i++) {
+        for(j=0;j<2;j++) {
+            x = 8+i*157;
+            y = 8+j*132;
+            UG_FillFrame(x,y,x+148,y+124,RGB(32,32,64));
+            UG_DrawFrame(x,y,x+148,y+124,RGB(128,128,255));
+            sprintf(s,"Channel %d",i*2+j);
+            UG_PutString(x+6,y+6,s);
+            UG_FillFrame(x+10,y+100-10*(i+j),x+40,y+110,RGB(0,200,0));
+            UG_FillFrame(x+50,y+60,x+80,y+110,RGB(200,200,0));
+            UG_FillFrame(x+90,y+30+15*j,x+120,y+110,RGB(200,0,0));
+        }
+    }
+}
+
+/*
+ * @brief   Page of text
+ */
+static void textpage(void) {
+int i;
+
+    UG_FillScreen(RGB(255,255,255));
+    UG_FontSelect(&FONT_8X12);
+    UG_SetBackcolor(RGB(255,255,255));
+    UG_SetForecolor(RGB(0,0,0));
+    for(i=0;i<20;i++)
+        UG_PutString(4,4+i*13,"The quick brown fox jumps over the lazy dog 0123456789");
+}
+
+/*
+ * @brief   Chart with grid, curve and markers
+ */
+static void chart(void) {
+int i,x,y,yprev;
+
+    UG_FillScreen(RGB(0,0,32));
+    for(x=20;x<LCD_DW;x+=40)
+        UG_DrawLine(x,10,x,LCD_DH-11,RGB(64,64,64));
+    for(y=10;y<LCD_DH;y+=32)
+        UG_DrawLine(20,y,LCD_DW-21,y,RGB(64,64,64));
+    yprev = LCD_DH/2;
+    for(i=1;i<110;i++) {
+        y = LCD_DH/2+((i*37)%120)-60;
+        UG_DrawLine(20+(i-1)*4,yprev,20+i*4,y,RGB(0,255,0));
+        if( (i%10) == 0 )
+            UG_DrawCircle(20+i*4,y,4,RGB(255,255,0));
+        yprev = y;
+    }
+}
+
+/*
+ * @brief   Window with buttons and a text box
+ */
+static void windowscreen(void) {
+static int created = 0;
+
+    if( !created ) {
+        UG_WindowCreate(&window,objects,6,windowcallback);
+        UG_WindowSetTitleText(&window,"UGUI Benchmark");
+        UG_WindowSetTitleTextFont(&window,&FONT_12X20);
+        UG_ButtonCreate(&window,&buttons[0],BTN_ID_0,10,10,110,60);
+        UG_ButtonCreate(&window,&buttons[1],BTN_ID_1,120,10,220,60);
+        UG_ButtonCreate(&window,&buttons[2],BTN_ID_2,230,10,330,60);
+        UG_ButtonCreate(&window,&buttons[3],BTN_ID_3,340,10,440,60);
+        UG_ButtonSetFont(&window,BTN_ID_0,&FONT_12X20);
+        UG_ButtonSetFont(&window,BTN_ID_1,&FONT_12X20);
+        UG_ButtonSetFont(&window,BTN_ID_2,&FONT_12X20);
+        UG_ButtonSetFont(&window,BTN_ID_3,&FONT_12X20);
+        UG_ButtonSetText(&window,BTN_ID_0,"Start");
+        UG_ButtonSetText(&window,BTN_ID_1,"Stop");
+        UG_ButtonSetText(&window,BTN_ID_2,"Reset");
+        UG_ButtonSetText(&window,BTN_ID_3,"Setup");
+        UG_TextboxCreate(&window,&textbox,TXB_ID_0,10,70,440,200);
+        UG_TextboxSetFont(&window,TXB_ID_0,&FONT_12X20);
+        UG_TextboxSetText(&window,TXB_ID_0,"Accelerated drawing\nwith DMA2D fills");
+        UG_WindowShow(&window);
+        created = 1;
+    }
+    // Setting a window property forces the redraw of the window and all its objects
+    UG_WindowSetBackColor(&window,RGB(240,240,240));
+    UG_Update();
+}
+
+static const struct {
+    char   *name;
+    void  (*draw)(void);
+} screens[] = {
+    { "Dashboard",  dashboard       },
+    { "Text",       textpage        },
+    { "Chart",      chart           },
+    { "Window",     windowscreen    },
+    { 0,            0               }
+};
+
+/*
+ * @brief   Draws a screen UGUI_RUNS times and returns the mean time (us)
+ */
+static uint32_t uguirun(void (*draw)(void)) {
+uint32_t t0,total = 0;
+int i;
+
+    for(i=0;i<UGUI_RUNS;i++) {
+        t0 = Bench_GetCycles();
+        draw();
+        UGUIPort_Sync();
+        total += Bench_GetCycles()-t0;
+    }
+    return Bench_CyclesToMicroseconds(total/UGUI_RUNS);
+}
+
+void uguibenchmark(int layer) {
+UGUIPort_Stats st;
+uint32_t tsw,thw,swpsets;
+int i;
+
+    Bench_Init();
+    if( UGUIPort_Init(&gui,layer) < 0 ) {
+        message("Layer format not supported by UGUI port");
+        return;
+    }
+    printf("%-10s %10s %8s %10s %8s %6s %6s %6s %6s %8s\n","Screen","pset(us)","psets",
+           "accel(us)","psets","fills","dma2d","lines","areas","areapix");
+    for(i=0;screens[i].name;i++) {
+        UGUIPort_Accelerate(0);
+        tsw = uguirun(screens[i].draw);
+        UGUIPort_GetStats(&st);
+        swpsets = st.psets;
+        UGUIPort_Accelerate(1);
+        thw = uguirun(screens[i].draw);
+        UGUIPort_GetStats(&st);
+        printf("%-10s %10u %8u %10u %8u %6u %6u %6u %6u %8u\n",screens[i].name,
+               (unsigned) tsw,(unsigned) swpsets/UGUI_RUNS,(unsigned) thw,
+               (unsigned) st.psets/UGUI_RUNS,(unsigned) st.fills/UGUI_RUNS,
+               (unsigned) st.dma2dfills/UGUI_RUNS,(unsigned) st.lines/UGUI_RUNS,
+               (unsigned) st.areas/UGUI_RUNS,(unsigned) st.areapixels/UGUI_RUNS);
+        messagewithconfirm("Press ENTER to continue");
+    }
+}
+#endif
+
 /**
  * @brief   main
  *
@@ -240,6 +416,11 @@ int format = LCD_FORMAT_RGB888;
     LCD_DisableLayer(2);
     LCD_EnableLayer(1);
 
+#ifdef UGUI_BENCHMARK
+    messagewithconfirm("Press ENTER to run the UGUI benchmark");
+    uguibenchmark(1);
+#endif
+
     /*
      * Show some screens
      */
@@ -0,0 +1,318 @@
+/**
+ * @file    uguiport.c
+ *
+ * @note    UGUI port: pixel set and drawing accelerators for a LCD layer
+ *
+ * @note    Without accelerators, UGUI draws everything with the pixel set function.
+ *          The port registers three drivers:
+ *
+ *          Driver              | Used by                 | Implementation
+ *          --------------------|-------------------------|---------------------------
+ *          DRIVER_FILL_FRAME   | UG_FillFrame/FillScreen | DMA2D_FillRegion or LCD_FillBox
+ *          DRIVER_DRAW_LINE    | UG_DrawLine, frames     | LCD_DrawLine and h/v lines
+ *          DRIVER_FILL_AREA    | characters              | sequential push into the area
+ *
+ * @note    The fills by the DMA2D are not waited for. Any drawing by the CPU waits
+ *          first for them to end, so the order of the operations is kept. The frame
+ *          buffer is in SDRAM, that is not cached, so no cache maintenance is needed.
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+#include "dma2d.h"
+#include "ugui.h"
+#include "uguiport.h"
+
+/**
+ * @brief   Layer info
+ *
+ * @note    Read once from the LTDC registers, that are slow to access
+ */
+///@{
+static int          layer;
+static uint8_t     *base;
+static int          pitch;
+static int          format;
+static int          ps;
+static int          width,height;
+///@}
+
+/**
+ * @brief   DMA2D fills not yet waited for
+ */
+static int          pending = 0;
+
+/**
+ * @brief   Area being written by the push functions
+ */
+static struct {
+    int         x1,x2;              ///< Columns of the area
+    int         x,y;                ///< Next pixel
+    uint8_t    *line;               ///< Start of the current line
+    uint8_t    *p;                  ///< Next pixel
+} area;
+
+/**
+ * @brief   Last color converted (glyphs use only two)
+ */
+///@{
+static UG_COLOR     lastcolor = 0xFFFFFFFF;       // Not a RGB888 color
+static uint32_t     lastvalue = 0;
+///@}
+
+/**
+ * @brief   Statistics
+ */
+static UGUIPort_Stats stats;
+
+/**
+ * @brief   Convert an UGUI color (RGB888) to the layer format
+ */
+static uint32_t convert(UG_COLOR c) {
+
+    if( c == lastcolor )
+        return lastvalue;
+    lastcolor = c;
+    switch(format) {
+    case LCD_FORMAT_ARGB8888:
+        lastvalue = 0xFF000000|c;
+        break;
+    case LCD_FORMAT_RGB565:
+        lastvalue = RGB565(c>>16,c>>8,c);
+        break;
+    default:
+        lastvalue = c&0xFFFFFF;
+        break;
+    }
+    return lastvalue;
+}
+
+/**
+ * @brief   Write a pixel value
+ */
+static inline void putpixel(uint8_t *p, uint32_t v) {
+
+    switch(ps) {
+    case 2:
+        *(uint16_t *) p = v;
+        break;
+    case 3:
+        p[0] = v;
+        p[1] = v>>8;
+        p[2] = v>>16;
+        break;
+    case 4:
+        *(uint32_t *) p = v;
+        break;
+    }
+}
+
+/**
+ * @brief   Wait for the DMA2D fills before drawing with the CPU
+ */
+static inline void sync(void) {
+
+    if( pending ) {
+        DMA2D_WaitIdle();
+        pending = 0;
+    }
+}
+
+/**
+ * @brief   Pixel set function
+ */
+static void pset(UG_S16 x, UG_S16 y, UG_COLOR c) {
+
+    if( x < 0 || x >= width || y < 0 || y >= height )
+        return;
+    sync();
+    putpixel(base+y*pitch+x*ps,convert(c));
+    stats.psets++;
+}
+
+/**
+ * @brief   Fill frame accelerator
+ *
+ * @note    Large frames are queued in the DMA2D, small ones are filled by the CPU
+ */
+static UG_RESULT fillframe(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c) {
+UG_S16 t;
+int w,h;
+
+    if( x2 < x1 ) { t = x1; x1 = x2; x2 = t; }
+    if( y2 < y1 ) { t = y1; y1 = y2; y2 = t; }
+    if( x1 < 0 ) x1 = 0;
+    if( y1 < 0 ) y1 = 0;
+    if( x2 >= width )  x2 = width-1;
+    if( y2 >= height ) y2 = height-1;
+    if( x2 < x1 || y2 < y1 )
+        return UG_RESULT_OK;
+
+    w = x2-x1+1;
+    h = y2-y1+1;
+    if( w*h >= UGUIPORT_DMA2DMINPIXELS ) {
+        DECLARE_REGION(r,base,x1,y1,w,h,format,pitch);
+        if( DMA2D_FillRegion(&r,convert(c)) == 0 ) {
+            pending = 1;
+            stats.dma2dfills++;
+            return UG_RESULT_OK;
+        }
+    }
+    sync();
+    LCD_FillBox(layer,x1,y1,w,h,convert(c));
+    stats.fills++;
+    return UG_RESULT_OK;
+}
+
+/**
+ * @brief   Draw line accelerator
+ *
+ * @note    Lines not inside the layer are left to UGUI (it draws them with pset,
+ *          that clips)
+ */
+static UG_RESULT drawline(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c) {
+
+    if( x1 < 0 || x1 >= width || x2 < 0 || x2 >= width
+     || y1 < 0 || y1 >= height || y2 < 0 || y2 >= height )
+        return UG_RESULT_FAIL;
+
+    sync();
+    if( y1 == y2 ) {
+        LCD_DrawHorizontalLine(layer,x1<x2?x1:x2,y1,(x1<x2?x2-x1:x1-x2)+1,convert(c));
+    } else if( x1 == x2 ) {
+        LCD_DrawVerticalLine(layer,x1,y1<y2?y1:y2,(y1<y2?y2-y1:y1-y2)+1,convert(c));
+    } else {
+        LCD_DrawLine(layer,x1,y1,x2-x1,y2-y1,convert(c));
+    }
+    stats.lines++;
+    return UG_RESULT_OK;
+}
+
+/**
+ * @brief   Push a pixel into the area (left to right, top to bottom)
+ */
+static void push(UG_COLOR c) {
+
+    putpixel(area.p,convert(c));
+    area.p += ps;
+    if( ++area.x > area.x2 ) {
+        area.x     = area.x1;
+        area.line += pitch;
+        area.p     = area.line;
+    }
+}
+
+/**
+ * @brief   Push a pixel into an area that is partially outside the layer
+ */
+static void pushclipped(UG_COLOR c) {
+
+    if( area.x >= 0 && area.x < width && area.y >= 0 && area.y < height )
+        putpixel(base+area.y*pitch+area.x*ps,convert(c));
+    if( ++area.x > area.x2 ) {
+        area.x = area.x1;
+        area.y++;
+    }
+}
+
+/**
+ * @brief   Fill area accelerator
+ *
+ * @note    UGUI calls the returned function once for each pixel of the area. The
+ *          address is not calculated again for every pixel, as with pset.
+ *
+ * @return  push function
+ */
+static void *fillarea(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2) {
+
+    sync();
+    area.x1   = x1;
+    area.x2   = x2;
+    area.x    = x1;
+    area.y    = y1;
+    stats.areas++;
+    stats.areapixels += (x2-x1+1)*(y2-y1+1);
+    if( x1 < 0 || x2 >= width || y1 < 0 || y2 >= height )
+        return (void *) pushclipped;
+
+    area.line = base+y1*pitch+x1*ps;
+    area.p    = area.line;
+    return (void *) push;
+}
+
+/**
+ * @brief   UGUIPort_Init
+ *
+ * @note    Initializes UGUI for the layer and registers the accelerators (enabled)
+ *
+ * @return  0 if OK, -1 if the layer format is not supported
+ */
+int
+UGUIPort_Init(UG_GUI *gui, int l) {
+
+    layer  = l;
+    format = LCD_GetFormat(layer);
+    if( format != LCD_FORMAT_ARGB8888 && format != LCD_FORMAT_RGB888
+     && format != LCD_FORMAT_RGB565 )
+        return -1;
+    base   = (uint8_t *) LCD_GetFrameBufferAddress(layer);
+    pitch  = LCD_GetPitch(layer);
+    ps     = LCD_GetPixelSize(layer);
+    width  = LCD_GetWidth(layer);
+    height = LCD_GetHeight(layer);
+    lastcolor = 0xFFFFFFFF;
+
+    DMA2D_Init();
+
+    UG_Init(gui,pset,width,height);
+    UG_DriverRegister(DRIVER_FILL_FRAME,(void *) fillframe);
+    UG_DriverRegister(DRIVER_DRAW_LINE,(void *) drawline);
+    UG_DriverRegister(DRIVER_FILL_AREA,(void *) fillarea);
+    return 0;
+}
+
+/**
+ * @brief   UGUIPort_Accelerate
+ *
+ * @note    Enables (on != 0) or disables the accelerators. When disabled, UGUI draws
+ *          everything with pset.
+ */
+void
+UGUIPort_Accelerate(int on) {
+
+    if( on ) {
+        UG_DriverEnable(DRIVER_FILL_FRAME);
+        UG_DriverEnable(DRIVER_DRAW_LINE);
+        UG_DriverEnable(DRIVER_FILL_AREA);
+    } else {
+        UG_DriverDisable(DRIVER_FILL_FRAME);
+        UG_DriverDisable(DRIVER_DRAW_LINE);
+        UG_DriverDisable(DRIVER_FILL_AREA);
+    }
+}
+
+/**
+ * @brief   UGUIPort_Sync
+ *
+ * @note    Waits for the DMA2D fills. Call it before showing the frame buffer.
+ */
+void
+UGUIPort_Sync(void) {
+
+    sync();
+}
+
+/**
+ * @brief   UGUIPort_GetStats
+ *
+ * @note    Copies the statistics collected since the last call and clears them
+ */
+void
+UGUIPort_GetStats(UGUIPort_Stats *s) {
+
+    *s = stats;
+    memset(&stats,0,sizeof(stats));
+}
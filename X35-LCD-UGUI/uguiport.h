@@ -0,0 +1,45 @@
+#ifndef UGUIPORT_H
+#define UGUIPORT_H
+/**
+ * @file    uguiport.h
+ *
+ * @note    UGUI port: pixel set and drawing accelerators for a LCD layer
+ *
+ * @note    The layer must be configured (LCD_SetFrameBuffer) before UGUIPort_Init and
+ *          use the ARGB8888, RGB888 or RGB565 format. UGUI must be configured for
+ *          RGB888 colors (USE_COLOR_RGB888 in ugui_config.h).
+ *
+ * @author  Hans
+ */
+
+#include <stdint.h>
+#include "ugui.h"
+
+/**
+ * @brief   Smallest frame filled by the DMA2D
+ *
+ * @note    For smaller frames, programming the DMA2D costs more than the fill itself
+ *          and the CPU does it.
+ */
+#ifndef UGUIPORT_DMA2DMINPIXELS
+#define UGUIPORT_DMA2DMINPIXELS     256
+#endif
+
+/**
+ * @brief   Statistics
+ */
+typedef struct {
+    uint32_t    psets;              ///< Pixels set one by one
+    uint32_t    fills;              ///< Frames filled by the CPU
+    uint32_t    dma2dfills;         ///< Frames filled by the DMA2D
+    uint32_t    lines;              ///< Lines drawn by the line engine
+    uint32_t    areas;              ///< Areas (glyphs) written with the push function
+    uint32_t    areapixels;         ///< Pixels in the areas
+} UGUIPort_Stats;
+
+int  UGUIPort_Init(UG_GUI *gui, int layer);
+void UGUIPort_Accelerate(int on);
+void UGUIPort_Sync(void);
+void UGUIPort_GetStats(UGUIPort_Stats *s);
+
+#endif